@@ -0,0 +1,102 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Benchmarks\ConcurrentEventBenchmarks.cpp
+//! \brief Benchmarks for raising and subscribing ConcurrentEvent under contention
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/windows/ConcurrentEvent.hpp>    //!< ConcurrentEvent
+#include <wtl/windows/event.hpp>              //!< Event
+#include <benchmark/benchmark.h>
+#include <mutex>
+
+using namespace wtl;
+
+namespace
+{
+  //! Event subscriber  (Touches no shared state, so only the event itself is contended)
+  struct Counter
+  {
+    void  onEvent(int value)    { benchmark::DoNotOptimize(value); }
+  };
+
+  //! Shared fixture state
+  EpochDomain                 domain;
+  ConcurrentEvent<void,int>*  concurrent = nullptr;
+  Event<void,int>*            locked = nullptr;
+  std::mutex                  lock;
+  Counter                     counter;
+
+  //! Subscribe 'n' delegates to an event
+  template <typename EVENT>
+  void  subscribe(EVENT& ev, int64_t n)
+  {
+    for (int64_t i = 0; i < n; ++i)
+      ev += new Delegate<void,int>(&counter, &Counter::onEvent);
+  }
+}
+
+//! Raise a ConcurrentEvent with 'subscribers' subscribers from 'n' threads
+static void BM_ConcurrentEvent_Raise(benchmark::State& state)
+{
+  if (state.thread_index() == 0)
+  {
+    concurrent = new ConcurrentEvent<void,int>(domain);
+    subscribe(*concurrent, state.range(0));
+  }
+
+  for (auto _ : state)
+    concurrent->raise(1);
+
+  if (state.thread_index() == 0)
+    delete concurrent;
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConcurrentEvent_Raise)->ArgName("subscribers")->ArgsProduct({{1, 8, 64}})->ThreadRange(1, 8)->UseRealTime();
+
+//! Raise an Event with 'subscribers' subscribers, serialized by a mutex, from 'n' threads  (Baseline)
+static void BM_LockedEvent_Raise(benchmark::State& state)
+{
+  if (state.thread_index() == 0)
+  {
+    locked = new Event<void,int>();
+    subscribe(*locked, state.range(0));
+  }
+
+  for (auto _ : state)
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    locked->raise(1);
+  }
+
+  if (state.thread_index() == 0)
+    delete locked;
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LockedEvent_Raise)->ArgName("subscribers")->ArgsProduct({{1, 8, 64}})->ThreadRange(1, 8)->UseRealTime();
+
+//! Thread 0 subscribes and unsubscribes, beside 'subscribers' existing subscribers, while the remaining threads raise
+static void BM_ConcurrentEvent_SubscribeUnderRaise(benchmark::State& state)
+{
+  if (state.thread_index() == 0)
+  {
+    concurrent = new ConcurrentEvent<void,int>(domain);
+    subscribe(*concurrent, state.range(0));
+  }
+
+  if (state.thread_index() == 0)
+    for (auto _ : state)
+      *concurrent -= (*concurrent += new Delegate<void,int>(&counter, &Counter::onEvent));
+  else
+    for (auto _ : state)
+      concurrent->raise(1);
+
+  if (state.thread_index() == 0)
+  {
+    delete concurrent;
+    state.counters["pending"] = static_cast<double>(domain.pending());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConcurrentEvent_SubscribeUnderRaise)->ArgName("subscribers")->ArgsProduct({{1, 8, 64}})->ThreadRange(2, 8)->UseRealTime();
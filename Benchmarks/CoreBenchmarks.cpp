@@ -0,0 +1,222 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Benchmarks\CoreBenchmarks.cpp
+//! \brief Benchmarks for the arrays, encodings, writers, xml reader and events of the portable core
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/utils/DynamicArray.hpp>         //!< DynamicArray
+#include <wtl/utils/chararray.hpp>            //!< CharArray
+#include <wtl/utils/Encoding.hpp>             //!< string_encoder
+#include <wtl/io/BinaryWriter.hpp>            //!< BinaryWriter
+#include <wtl/io/ChunkedStream.hpp>           //!< ChunkedStream
+#include <wtl/io/FrameCodec.hpp>              //!< FrameView
+#include <wtl/io/TextBuffer.hpp>              //!< TextBuffer
+#include <wtl/io/TextWriter.hpp>              //!< TextWriter
+#include <wtl/io/XmlReader.hpp>               //!< XmlReader
+#include <wtl/windows/event.hpp>              //!< Event
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! Generate an xml document with 'count' item elements
+  std::string  makeDocument(int count)
+  {
+    std::string doc = "<items>";
+    for (int i = 0; i < count; ++i)
+      doc += "<item id='" + std::to_string(i) + "' kind='" + (i % 3 ? "file" : "folder") + "'><name>Item " + std::to_string(i) + "</name><size>" + std::to_string(i * 37) + "</size></item>";
+    return doc + "</items>";
+  }
+
+  //! Event subscriber
+  struct Counter
+  {
+    int64_t  Total = 0;
+
+    void  onEvent(int value)    { Total += value; }
+  };
+}
+
+// ------------------------------------ DYNAMIC ARRAY -----------------------------------
+
+//! Fill a DynamicArray to capacity then clear it
+static void BM_DynamicArray_Fill(benchmark::State& state)
+{
+  DynamicArray<int32_t,256> arr;
+  for (auto _ : state)
+  {
+    for (int32_t i = 0; i < 256; ++i)
+      arr.emplace_back(i);
+    benchmark::DoNotOptimize(arr.c_arr());
+    arr.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * 256);
+}
+BENCHMARK(BM_DynamicArray_Fill);
+
+//! Linear search of a full DynamicArray
+static void BM_DynamicArray_Contains(benchmark::State& state)
+{
+  DynamicArray<int32_t,256> arr;
+  for (int32_t i = 0; i < 256; ++i)
+    arr.emplace_back(i);
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(arr.contains(255));
+}
+BENCHMARK(BM_DynamicArray_Contains);
+
+// ------------------------------------- CHAR ARRAY -------------------------------------
+
+//! Assign then append into a path-sized CharArray
+static void BM_CharArray_AssignAppend(benchmark::State& state)
+{
+  static const char folder[] = "C:\\Users\\Public\\Documents\\Projects",
+                    file[] = "\\Win32 Template Library\\WTL.hpp";
+  CharArray<Encoding::UTF8,260> str;
+
+  for (auto _ : state)
+  {
+    str.assign(std::begin(folder), std::end(folder)-1);
+    str.append(std::begin(file), std::end(file)-1);
+    benchmark::DoNotOptimize(str.c_str());
+  }
+}
+BENCHMARK(BM_CharArray_AssignAppend);
+
+//! Format an integer into a CharArray
+static void BM_CharArray_Format(benchmark::State& state)
+{
+  CharArray<Encoding::UTF8,64> str;
+  int32_t n = 0;
+
+  for (auto _ : state)
+  {
+    str.format("Item %d of %d", n++, 1000);
+    benchmark::DoNotOptimize(str.c_str());
+  }
+}
+BENCHMARK(BM_CharArray_Format);
+
+// ----------------------------------- STRING ENCODER -----------------------------------
+
+//! Convert UTF-8 to wide characters
+static void BM_StringEncoder_Utf8ToWide(benchmark::State& state)
+{
+  std::string          input(static_cast<size_t>(state.range(0)), 'a');
+  std::vector<wchar_t> output(input.size() + 1);
+
+  for (auto _ : state)
+  {
+    int32_t n = string_encoder<Encoding::UTF8,Encoding::UTF16>::convert(input.c_str(), input.c_str() + input.size(), output.data(), output.data() + output.size());
+    benchmark::DoNotOptimize(n);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StringEncoder_Utf8ToWide)->Arg(16)->Arg(256)->Arg(4096);
+
+//! Convert wide characters to UTF-8
+static void BM_StringEncoder_WideToUtf8(benchmark::State& state)
+{
+  std::wstring      input(static_cast<size_t>(state.range(0)), L'\u00e9');
+  std::vector<char> output(input.size() * 2 + 1);
+
+  for (auto _ : state)
+  {
+    int32_t n = string_encoder<Encoding::UTF16,Encoding::UTF8>::convert(input.c_str(), input.c_str() + input.size(), output.data(), output.data() + output.size());
+    benchmark::DoNotOptimize(n);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(wchar_t)));
+}
+BENCHMARK(BM_StringEncoder_WideToUtf8)->Arg(16)->Arg(256)->Arg(4096);
+
+// -------------------------------------- WRITERS ---------------------------------------
+
+//! Write a mixture of text and numerals
+static void BM_TextWriter_Record(benchmark::State& state)
+{
+  TextWriter<TextBuffer<char>> w(4096);
+  int32_t n = 0;
+
+  for (auto _ : state)
+  {
+    for (int32_t i = 0; i < 64; ++i, ++n)
+      w << "id=" << n << " size=" << n * 37 << " ratio=" << n * 0.5 << '\n';
+    benchmark::DoNotOptimize(w.str());
+    w.stream().clear();
+  }
+  state.SetItemsProcessed(state.iterations() * 64);
+}
+BENCHMARK(BM_TextWriter_Record);
+
+//! Write integral values in binary
+static void BM_BinaryWriter_Values(benchmark::State& state)
+{
+  auto pool = std::make_shared<SocketBufferPool>(4096);
+
+  for (auto _ : state)
+  {
+    BinaryWriter<ChunkedStream> w(pool);
+    for (int32_t i = 0; i < 1024; ++i)
+      w << i << static_cast<int16_t>(i) << (i & 1) << static_cast<double>(i);
+    benchmark::DoNotOptimize(w.stream().size());
+  }
+  state.SetItemsProcessed(state.iterations() * 1024);
+}
+BENCHMARK(BM_BinaryWriter_Values);
+
+// ------------------------------------- XML READER -------------------------------------
+
+//! Parse a document in-place
+static void BM_XmlReader_Parse(benchmark::State& state)
+{
+  std::string const doc = makeDocument(static_cast<int>(state.range(0)));
+  std::vector<char> buffer(doc.size());
+
+  for (auto _ : state)
+  {
+    std::copy(doc.begin(), doc.end(), buffer.begin());
+    XmlReader<FrameView> reader(reinterpret_cast<byte*>(buffer.data()), buffer.size());
+    benchmark::DoNotOptimize(reader.root());
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(doc.size()));
+}
+BENCHMARK(BM_XmlReader_Parse)->Arg(10)->Arg(1000);
+
+//! Evaluate xpath queries against a parsed document
+static void BM_XmlReader_XPath(benchmark::State& state)
+{
+  std::string doc = makeDocument(1000);
+  XmlReader<FrameView> reader(reinterpret_cast<byte*>(&doc[0]), doc.size());
+  int32_t size = 0;
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(reader.selectNodes("/items/item[@kind='folder']").size());
+    reader.getValue("/items/item[@id='500']/size", size);
+  }
+}
+BENCHMARK(BM_XmlReader_XPath);
+
+// --------------------------------------- EVENTS ---------------------------------------
+
+//! Raise an event with 'n' subscribers
+static void BM_Event_Raise(benchmark::State& state)
+{
+  Event<void,int> event;
+  Counter counter;
+  for (int64_t i = 0; i < state.range(0); ++i)
+    event += new Delegate<void,int>(&counter, &Counter::onEvent);
+
+  for (auto _ : state)
+    event.raise(1);
+
+  benchmark::DoNotOptimize(counter.Total);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Event_Raise)->Arg(1)->Arg(8)->Arg(64);
@@ -0,0 +1,168 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Benchmarks\DialogTemplateBenchmarks.cpp
+//! \brief Benchmarks for parsing and retrieving a large set of dialog templates
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/resources/DialogTemplate.hpp>   //!< DialogTemplate
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! Number of dialogs within the set
+  constexpr uint16_t  Dialogs = 1000;
+
+  //! Append a little-endian field
+  template <typename T>
+  void  put(std::vector<uint8_t>& out, T value)
+  {
+    for (size_t b = 0; b < sizeof(T); ++b)
+      out.push_back(static_cast<uint8_t>(static_cast<uint64_t>(value) >> (8*b)));
+  }
+
+  //! Append a null-terminated UTF-16 string
+  void  putString(std::vector<uint8_t>& out, const std::u16string& s)
+  {
+    for (char16_t ch : s)
+      put<uint16_t>(out, ch);
+    put<uint16_t>(out, 0);
+  }
+
+  //! Write an extended template of 'items' labelled buttons, edits and list views
+  std::vector<uint8_t>  dialog(uint16_t id, uint16_t items)
+  {
+    std::vector<uint8_t> out;
+    put<uint16_t>(out, 1);
+    put<uint16_t>(out, 0xFFFF);
+    put<uint32_t>(out, 0);
+    put<uint32_t>(out, 0);
+    put<uint32_t>(out, 0x80C800C0 | DS_SETFONT);
+    put<uint16_t>(out, items);
+    for (int16_t v : {0, 0, 320, 240})
+      put<int16_t>(out, v);
+    put<uint16_t>(out, 0);
+    put<uint16_t>(out, 0);
+    putString(out, u"Dialog " + std::u16string(1, char16_t(u'A' + id % 26)));
+    put<uint16_t>(out, 8);
+    put<uint16_t>(out, 400);
+    put<uint16_t>(out, 0);
+    putString(out, u"MS Shell Dlg");
+
+    for (uint16_t idx = 0; idx < items; ++idx)
+    {
+      while (out.size() % 4)
+        out.push_back(0);
+      put<uint32_t>(out, 0);
+      put<uint32_t>(out, 0);
+      put<uint32_t>(out, 0x50010000);
+      for (int16_t v : {int16_t(7), int16_t(7 + idx * 14), int16_t(100), int16_t(12)})
+        put<int16_t>(out, v);
+      put<uint32_t>(out, 1000u + idx);
+      if (idx % 3 == 2)
+        putString(out, u"SysListView32");
+      else
+      {
+        put<uint16_t>(out, 0xFFFF);
+        put<uint16_t>(out, idx % 3 ? 0x0081 : 0x0080);
+      }
+      putString(out, u"Control label " + std::u16string(1, char16_t(u'0' + idx % 10)));
+      put<uint16_t>(out, 0);
+    }
+    return out;
+  }
+
+  //! Generate the set of dialogs, of 8 to 64 items
+  const std::vector<std::vector<uint8_t>>&  dialogSet()
+  {
+    static std::vector<std::vector<uint8_t>> set;
+    if (set.empty())
+      for (uint16_t id = 0; id < Dialogs; ++id)
+        set.push_back(dialog(id, 8 + (id * 7) % 57));
+    return set;
+  }
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct CopiedTemplate - Parsed template whose strings and creation data are copied
+  //!
+  //! \remarks Models the representation formerly built by DialogResource  (Baseline)
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct CopiedTemplate
+  {
+    struct Item
+    {
+      std::u16string        Class,
+                            Text;
+      std::vector<uint8_t>  Data;
+    };
+
+    std::u16string     Title,
+                       Typeface;
+    std::vector<Item>  Items;
+
+    explicit CopiedTemplate(const std::vector<uint8_t>& blob)
+    {
+      DialogTemplate const dlg(blob.data(), static_cast<uint32_t>(blob.size()));
+      Title.assign(dlg.Title.Text, dlg.Title.Length);
+      Typeface.assign(dlg.Typeface.Text, dlg.Typeface.Length);
+      for (const DialogItemTemplate& item : dlg)
+        Items.push_back(Item {item.className(),
+                              item.Text.Text ? std::u16string(item.Text.Text, item.Text.Length) : std::u16string(),
+                              std::vector<uint8_t>(item.CreateData, item.CreateData + item.CreateLength)});
+    }
+  };
+}
+
+//! Parse every dialog of the set in-place
+static void BM_DialogTemplate_ParseSet(benchmark::State& state)
+{
+  auto const& set = dialogSet();
+  for (auto _ : state)
+    for (const auto& blob : set)
+    {
+      DialogTemplate dlg(blob.data(), static_cast<uint32_t>(blob.size()));
+      benchmark::DoNotOptimize(dlg.size());
+    }
+  state.SetItemsProcessed(state.iterations() * Dialogs);
+}
+BENCHMARK(BM_DialogTemplate_ParseSet);
+
+//! Parse every dialog of the set, copying strings and creation data  (Baseline)
+static void BM_DialogTemplate_ParseAndCopySet(benchmark::State& state)
+{
+  auto const& set = dialogSet();
+  for (auto _ : state)
+    for (const auto& blob : set)
+    {
+      CopiedTemplate dlg(blob);
+      benchmark::DoNotOptimize(dlg.Items.size());
+    }
+  state.SetItemsProcessed(state.iterations() * Dialogs);
+}
+BENCHMARK(BM_DialogTemplate_ParseAndCopySet);
+
+//! Retrieve parsed dialogs of the set by id, as DialogTemplateCache does after first use
+static void BM_DialogTemplate_CachedLookup(benchmark::State& state)
+{
+  auto const& set = dialogSet();
+  std::unordered_map<uint16_t,std::shared_ptr<const DialogTemplate>> cache;
+  for (uint16_t id = 0; id < Dialogs; ++id)
+    cache.emplace(id, std::make_shared<const DialogTemplate>(set[id].data(), static_cast<uint32_t>(set[id].size())));
+
+  uint16_t id = 0;
+  for (auto _ : state)
+  {
+    std::shared_ptr<const DialogTemplate> dlg = cache.find(id)->second;
+    benchmark::DoNotOptimize(dlg->size());
+    id = (id + 1) % Dialogs;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DialogTemplate_CachedLookup);
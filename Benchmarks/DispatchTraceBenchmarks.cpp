@@ -0,0 +1,134 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Benchmarks\DispatchTraceBenchmarks.cpp
+//! \brief Benchmarks for the cost of dispatch tracing upon a synthetic message dispatch
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/utils/DispatchTrace.hpp>        //!< DispatchTrace, TraceScope, LatencyHistogram
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct SyntheticDispatch - Models the stages traced by Window::WndProc and Event::raise
+  //!
+  //! \tparam TRACED - Whether each stage opens a span, as when DISPATCH_TRACING is non-zero
+  //!
+  //! \remarks Stages are spelled out rather than using TRACE_SCOPE so that traced and untraced variants can be
+  //! \remarks compared within one binary.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <bool TRACED>
+  struct SyntheticDispatch
+  {
+    std::vector<std::function<void (uint32_t)>>  Handlers;      //!< Event subscribers
+    uint64_t                                     Total = 0;     //!< Accumulated by handlers
+
+    explicit SyntheticDispatch(int64_t handlers)
+    {
+      for (int64_t i = 0; i < handlers; ++i)
+        Handlers.emplace_back([this] (uint32_t msg) { Total += msg; });
+    }
+
+    void  dispatch(uint32_t message)
+    {
+      if (TRACED)
+      {
+        TraceScope wndproc(TraceCategory::WndProc, message);
+        { TraceScope lookup(TraceCategory::Lookup, message); benchmark::ClobberMemory(); }
+        TraceScope route(TraceCategory::Route, message);
+        TraceScope event(TraceCategory::Event, reinterpret_cast<uintptr_t>(this));
+        for (auto& fn : Handlers)
+        {
+          TraceScope handler(TraceCategory::Handler, reinterpret_cast<uintptr_t>(&fn), "Handler");
+          fn(message);
+        }
+      }
+      else
+      {
+        benchmark::ClobberMemory();
+        for (auto& fn : Handlers)
+          fn(message);
+      }
+    }
+  };
+
+  //! Dispatch messages of 16 types round-robin
+  template <bool TRACED>
+  void  runDispatch(benchmark::State& state)
+  {
+    SyntheticDispatch<TRACED> dispatcher(state.range(0));
+    uint32_t message = 0;
+
+    for (auto _ : state)
+      dispatcher.dispatch(0x0100 + (message++ & 0x0f));
+
+    benchmark::DoNotOptimize(dispatcher.Total);
+    state.SetItemsProcessed(state.iterations());
+  }
+}
+
+// ---------------------------------- LATENCY HISTOGRAM ---------------------------------
+
+//! Record values spanning several orders of magnitude
+static void BM_LatencyHistogram_Record(benchmark::State& state)
+{
+  LatencyHistogram h;
+  uint64_t ns = 1;
+
+  for (auto _ : state)
+  {
+    h.record(ns);
+    ns = (ns * 7 + 13) & 0xfffff;
+  }
+  benchmark::DoNotOptimize(h.Count);
+}
+BENCHMARK(BM_LatencyHistogram_Record);
+
+//! Query the 99th percentile of a populated histogram
+static void BM_LatencyHistogram_Percentile(benchmark::State& state)
+{
+  LatencyHistogram h;
+  for (uint64_t ns = 1; ns < 100000; ns += 7)
+    h.record(ns);
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(h.percentile(99));
+}
+BENCHMARK(BM_LatencyHistogram_Percentile);
+
+// ---------------------------------- SYNTHETIC DISPATCH --------------------------------
+
+//! Dispatch without tracing  (Baseline)
+static void BM_Dispatch_Untraced(benchmark::State& state)
+{
+  runDispatch<false>(state);
+}
+BENCHMARK(BM_Dispatch_Untraced)->Arg(1)->Arg(4);
+
+//! Dispatch recording statistics only
+static void BM_Dispatch_TracedStatistics(benchmark::State& state)
+{
+  DispatchTrace& trace = DispatchTrace::instance();
+  trace.Timeline = false;
+  runDispatch<true>(state);
+  trace.flush();
+  trace.clear();
+}
+BENCHMARK(BM_Dispatch_TracedStatistics)->Arg(1)->Arg(4);
+
+//! Dispatch recording statistics and timeline
+static void BM_Dispatch_TracedTimeline(benchmark::State& state)
+{
+  DispatchTrace& trace = DispatchTrace::instance();
+  trace.Timeline = true;
+  runDispatch<true>(state);
+  trace.flush();
+  trace.clear();
+}
+BENCHMARK(BM_Dispatch_TracedTimeline)->Arg(1)->Arg(4);
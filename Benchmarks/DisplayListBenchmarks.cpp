@@ -0,0 +1,102 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Benchmarks\DisplayListBenchmarks.cpp
+//! \brief Benchmarks for recording, comparing and replaying display lists
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/gdi/DisplayList.hpp>            //!< DisplayList, DamageRegion
+#include <benchmark/benchmark.h>
+#include <cstdio>
+
+using namespace wtl;
+
+namespace
+{
+  //! Surface which only counts commands
+  struct NullSurface : IDisplaySurface
+  {
+    size_t  Executed = 0;
+
+    void  begin(const RectL&) override                            {}
+    void  end() override                                          {}
+    void  execute(const DisplayCommand&, const void*) override    { ++Executed; }
+  };
+
+  //! Record a grid of 'n' labelled cells, as drawn by a list view  (Cell 'changed' shows a different label)
+  void  recordGrid(DisplayList& list, int64_t n, int64_t changed = -1)
+  {
+    char label[16];
+    list.clear();
+    for (int32_t i = 0; i < int32_t(n); ++i)
+    {
+      RectL const cell((i % 10) * 80, (i / 10) * 20, (i % 10) * 80 + 80, (i / 10) * 20 + 20);
+      int const length = std::snprintf(label, sizeof(label), "Item %d", i == changed ? -i : i);
+
+      list.record(DisplayList::command(DisplayOp::Fill, cell, 1));
+      list.record(DisplayList::command(DisplayOp::Text, cell, 0, 2), label, static_cast<uint32_t>(length));
+    }
+  }
+}
+
+//! Record a frame of 'n' cells into a list whose capacity is retained
+static void BM_DisplayList_Record(benchmark::State& state)
+{
+  DisplayList list;
+  for (auto _ : state)
+  {
+    recordGrid(list, state.range(0));
+    benchmark::DoNotOptimize(list.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(BM_DisplayList_Record)->Arg(100)->Arg(1000);
+
+//! Compare successive frames of 'n' cells, one of which changed
+static void BM_DisplayList_DiffOneChanged(benchmark::State& state)
+{
+  DisplayList previous, current;
+  recordGrid(previous, state.range(0));
+  recordGrid(current, state.range(0), state.range(0) / 2);
+
+  for (auto _ : state)
+  {
+    DamageRegion damage;
+    current.diff(previous, damage);
+    benchmark::DoNotOptimize(damage.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(BM_DisplayList_DiffOneChanged)->Arg(100)->Arg(1000);
+
+//! Replay the damage of one changed cell, versus the entire frame
+static void BM_DisplayList_ReplayDamaged(benchmark::State& state)
+{
+  DisplayList previous, current;
+  recordGrid(previous, state.range(0));
+  recordGrid(current, state.range(0), state.range(0) / 2);
+
+  DamageRegion damage;
+  current.diff(previous, damage);
+
+  NullSurface surface;
+  for (auto _ : state)
+    current.replay(surface, damage);
+  benchmark::DoNotOptimize(surface.Executed);
+}
+BENCHMARK(BM_DisplayList_ReplayDamaged)->Arg(100)->Arg(1000);
+
+//! Accumulate scattered damage until the region is full
+static void BM_DamageRegion_AddScattered(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    DamageRegion region;
+    for (int32_t i = 0; i < 64; ++i)
+      region.add(RectL((i * 37) % 800, (i * 53) % 600, (i * 37) % 800 + 16, (i * 53) % 600 + 16));
+    benchmark::DoNotOptimize(region.size());
+  }
+  state.SetItemsProcessed(state.iterations() * 64);
+}
+BENCHMARK(BM_DamageRegion_AddScattered);
@@ -0,0 +1,116 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Benchmarks\DynamicBitsetBenchmarks.cpp
+//! \brief Benchmarks for enumerating, combining and ranking the bits of a 64K-bit set
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/utils/DynamicBitset.hpp>        //!< DynamicBitset
+#include <benchmark/benchmark.h>
+#include <bitset>
+#include <memory>
+#include <random>
+
+using namespace wtl;
+
+namespace
+{
+  //! Number of bits
+  constexpr uint32_t  Width = 65536;
+
+  //! Generate a bitset with 1/'sparsity' of its bits set
+  DynamicBitset  randomBits(uint32_t sparsity, uint32_t seed)
+  {
+    std::mt19937 rng(seed);
+    DynamicBitset bs(Width);
+    for (uint32_t i = 0; i < Width; ++i)
+      bs.set(i, rng() % sparsity == 0);
+    return bs;
+  }
+
+  //! Copy a bitset into a std::bitset
+  std::unique_ptr<std::bitset<Width>>  toStd(const DynamicBitset& bs)
+  {
+    std::unique_ptr<std::bitset<Width>> r(new std::bitset<Width>());
+    bs.forEach([&r] (uint32_t idx) { r->set(idx); });
+    return r;
+  }
+}
+
+// ------------------------------------- ITERATION -------------------------------------
+
+//! Enumerate the set bits of 64K bits with 1/16 set, by testing each bit  (Baseline)
+static void BM_DynamicBitset_TestEachBit(benchmark::State& state)
+{
+  DynamicBitset const bs = randomBits(16, 1);
+  for (auto _ : state)
+  {
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < Width; ++i)
+      if (bs[i])
+        sum += i;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * Width);
+}
+BENCHMARK(BM_DynamicBitset_TestEachBit);
+
+//! Enumerate the set bits of 64K bits with 1/16 set, a word at a time
+static void BM_DynamicBitset_ForEach(benchmark::State& state)
+{
+  DynamicBitset const bs = randomBits(16, 1);
+  for (auto _ : state)
+  {
+    uint32_t sum = 0;
+    bs.forEach([&sum] (uint32_t idx) { sum += idx; });
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * Width);
+}
+BENCHMARK(BM_DynamicBitset_ForEach);
+
+// ----------------------------------- SET OPERATIONS -----------------------------------
+
+//! OR then exclusive-OR two 64K-bit std::bitsets  (Baseline)
+static void BM_DynamicBitset_StdOrXor(benchmark::State& state)
+{
+  auto a = toStd(randomBits(16, 1)),
+       b = toStd(randomBits(16, 2));
+  for (auto _ : state)
+  {
+    *a |= *b;
+    *a ^= *b;
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * Width / 8);
+}
+BENCHMARK(BM_DynamicBitset_StdOrXor);
+
+//! OR then exclusive-OR two 64K-bit dynamic bitsets
+static void BM_DynamicBitset_OrXor(benchmark::State& state)
+{
+  DynamicBitset a = randomBits(16, 1),
+                b = randomBits(16, 2);
+  for (auto _ : state)
+  {
+    a |= b;
+    a ^= b;
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * Width / 8);
+}
+BENCHMARK(BM_DynamicBitset_OrXor);
+
+// ------------------------------------ RANK & SELECT -----------------------------------
+
+//! Find the median set bit of 64K bits with 1/16 set, then count the bits preceding it
+static void BM_DynamicBitset_SelectRank(benchmark::State& state)
+{
+  DynamicBitset const bs = randomBits(16, 1);
+  uint32_t const median = bs.count() / 2;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(bs.rank(bs.select(median)));
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DynamicBitset_SelectRank);
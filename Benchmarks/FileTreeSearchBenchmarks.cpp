@@ -0,0 +1,164 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Benchmarks\FileTreeSearchBenchmarks.cpp
+//! \brief Benchmarks for walking a folder tree in parallel, against a serial walk
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/platform/FileTreeSearch.hpp>    //!< FileTreeSearch
+#include <benchmark/benchmark.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! Number of folders beneath each folder, and folder depth
+  constexpr int  Fanout = 8,
+                 Depth = 2;
+
+  //! Number of files within each folder
+  constexpr int  Files = 48;
+
+  //! Remove the contents of a folder, then the folder itself
+  void  removeAt(int parent, const char* name)
+  {
+    int fd = ::openat(parent, name, O_RDONLY|O_DIRECTORY|O_NOFOLLOW|O_CLOEXEC);
+    if (DIR* dir = (fd != -1 ? ::fdopendir(fd) : nullptr))
+    {
+      std::vector<std::string> children;
+      while (::dirent* d = ::readdir(dir))
+        if (std::strcmp(d->d_name, ".") && std::strcmp(d->d_name, ".."))
+          children.push_back(d->d_name);
+
+      for (auto const& c : children)
+        if (::unlinkat(::dirfd(dir), c.c_str(), 0) != 0)
+          removeAt(::dirfd(dir), c.c_str());
+      ::closedir(dir);
+    }
+    ::unlinkat(parent, name, AT_REMOVEDIR);
+  }
+
+  //! Populate a folder with 'Files' files and, above 'Depth', 'Fanout' subfolders
+  void  populate(const std::string& folder, int depth)
+  {
+    for (int i = 0; i < Files; ++i)
+      ::close(::open((folder + "/file" + std::to_string(i) + (i % 4 ? ".cpp" : ".hpp")).c_str(), O_WRONLY|O_CREAT|O_CLOEXEC, 0644));
+
+    if (depth < Depth)
+      for (int i = 0; i < Fanout; ++i)
+      {
+        std::string const child = folder + "/folder" + std::to_string(i);
+        ::mkdir(child.c_str(), 0755);
+        populate(child, depth + 1);
+      }
+  }
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct Tree - Temporary folder tree shared by every benchmark, removed upon exit
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct Tree
+  {
+    std::string  Root;
+
+    Tree()
+    {
+      char path[] = "/tmp/wtl-bench-XXXXXX";
+      if (::mkdtemp(path))
+        populate(Root = path, 0);
+    }
+
+    ~Tree()
+    {
+      if (!Root.empty())
+        removeAt(AT_FDCWD, Root.c_str());
+    }
+
+    static const std::string&  root()
+    {
+      static Tree tree;
+      return tree.Root;
+    }
+  };
+
+  //! Walk a folder serially, describing every entry as the search does  (Returns number of entries)
+  int64_t  walk(const std::string& folder)
+  {
+    int64_t n = 0;
+    if (DIR* dir = ::opendir(folder.c_str()))
+    {
+      while (::dirent* d = ::readdir(dir))
+      {
+        if (!std::strcmp(d->d_name, ".") || !std::strcmp(d->d_name, ".."))
+          continue;
+
+        struct ::stat st;
+        ::fstatat(::dirfd(dir), d->d_name, &st, AT_SYMLINK_NOFOLLOW);
+        benchmark::DoNotOptimize(st.st_size);
+        ++n;
+
+        if (d->d_type == DT_DIR)
+          n += walk(folder + '/' + d->d_name);
+      }
+      ::closedir(dir);
+    }
+    return n;
+  }
+}
+
+// ---------------------------------------- WALK ----------------------------------------
+
+//! Walk the tree with opendir/readdir on the calling thread  (Baseline)
+static void BM_FileTreeSearch_SerialWalk(benchmark::State& state)
+{
+  std::string const& root = Tree::root();
+  int64_t entries = 0;
+  for (auto _ : state)
+    benchmark::DoNotOptimize(entries = walk(root));
+  state.SetItemsProcessed(state.iterations() * entries);
+}
+BENCHMARK(BM_FileTreeSearch_SerialWalk)->UseRealTime();
+
+//! Walk the tree with a search upon a pool of 'threads' workers
+static void BM_FileTreeSearch_Search(benchmark::State& state)
+{
+  std::string const& root = Tree::root();
+  ThreadPool pool(uint32_t(state.range(0)));
+  int64_t entries = 0;
+  for (auto _ : state)
+  {
+    entries = 0;
+    FileTreeSearch<Encoding::UTF8> search(root, FileFilter<char>(), pool);
+    for (FileBatch<char> batch; search.next(batch); )
+      entries += int64_t(batch.Entries.size());
+    benchmark::DoNotOptimize(entries);
+  }
+  state.SetItemsProcessed(state.iterations() * entries);
+}
+BENCHMARK(BM_FileTreeSearch_Search)->ArgName("threads")->Arg(1)->Arg(4)->UseRealTime();
+
+//! Search the tree for one extension, describing only the files reported
+static void BM_FileTreeSearch_SearchFiltered(benchmark::State& state)
+{
+  std::string const& root = Tree::root();
+  ThreadPool pool(uint32_t(state.range(0)));
+  int64_t entries = 0;
+  for (auto _ : state)
+  {
+    entries = 0;
+    FileTreeSearch<Encoding::UTF8> search(root, FileFilter<char>().extension("hpp").folders(false), pool);
+    for (FileBatch<char> batch; search.next(batch); )
+      entries += int64_t(batch.Entries.size());
+    benchmark::DoNotOptimize(entries);
+  }
+  state.SetItemsProcessed(state.iterations() * entries);
+}
+BENCHMARK(BM_FileTreeSearch_SearchFiltered)->ArgName("threads")->Arg(1)->Arg(4)->UseRealTime();
@@ -0,0 +1,139 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Benchmarks\FlatRegistryBenchmarks.cpp
+//! \brief Benchmarks for window lookup using FlatRegistry
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/utils/FlatRegistry.hpp>         //!< FlatRegistry
+#include <benchmark/benchmark.h>
+#include <map>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! Placeholder window
+  struct FakeWindow
+  {
+    int32_t  Id;
+  };
+
+  //! Generate a handle-like key  (Aligned, sharing low-order bits)
+  const void*  handle(uintptr_t n)
+  {
+    return reinterpret_cast<const void*>(0x10000 + n * 4);
+  }
+
+  //! Generate a lookup sequence visiting windows in random order
+  std::vector<const void*>  randomOrder(size_t windows)
+  {
+    std::vector<const void*> keys(windows);
+    std::mt19937 rng(42);
+    for (auto& k : keys)
+      k = handle(rng() % windows);
+    return keys;
+  }
+}
+
+// ------------------------------------ FLAT REGISTRY -----------------------------------
+
+//! Lookup windows in random order among 'n' windows
+static void BM_FlatRegistry_RandomLookup(benchmark::State& state)
+{
+  size_t const windows = static_cast<size_t>(state.range(0));
+  std::vector<FakeWindow> objects(windows);
+  FlatRegistry<const void*,FakeWindow> reg;
+  for (size_t i = 0; i < windows; ++i)
+    reg.insert(handle(i), &objects[i]);
+
+  std::vector<const void*> const keys = randomOrder(windows);
+  size_t idx = 0;
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(reg.find(keys[idx]));
+    idx = (idx + 1) % keys.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FlatRegistry_RandomLookup)->Arg(16)->Arg(10000);
+
+//! Lookup the same window repeatedly among 'n' windows, as during a burst of messages
+static void BM_FlatRegistry_RepeatedLookup(benchmark::State& state)
+{
+  size_t const windows = static_cast<size_t>(state.range(0));
+  std::vector<FakeWindow> objects(windows);
+  FlatRegistry<const void*,FakeWindow> reg;
+  for (size_t i = 0; i < windows; ++i)
+    reg.insert(handle(i), &objects[i]);
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(reg.find(handle(windows / 2)));
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FlatRegistry_RepeatedLookup)->Arg(16)->Arg(10000);
+
+//! Lookup windows in random order among 'n' windows using std::map  (Baseline, as formerly used by ActiveWindows)
+static void BM_Map_RandomLookup(benchmark::State& state)
+{
+  size_t const windows = static_cast<size_t>(state.range(0));
+  std::vector<FakeWindow> objects(windows);
+  std::map<const void*,FakeWindow*> map;
+  for (size_t i = 0; i < windows; ++i)
+    map.emplace(handle(i), &objects[i]);
+
+  std::vector<const void*> const keys = randomOrder(windows);
+  size_t idx = 0;
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(map.find(keys[idx]));
+    idx = (idx + 1) % keys.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Map_RandomLookup)->Arg(16)->Arg(10000);
+
+//! Lookup windows in random order among 'n' windows using std::unordered_map  (Baseline, without concurrent readers)
+static void BM_UnorderedMap_RandomLookup(benchmark::State& state)
+{
+  size_t const windows = static_cast<size_t>(state.range(0));
+  std::vector<FakeWindow> objects(windows);
+  std::unordered_map<const void*,FakeWindow*> map;
+  for (size_t i = 0; i < windows; ++i)
+    map.emplace(handle(i), &objects[i]);
+
+  std::vector<const void*> const keys = randomOrder(windows);
+  size_t idx = 0;
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(map.find(keys[idx]));
+    idx = (idx + 1) % keys.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_UnorderedMap_RandomLookup)->Arg(16)->Arg(10000);
+
+//! Register then unregister 'n' windows
+static void BM_FlatRegistry_InsertErase(benchmark::State& state)
+{
+  size_t const windows = static_cast<size_t>(state.range(0));
+  std::vector<FakeWindow> objects(windows);
+
+  for (auto _ : state)
+  {
+    FlatRegistry<const void*,FakeWindow> reg;
+    for (size_t i = 0; i < windows; ++i)
+      reg.insert(handle(i), &objects[i]);
+    for (size_t i = 0; i < windows; ++i)
+      reg.erase(handle(i));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FlatRegistry_InsertErase)->Arg(10000);
@@ -0,0 +1,125 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Benchmarks\FrameCodecBenchmarks.cpp
+//! \brief Benchmarks for splitting received data into frames, and batching outbound frames
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/io/FrameCodec.hpp>              //!< FrameReader, FrameWriter
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! Number of frames within the stream
+  constexpr size_t  Frames = 4096;
+
+  //! Encode frames of 'n' bytes
+  template <typename CODEC>
+  std::vector<byte>  encode(size_t n, CODEC codec = CODEC())
+  {
+    FrameWriter<CODEC> writer(std::make_shared<SocketBufferPool>(65536), codec);
+    std::vector<byte> const payload(n, 'x');
+    for (size_t i = 0; i < Frames; ++i)
+      writer.write(payload.data(), payload.size());
+
+    struct { std::vector<byte> Data; bool send(ChunkedStream&& s) {
+      s.segments([this] (const BufferSegment& seg) { Data.insert(Data.end(), seg.Data, seg.Data + seg.Length); });
+      return true;
+    } } sink;
+    writer.flush(sink);
+    return sink.Data;
+  }
+
+  //! Feed a stream to a reader in receives of 'chunk' bytes
+  template <typename CODEC>
+  void  split(benchmark::State& state, CODEC codec = CODEC())
+  {
+    std::vector<byte> stream = encode<CODEC>(size_t(state.range(0)), codec);
+    size_t const chunk = size_t(state.range(1));
+    FrameReader<CODEC> reader(codec);
+
+    for (auto _ : state)
+    {
+      size_t frames = 0;
+      for (size_t pos = 0; pos < stream.size(); pos += chunk)
+        reader.feed(stream.data() + pos, std::min(chunk, stream.size() - pos), [&frames] (FrameView& v) {
+          frames += v.size() != 0;
+        });
+      benchmark::DoNotOptimize(frames);
+    }
+    state.SetItemsProcessed(state.iterations() * Frames);
+    state.SetBytesProcessed(state.iterations() * int64_t(stream.size()));
+  }
+}
+
+//! Split 4096 length-prefixed frames of 'size' bytes, received 'chunk' bytes at a time
+static void BM_FrameReader_LengthPrefix(benchmark::State& state)
+{
+  split<LengthPrefixCodec<>>(state);
+}
+BENCHMARK(BM_FrameReader_LengthPrefix)->ArgNames({"size", "chunk"})->Args({64, 1460})->Args({64, 65536})->Args({4000, 1460});
+
+//! Split 4096 varint-prefixed frames of 'size' bytes, received 'chunk' bytes at a time
+static void BM_FrameReader_VarintPrefix(benchmark::State& state)
+{
+  split<VarintPrefixCodec>(state);
+}
+BENCHMARK(BM_FrameReader_VarintPrefix)->ArgNames({"size", "chunk"})->Args({64, 1460})->Args({64, 65536})->Args({4000, 1460});
+
+//! Split 4096 CRLF-delimited frames of 'size' bytes, received 'chunk' bytes at a time
+static void BM_FrameReader_Delimiter(benchmark::State& state)
+{
+  split<DelimiterCodec>(state, DelimiterCodec("\r\n"));
+}
+BENCHMARK(BM_FrameReader_Delimiter)->ArgNames({"size", "chunk"})->Args({64, 1460})->Args({64, 65536})->Args({4000, 1460});
+
+//! Append every receive to a buffer, then copy out and erase each complete length-prefixed frame  (Baseline)
+static void BM_FrameReader_CopyEachFrame(benchmark::State& state)
+{
+  std::vector<byte> stream = encode<LengthPrefixCodec<>>(size_t(state.range(0)));
+  size_t const chunk = size_t(state.range(1));
+  LengthPrefixCodec<> codec;
+  std::vector<byte> pending, payload;
+
+  for (auto _ : state)
+  {
+    size_t frames = 0;
+    for (size_t pos = 0; pos < stream.size(); pos += chunk)
+    {
+      pending.insert(pending.end(), stream.begin() + pos, stream.begin() + std::min(pos + chunk, stream.size()));
+      for (size_t total; (total = codec.measure(pending.data(), pending.size())) && total <= pending.size(); ++frames)
+      {
+        payload.assign(pending.begin() + 4, pending.begin() + total);
+        pending.erase(pending.begin(), pending.begin() + total);
+      }
+    }
+    benchmark::DoNotOptimize(frames);
+  }
+  state.SetItemsProcessed(state.iterations() * Frames);
+  state.SetBytesProcessed(state.iterations() * int64_t(stream.size()));
+}
+BENCHMARK(BM_FrameReader_CopyEachFrame)->ArgNames({"size", "chunk"})->Args({64, 1460})->Args({64, 65536})->Args({4000, 1460});
+
+//! Encode 4096 frames of 'n' bytes into a batch
+static void BM_FrameWriter_Batch(benchmark::State& state)
+{
+  auto pool = std::make_shared<SocketBufferPool>(16384);
+  std::vector<byte> const payload(size_t(state.range(0)), 'x');
+  FrameWriter<VarintPrefixCodec> writer(pool);
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < Frames; ++i)
+      writer.write(payload.data(), payload.size());
+
+    struct { bool send(ChunkedStream&&) { return true; } } discard;
+    writer.flush(discard);
+  }
+  state.SetItemsProcessed(state.iterations() * Frames);
+}
+BENCHMARK(BM_FrameWriter_Batch)->Arg(64)->Arg(4000);
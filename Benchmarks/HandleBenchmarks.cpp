@@ -0,0 +1,119 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Benchmarks\HandleBenchmarks.cpp
+//! \brief Benchmarks for creating, copying and recycling handles, using eventfd descriptors as native handles
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/utils/Handle.hpp>               //!< Handle
+#include <wtl/utils/HandlePool.hpp>           //!< HandlePool
+#include <wtl/utils/SharedHandle.hpp>         //!< SharedHandle
+#include <wtl/utils/UniqueHandle.hpp>         //!< UniqueHandle
+#include <benchmark/benchmark.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+using namespace wtl;
+
+namespace
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct EventAlloc - Allocator of eventfd descriptors, a kernel object comparable in cost to a GDI brush
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct EventAlloc
+  {
+    static constexpr int  npos = -1;
+
+    static NativeHandle<int>  create(unsigned initial)
+    {
+      return NativeHandle<int>(::eventfd(initial, int(EFD_CLOEXEC)), AllocType::Create);
+    }
+
+    static NativeHandle<int>  clone(NativeHandle<int> h)
+    {
+      return NativeHandle<int>(::dup(h.Handle), AllocType::Create);
+    }
+
+    static bool  destroy(NativeHandle<int> h) noexcept
+    {
+      return h.Method != AllocType::Create || ::close(h.Handle) == 0;
+    }
+  };
+}
+
+//! Create and destroy a reference-counted handle  (Baseline)
+static void BM_Handle_Churn(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    Handle<int,EventAlloc> h(0u);
+    benchmark::DoNotOptimize(h.get());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Handle_Churn);
+
+//! Create and destroy a unique handle
+static void BM_UniqueHandle_Churn(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    UniqueHandle<int,EventAlloc> h(0u);
+    benchmark::DoNotOptimize(h.get());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_UniqueHandle_Churn);
+
+//! Lease and return a pooled handle
+static void BM_HandlePool_Churn(benchmark::State& state)
+{
+  HandlePool<int,unsigned,EventAlloc> pool;
+  for (auto _ : state)
+  {
+    auto lease = pool.acquire(0u);
+    benchmark::DoNotOptimize(lease.get());
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["hit%"] = 100.0 * double(pool.hits()) / double(pool.hits() + pool.misses());
+}
+BENCHMARK(BM_HandlePool_Churn);
+
+//! Copy a reference-counted handle  (Baseline)
+static void BM_Handle_Copy(benchmark::State& state)
+{
+  Handle<int,EventAlloc> const h(0u);
+  for (auto _ : state)
+  {
+    Handle<int,EventAlloc> copy(h);
+    benchmark::DoNotOptimize(copy.get());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Handle_Copy);
+
+//! Copy a shared handle, whose count resides in the side table
+static void BM_SharedHandle_Copy(benchmark::State& state)
+{
+  SharedHandle<int,EventAlloc> const h(0u);
+  for (auto _ : state)
+  {
+    SharedHandle<int,EventAlloc> copy(h);
+    benchmark::DoNotOptimize(copy.get());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SharedHandle_Copy);
+
+//! Create and destroy a shared handle which is never copied
+static void BM_SharedHandle_Churn(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    SharedHandle<int,EventAlloc> h(0u);
+    benchmark::DoNotOptimize(h.get());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SharedHandle_Churn);
@@ -0,0 +1,119 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Benchmarks\ItemModelBenchmarks.cpp
+//! \brief Benchmarks for populating, sorting and filtering an item model
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/utils/ItemModel.hpp>            //!< ItemModel
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! Generate 'n' random names of 8 to 24 characters
+  std::vector<std::string>  names(size_t n)
+  {
+    std::mt19937 rng(42);
+    std::vector<std::string> r(n);
+    for (auto& s : r)
+    {
+      s.resize(8 + rng() % 17);
+      for (char& c : s)
+        c = char('a' + rng() % 26);
+    }
+    return r;
+  }
+}
+
+// ---------------------------------------- APPEND --------------------------------------
+
+//! Append 'n' items to a vector of strings  (Baseline)
+static void BM_ItemModel_AppendStrings(benchmark::State& state)
+{
+  auto const input = names(size_t(state.range(0)));
+  for (auto _ : state)
+  {
+    std::vector<std::pair<std::string,uintptr_t>> items;
+    for (auto const& s : input)
+      items.emplace_back(s, 0);
+    benchmark::DoNotOptimize(items.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ItemModel_AppendStrings)->Arg(1000)->Arg(100000);
+
+//! Append 'n' items to a model in one operation
+static void BM_ItemModel_AppendRange(benchmark::State& state)
+{
+  auto const input = names(size_t(state.range(0)));
+  for (auto _ : state)
+  {
+    ItemModel<char> model;
+    model.append(input.begin(), input.end());
+    benchmark::DoNotOptimize(model.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ItemModel_AppendRange)->Arg(1000)->Arg(100000);
+
+// ----------------------------------------- SORT ---------------------------------------
+
+//! Stable-sort a vector of 'n' strings  (Baseline)
+static void BM_ItemModel_SortStrings(benchmark::State& state)
+{
+  auto const input = names(size_t(state.range(0)));
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    auto items = input;
+    state.ResumeTiming();
+    std::stable_sort(items.begin(), items.end());
+    benchmark::DoNotOptimize(items.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ItemModel_SortStrings)->Arg(1000)->Arg(100000);
+
+//! Sort a model of 'n' items by text
+static void BM_ItemModel_Sort(benchmark::State& state)
+{
+  auto const input = names(size_t(state.range(0)));
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    ItemModel<char> model;
+    model.append(input.begin(), input.end());
+    state.ResumeTiming();
+    model.sort();
+    benchmark::DoNotOptimize(model[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ItemModel_Sort)->Arg(1000)->Arg(100000);
+
+//! Filter a sorted model of 'n' items to those beginning with a vowel
+static void BM_ItemModel_Filter(benchmark::State& state)
+{
+  ItemModel<char> model;
+  auto const input = names(size_t(state.range(0)));
+  model.append(input.begin(), input.end());
+  model.sort();
+
+  for (auto _ : state)
+  {
+    model.filter([] (const ItemModel<char>::ItemView& v) {
+      char const c = v.Text[0];
+      return c == 'a' || c == 'e' || c == 'i' || c == 'o' || c == 'u';
+    });
+    benchmark::DoNotOptimize(model.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ItemModel_Filter)->Arg(1000)->Arg(100000);
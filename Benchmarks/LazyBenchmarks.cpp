@@ -0,0 +1,40 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Benchmarks\LazyBenchmarks.cpp
+//! \brief Benchmarks for accessing a lazily created object once it exists
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/utils/Lazy.hpp>                 //!< Lazy
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <mutex>
+
+using namespace wtl;
+
+//! Access an existing object through std::call_once  (Baseline)
+static void BM_Lazy_CallOnce(benchmark::State& state)
+{
+  static std::once_flag once;
+  static std::unique_ptr<int> object;
+
+  for (auto _ : state)
+  {
+    std::call_once(once, [] { object.reset(new int(42)); });
+    benchmark::DoNotOptimize(*object);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Lazy_CallOnce)->ThreadRange(1, 4);
+
+//! Access an existing object through get_or_create
+static void BM_Lazy_GetOrCreate(benchmark::State& state)
+{
+  static Lazy<int> lazy;
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(lazy.get_or_create([] { return 42; }));
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Lazy_GetOrCreate)->ThreadRange(1, 4);
@@ -0,0 +1,119 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Benchmarks\PathTableBenchmarks.cpp
+//! \brief Benchmarks for interning, finding and rebuilding a million paths
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/utils/PathTable.hpp>            //!< PathTable
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! \alias table_t - Narrow path table
+  using table_t = PathTable<Encoding::ANSI>;
+
+  //! Number of paths within the set
+  constexpr size_t  Paths = 1000000;
+
+  //! Generate paths resembling a source tree: 10 projects of 100 folders of 1000 files
+  const std::vector<std::string>&  pathSet()
+  {
+    static std::vector<std::string> set;
+    if (set.empty())
+    {
+      char path[128];
+      set.reserve(Paths);
+      for (size_t i = 0; i < Paths; ++i)
+      {
+        int const length = std::snprintf(path, sizeof(path), "C:\\Users\\developer\\Projects\\project%zu\\src\\module%zu\\source%zu.cpp",
+                                         i % 10, (i / 10) % 100, i / 1000);
+        set.emplace_back(path, length);
+      }
+    }
+    return set;
+  }
+
+  //! Intern every path of the set
+  table_t  internSet()
+  {
+    table_t table;
+    for (const std::string& p : pathSet())
+      table.intern(p.c_str(), p.size());
+    return table;
+  }
+}
+
+//! Intern the set into an empty table
+static void BM_PathTable_Intern1M(benchmark::State& state)
+{
+  pathSet();
+  size_t memory = 0;
+  for (auto _ : state)
+  {
+    table_t const table = internSet();
+    memory = table.memory();
+    benchmark::DoNotOptimize(memory);
+  }
+  state.SetItemsProcessed(state.iterations() * Paths);
+  state.counters["bytes"] = double(memory);
+}
+BENCHMARK(BM_PathTable_Intern1M)->Unit(benchmark::kMillisecond);
+
+//! Store the set as strings  (Baseline)
+static void BM_PathTable_StringSet1M(benchmark::State& state)
+{
+  auto const& set = pathSet();
+  size_t memory = 0;
+  for (auto _ : state)
+  {
+    std::vector<std::string> copy;
+    copy.reserve(Paths);
+    for (const std::string& p : set)
+      copy.emplace_back(p);
+    memory = copy.capacity() * sizeof(std::string);
+    for (const std::string& p : copy)
+      memory += p.capacity() + 1;
+    benchmark::DoNotOptimize(memory);
+  }
+  state.SetItemsProcessed(state.iterations() * Paths);
+  state.counters["bytes"] = double(memory);
+}
+BENCHMARK(BM_PathTable_StringSet1M)->Unit(benchmark::kMillisecond);
+
+//! Find interned paths by text
+static void BM_PathTable_Find(benchmark::State& state)
+{
+  auto const& set = pathSet();
+  table_t const table = internSet();
+  size_t idx = 0;
+  for (auto _ : state)
+  {
+    const std::string& p = set[idx];
+    benchmark::DoNotOptimize(table.find(p.c_str(), p.size()));
+    idx = (idx + 7919) % Paths;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PathTable_Find);
+
+//! Rebuild interned paths into a caller buffer
+static void BM_PathTable_Copy(benchmark::State& state)
+{
+  table_t const table = internSet();
+  char buffer[260];
+  table_t::id_t id = 1;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(table.copy(id, buffer, sizeof(buffer)));
+    id = id % (table.size() - 1) + 1;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PathTable_Copy);
@@ -0,0 +1,101 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Benchmarks\PumpSchedulerBenchmarks.cpp
+//! \brief Benchmarks for PumpScheduler driven by a synthetic message source
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/threads/PumpScheduler.hpp>      //!< PumpScheduler
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <vector>
+
+using namespace wtl;
+using namespace std::chrono;
+
+namespace
+{
+  //! Message source yielding a fixed number of messages, then quitting once the loop waits
+  struct SyntheticSource
+  {
+    using message_t = int64_t;
+
+    int64_t   Remaining;        //!< Messages yet to be dispatched
+    int64_t   Sum = 0;          //!< Work performed by dispatch
+    int64_t   Waits = 0;        //!< Number of waits
+
+    explicit SyntheticSource(int64_t messages) : Remaining(messages)
+    {}
+
+    bool peek(int64_t& msg)
+    {
+      if (Remaining > 0)
+        msg = Remaining--;
+      else if (Waits != 0)
+        msg = -1;
+      else
+        return false;
+      return true;
+    }
+
+    bool pending() const                { return Remaining > 0 || Waits != 0; }
+    bool quit(int64_t msg) const        { return msg < 0; }
+    int32_t result(int64_t) const       { return 0; }
+    void dispatch(int64_t& msg)         { Sum += msg; }
+    void wait(PumpScheduler::duration_t){ ++Waits; }
+  };
+}
+
+//! Dispatch messages through the scheduler
+static void BM_PumpScheduler_Dispatch(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    PumpScheduler scheduler;
+    SyntheticSource source(state.range(0));
+    scheduler.pump(source);
+    benchmark::DoNotOptimize(source.Sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PumpScheduler_Dispatch)->Arg(1000)->Arg(100000);
+
+//! Schedule then cancel timers, as when a debounce timer is repeatedly restarted
+static void BM_PumpScheduler_ScheduleCancel(benchmark::State& state)
+{
+  PumpScheduler scheduler;
+  scheduler.schedule(hours(1), [] {});
+
+  for (auto _ : state)
+  {
+    auto id = scheduler.schedule(milliseconds(250), [] {});
+    scheduler.cancel(id);
+    benchmark::DoNotOptimize(scheduler.timeout(PumpScheduler::clock_t::now()));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PumpScheduler_ScheduleCancel);
+
+//! Expire 'n' timers which are already due
+static void BM_PumpScheduler_ExpireTimers(benchmark::State& state)
+{
+  int64_t fired = 0;
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    PumpScheduler scheduler(hours(1));
+    auto const now = PumpScheduler::clock_t::now();
+    for (int64_t i = 0; i < state.range(0); ++i)
+      scheduler.schedule(now - microseconds(i), [&fired] { ++fired; });
+    SyntheticSource source(0);
+    state.ResumeTiming();
+
+    scheduler.pump(source);
+  }
+  if (fired != state.iterations() * state.range(0))
+    state.SkipWithError("Timers did not fire");
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PumpScheduler_ExpireTimers)->Arg(64)->Arg(4096);
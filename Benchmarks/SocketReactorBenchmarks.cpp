@@ -0,0 +1,291 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Benchmarks\SocketReactorBenchmarks.cpp
+//! \brief Benchmarks for loopback echo throughput and latency of SocketReactor
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/io/FrameCodec.hpp>              //!< FrameWriter, LengthPrefixCodec
+#include <wtl/io/SocketReactor.hpp>           //!< SocketReactor
+#include <benchmark/benchmark.h>
+#include <arpa/inet.h>
+#include <netinet/tcp.h>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! Create a connected pair of blocking loopback sockets: (client, server)
+  std::pair<int,int>  loopback()
+  {
+    int const listener = ::socket(AF_INET, int(SOCK_STREAM) | int(SOCK_CLOEXEC), 0),
+              client = ::socket(AF_INET, int(SOCK_STREAM) | int(SOCK_CLOEXEC), 0),
+              one = 1;
+    ::sockaddr_in addr = {};
+    ::socklen_t length = sizeof(addr);
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (::bind(listener, reinterpret_cast<::sockaddr*>(&addr), sizeof(addr)) == -1 || ::listen(listener, 1) == -1
+     || ::getsockname(listener, reinterpret_cast<::sockaddr*>(&addr), &length) == -1
+     || ::connect(client, reinterpret_cast<::sockaddr*>(&addr), sizeof(addr)) == -1)
+      throw platform_error(HERE, "Unable to create loopback connection");
+
+    int const server = ::accept4(listener, nullptr, nullptr, int(SOCK_CLOEXEC));
+    ::close(listener);
+    ::setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    ::setsockopt(server, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    return {client, server};
+  }
+
+  //! Send every byte from a blocking socket
+  void  sendAll(int s, const uint8_t* data, size_t length)
+  {
+    for (ssize_t n; length; data += n, length -= n)
+      if ((n = ::send(s, data, length, int(MSG_NOSIGNAL))) <= 0)
+        return;
+  }
+
+  //! Receive an exact number of bytes into a blocking socket
+  void  receiveAll(int s, uint8_t* data, size_t length)
+  {
+    for (ssize_t n; length; data += n, length -= n)
+      if ((n = ::recv(s, data, length, 0)) <= 0)
+        return;
+  }
+
+  //! Receive handler which echoes data back to the peer
+  void  echo(SocketReactor::Connection& c, uint8_t* data, uint32_t length)
+  {
+    c.send(data, length);
+  }
+}
+
+//! Stream 1 MB through an echo connection in messages of 'n' bytes, reading the echo concurrently
+static void BM_SocketReactor_EchoThroughput(benchmark::State& state)
+{
+  SocketReactor reactor(uint32_t(state.range(1)));
+  auto const sockets = loopback();
+  reactor.attach(sockets.second, echo);
+
+  size_t const total = 1 << 20,
+               message = size_t(state.range(0));
+  std::vector<uint8_t> out(message, 0x5A),
+                       in(total);
+
+  for (auto _ : state)
+  {
+    std::thread sender([&] {
+      for (size_t sent = 0; sent < total; sent += message)
+        sendAll(sockets.first, out.data(), message);
+    });
+    receiveAll(sockets.first, in.data(), total);
+    sender.join();
+  }
+  state.SetBytesProcessed(state.iterations() * int64_t(total));
+  ::close(sockets.first);
+}
+BENCHMARK(BM_SocketReactor_EchoThroughput)->ArgNames({"message", "threads"})
+                                          ->Args({64, 1})->Args({4096, 1})->Args({65536, 1})->Args({4096, 4})
+                                          ->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+//! Round-trip a single message of 'n' bytes through an echo connection
+static void BM_SocketReactor_EchoLatency(benchmark::State& state)
+{
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  reactor.attach(sockets.second, echo);
+
+  std::vector<uint8_t> buffer(size_t(state.range(0)), 0x5A);
+  for (auto _ : state)
+  {
+    sendAll(sockets.first, buffer.data(), buffer.size());
+    receiveAll(sockets.first, buffer.data(), buffer.size());
+  }
+  state.SetItemsProcessed(state.iterations());
+  ::close(sockets.first);
+}
+BENCHMARK(BM_SocketReactor_EchoLatency)->Arg(64)->Arg(4096)->UseRealTime();
+
+//! Round-trip a single message through a blocking echo thread  (Baseline)
+static void BM_SocketReactor_BlockingEchoLatency(benchmark::State& state)
+{
+  auto const sockets = loopback();
+  std::thread server([s = sockets.second] {
+    uint8_t buffer[65536];
+    for (ssize_t n; (n = ::recv(s, buffer, sizeof(buffer), 0)) > 0; )
+      sendAll(s, buffer, size_t(n));
+    ::close(s);
+  });
+
+  std::vector<uint8_t> buffer(size_t(state.range(0)), 0x5A);
+  for (auto _ : state)
+  {
+    sendAll(sockets.first, buffer.data(), buffer.size());
+    receiveAll(sockets.first, buffer.data(), buffer.size());
+  }
+  state.SetItemsProcessed(state.iterations());
+  ::close(sockets.first);
+  server.join();
+}
+BENCHMARK(BM_SocketReactor_BlockingEchoLatency)->Arg(64)->Arg(4096)->UseRealTime();
+
+// -------------------------------------- SEND PATHS --------------------------------------
+
+namespace
+{
+  //! Message of 'parts' separately-owned fields of 'size' bytes, as produced by a serializer
+  std::vector<std::vector<uint8_t>>  message(const benchmark::State& state)
+  {
+    return std::vector<std::vector<uint8_t>>(size_t(state.range(0)), std::vector<uint8_t>(size_t(state.range(1)), 0x5A));
+  }
+
+  //! Total length of a message
+  size_t  length(const std::vector<std::vector<uint8_t>>& parts)
+  {
+    return parts.size() * parts.front().size();
+  }
+}
+
+//! Assemble a message into a contiguous buffer, then send it  (Baseline)
+static void BM_SocketReactor_SendContiguous(benchmark::State& state)
+{
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  auto const conn = reactor.attach(sockets.second, nullptr);
+  auto const parts = message(state);
+  std::vector<uint8_t> in(length(parts));
+
+  for (auto _ : state)
+  {
+    std::vector<uint8_t> out;
+    for (auto const& p : parts)
+      out.insert(out.end(), p.begin(), p.end());
+    conn->send(out.data(), out.size());
+    receiveAll(sockets.first, in.data(), in.size());
+  }
+  state.SetBytesProcessed(state.iterations() * int64_t(in.size()));
+  ::close(sockets.first);
+}
+BENCHMARK(BM_SocketReactor_SendContiguous)->ArgNames({"parts", "size"})->Args({16, 4096})->Args({256, 256});
+
+//! Send a message directly from its fields with a single vectored write
+static void BM_SocketReactor_SendSegments(benchmark::State& state)
+{
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  auto const conn = reactor.attach(sockets.second, nullptr);
+  auto const parts = message(state);
+  std::vector<uint8_t> in(length(parts));
+
+  for (auto _ : state)
+  {
+    std::vector<BufferSegment> segments;
+    for (auto const& p : parts)
+      segments.push_back(BufferSegment{p.data(), p.size()});
+    conn->send(segments.data(), segments.size());
+    receiveAll(sockets.first, in.data(), in.size());
+  }
+  state.SetBytesProcessed(state.iterations() * int64_t(in.size()));
+  ::close(sockets.first);
+}
+BENCHMARK(BM_SocketReactor_SendSegments)->ArgNames({"parts", "size"})->Args({16, 4096})->Args({256, 256});
+
+//! Assemble a message into pooled blocks, then transfer them to the write queue
+static void BM_SocketReactor_SendStream(benchmark::State& state)
+{
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  auto const conn = reactor.attach(sockets.second, nullptr);
+  auto const parts = message(state);
+  std::vector<uint8_t> in(length(parts));
+
+  for (auto _ : state)
+  {
+    ChunkedStream out(reactor.pool());
+    for (auto const& p : parts)
+      out.write(p.data(), p.size());
+    conn->send(std::move(out));
+    receiveAll(sockets.first, in.data(), in.size());
+  }
+  state.SetBytesProcessed(state.iterations() * int64_t(in.size()));
+  ::close(sockets.first);
+}
+BENCHMARK(BM_SocketReactor_SendStream)->ArgNames({"parts", "size"})->Args({16, 4096})->Args({256, 256});
+
+//! Send a region of a file of 'n' bytes within the kernel
+static void BM_SocketReactor_SendFile(benchmark::State& state)
+{
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  auto const conn = reactor.attach(sockets.second, nullptr);
+
+  char path[] = "/tmp/wtl_bench_XXXXXX";
+  int const file = ::mkstemp(path);
+  ::unlink(path);
+  std::vector<uint8_t> in(size_t(state.range(0)), 0x5A);
+  if (file == -1 || ::write(file, in.data(), in.size()) != ssize_t(in.size()))
+  {
+    state.SkipWithError("Unable to create temporary file");
+    return;
+  }
+
+  for (auto _ : state)
+  {
+    conn->sendFile(::dup(file), 0, in.size());
+    receiveAll(sockets.first, in.data(), in.size());
+  }
+  state.SetBytesProcessed(state.iterations() * int64_t(in.size()));
+  ::close(file);
+  ::close(sockets.first);
+}
+BENCHMARK(BM_SocketReactor_SendFile)->Arg(65536);
+
+// ------------------------------------ FRAME BATCHING ------------------------------------
+
+//! Send 64 small length-prefixed frames, each with its own write  (Baseline)
+static void BM_SocketReactor_SendEachFrame(benchmark::State& state)
+{
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  auto const conn = reactor.attach(sockets.second, nullptr);
+  LengthPrefixCodec<> codec;
+  std::vector<uint8_t> frame(4 + size_t(state.range(0)), 0x5A),
+                       in(64 * frame.size());
+  codec.header(frame.size() - 4, frame.data());
+
+  for (auto _ : state)
+  {
+    for (int i = 0; i < 64; ++i)
+      conn->send(frame.data(), frame.size());
+    receiveAll(sockets.first, in.data(), in.size());
+  }
+  state.SetItemsProcessed(state.iterations() * 64);
+  ::close(sockets.first);
+}
+BENCHMARK(BM_SocketReactor_SendEachFrame)->Arg(64);
+
+//! Batch 64 small length-prefixed frames, then send them with a single write
+static void BM_SocketReactor_SendFrameBatch(benchmark::State& state)
+{
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  auto const conn = reactor.attach(sockets.second, nullptr);
+  FrameWriter<LengthPrefixCodec<>> writer(reactor.pool());
+  std::vector<uint8_t> const payload(size_t(state.range(0)), 0x5A);
+  std::vector<uint8_t> in(64 * (4 + payload.size()));
+
+  for (auto _ : state)
+  {
+    for (int i = 0; i < 64; ++i)
+      writer.write(payload.data(), payload.size());
+    writer.flush(*conn);
+    receiveAll(sockets.first, in.data(), in.size());
+  }
+  state.SetItemsProcessed(state.iterations() * 64);
+  ::close(sockets.first);
+}
+BENCHMARK(BM_SocketReactor_SendFrameBatch)->Arg(64);
@@ -0,0 +1,89 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Benchmarks\ThreadPoolBenchmarks.cpp
+//! \brief Benchmarks for ThreadPool tasks, nested waits and parallel loops
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/threads/ThreadPool.hpp>         //!< ThreadPool
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace wtl;
+
+//! Round trip of a trivial task posted and awaited from a non-worker thread
+static void BM_ThreadPool_AsyncGet(benchmark::State& state)
+{
+  ThreadPool pool(static_cast<uint32_t>(state.range(0)));
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(pool.async([] { return 1; }).get());
+}
+BENCHMARK(BM_ThreadPool_AsyncGet)->Arg(1)->Arg(4)->UseRealTime();
+
+//! Task which spawns and awaits 'n' children upon the pool  (Waiting workers execute the children)
+static void BM_ThreadPool_NestedTasks(benchmark::State& state)
+{
+  ThreadPool pool(4);
+  int64_t const children = state.range(0);
+
+  for (auto _ : state)
+  {
+    auto parent = pool.async([&pool, children]
+    {
+      std::vector<Task<int64_t>> tasks;
+      for (int64_t i = 0; i < children; ++i)
+        tasks.push_back(pool.async([i] { return i; }));
+
+      int64_t sum = 0;
+      for (auto& t : tasks)
+        sum += t.get();
+      return sum;
+    });
+    benchmark::DoNotOptimize(parent.get());
+  }
+  state.SetItemsProcessed(state.iterations() * children);
+}
+BENCHMARK(BM_ThreadPool_NestedTasks)->Arg(16)->Arg(256)->UseRealTime();
+
+//! Sum a large array with parallel_for
+static void BM_ThreadPool_ParallelFor(benchmark::State& state)
+{
+  ThreadPool pool(4);
+  std::vector<int64_t> values(1 << 20);
+  std::iota(values.begin(), values.end(), 0);
+  uint32_t const grain = static_cast<uint32_t>(state.range(0));
+
+  for (auto _ : state)
+  {
+    std::atomic<int64_t> total{0};
+    pool.parallel_for<uint32_t>(0, static_cast<uint32_t>(values.size()) / grain, [&] (uint32_t chunk)
+    {
+      int64_t sum = 0;
+      for (uint32_t i = chunk * grain, end = i + grain; i < end; ++i)
+        sum += values[i];
+      total.fetch_add(sum, std::memory_order_relaxed);
+    });
+    benchmark::DoNotOptimize(total.load());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values.size()));
+}
+BENCHMARK(BM_ThreadPool_ParallelFor)->Arg(1024)->Arg(16384)->UseRealTime();
+
+//! Non-worker waits upon work lasting 1ms; reports CPU consumed by the waiter  (Parking keeps it near zero)
+static void BM_ThreadPool_ExternalWaitCpu(benchmark::State& state)
+{
+  ThreadPool pool(1);
+
+  for (auto _ : state)
+  {
+    std::atomic<bool> done{false};
+    pool.post([&done] { std::this_thread::sleep_for(std::chrono::milliseconds(1)); done = true; });
+    pool.wait([&done] { return done.load(); });
+  }
+}
+BENCHMARK(BM_ThreadPool_ExternalWaitCpu)->UseRealTime()->Unit(benchmark::kMicrosecond);
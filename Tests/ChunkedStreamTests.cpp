@@ -0,0 +1,192 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\ChunkedStreamTests.cpp
+//! \brief Unit tests for SocketBufferPool and ChunkedStream
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/io/BinaryWriter.hpp>            //!< BinaryWriter
+#include <wtl/io/ChunkedStream.hpp>           //!< ChunkedStream, SocketBufferPool
+#include <gtest/gtest.h>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! Concatenate the segments of a stream
+  std::vector<byte>  flatten(const ChunkedStream& s)
+  {
+    std::vector<byte> out;
+    s.segments([&out] (const BufferSegment& seg) { out.insert(out.end(), seg.Data, seg.Data + seg.Length); });
+    return out;
+  }
+
+  //! Count the segments of a stream
+  size_t  count(const ChunkedStream& s)
+  {
+    size_t n = 0;
+    s.segments([&n] (const BufferSegment&) { ++n; });
+    return n;
+  }
+
+  //! Generate recognisable data
+  std::vector<byte>  pattern(size_t length)
+  {
+    std::vector<byte> data(length);
+    for (size_t i = 0; i < length; ++i)
+      data[i] = static_cast<byte>(i * 31 + (i >> 8));
+    return data;
+  }
+}
+
+// ---------------------------------- SOCKET BUFFER POOL ----------------------------------
+
+TEST(SocketBufferPool, RejectsZeroSizes)
+{
+  EXPECT_THROW(SocketBufferPool(0), invalid_argument);
+  EXPECT_THROW(SocketBufferPool(4096, 0), invalid_argument);
+}
+
+TEST(SocketBufferPool, AllocatesWholeSlabs)
+{
+  SocketBufferPool pool(512, 4);
+  EXPECT_EQ(0u, pool.allocated()) << "nothing allocated until first use";
+
+  std::vector<SocketBufferPool::Block*> blocks;
+  for (int i = 0; i < 5; ++i)
+    blocks.push_back(pool.acquire());
+
+  EXPECT_EQ(8u, pool.allocated());
+  EXPECT_EQ(5u, pool.used());
+  EXPECT_EQ(512u, pool.capacity());
+  for (auto* b : blocks)
+  {
+    EXPECT_EQ(nullptr, b->Next);
+    EXPECT_EQ(0u, b->Begin);
+    EXPECT_EQ(0u, b->End);
+    pool.release(b);
+  }
+  EXPECT_EQ(0u, pool.used());
+}
+
+TEST(SocketBufferPool, RecyclesReleasedBlocks)
+{
+  SocketBufferPool pool(512, 4);
+  SocketBufferPool::Block* const first = pool.acquire();
+  pool.release(first);
+
+  EXPECT_EQ(first, pool.acquire());
+  EXPECT_EQ(4u, pool.allocated());
+}
+
+TEST(SocketBufferPool, ReleasesChains)
+{
+  SocketBufferPool pool(512, 4);
+  SocketBufferPool::Block* const head = pool.acquire();
+  head->Next = pool.acquire();
+  head->Next->Next = pool.acquire();
+  ASSERT_EQ(3u, pool.used());
+
+  pool.release(head);
+  pool.release(nullptr);
+  EXPECT_EQ(0u, pool.used());
+}
+
+// ------------------------------------ CHUNKED STREAM ------------------------------------
+
+TEST(ChunkedStream, RejectsMissingPool)
+{
+  EXPECT_THROW(ChunkedStream(nullptr), invalid_argument);
+}
+
+TEST(ChunkedStream, AppendsBlocksAsNecessary)
+{
+  auto pool = std::make_shared<SocketBufferPool>(1024);
+  ChunkedStream s(pool);
+  std::vector<byte> const data = pattern(2500);
+
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(0u, count(s));
+
+  s.write(data.data(), 1000);
+  s.write(data.data() + 1000, 1499);
+  s.put(data.back());
+
+  EXPECT_EQ(data.size(), s.size());
+  EXPECT_EQ(3u, count(s)) << "blocks are filled before another is appended";
+  EXPECT_EQ(3u, pool->used());
+  EXPECT_EQ(data, flatten(s));
+}
+
+TEST(ChunkedStream, WritesThroughBinaryWriter)
+{
+  BinaryWriter<ChunkedStream> w(std::make_shared<SocketBufferPool>(16));
+  for (int32_t i = 0; i < 10; ++i)
+    w << i;
+
+  std::vector<byte> const out = flatten(w.stream());
+  ASSERT_EQ(40u, out.size());
+  for (int32_t i = 0; i < 10; ++i)
+    EXPECT_EQ(0, std::memcmp(&i, &out[i * 4], 4)) << "value " << i;
+}
+
+TEST(ChunkedStream, ReleasesBlocksWhenClearedOrDestroyed)
+{
+  auto pool = std::make_shared<SocketBufferPool>(256);
+  {
+    ChunkedStream s(pool);
+    s.write(pattern(1000).data(), 1000);
+    EXPECT_EQ(4u, pool->used());
+
+    s.clear();
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(0u, pool->used());
+
+    s.write(pattern(300).data(), 300);
+    EXPECT_EQ(2u, pool->used());
+  }
+  EXPECT_EQ(0u, pool->used());
+}
+
+TEST(ChunkedStream, MovesBlocksWithoutCopying)
+{
+  auto pool = std::make_shared<SocketBufferPool>(256);
+  std::vector<byte> const data = pattern(600);
+  ChunkedStream a(pool);
+  a.write(data.data(), data.size());
+
+  ChunkedStream b(std::move(a));
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(data, flatten(b));
+  EXPECT_EQ(3u, pool->used());
+
+  ChunkedStream c(pool);
+  c.put(1);
+  c = std::move(b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(data, flatten(c));
+  EXPECT_EQ(3u, pool->used()) << "existing blocks are released by assignment";
+}
+
+TEST(ChunkedStream, DetachesChain)
+{
+  auto pool = std::make_shared<SocketBufferPool>(256);
+  ChunkedStream s(pool);
+  s.write(pattern(600).data(), 600);
+
+  ChunkedStream::block_t* chain = s.detach();
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(3u, pool->used()) << "caller owns detached blocks";
+
+  size_t length = 0;
+  for (auto* b = chain; b; b = b->Next)
+    length += b->End - b->Begin;
+  EXPECT_EQ(600u, length);
+
+  pool->release(chain);
+  EXPECT_EQ(0u, pool->used());
+}
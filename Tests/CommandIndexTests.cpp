@@ -0,0 +1,143 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\CommandIndexTests.cpp
+//! \brief Unit tests for CommandIndex
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/windows/CommandIndex.hpp>       //!< CommandIndex
+#include <gtest/gtest.h>
+#include <memory>
+
+using namespace wtl;
+
+namespace
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct StubCommand - Command providing only an identifier
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct StubCommand
+  {
+    CommandId  Ident;
+
+    CommandId  ident() const    { return Ident; }
+  };
+
+  //! \struct Owner - Command owner  (eg. group or popup menu)
+  struct Owner {};
+
+  //! \alias index_t - Index of stub commands
+  using index_t = CommandIndex<Encoding::UTF16,Owner,StubCommand>;
+
+  //! Create a stub command
+  std::shared_ptr<StubCommand>  command(uint16_t id)
+  {
+    return std::make_shared<StubCommand>(StubCommand{command_id(id)});
+  }
+}
+
+// --------------------------------------- LOOKUP ---------------------------------------
+
+TEST(CommandIndex, FindsCommandAndOwner)
+{
+  index_t index;
+  Owner group;
+  auto cmd = command(0xE101);
+
+  index.insert(cmd, &group);
+  EXPECT_EQ(cmd, index.find(command_id(0xE101)));
+  EXPECT_EQ(&group, index.owner(command_id(0xE101)));
+  EXPECT_EQ(1u, index.size());
+}
+
+TEST(CommandIndex, MissesAbsentCommands)
+{
+  index_t index;
+  Owner group;
+  index.insert(command(0xE101), &group);
+
+  EXPECT_FALSE(index.find(command_id(0xE102))) << "same page";
+  EXPECT_FALSE(index.find(command_id(0x0101))) << "unallocated page";
+  EXPECT_EQ(nullptr, index.owner(command_id(0xE102)));
+}
+
+TEST(CommandIndex, IndexesEveryPage)
+{
+  index_t index;
+  Owner group;
+  for (uint32_t id : {0x0000u, 0x00FFu, 0x0100u, 0xE100u, 0xFFFFu})
+    index.insert(command(uint16_t(id)), &group);
+
+  EXPECT_EQ(5u, index.size());
+  for (uint32_t id : {0x0000u, 0x00FFu, 0x0100u, 0xE100u, 0xFFFFu})
+    EXPECT_EQ(id, enum_cast(index.find(command_id(id))->ident()));
+}
+
+// -------------------------------------- MUTATION --------------------------------------
+
+TEST(CommandIndex, OverwriteReplacesCommandAndOwnerWithoutCounting)
+{
+  index_t index;
+  Owner first, second;
+  auto replacement = command(0xE101);
+
+  index.insert(command(0xE101), &first);
+  index.insert(replacement, &second);
+  EXPECT_EQ(1u, index.size());
+  EXPECT_EQ(replacement, index.find(command_id(0xE101)));
+  EXPECT_EQ(&second, index.owner(command_id(0xE101)));
+}
+
+TEST(CommandIndex, EraseRequiresOwner)
+{
+  index_t index;
+  Owner first, second;
+  index.insert(command(0xE101), &first);
+  index.insert(command(0xE101), &second);
+
+  EXPECT_FALSE(index.erase(command_id(0xE101), &first)) << "overwritten by another owner";
+  EXPECT_EQ(1u, index.size());
+  EXPECT_TRUE(index.find(command_id(0xE101)));
+
+  EXPECT_TRUE(index.erase(command_id(0xE101), &second));
+  EXPECT_EQ(0u, index.size());
+  EXPECT_FALSE(index.find(command_id(0xE101)));
+  EXPECT_FALSE(index.erase(command_id(0xE101), &second)) << "already erased";
+  EXPECT_EQ(0u, index.size());
+}
+
+TEST(CommandIndex, ReinsertAfterEraseCounts)
+{
+  index_t index;
+  Owner group;
+  index.insert(command(0xE101), &group);
+  index.erase(command_id(0xE101), &group);
+  index.insert(command(0xE101), &group);
+  EXPECT_EQ(1u, index.size());
+}
+
+TEST(CommandIndex, ClearRemovesEverything)
+{
+  index_t index;
+  Owner group;
+  index.insert(command(0x0001), &group);
+  index.insert(command(0xE101), &group);
+
+  index.clear();
+  EXPECT_EQ(0u, index.size());
+  EXPECT_FALSE(index.find(command_id(0xE101)));
+}
+
+TEST(CommandIndex, MovesEntries)
+{
+  index_t index;
+  Owner group;
+  auto cmd = command(0xE101);
+  index.insert(cmd, &group);
+
+  index_t moved(std::move(index));
+  EXPECT_EQ(cmd, moved.find(command_id(0xE101)));
+  EXPECT_EQ(&group, moved.owner(command_id(0xE101)));
+  EXPECT_EQ(1u, moved.size());
+}
@@ -0,0 +1,123 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\ConcurrentEventTests.cpp
+//! \brief Unit tests for ConcurrentEvent and EpochDomain
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/windows/ConcurrentEvent.hpp>    //!< ConcurrentEvent
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! Event subscriber
+  struct Counter
+  {
+    std::atomic<int32_t>  Total{0};
+
+    void  onEvent(int value)    { Total += value; }
+    int   onQuery(int value)    { return Total += value; }
+  };
+
+  //! Subscriber which unsubscribes itself when first notified
+  struct OneShot
+  {
+    ConcurrentEvent<void,int>*  Source = nullptr;
+    LPARAM                      Cookie = 0;
+    int32_t                     Calls = 0;
+
+    void  onEvent(int)    { ++Calls; *Source -= Cookie; }
+  };
+}
+
+TEST(ConcurrentEvent, RaisesSubscribersInOrderAndReturnsLastResult)
+{
+  EpochDomain domain;
+  ConcurrentEvent<int,int> event(domain);
+  Counter a, b;
+
+  EXPECT_EQ(0, event.raise(1));
+  event += new Delegate<int,int>(&a, &Counter::onQuery);
+  event += new Delegate<int,int>(&b, &Counter::onQuery);
+
+  EXPECT_EQ(5, event.raise(5));
+  EXPECT_EQ(5, a.Total);
+  EXPECT_EQ(5, b.Total);
+}
+
+TEST(ConcurrentEvent, UnsubscribeReclaimsDelegateImmediately)
+{
+  EpochDomain domain;
+  ConcurrentEvent<void,int> event(domain);
+  Counter c;
+
+  LPARAM first = event += new Delegate<void,int>(&c, &Counter::onEvent);
+  LPARAM second = event += new Delegate<void,int>(&c, &Counter::onEvent);
+  event.raise(1);
+
+  event -= first;
+  EXPECT_EQ(0u, domain.pending());
+  event -= second;
+  EXPECT_EQ(0u, domain.pending());
+  EXPECT_TRUE(event.empty());
+
+  event.raise(1);
+  EXPECT_EQ(2, c.Total);
+}
+
+TEST(ConcurrentEvent, HandlerMayUnsubscribeItself)
+{
+  EpochDomain domain;
+  ConcurrentEvent<void,int> event(domain);
+  OneShot shot;
+  shot.Source = &event;
+  shot.Cookie = event += new Delegate<void,int>(&shot, &OneShot::onEvent);
+
+  event.raise(1);
+  event.raise(1);
+
+  EXPECT_EQ(1, shot.Calls);
+  EXPECT_TRUE(event.empty());
+  EXPECT_EQ(0u, domain.pending());      // Reclaimed when the raise left its read section
+}
+
+TEST(ConcurrentEvent, ConcurrentRaiseAndSubscribe)
+{
+  EpochDomain domain;
+  ConcurrentEvent<void,int> event(domain);
+  Counter c;
+  std::atomic<bool> stop{false};
+
+  std::vector<std::thread> raisers;
+  for (int i = 0; i < 4; ++i)
+    raisers.emplace_back([&] { while (!stop) event.raise(1); });
+
+  for (int i = 0; i < 2000; ++i)
+    event -= (event += new Delegate<void,int>(&c, &Counter::onEvent));
+
+  stop = true;
+  for (auto& t : raisers)
+    t.join();
+
+  EXPECT_TRUE(event.empty());
+  EXPECT_EQ(0u, domain.pending());
+}
+
+TEST(EpochDomain, SynchronizeWithinReadSectionDefers)
+{
+  EpochDomain domain;
+  {
+    EpochGuard section(domain);
+    domain.retire(new int(1));
+    EXPECT_FALSE(domain.synchronize());
+    EXPECT_EQ(1u, domain.pending());
+  }
+  EXPECT_TRUE(domain.synchronize());
+  EXPECT_EQ(0u, domain.pending());
+}
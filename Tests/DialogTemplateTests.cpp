@@ -0,0 +1,202 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\DialogTemplateTests.cpp
+//! \brief Unit tests for DialogTemplate
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/resources/DialogTemplate.hpp>   //!< DialogTemplate
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct TemplateBuilder - Writes standard and extended dialog templates
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct TemplateBuilder
+  {
+    std::vector<uint8_t>  Bytes;
+    bool                  Extended;
+
+    explicit TemplateBuilder(bool extended) : Extended(extended)
+    {}
+
+    void  u8(uint8_t v)     { Bytes.push_back(v); }
+    void  u16(uint16_t v)   { u8(uint8_t(v)); u8(uint8_t(v >> 8)); }
+    void  u32(uint32_t v)   { u16(uint16_t(v)); u16(uint16_t(v >> 16)); }
+
+    void  str(const char16_t* s)
+    {
+      for (; *s; ++s)
+        u16(*s);
+      u16(0);
+    }
+
+    void  ord(uint16_t v)   { u16(0xFFFF); u16(v); }
+    void  align()           { while (Bytes.size() % 4) u8(0); }
+
+    void  rect(int16_t x, int16_t y, int16_t cx, int16_t cy)
+    {
+      u16(x); u16(y); u16(cx); u16(cy);
+    }
+
+    //! Write header with an ordinal menu, default class and font
+    void  header(uint32_t style, uint16_t items, const char16_t* title)
+    {
+      if (Extended)
+      {
+        u16(1); u16(0xFFFF);
+        u32(42);              // Help id
+        u32(0x00000100);      // WS_EX_WINDOWEDGE
+        u32(style);
+      }
+      else
+      {
+        u32(style);
+        u32(0x00000100);
+      }
+      u16(items);
+      rect(10, 20, 200, 100);
+      ord(101);               // Menu
+      u16(0);                 // Default class
+      str(title);
+
+      if (style & DS_SETFONT)
+      {
+        u16(9);
+        if (Extended)
+        {
+          u16(700); u8(1); u8(0);
+        }
+        str(u"MS Shell Dlg");
+      }
+    }
+
+    //! Write item with a predefined or named class
+    void  item(uint32_t id, uint16_t atom, const char16_t* name, const char16_t* text, uint16_t extra = 0)
+    {
+      align();
+      if (Extended)
+      {
+        u32(7); u32(0); u32(0x50010000);
+      }
+      else
+      {
+        u32(0x50010000); u32(0);
+      }
+      rect(5, 5, 50, 14);
+      if (Extended)
+        u32(id);
+      else
+        u16(uint16_t(id));
+
+      if (name)
+        str(name);
+      else
+        ord(atom);
+      str(text);
+
+      u16(extra);
+      for (uint16_t b = 0; b < extra; ++b)
+        u8(uint8_t(b));
+    }
+  };
+
+  //! Convert a template string to std::u16string
+  std::u16string  text(const DialogString& s)
+  {
+    return s.Text ? std::u16string(s.Text, s.Length) : std::u16string();
+  }
+}
+
+TEST(DialogTemplate, ParsesStandardTemplate)
+{
+  TemplateBuilder b(false);
+  b.header(DS_SETFONT, 2, u"Options");
+  b.item(1, 0x0080, nullptr, u"OK");
+  b.item(1001, 0, u"SysListView32", u"", 3);
+
+  DialogTemplate const dlg(b.Bytes.data(), uint32_t(b.Bytes.size()));
+
+  EXPECT_FALSE(dlg.Extended);
+  EXPECT_EQ(0u, dlg.HelpId);
+  EXPECT_EQ(Rect<int16_t>(10, 20, 210, 120), dlg.Position);
+  EXPECT_TRUE(dlg.Menu.isOrdinal());
+  EXPECT_EQ(101u, dlg.Menu.Ordinal);
+  EXPECT_TRUE(dlg.WndClass.empty());
+  EXPECT_EQ(u"Options", text(dlg.Title));
+  EXPECT_EQ(9u, dlg.PointSize);
+  EXPECT_EQ(u"MS Shell Dlg", text(dlg.Typeface));
+
+  ASSERT_EQ(2u, dlg.size());
+  EXPECT_EQ(1u, dlg[0].Ident);
+  EXPECT_EQ(std::u16string(u"Button"), dlg[0].className());
+  EXPECT_EQ(u"OK", text(dlg[0].Text));
+  EXPECT_EQ(nullptr, dlg[0].CreateData);
+
+  EXPECT_EQ(1001u, dlg[1].Ident);
+  EXPECT_EQ(std::u16string(u"SysListView32"), dlg[1].className());
+  ASSERT_EQ(3u, dlg[1].CreateLength);
+  EXPECT_EQ(2u, dlg[1].CreateData[2]);
+}
+
+TEST(DialogTemplate, ParsesExtendedTemplate)
+{
+  TemplateBuilder b(true);
+  b.header(DS_SETFONT, 1, u"Find");
+  b.item(70000, 0x0081, nullptr, u"");
+
+  DialogTemplate const dlg(b.Bytes.data(), uint32_t(b.Bytes.size()));
+
+  EXPECT_TRUE(dlg.Extended);
+  EXPECT_EQ(42u, dlg.HelpId);
+  EXPECT_EQ(700u, dlg.Weight);
+  EXPECT_TRUE(dlg.Italic);
+  EXPECT_EQ(u"MS Shell Dlg", text(dlg.Typeface));
+
+  ASSERT_EQ(1u, dlg.size());
+  EXPECT_EQ(7u, dlg[0].HelpId);
+  EXPECT_EQ(70000u, dlg[0].Ident);
+  EXPECT_EQ(std::u16string(u"Edit"), dlg[0].className());
+}
+
+TEST(DialogTemplate, OmitsFontUnlessRequested)
+{
+  TemplateBuilder b(false);
+  b.header(0, 0, u"");
+
+  DialogTemplate const dlg(b.Bytes.data(), uint32_t(b.Bytes.size()));
+
+  EXPECT_EQ(0u, dlg.PointSize);
+  EXPECT_TRUE(dlg.Typeface.empty());
+  EXPECT_EQ(0u, dlg.size());
+  EXPECT_EQ(dlg.begin(), dlg.end());
+}
+
+TEST(DialogTemplate, RejectsTruncatedTemplate)
+{
+  TemplateBuilder b(true);
+  b.header(DS_SETFONT, 2, u"Truncated");
+  b.item(1, 0x0080, nullptr, u"OK", 8);
+  b.item(2, 0x0080, nullptr, u"Cancel");
+
+  // Every proper prefix is rejected
+  for (size_t length = 0; length < b.Bytes.size(); ++length)
+    EXPECT_THROW(DialogTemplate(b.Bytes.data(), uint32_t(length)), domain_error) << length;
+}
+
+TEST(DialogTemplate, RejectsUnrecognisedClassOrdinal)
+{
+  TemplateBuilder b(false);
+  b.header(0, 1, u"");
+  b.item(1, 0x0099, nullptr, u"");
+
+  DialogTemplate const dlg(b.Bytes.data(), uint32_t(b.Bytes.size()));
+
+  EXPECT_THROW(dlg[0].className(), domain_error);
+}
@@ -0,0 +1,201 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\DispatchTraceTests.cpp
+//! \brief Unit tests for LatencyHistogram and DispatchTrace
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/utils/DispatchTrace.hpp>        //!< DispatchTrace, LatencyHistogram
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace wtl;
+
+namespace
+{
+  //! Reset the process-wide trace to its default state
+  DispatchTrace&  resetTrace()
+  {
+    DispatchTrace& trace = DispatchTrace::instance();
+    trace.flush();
+    trace.clear();
+    trace.Timeline = true;
+    trace.MaxEvents = 1u << 20;
+    return trace;
+  }
+}
+
+// ---------------------------------- LATENCY HISTOGRAM ---------------------------------
+
+TEST(LatencyHistogram, RecordsSmallValuesExactly)
+{
+  for (uint64_t ns = 0; ns < LatencyHistogram::subBuckets; ++ns)
+  {
+    EXPECT_EQ(ns, LatencyHistogram::bucket(ns));
+    EXPECT_EQ(ns, LatencyHistogram::upperBound(static_cast<uint32_t>(ns)));
+  }
+}
+
+TEST(LatencyHistogram, BucketBoundariesAreContiguous)
+{
+  // Each bucket begins immediately after the upper bound of its predecessor
+  for (uint32_t idx = 0; idx + 1 < LatencyHistogram::buckets; ++idx)
+  {
+    uint64_t const upper = LatencyHistogram::upperBound(idx);
+    ASSERT_EQ(idx, LatencyHistogram::bucket(upper)) << "upper bound of bucket " << idx;
+    ASSERT_EQ(idx + 1, LatencyHistogram::bucket(upper + 1)) << "lower bound of bucket " << idx + 1;
+  }
+}
+
+TEST(LatencyHistogram, SplitsEachPowerOfTwoIntoEightBuckets)
+{
+  EXPECT_EQ(8u, LatencyHistogram::bucket(8));
+  EXPECT_EQ(15u, LatencyHistogram::bucket(15));
+  EXPECT_EQ(16u, LatencyHistogram::bucket(16));
+  EXPECT_EQ(16u, LatencyHistogram::bucket(17));
+  EXPECT_EQ(17u, LatencyHistogram::bucket(18));
+  EXPECT_EQ(23u, LatencyHistogram::bucket(31));
+  EXPECT_EQ(24u, LatencyHistogram::bucket(32));
+  EXPECT_EQ(24u, LatencyHistogram::bucket(35));
+  EXPECT_EQ(25u, LatencyHistogram::bucket(36));
+}
+
+TEST(LatencyHistogram, CoversTheFullRange)
+{
+  EXPECT_EQ(LatencyHistogram::buckets - 1, LatencyHistogram::bucket(UINT64_MAX));
+  EXPECT_EQ(UINT64_MAX, LatencyHistogram::upperBound(LatencyHistogram::buckets - 1));
+}
+
+TEST(LatencyHistogram, BoundsRelativeErrorOfBuckets)
+{
+  // Upper bound never exceeds the value by more than 1/8th
+  for (uint64_t ns = 1; ns < (1ull << 40); ns = ns * 3 + 1)
+  {
+    uint64_t const upper = LatencyHistogram::upperBound(LatencyHistogram::bucket(ns));
+    ASSERT_GE(upper, ns);
+    ASSERT_LE(static_cast<double>(upper - ns), ns / 8.0) << ns;
+  }
+}
+
+TEST(LatencyHistogram, ReportsPercentilesWithinBucketPrecision)
+{
+  LatencyHistogram h;
+  for (uint64_t ns = 1; ns <= 1000; ++ns)
+    h.record(ns);
+
+  EXPECT_EQ(1000u, h.Count);
+  EXPECT_EQ(1u, h.Min);
+  EXPECT_EQ(1000u, h.Max);
+  EXPECT_EQ(500u, h.mean());
+  EXPECT_GE(h.percentile(50), 500u);
+  EXPECT_LE(h.percentile(50), 500u + 500u / 8);
+  EXPECT_GE(h.percentile(99), 990u);
+  EXPECT_LE(h.percentile(99), 1000u);
+  EXPECT_EQ(1000u, h.percentile(100));
+}
+
+TEST(LatencyHistogram, EmptyHistogramReportsZero)
+{
+  LatencyHistogram h;
+  EXPECT_EQ(0u, h.mean());
+  EXPECT_EQ(0u, h.percentile(50));
+}
+
+TEST(LatencyHistogram, MergeCombinesCountsAndExtremes)
+{
+  LatencyHistogram a, b;
+  a.record(10);
+  a.record(20);
+  b.record(5);
+  b.record(4000);
+
+  a.merge(b);
+
+  EXPECT_EQ(4u, a.Count);
+  EXPECT_EQ(4035u, a.Sum);
+  EXPECT_EQ(5u, a.Min);
+  EXPECT_EQ(4000u, a.Max);
+  EXPECT_EQ(1u, a.Counts[LatencyHistogram::bucket(4000)]);
+}
+
+// ----------------------------------- DISPATCH TRACE -----------------------------------
+
+TEST(DispatchTrace, AggregatesStagesMessagesAndHandlers)
+{
+  DispatchTrace& trace = resetTrace();
+  static const char handler[] = "Handler";
+
+  trace.record(TraceCategory::WndProc, 0x0f, nullptr, 100, 300);
+  trace.record(TraceCategory::WndProc, 0x0f, nullptr, 400, 500);
+  trace.record(TraceCategory::Handler, 0x1234, handler, 150, 250);
+  trace.flush();
+
+  TraceStatistics const stats = trace.statistics();
+  EXPECT_EQ(2u, stats.Categories[static_cast<uint32_t>(TraceCategory::WndProc)].Count);
+  EXPECT_EQ(1u, stats.Categories[static_cast<uint32_t>(TraceCategory::Handler)].Count);
+  ASSERT_EQ(1u, stats.Messages.count(0x0f));
+  EXPECT_EQ(300u, stats.Messages.at(0x0f).Sum);
+  ASSERT_EQ(1u, stats.Handlers.count(0x1234));
+  EXPECT_EQ(1u, stats.Handlers.at(0x1234).Calls);
+  EXPECT_EQ(100u, stats.Handlers.at(0x1234).Longest);
+  EXPECT_EQ(3u, stats.Events.size());
+}
+
+TEST(DispatchTrace, MergesBuffersAtThreadExit)
+{
+  DispatchTrace& trace = resetTrace();
+
+  std::thread([&trace] { trace.record(TraceCategory::Route, 7, nullptr, 0, 10); }).join();
+
+  EXPECT_EQ(1u, trace.statistics().Categories[static_cast<uint32_t>(TraceCategory::Route)].Count);
+}
+
+TEST(DispatchTrace, DropsTimelineBeyondCapacity)
+{
+  DispatchTrace& trace = resetTrace();
+  trace.MaxEvents = 2;
+
+  for (uint64_t i = 0; i < 5; ++i)
+    trace.record(TraceCategory::Lookup, 1, nullptr, i, i + 1);
+  trace.flush();
+
+  TraceStatistics const stats = trace.statistics();
+  EXPECT_EQ(2u, stats.Events.size());
+  EXPECT_EQ(5u, stats.Categories[static_cast<uint32_t>(TraceCategory::Lookup)].Count);
+
+  std::ostringstream report;
+  trace.writeReport(report);
+  EXPECT_NE(std::string::npos, report.str().find("3 timeline entries dropped"));
+  resetTrace();
+}
+
+TEST(DispatchTrace, OmitsTimelineWhenDisabled)
+{
+  DispatchTrace& trace = resetTrace();
+  trace.Timeline = false;
+
+  trace.record(TraceCategory::Event, 1, nullptr, 0, 10);
+  trace.flush();
+
+  EXPECT_TRUE(trace.statistics().Events.empty());
+  EXPECT_EQ(1u, trace.statistics().Categories[static_cast<uint32_t>(TraceCategory::Event)].Count);
+  resetTrace();
+}
+
+TEST(DispatchTrace, WritesEscapedChromeTrace)
+{
+  DispatchTrace& trace = resetTrace();
+  static const char handler[] = "Handler<\"quoted\">";
+
+  trace.record(TraceCategory::Handler, 1, handler, 1500, 4250);
+  trace.flush();
+
+  std::ostringstream out;
+  trace.writeChromeTrace(out);
+  std::string const json = out.str();
+  EXPECT_NE(std::string::npos, json.find("\"name\":\"Handler<\\\"quoted\\\">\""));
+  EXPECT_NE(std::string::npos, json.find("\"ts\":1.500,\"dur\":2.750"));
+}
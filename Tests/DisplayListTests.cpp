@@ -0,0 +1,209 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\DisplayListTests.cpp
+//! \brief Unit tests for DamageRegion and DisplayList
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/gdi/DisplayList.hpp>            //!< DisplayList, DamageRegion
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! Surface recording the commands replayed within each damaged rectangle
+  struct RecordingSurface : IDisplaySurface
+  {
+    std::vector<RectL>          Clips;
+    std::vector<DisplayOp>      Ops;
+    std::vector<std::string>    Texts;
+
+    void  begin(const RectL& damage) override   { Clips.push_back(damage); }
+    void  end() override                        {}
+
+    void  execute(const DisplayCommand& cmd, const void* text) override
+    {
+      Ops.push_back(cmd.Op);
+      Texts.emplace_back(text ? static_cast<const char*>(text) : "", cmd.TextLength);
+    }
+  };
+
+  //! Record a row of 'n' filled cells, 10 pixels wide
+  DisplayList  cells(int32_t n, uintptr_t brush = 1)
+  {
+    DisplayList list;
+    for (int32_t i = 0; i < n; ++i)
+      list.record(DisplayList::command(DisplayOp::Fill, RectL(i*10, 0, i*10+10, 10), brush));
+    return list;
+  }
+}
+
+// ------------------------------------ DAMAGE REGION -----------------------------------
+
+TEST(DamageRegion, IgnoresEmptyRectangles)
+{
+  DamageRegion region;
+  region.add(RectL(10, 10, 10, 20));
+  region.add(RectL(10, 10, 5, 5));
+
+  EXPECT_TRUE(region.empty());
+  EXPECT_EQ(RectL::EMPTY, region.bounds());
+}
+
+TEST(DamageRegion, MergesOverlappingRectangles)
+{
+  DamageRegion region;
+  region.add(RectL(0, 0, 10, 10));
+  region.add(RectL(20, 0, 30, 10));
+  region.add(RectL(5, 0, 25, 10));      // Bridges both
+
+  ASSERT_EQ(1u, region.size());
+  EXPECT_EQ(RectL(0, 0, 30, 10), *region.begin());
+  EXPECT_EQ(300u, region.area());
+}
+
+TEST(DamageRegion, KeepsDisjointRectanglesSeparate)
+{
+  DamageRegion region;
+  region.add(RectL(0, 0, 10, 10));
+  region.add(RectL(10, 0, 20, 10));     // Adjacent, not overlapping
+
+  EXPECT_EQ(2u, region.size());
+  EXPECT_EQ(RectL(0, 0, 20, 10), region.bounds());
+  EXPECT_TRUE(region.intersects(RectL(15, 5, 16, 6)));
+  EXPECT_FALSE(region.intersects(RectL(20, 0, 30, 10)));
+}
+
+TEST(DamageRegion, MergesCheapestPairWhenFull)
+{
+  DamageRegion region;
+
+  // Fill to capacity with widely-spaced cells, then place one beside the first
+  for (int32_t i = 0; i < int32_t(DamageRegion::Capacity); ++i)
+    region.add(RectL(i*100, 0, i*100+10, 10));
+  region.add(RectL(12, 0, 22, 10));
+
+  EXPECT_LE(region.size(), uint32_t(DamageRegion::Capacity));
+
+  // Every damaged pixel remains covered
+  for (int32_t i = 0; i < int32_t(DamageRegion::Capacity); ++i)
+    EXPECT_TRUE(region.intersects(RectL(i*100, 0, i*100+1, 1))) << i;
+  EXPECT_TRUE(region.intersects(RectL(21, 0, 22, 1)));
+
+  // ...and no rectangles overlap
+  for (auto a = region.begin(); a != region.end(); ++a)
+    for (auto b = a + 1; b != region.end(); ++b)
+      EXPECT_FALSE(DamageRegion::intersects(*a, *b));
+}
+
+TEST(DamageRegion, ClipsToSurface)
+{
+  DamageRegion region;
+  region.add(RectL(-10, -10, 10, 10));
+  region.add(RectL(200, 200, 300, 300));
+
+  region.clip(RectL(0, 0, 100, 100));
+
+  ASSERT_EQ(1u, region.size());
+  EXPECT_EQ(RectL(0, 0, 10, 10), *region.begin());
+}
+
+// ------------------------------------- DISPLAY LIST -----------------------------------
+
+TEST(DisplayList, IdenticalFramesProduceNoDamage)
+{
+  DisplayList const previous = cells(20),
+                    current = cells(20);
+  DamageRegion damage;
+
+  current.diff(previous, damage);
+
+  EXPECT_TRUE(damage.empty());
+}
+
+TEST(DisplayList, DamagesOnlyChangedCommand)
+{
+  DisplayList const previous = cells(20);
+  DisplayList current;
+  for (int32_t i = 0; i < 20; ++i)
+    current.record(DisplayList::command(DisplayOp::Fill, RectL(i*10, 0, i*10+10, 10), i == 7 ? 2 : 1));
+
+  DamageRegion damage;
+  current.diff(previous, damage);
+
+  ASSERT_EQ(1u, damage.size());
+  EXPECT_EQ(RectL(70, 0, 80, 10), *damage.begin());
+}
+
+TEST(DisplayList, InsertionDoesNotDamageSubsequentCommands)
+{
+  DisplayList const previous = cells(20);
+  DisplayList current = cells(20);
+  current.record(DisplayList::command(DisplayOp::Focus, RectL(500, 0, 510, 10)));
+
+  DamageRegion damage;
+  current.diff(previous, damage);
+
+  ASSERT_EQ(1u, damage.size());
+  EXPECT_EQ(RectL(500, 0, 510, 10), *damage.begin());
+}
+
+TEST(DisplayList, RemovalDamagesFormerBounds)
+{
+  DisplayList const previous = cells(20),
+                    current = cells(19);
+  DamageRegion damage;
+
+  current.diff(previous, damage);
+
+  ASSERT_EQ(1u, damage.size());
+  EXPECT_EQ(RectL(190, 0, 200, 10), *damage.begin());
+}
+
+TEST(DisplayList, ComparesText)
+{
+  DisplayCommand const cmd = DisplayList::command(DisplayOp::Text, RectL(0, 0, 100, 20));
+  DisplayList previous, current;
+  previous.record(cmd, "Hello", 5);
+  current.record(cmd, "Hellp", 5);
+
+  DamageRegion damage;
+  current.diff(previous, damage);
+  EXPECT_EQ(1u, damage.size());
+
+  damage.clear();
+  previous.diff(previous, damage);
+  EXPECT_TRUE(damage.empty());
+}
+
+TEST(DisplayList, ReplaysOnlyCommandsWithinDamage)
+{
+  DisplayList list = cells(4);
+  list.record(DisplayList::command(DisplayOp::Text, RectL(0, 0, 40, 10)), "label", 5);
+
+  DamageRegion damage;
+  damage.add(RectL(12, 2, 18, 8));
+
+  RecordingSurface surface;
+  list.replay(surface, damage);
+
+  ASSERT_EQ(1u, surface.Clips.size());
+  ASSERT_EQ(2u, surface.Ops.size());
+  EXPECT_EQ(DisplayOp::Fill, surface.Ops[0]);
+  EXPECT_EQ(DisplayOp::Text, surface.Ops[1]);
+  EXPECT_EQ("label", surface.Texts[1]);
+}
+
+TEST(DisplayList, ClearRetainsNothing)
+{
+  DisplayList list = cells(4);
+  list.record(DisplayList::command(DisplayOp::Text, RectL(0, 0, 40, 10)), u"wide", 4);
+  list.clear();
+
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(0u, list.size());
+}
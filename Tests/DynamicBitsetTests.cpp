@@ -0,0 +1,307 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\DynamicBitsetTests.cpp
+//! \brief Unit tests for DynamicBitset
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/utils/DynamicBitset.hpp>        //!< DynamicBitset
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! Sentinel returned when no bit is found
+  uint32_t const npos = ~0u;
+
+  //! Generate a reference model of 'bits' bits, each set with probability 1/'sparsity'
+  std::vector<bool>  randomBits(uint32_t bits, uint32_t sparsity, uint32_t seed)
+  {
+    std::mt19937 rng(seed);
+    std::vector<bool> model(bits);
+    for (uint32_t i = 0; i < bits; ++i)
+      model[i] = rng() % sparsity == 0;
+    return model;
+  }
+
+  //! Build a bitset from a reference model
+  DynamicBitset  fromModel(const std::vector<bool>& model)
+  {
+    DynamicBitset bs(uint32_t(model.size()));
+    for (uint32_t i = 0; i < model.size(); ++i)
+      bs.set(i, model[i]);
+    return bs;
+  }
+
+  //! Query whether a bitset matches a reference model
+  ::testing::AssertionResult  matches(const DynamicBitset& bs, const std::vector<bool>& model)
+  {
+    if (bs.size() != model.size())
+      return ::testing::AssertionFailure() << "size " << bs.size() << " != " << model.size();
+    for (uint32_t i = 0; i < model.size(); ++i)
+      if (bs[i] != model[i])
+        return ::testing::AssertionFailure() << "bit " << i << " is " << bs[i];
+
+    // Bits beyond the width must be clear
+    if (bs.size() % 64 && bs.data()[bs.words()-1] >> (bs.size() % 64))
+      return ::testing::AssertionFailure() << "bits beyond size() are set";
+    return ::testing::AssertionSuccess();
+  }
+}
+
+// ------------------------------------ CONSTRUCTION ------------------------------------
+
+TEST(DynamicBitset, ConstructsClearBits)
+{
+  DynamicBitset empty, bs(100);
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(empty.all()) << "vacuously true";
+  EXPECT_EQ(100u, bs.size());
+  EXPECT_EQ(2u, bs.words());
+  EXPECT_FALSE(bs.any());
+  EXPECT_EQ(0u, bs.count());
+}
+
+TEST(DynamicBitset, GrowsFromInlineToHeapStorage)
+{
+  std::vector<bool> model = randomBits(256, 3, 1);
+  DynamicBitset bs = fromModel(model);
+  const uint64_t* inline_data = bs.data();
+
+  // Widen beyond inline capacity, retaining existing bits
+  bs.resize(5000);
+  model.resize(5000);
+  EXPECT_NE(inline_data, bs.data());
+  bs.set(4999);
+  model[4999] = true;
+  EXPECT_TRUE(matches(bs, model));
+}
+
+TEST(DynamicBitset, ShrinkingClearsTruncatedBits)
+{
+  DynamicBitset bs(200);
+  bs.set();
+  bs.resize(70);
+  EXPECT_EQ(70u, bs.count());
+
+  bs.resize(200);
+  EXPECT_EQ(70u, bs.count()) << "bits restored by widening must be clear";
+  EXPECT_FALSE(bs[70]);
+  EXPECT_FALSE(bs[199]);
+}
+
+TEST(DynamicBitset, SetAllLeavesBitsBeyondSizeClear)
+{
+  DynamicBitset bs(130);
+  bs.set();
+  EXPECT_TRUE(bs.all());
+  EXPECT_EQ(130u, bs.count());
+  EXPECT_EQ(0x3u, bs.data()[2]);
+
+  bs.clear(129);
+  EXPECT_FALSE(bs.all());
+  bs.clear();
+  EXPECT_FALSE(bs.any());
+}
+
+TEST(DynamicBitset, SetsClearsAndFlipsBits)
+{
+  DynamicBitset bs(65);
+  bs.set(0);
+  bs.set(64);
+  bs.flip(63);
+  bs.flip(0);
+  bs.set(10, true);
+  bs.set(10, false);
+  EXPECT_EQ((std::vector<uint32_t>{63, 64}), bs.flatten());
+}
+
+#if CHECKED_BOUNDARIES
+TEST(DynamicBitset, RejectsIndicesBeyondSize)
+{
+  DynamicBitset bs(65);
+  EXPECT_NO_THROW(bs.get(64));
+  EXPECT_THROW(bs.get(65), out_of_range);
+  EXPECT_THROW(bs.set(65), out_of_range);
+  EXPECT_THROW(bs.clear(65), out_of_range);
+  EXPECT_THROW(bs.flip(~0u), out_of_range);
+
+  // rank() permits the index one beyond the last bit
+  EXPECT_NO_THROW(bs.rank(65));
+  EXPECT_THROW(bs.rank(66), out_of_range);
+}
+#endif
+
+// ------------------------------------ COPY & MOVE ------------------------------------
+
+TEST(DynamicBitset, CopiesInlineAndHeapStorage)
+{
+  for (uint32_t width : {100u, 3000u})
+  {
+    DynamicBitset const src = fromModel(randomBits(width, 4, width));
+    DynamicBitset copy(src), assigned(5000);
+    assigned.set();
+    assigned = src;
+
+    EXPECT_TRUE(copy == src);
+    EXPECT_TRUE(assigned == src) << "surplus words cleared by assignment";
+    EXPECT_NE(src.data(), copy.data());
+  }
+}
+
+TEST(DynamicBitset, MovesHeapBlockWithoutCopying)
+{
+  DynamicBitset src = fromModel(randomBits(3000, 4, 7));
+  DynamicBitset const expected(src);
+  const uint64_t* block = src.data();
+
+  DynamicBitset moved(std::move(src));
+  EXPECT_EQ(block, moved.data());
+  EXPECT_TRUE(moved == expected);
+  EXPECT_EQ(0u, src.size());
+
+  DynamicBitset assigned(100);
+  assigned = std::move(moved);
+  EXPECT_EQ(block, assigned.data());
+  EXPECT_TRUE(assigned == expected);
+  EXPECT_TRUE(moved.empty());
+}
+
+TEST(DynamicBitset, ComparesWidthAndBits)
+{
+  DynamicBitset a(100), b(100), c(101);
+  EXPECT_TRUE(a == b);
+  EXPECT_TRUE(a != c) << "different widths";
+  b.set(99);
+  EXPECT_TRUE(a != b);
+}
+
+// ------------------------------------ ITERATION --------------------------------------
+
+TEST(DynamicBitset, EnumeratesSetBitsInOrder)
+{
+  std::vector<bool> const model = randomBits(1000, 7, 3);
+  DynamicBitset const bs = fromModel(model);
+
+  std::vector<uint32_t> expected;
+  for (uint32_t i = 0; i < model.size(); ++i)
+    if (model[i])
+      expected.push_back(i);
+
+  std::vector<uint32_t> visited;
+  bs.forEach([&visited] (uint32_t idx) { visited.push_back(idx); });
+  EXPECT_EQ(expected, visited);
+  EXPECT_EQ(expected, bs.flatten());
+  EXPECT_EQ(expected.size(), bs.count());
+}
+
+TEST(DynamicBitset, FindsNextSetBit)
+{
+  DynamicBitset bs(300);
+  EXPECT_EQ(npos, bs.next());
+  bs.set(5);
+  bs.set(64);
+  bs.set(299);
+
+  EXPECT_EQ(5u, bs.next());
+  EXPECT_EQ(5u, bs.next(5));
+  EXPECT_EQ(64u, bs.next(6));
+  EXPECT_EQ(299u, bs.next(65));
+  EXPECT_EQ(npos, bs.next(300));
+  EXPECT_EQ(npos, bs.next(npos));
+}
+
+// ----------------------------------- RANK & SELECT ------------------------------------
+
+TEST(DynamicBitset, RankCountsPrecedingBits)
+{
+  std::vector<bool> const model = randomBits(700, 5, 11);
+  DynamicBitset const bs = fromModel(model);
+
+  uint32_t expected = 0;
+  for (uint32_t i = 0; i <= model.size(); ++i)
+  {
+    ASSERT_EQ(expected, bs.rank(i)) << "index " << i;
+    if (i < model.size())
+      expected += model[i];
+  }
+}
+
+TEST(DynamicBitset, SelectInvertsRank)
+{
+  DynamicBitset const bs = fromModel(randomBits(700, 5, 13));
+  uint32_t const total = bs.count();
+
+  for (uint32_t n = 0; n < total; ++n)
+  {
+    uint32_t const idx = bs.select(n);
+    ASSERT_TRUE(bs[idx]);
+    ASSERT_EQ(n, bs.rank(idx));
+  }
+  EXPECT_EQ(npos, bs.select(total));
+}
+
+TEST(DynamicBitset, SelectsWithinDenseWord)
+{
+  uint64_t const word = 0xF00000000000000Full;
+  EXPECT_EQ(0u, DynamicBitset::selectWord(word, 0));
+  EXPECT_EQ(3u, DynamicBitset::selectWord(word, 3));
+  EXPECT_EQ(60u, DynamicBitset::selectWord(word, 4));
+  EXPECT_EQ(63u, DynamicBitset::selectWord(word, 7));
+  EXPECT_EQ(8u, DynamicBitset::popcount(word));
+  EXPECT_EQ(60u, DynamicBitset::tzcnt(word & ~0xFull));
+}
+
+// ---------------------------------- SET OPERATIONS ------------------------------------
+
+TEST(DynamicBitset, CombinesEqualWidths)
+{
+  // 7 words exercises both the vector loop and the scalar tail
+  for (uint32_t width : {64u, 130u, 448u, 4500u})
+  {
+    std::vector<bool> const l = randomBits(width, 2, width),
+                            r = randomBits(width, 3, width+1);
+    std::vector<bool> both(width), either(width), one(width), left(width);
+    for (uint32_t i = 0; i < width; ++i)
+    {
+      both[i] = l[i] && r[i];
+      either[i] = l[i] || r[i];
+      one[i] = l[i] != r[i];
+      left[i] = l[i] && !r[i];
+    }
+
+    DynamicBitset const a = fromModel(l), b = fromModel(r);
+    EXPECT_TRUE(matches(a & b, both)) << width;
+    EXPECT_TRUE(matches(a | b, either)) << width;
+    EXPECT_TRUE(matches(a ^ b, one)) << width;
+    EXPECT_TRUE(matches(DynamicBitset(a).andNot(b), left)) << width;
+  }
+}
+
+TEST(DynamicBitset, CombinesDifferentWidths)
+{
+  DynamicBitset narrow(70), wide(300);
+  narrow.set();
+  wide.set(3);
+  wide.set(250);
+
+  DynamicBitset const either = narrow | wide;
+  EXPECT_EQ(300u, either.size()) << "widened to the greater width";
+  EXPECT_EQ(71u, either.count());
+
+  DynamicBitset const one = narrow ^ wide;
+  EXPECT_EQ(300u, one.size());
+  EXPECT_EQ(70u, one.count());
+
+  DynamicBitset const both = wide & narrow;
+  EXPECT_EQ(300u, both.size()) << "width of the left operand";
+  EXPECT_EQ((std::vector<uint32_t>{3}), both.flatten());
+
+  DynamicBitset trimmed(narrow);
+  trimmed.andNot(wide);
+  EXPECT_EQ(69u, trimmed.count());
+}
@@ -0,0 +1,413 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\FileIndexTests.cpp
+//! \brief Unit tests for FileIndex over temporary folders
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/platform/FileIndex.hpp>         //!< FileIndex
+#include <gtest/gtest.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! \alias index_t - Narrow index
+  using index_t = FileIndex<Encoding::UTF8>;
+
+  //! Remove the contents of a folder, then the folder itself
+  void  removeAt(int parent, const char* name)
+  {
+    int fd = ::openat(parent, name, O_RDONLY|O_DIRECTORY|O_NOFOLLOW|O_CLOEXEC);
+    if (DIR* dir = (fd != -1 ? ::fdopendir(fd) : nullptr))
+    {
+      std::vector<std::string> children;
+      while (::dirent* d = ::readdir(dir))
+        if (std::strcmp(d->d_name, ".") && std::strcmp(d->d_name, ".."))
+          children.push_back(d->d_name);
+
+      for (auto const& c : children)
+        if (::unlinkat(::dirfd(dir), c.c_str(), 0) != 0)
+          removeAt(::dirfd(dir), c.c_str());
+      ::closedir(dir);
+    }
+    ::unlinkat(parent, name, AT_REMOVEDIR);
+  }
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct TempTree - Temporary folder which is removed, with its contents, upon destruction
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct TempTree
+  {
+    std::string  Root;      //!< Absolute path, without trailing separator
+
+    TempTree()
+    {
+      char path[] = "/tmp/wtl-index-XXXXXX";
+      if (!::mkdtemp(path))
+        throw platform_error(HERE, "Unable to create temporary folder");
+      Root = path;
+    }
+
+    ~TempTree()
+    {
+      removeAt(AT_FDCWD, Root.c_str());
+    }
+
+    //! Create a folder  (Relative to the root)
+    void  folder(const std::string& rel) const
+    {
+      ::mkdir((Root + '/' + rel).c_str(), 0755);
+    }
+
+    //! Create a file of 'size' bytes  (Relative to the root)
+    void  file(const std::string& rel, size_t size = 0) const
+    {
+      int fd = ::open((Root + '/' + rel).c_str(), O_WRONLY|O_CREAT|O_TRUNC|O_CLOEXEC, 0644);
+      std::string const content(size, 'x');
+      if (fd == -1 || ::write(fd, content.data(), size) != static_cast<ssize_t>(size))
+        throw platform_error(HERE, "Unable to create temporary file");
+      ::close(fd);
+    }
+
+    //! Remove a file or folder  (Relative to the root)
+    void  remove(const std::string& rel) const
+    {
+      if (::unlink((Root + '/' + rel).c_str()) != 0)
+        removeAt(AT_FDCWD, (Root + '/' + rel).c_str());
+    }
+
+    //! Rename a file or folder  (Relative to the root)
+    void  rename(const std::string& from, const std::string& to) const
+    {
+      ::rename((Root + '/' + from).c_str(), (Root + '/' + to).c_str());
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct Snapshot - Builds snapshots by hand, in the format written by FileIndex::save()
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct Snapshot
+  {
+    std::string  Bytes;
+
+    template <typename T>
+    Snapshot&  value(T v)
+    {
+      Bytes.append(reinterpret_cast<const char*>(&v), sizeof(T));
+      return *this;
+    }
+
+    Snapshot&  header(const std::string& root, uint32_t count)
+    {
+      value<uint32_t>(0x58444946).value<uint32_t>(index_t::SnapshotVersion).value<uint32_t>(1);
+      value<uint32_t>(uint32_t(root.size()));
+      Bytes += root;
+      return value<uint32_t>(count);
+    }
+
+    Snapshot&  entry(uint32_t parent, uint32_t attributes, const std::string& name, uint32_t length)
+    {
+      value<uint32_t>(parent).value<uint32_t>(attributes).value<uint64_t>(0).value<uint64_t>(0).value<uint32_t>(length);
+      Bytes += name;
+      return *this;
+    }
+
+    Snapshot&  entry(uint32_t parent, uint32_t attributes, const std::string& name)
+    {
+      return entry(parent, attributes, name, uint32_t(name.size()));
+    }
+  };
+
+  //! Get the sorted paths of every entry beneath a prefix
+  std::vector<std::string>  prefixed(const index_t& index, const std::string& prefix)
+  {
+    std::vector<std::string> paths;
+    index.prefix(prefix, [&paths] (const index_t::Entry& e) { paths.push_back(e.path()); });
+    std::sort(paths.begin(), paths.end());
+    return paths;
+  }
+
+  //! Get the sorted paths of every file with an extension
+  std::vector<std::string>  extended(const index_t& index, const std::string& ext)
+  {
+    std::vector<std::string> paths;
+    index.extension(ext, [&paths] (const index_t::Entry& e) { paths.push_back(e.path()); });
+    std::sort(paths.begin(), paths.end());
+    return paths;
+  }
+
+  //! Apply notifications until a condition holds, or a few seconds elapse
+  bool  updateUntil(index_t& index, ThreadPool& pool, const std::function<bool ()>& condition)
+  {
+    for (int attempt = 0; attempt < 50; ++attempt)
+    {
+      if (condition())
+        return true;
+      index.update(100, pool);
+    }
+    return condition();
+  }
+
+  //! Query whether a loaded snapshot is rejected
+  bool  rejected(index_t& index, const std::string& bytes)
+  {
+    std::istringstream in(bytes);
+    try
+    {
+      index.load(in);
+      return false;
+    }
+    catch (const domain_error&)
+    {
+      return true;
+    }
+  }
+}
+
+// ---------------------------------------- SCAN ----------------------------------------
+
+TEST(FileIndex, ScansEntireTree)
+{
+  TempTree tree;
+  tree.folder("src");
+  tree.folder("src/utils");
+  tree.file("src/main.cpp", 12);
+  tree.file("src/utils/Lazy.hpp");
+  tree.file("readme.md");
+
+  ThreadPool pool(2);
+  index_t index(tree.Root);
+  index.scan(pool);
+
+  EXPECT_EQ(tree.Root + '/', index.root());
+  EXPECT_EQ(5u, index.size());
+  ASSERT_TRUE(index.find("src/main.cpp"));
+  EXPECT_EQ(12u, index.find("src/main.cpp").size());
+  EXPECT_TRUE(index.find("src/utils").isFolder());
+  EXPECT_EQ("Lazy.hpp", index.find("src/utils/Lazy.hpp").name());
+  EXPECT_FALSE(index.find("src/missing.cpp"));
+  EXPECT_FALSE(index.find("readme.md/child"));
+}
+
+TEST(FileIndex, RejectsMissingFolder)
+{
+  EXPECT_THROW(index_t("/nonexistent/wtl-index"), logic_error);
+}
+
+// --------------------------------------- QUERIES --------------------------------------
+
+TEST(FileIndex, VisitsEntriesByPrefix)
+{
+  TempTree tree;
+  tree.folder("src");
+  tree.folder("src/utils");
+  tree.folder("src/util-old");
+  tree.folder("srcgen");
+  tree.file("src/utils/a.hpp");
+  tree.file("src/utils/b.hpp");
+  tree.file("src/util-old/c.hpp");
+  tree.file("src/main.cpp");
+
+  ThreadPool pool(2);
+  index_t index(tree.Root);
+  index.scan(pool);
+
+  EXPECT_EQ((std::vector<std::string>{"src/util-old", "src/util-old/c.hpp", "src/utils", "src/utils/a.hpp", "src/utils/b.hpp"}), prefixed(index, "src/ut"));
+  EXPECT_EQ((std::vector<std::string>{"src/utils", "src/utils/a.hpp", "src/utils/b.hpp"}), prefixed(index, "src/utils"));
+  EXPECT_EQ((std::vector<std::string>{"src/utils/a.hpp", "src/utils/b.hpp"}), prefixed(index, "src/utils/"));
+  EXPECT_EQ(8u, prefixed(index, "src").size());      // Includes 'srcgen'
+  EXPECT_TRUE(prefixed(index, "lib/").empty());
+  EXPECT_TRUE(prefixed(index, "src/x").empty());
+}
+
+TEST(FileIndex, VisitsFilesByExtension)
+{
+  TempTree tree;
+  tree.folder("a");
+  tree.folder("a.hpp");
+  tree.file("a/x.hpp");
+  tree.file("a/y.hpp.bak");
+  tree.file("z.hpp");
+  tree.file("hpp");
+  tree.file("w.HPP");
+
+  ThreadPool pool(2);
+  index_t index(tree.Root);
+  index.scan(pool);
+
+  EXPECT_EQ((std::vector<std::string>{"a/x.hpp", "z.hpp"}), extended(index, "hpp"));
+  EXPECT_EQ((std::vector<std::string>{"a/y.hpp.bak"}), extended(index, "bak"));
+  EXPECT_EQ((std::vector<std::string>{"w.HPP"}), extended(index, "HPP"));
+  EXPECT_TRUE(extended(index, "cpp").empty());
+}
+
+// ------------------------------------ NOTIFICATIONS -----------------------------------
+
+TEST(FileIndex, UpdatesFromNotifications)
+{
+  TempTree tree;
+  tree.folder("src");
+  tree.file("src/old.cpp");
+  tree.file("src/doomed.cpp");
+
+  ThreadPool pool(2);
+  index_t index(tree.Root);
+  index.watch();
+  index.scan(pool);
+  ASSERT_EQ(3u, index.size());
+
+  // Create, resize, rename and remove files
+  tree.file("src/new.hpp");
+  tree.file("src/old.cpp", 42);
+  tree.rename("src/old.cpp", "src/renamed.cpp");
+  tree.remove("src/doomed.cpp");
+  EXPECT_TRUE(updateUntil(index, pool, [&] { return index.find("src/new.hpp") && index.find("src/renamed.cpp") && !index.find("src/doomed.cpp"); }));
+  EXPECT_FALSE(index.find("src/old.cpp"));
+  EXPECT_EQ(42u, index.find("src/renamed.cpp").size());
+  EXPECT_EQ((std::vector<std::string>{"src/new.hpp"}), extended(index, "hpp"));
+  EXPECT_EQ((std::vector<std::string>{"src/renamed.cpp"}), extended(index, "cpp"));
+}
+
+TEST(FileIndex, EnumeratesAndWatchesCreatedFolders)
+{
+  TempTree tree;
+  ThreadPool pool(2);
+  index_t index(tree.Root);
+  index.watch();
+  index.scan(pool);
+
+  // Contents created with the folder are enumerated, later contents are notified
+  tree.folder("lib");
+  tree.file("lib/early.hpp");
+  EXPECT_TRUE(updateUntil(index, pool, [&] { return bool(index.find("lib/early.hpp")); }));
+
+  tree.file("lib/late.hpp");
+  EXPECT_TRUE(updateUntil(index, pool, [&] { return bool(index.find("lib/late.hpp")); }));
+
+  // Removing the folder removes its descendants
+  tree.remove("lib");
+  EXPECT_TRUE(updateUntil(index, pool, [&] { return !index.find("lib"); }));
+  EXPECT_EQ(0u, index.size());
+  EXPECT_TRUE(extended(index, "hpp").empty());
+}
+
+TEST(FileIndex, UpdateRequiresWatching)
+{
+  TempTree tree;
+  index_t index(tree.Root);
+  EXPECT_THROW(index.update(), logic_error);
+}
+
+// -------------------------------------- SNAPSHOTS -------------------------------------
+
+TEST(FileIndex, SnapshotRoundTrips)
+{
+  TempTree tree;
+  tree.folder("src");
+  tree.folder("src/utils");
+  tree.file("src/utils/Lazy.hpp", 7);
+  tree.file("src/main.cpp");
+  tree.file(".hidden");
+
+  ThreadPool pool(2);
+  index_t original(tree.Root);
+  original.scan(pool);
+  std::stringstream snapshot;
+  original.save(snapshot);
+
+  index_t copy(tree.Root);
+  copy.load(snapshot);
+  EXPECT_EQ(original.size(), copy.size());
+  EXPECT_EQ(prefixed(original, ""), prefixed(copy, ""));
+  EXPECT_EQ((std::vector<std::string>{"src/utils/Lazy.hpp"}), extended(copy, "hpp"));
+  EXPECT_EQ(7u, copy.find("src/utils/Lazy.hpp").size());
+  EXPECT_EQ(original.find("src/main.cpp").modified(), copy.find("src/main.cpp").modified());
+  EXPECT_TRUE(copy.find("src/utils").isFolder());
+}
+
+TEST(FileIndex, LoadResumesWatching)
+{
+  TempTree tree;
+  tree.folder("src");
+
+  ThreadPool pool(2);
+  index_t index(tree.Root);
+  index.scan(pool);
+  std::stringstream snapshot;
+  index.save(snapshot);
+
+  // Loading into a watching index must not silently stop notifications, including within loaded folders
+  index.watch();
+  index.load(snapshot);
+  tree.file("src/after.cpp");
+  EXPECT_TRUE(updateUntil(index, pool, [&] { return bool(index.find("src/after.cpp")); }));
+}
+
+TEST(FileIndex, RejectsTruncatedSnapshots)
+{
+  TempTree tree;
+  tree.folder("src");
+  tree.file("src/main.cpp");
+
+  ThreadPool pool(1);
+  index_t original(tree.Root);
+  original.scan(pool);
+  std::ostringstream out;
+  original.save(out);
+  std::string const bytes = out.str();
+
+  // Every proper prefix is rejected, and leaves the index empty
+  index_t index(tree.Root);
+  for (size_t length = 0; length < bytes.size(); ++length)
+  {
+    ASSERT_TRUE(rejected(index, bytes.substr(0, length))) << "prefix of " << length << " bytes";
+    ASSERT_EQ(0u, index.size());
+  }
+  EXPECT_FALSE(rejected(index, bytes));
+  EXPECT_EQ(2u, index.size());
+}
+
+TEST(FileIndex, RejectsCorruptSnapshots)
+{
+  TempTree tree;
+  index_t index(tree.Root);
+  std::string const root = index.root();
+  uint32_t const folder = FileEntry::Directory,
+                 file = FileEntry::Normal,
+                 maxPath = index_t::MaxPath;
+
+  // Well-formed
+  EXPECT_FALSE(rejected(index, Snapshot().header(root, 2).entry(0, folder, "a").entry(1, file, "b").Bytes));
+  EXPECT_TRUE(index.find("a/b"));
+
+  // Another magic number or folder
+  EXPECT_TRUE(rejected(index, "XXXX" + Snapshot().header(root, 0).Bytes.substr(4)));
+  EXPECT_TRUE(rejected(index, Snapshot().header("/elsewhere/", 0).Bytes));
+
+  // Names which are empty or exceed MaxPath
+  EXPECT_TRUE(rejected(index, Snapshot().header(root, 1).entry(0, file, "", 0).Bytes));
+  EXPECT_TRUE(rejected(index, Snapshot().header(root, 1).entry(0, file, "x", maxPath + 1).Bytes));
+
+  // Parents which have not been read, or are files
+  EXPECT_TRUE(rejected(index, Snapshot().header(root, 1).entry(1, file, "a").Bytes));
+  EXPECT_TRUE(rejected(index, Snapshot().header(root, 2).entry(0, file, "a").entry(1, file, "b").Bytes));
+
+  // Counts far beyond the data are rejected without first being allocated
+  EXPECT_TRUE(rejected(index, Snapshot().header(root, 0xFFFFFFFEu).entry(0, file, "a").Bytes));
+  EXPECT_TRUE(rejected(index, Snapshot().header(root, 0xFFFFFFFFu).Bytes));
+  EXPECT_EQ(0u, index.size());
+}
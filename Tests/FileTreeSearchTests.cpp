@@ -0,0 +1,352 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\FileTreeSearchTests.cpp
+//! \brief Unit tests for FileFilter and FileTreeSearch over temporary folders
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/platform/FileTreeSearch.hpp>    //!< FileTreeSearch
+#include <gtest/gtest.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! \alias search_t - Narrow search
+  using search_t = FileTreeSearch<Encoding::UTF8>;
+
+  //! \alias filter_t - Narrow filter
+  using filter_t = FileFilter<char>;
+
+  //! Remove the contents of a folder, then the folder itself  (Relative to a descriptor, so paths may exceed PATH_MAX)
+  void  removeAt(int parent, const char* name)
+  {
+    ::fchmodat(parent, name, 0700, 0);
+    int fd = ::openat(parent, name, O_RDONLY|O_DIRECTORY|O_NOFOLLOW|O_CLOEXEC);
+    if (fd != -1)
+    {
+      if (DIR* dir = ::fdopendir(fd))
+      {
+        std::vector<std::string> children;
+        while (::dirent* d = ::readdir(dir))
+          if (std::strcmp(d->d_name, ".") && std::strcmp(d->d_name, ".."))
+            children.push_back(d->d_name);
+
+        for (auto const& c : children)
+          if (::unlinkat(::dirfd(dir), c.c_str(), 0) != 0)
+            removeAt(::dirfd(dir), c.c_str());
+        ::closedir(dir);
+      }
+      else
+        ::close(fd);
+    }
+    ::unlinkat(parent, name, AT_REMOVEDIR);
+  }
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct TempTree - Temporary folder which is removed, with its contents, upon destruction
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct TempTree
+  {
+    std::string  Root;      //!< Absolute path, without trailing separator
+
+    TempTree()
+    {
+      char path[] = "/tmp/wtl-tree-XXXXXX";
+      if (!::mkdtemp(path))
+        throw platform_error(HERE, "Unable to create temporary folder");
+      Root = path;
+    }
+
+    ~TempTree()
+    {
+      removeAt(AT_FDCWD, Root.c_str());
+    }
+
+    //! Create a folder  (Relative to the root)
+    void  folder(const std::string& rel) const
+    {
+      ::mkdir((Root + '/' + rel).c_str(), 0755);
+    }
+
+    //! Create a file of 'size' bytes  (Relative to the root)
+    void  file(const std::string& rel, size_t size = 0) const
+    {
+      int fd = ::open((Root + '/' + rel).c_str(), O_WRONLY|O_CREAT|O_TRUNC|O_CLOEXEC, 0644);
+      std::string const content(size, 'x');
+      if (fd == -1 || ::write(fd, content.data(), size) != static_cast<ssize_t>(size))
+        throw platform_error(HERE, "Unable to create temporary file");
+      ::close(fd);
+    }
+
+    //! Create a symbolic link  (Relative to the root)
+    void  link(const std::string& target, const std::string& rel) const
+    {
+      if (::symlink(target.c_str(), (Root + '/' + rel).c_str()) != 0)
+        throw platform_error(HERE, "Unable to create symbolic link");
+    }
+  };
+
+  //! Search a folder, returning the paths (relative to the folder) of every entry, sorted
+  std::vector<std::string>  searchAll(search_t& search, const std::string& root)
+  {
+    std::vector<std::string> paths;
+    for (auto const& r : search)
+      paths.push_back(r.fullPath().substr(root.length() + 1) + (r.isFolder() ? "/" : ""));
+    std::sort(paths.begin(), paths.end());
+    return paths;
+  }
+
+  //! Query whether a name matches a pattern
+  bool  glob(const char* pattern, const std::string& name, bool caseSensitive = true)
+  {
+    return filter_t::glob(pattern, name.c_str(), name.length(), caseSensitive);
+  }
+}
+
+// ---------------------------------------- GLOB ----------------------------------------
+
+TEST(FileFilter, GlobMatchesLiteralsAndSingleCharacters)
+{
+  EXPECT_TRUE(glob("report.txt", "report.txt"));
+  EXPECT_FALSE(glob("report.txt", "report.tx"));
+  EXPECT_FALSE(glob("report.tx", "report.txt"));
+  EXPECT_TRUE(glob("report-??.txt", "report-01.txt"));
+  EXPECT_FALSE(glob("report-??.txt", "report-1.txt"));
+  EXPECT_FALSE(glob("?", ""));
+  EXPECT_TRUE(glob("", ""));
+  EXPECT_FALSE(glob("", "a"));
+}
+
+TEST(FileFilter, GlobMatchesLeadingAndTrailingStars)
+{
+  EXPECT_TRUE(glob("*.tmp", ".tmp"));
+  EXPECT_TRUE(glob("*.tmp", "a.b.tmp"));
+  EXPECT_FALSE(glob("*.tmp", "a.tmp.bak"));
+  EXPECT_TRUE(glob("build*", "build"));
+  EXPECT_TRUE(glob("build*", "build-output"));
+  EXPECT_FALSE(glob("build*", "rebuild"));
+  EXPECT_TRUE(glob("*", ""));
+  EXPECT_TRUE(glob("**", "anything"));
+  EXPECT_TRUE(glob("*a*", "banana"));
+  EXPECT_FALSE(glob("*x*", "banana"));
+}
+
+TEST(FileFilter, GlobBacktracksAcrossStars)
+{
+  EXPECT_TRUE(glob("*ab*cd", "xxabyyabzzcd"));
+  EXPECT_TRUE(glob("a*?b", "aaab"));
+  EXPECT_FALSE(glob("a*?b", "ab"));
+  EXPECT_TRUE(glob("*?.?", "ab.c"));
+}
+
+TEST(FileFilter, GlobFoldsAsciiCaseOnlyWhenInsensitive)
+{
+  EXPECT_FALSE(glob("*.TXT", "notes.txt"));
+  EXPECT_TRUE(glob("*.TXT", "notes.txt", false));
+  EXPECT_TRUE(glob("Read?E", "readme", false));
+  EXPECT_FALSE(glob("[", "{", false));
+  EXPECT_FALSE(glob("\xC3\x89", "\xC3\xA9", false));
+}
+
+// -------------------------------------- MATCHING --------------------------------------
+
+TEST(FileFilter, MatchesEverythingByDefault)
+{
+  filter_t const f;
+  EXPECT_TRUE(f.matches("anything", 8));
+  EXPECT_TRUE(f.folders());
+}
+
+TEST(FileFilter, MatchesExtensionBeyondFinalDot)
+{
+  filter_t f;
+  f.extension("hpp").extension("h");
+
+  EXPECT_TRUE(f.matches("a.hpp", 5));
+  EXPECT_TRUE(f.matches("a.b.h", 5));
+  EXPECT_FALSE(f.matches("a.hpp.bak", 9));
+  EXPECT_FALSE(f.matches("a.hp", 4));
+  EXPECT_FALSE(f.matches("hpp", 3));
+  EXPECT_FALSE(f.matches("a.HPP", 5));
+  EXPECT_TRUE(f.caseSensitive(false).matches("a.HPP", 5));
+}
+
+TEST(FileFilter, RequiresBothExtensionAndPattern)
+{
+  filter_t f;
+  f.extension("txt").pattern("report-*");
+
+  EXPECT_TRUE(f.matches("report-1.txt", 12));
+  EXPECT_FALSE(f.matches("report-1.log", 12));
+  EXPECT_FALSE(f.matches("summary.txt", 11));
+}
+
+TEST(FileFilter, RejectsInvalidExtensions)
+{
+  filter_t f;
+  EXPECT_THROW(f.extension(""), invalid_argument);
+  EXPECT_THROW(f.extension(".txt"), invalid_argument);
+  EXPECT_THROW(f.extension("t*"), invalid_argument);
+  EXPECT_THROW(f.extension("t?t"), invalid_argument);
+}
+
+// --------------------------------------- SEARCH ---------------------------------------
+
+TEST(FileTreeSearch, EnumeratesAllDescendants)
+{
+  TempTree tree;
+  tree.folder("a");
+  tree.folder("a/b");
+  tree.folder("empty");
+  tree.file("root.txt", 3);
+  tree.file("a/one.hpp");
+  tree.file("a/b/two.cpp", 10);
+
+  ThreadPool pool(4);
+  search_t search(tree.Root, filter_t(), pool);
+  EXPECT_EQ((std::vector<std::string>{"a/", "a/b/", "a/b/two.cpp", "a/one.hpp", "empty/", "root.txt"}), searchAll(search, tree.Root));
+  EXPECT_EQ(0u, search.errors());
+}
+
+TEST(FileTreeSearch, DescribesReportedFiles)
+{
+  TempTree tree;
+  tree.file("data.bin", 1234);
+
+  ThreadPool pool(1);
+  search_t search(tree.Root, filter_t(), pool);
+  auto pos = search.begin();
+  ASSERT_NE(search.end(), pos);
+  EXPECT_STREQ("data.bin", pos->name());
+  EXPECT_EQ(tree.Root + '/', pos->folder());
+  EXPECT_EQ(1234u, pos->size());
+  EXPECT_FALSE(pos->isFolder());
+  EXPECT_GT(pos->modified(), 116444736000000000ull);      // After 1 January 1970
+  EXPECT_EQ(search.end(), ++pos);
+}
+
+TEST(FileTreeSearch, FiltersFilesButSearchesEveryFolder)
+{
+  TempTree tree;
+  tree.folder("src");
+  tree.folder("src/detail");
+  tree.file("readme.md");
+  tree.file("src/a.hpp");
+  tree.file("src/a.cpp");
+  tree.file("src/detail/b.hpp");
+
+  ThreadPool pool(2);
+  search_t search(tree.Root, filter_t().extension("hpp").folders(false), pool);
+  EXPECT_EQ((std::vector<std::string>{"src/a.hpp", "src/detail/b.hpp"}), searchAll(search, tree.Root));
+}
+
+TEST(FileTreeSearch, PublishesFullBatchesOfBatchSize)
+{
+  uint32_t const batchSize = search_t::BatchSize;
+  TempTree tree;
+  for (uint32_t i = 0; i < batchSize + 10; ++i)
+    tree.file("f" + std::to_string(i));
+
+  ThreadPool pool(1);
+  search_t search(tree.Root, filter_t(), pool);
+  std::vector<size_t> sizes;
+  for (search_t::batch_t batch; search.next(batch); )
+    sizes.push_back(batch.Entries.size());
+
+  EXPECT_EQ((std::vector<size_t>{batchSize, 10}), sizes);
+}
+
+TEST(FileTreeSearch, ReportsButNeverFollowsSymbolicLinks)
+{
+  TempTree tree;
+  tree.folder("real");
+  tree.file("real/inner.txt");
+  tree.link(tree.Root + "/real", "alias");
+  tree.link(tree.Root, "real/loop");
+
+  ThreadPool pool(2);
+  search_t search(tree.Root, filter_t(), pool);
+  EXPECT_EQ((std::vector<std::string>{"alias", "real/", "real/inner.txt", "real/loop"}), searchAll(search, tree.Root));
+}
+
+TEST(FileTreeSearch, CountsFoldersWhichCannotBeOpened)
+{
+  // Every folder beyond PATH_MAX fails to open, even with elevated privileges
+  TempTree tree;
+  std::string const component(200, 'd');
+  int fd = ::open(tree.Root.c_str(), O_RDONLY|O_DIRECTORY|O_CLOEXEC);
+  for (int depth = 0; depth < 24; ++depth)
+  {
+    ASSERT_EQ(0, ::mkdirat(fd, component.c_str(), 0755));
+    int child = ::openat(fd, component.c_str(), O_RDONLY|O_DIRECTORY|O_CLOEXEC);
+    ::close(fd);
+    fd = child;
+  }
+  ::close(fd);
+
+  ThreadPool pool(2);
+  search_t search(tree.Root, filter_t(), pool);
+  size_t reported = 0;
+  for (auto const& r : search)
+    reported += r.isFolder();
+
+  EXPECT_EQ(1u, search.errors());
+  EXPECT_LT(reported, 24u);
+}
+
+TEST(FileTreeSearch, CountsFoldersWithoutPermission)
+{
+  if (::geteuid() == 0)
+    GTEST_SKIP() << "Permissions are not enforced for root";
+
+  TempTree tree;
+  tree.folder("locked");
+  tree.file("locked/secret.txt");
+  tree.file("open.txt");
+  ::chmod((tree.Root + "/locked").c_str(), 0);
+
+  ThreadPool pool(2);
+  search_t search(tree.Root, filter_t(), pool);
+  EXPECT_EQ((std::vector<std::string>{"locked/", "open.txt"}), searchAll(search, tree.Root));
+  EXPECT_EQ(1u, search.errors());
+}
+
+TEST(FileTreeSearch, IteratesUponWorkerOfItsOwnPool)
+{
+  TempTree tree;
+  for (int i = 0; i < 16; ++i)
+  {
+    tree.folder("d" + std::to_string(i));
+    tree.file("d" + std::to_string(i) + "/f");
+  }
+
+  // A single worker must execute the search while it waits, rather than deadlock
+  ThreadPool pool(1);
+  std::string const root = tree.Root;
+  auto task = pool.async([&pool, root]
+  {
+    search_t search(root, filter_t(), pool);
+    size_t n = 0;
+    for (auto const& r : search)
+      n += !r.isFolder();
+    return n;
+  });
+  EXPECT_EQ(16u, task.take());
+}
+
+TEST(FileTreeSearch, RejectsMissingFolder)
+{
+  ThreadPool pool(1);
+  EXPECT_THROW(search_t("/nonexistent/wtl-tree", filter_t(), pool), logic_error);
+}
@@ -0,0 +1,113 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\FlatRegistryTests.cpp
+//! \brief Unit tests for FlatRegistry
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/utils/FlatRegistry.hpp>         //!< FlatRegistry
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! Registry keyed by handle-like pointers
+  using HandleRegistry = FlatRegistry<const void*,int32_t>;
+
+  //! Generate a handle-like key  (Aligned, sharing low-order bits)
+  const void*  handle(uintptr_t n)
+  {
+    return reinterpret_cast<const void*>(0x10000 + n * 4);
+  }
+}
+
+TEST(FlatRegistry, InsertsFindsAndErases)
+{
+  HandleRegistry reg;
+  std::vector<int32_t> values(1000);
+
+  for (uintptr_t i = 0; i < values.size(); ++i)
+    EXPECT_TRUE(reg.insert(handle(i), &values[i]));
+
+  EXPECT_EQ(1000u, reg.size());
+  for (uintptr_t i = 0; i < values.size(); ++i)
+    ASSERT_EQ(&values[i], reg.find(handle(i)));
+  EXPECT_EQ(nullptr, reg.find(handle(5000)));
+
+  // Erase every other entry; the remainder must still be reachable
+  for (uintptr_t i = 0; i < values.size(); i += 2)
+    EXPECT_TRUE(reg.erase(handle(i)));
+  EXPECT_FALSE(reg.erase(handle(0)));
+
+  EXPECT_EQ(500u, reg.size());
+  for (uintptr_t i = 0; i < values.size(); ++i)
+    ASSERT_EQ(i % 2 ? &values[i] : nullptr, reg.find(handle(i)));
+}
+
+TEST(FlatRegistry, InsertReplacesExistingAssociation)
+{
+  HandleRegistry reg;
+  int32_t a = 1, b = 2;
+
+  EXPECT_TRUE(reg.insert(handle(1), &a));
+  EXPECT_FALSE(reg.insert(handle(1), &b));
+  EXPECT_EQ(&b, reg.find(handle(1)));
+  EXPECT_EQ(1u, reg.size());
+}
+
+TEST(FlatRegistry, ReclaimsSupersededTables)
+{
+  EpochDomain domain;
+  {
+    HandleRegistry reg(domain);
+    int32_t value = 0;
+
+    // Grow from 16 slots to 2048
+    for (uintptr_t i = 0; i < 1000; ++i)
+      reg.insert(handle(i), &value);
+
+    EXPECT_TRUE(domain.synchronize());
+    EXPECT_EQ(0u, domain.pending());
+  }
+}
+
+TEST(FlatRegistry, ConcurrentLookupsObserveEveryStableEntry)
+{
+  HandleRegistry reg;
+  std::vector<int32_t> values(4096);
+  std::atomic<bool> stop(false);
+  std::atomic<uint32_t> errors(0);
+
+  // Stable entries remain present while others are inserted and erased, forcing growth
+  for (uintptr_t i = 0; i < 64; ++i)
+    reg.insert(handle(i), &values[i]);
+
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 3; ++t)
+    readers.emplace_back([&] {
+      while (!stop.load())
+        for (uintptr_t i = 0; i < 64; ++i)
+          if (reg.find(handle(i)) != &values[i])
+            ++errors;
+    });
+
+  for (int round = 0; round < 4; ++round)
+  {
+    for (uintptr_t i = 64; i < values.size(); ++i)
+      reg.insert(handle(i), &values[i]);
+    for (uintptr_t i = 64; i < values.size(); ++i)
+      reg.erase(handle(i));
+  }
+
+  stop = true;
+  for (auto& r : readers)
+    r.join();
+
+  EXPECT_EQ(0u, errors.load());
+  EXPECT_EQ(64u, reg.size());
+}
@@ -0,0 +1,236 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\FontCacheTests.cpp
+//! \brief Unit tests for FontCache
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/gdi/FontCache.hpp>              //!< FontCache, IFontMetrics
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct FakeFontMetrics - Synthetic fonts whose extents follow the rules of GetTextExtentPoint32
+  //!
+  //! \remarks Each character advances by a width derived from the character and font height. Strings are measured
+  //! \remarks by summing advances, without kerning, then adding the overhang of the font once.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct FakeFontMetrics : IFontMetrics
+  {
+    std::map<uintptr_t,FontKey>   Fonts;              //!< Live fonts
+    uintptr_t                     Next = 0x1000;      //!< Next font handle
+    bool                          ReuseHandles = false;
+    uint32_t                      Created = 0,
+                                  Destroyed = 0,
+                                  Measured = 0;
+
+    uintptr_t  create(const FontKey& key) override
+    {
+      ++Created;
+      uintptr_t const handle = ReuseHandles ? 0x1000 : Next++;
+      Fonts[handle] = key;
+      return handle;
+    }
+
+    void  destroy(uintptr_t font) override
+    {
+      ++Destroyed;
+      Fonts.erase(font);
+    }
+
+    int32_t  height(uintptr_t font) override
+    {
+      return Fonts.at(font).Height;
+    }
+
+    //! Synthesized italics overhang, as raster fonts do
+    int32_t  overhang(uintptr_t font) override
+    {
+      return Fonts.at(font).Italic ? Fonts.at(font).Height / 4 : 0;
+    }
+
+    void  advances(uintptr_t font, wchar_t first, wchar_t last, int32_t* widths) override
+    {
+      for (wchar_t ch = first; ch <= last; ++ch)
+        *widths++ = advance(font, ch);
+    }
+
+    SizeL  measure(uintptr_t font, const wchar_t* text, uint32_t length) override
+    {
+      ++Measured;
+      return extent(font, text, length);
+    }
+
+    //! Advance width of a character
+    int32_t  advance(uintptr_t font, wchar_t ch) const
+    {
+      return Fonts.at(font).Height / 2 + static_cast<int32_t>(ch % 7) + (Fonts.at(font).Weight > 400 ? 1 : 0);
+    }
+
+    //! Reference extent, as GetTextExtentPoint32 would report
+    SizeL  extent(uintptr_t font, const wchar_t* text, uint32_t length)
+    {
+      int32_t width = 0;
+      for (uint32_t idx = 0; idx < length; ++idx)
+        width += advance(font, text[idx]);
+      return SizeL(length ? width + overhang(font) : 0, height(font));
+    }
+  };
+
+  //! Font attributes
+  FontKey  font(int32_t height, int32_t weight = 400, bool italic = false)
+  {
+    return FontKey {L"Tahoma", height, weight, italic, false, false, 0, 5};
+  }
+
+  //! Strings spanning ASCII, Latin-1, Latin Extended, and other scripts
+  const std::vector<std::wstring>&  corpus()
+  {
+    static const std::vector<std::wstring> strings {
+      L"", L" ", L"OK", L"Cancel", L"&Apply changes", L"File name:", L"1,234.56",
+      L"Café crème", L"Straße", L"Łódź", L"Ștefan ț",    // Latin-1 and Latin Extended
+      L"Привет", L"日本語", L"مرحبا",     // Cyrillic, CJK, Arabic
+      L"Mixed 日本 text", L"Tab\there", L"ɏɐ"                                    // Latin boundary
+    };
+    return strings;
+  }
+}
+
+TEST(FontCache, SharesFontsWithIdenticalAttributes)
+{
+  FakeFontMetrics provider;
+  FontCache cache(provider);
+
+  FontCache::font_t const a = cache.acquire(font(16)),
+                          b = cache.acquire(font(16)),
+                          c = cache.acquire(font(16, 700));
+
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, c);
+  EXPECT_EQ(2u, provider.Created);
+  EXPECT_EQ(1u, cache.statistics().Fonts.Hits);
+  EXPECT_EQ(2u, cache.statistics().Fonts.Misses);
+  EXPECT_EQ(a, cache.find(a->Handle));
+  EXPECT_EQ(nullptr, cache.find(0xdead));
+}
+
+TEST(FontCache, ExtentsMatchProviderForEveryString)
+{
+  FakeFontMetrics provider;
+  FontCache cache(provider);
+
+  for (const FontKey& key : {font(13), font(16, 700), font(20, 400, true)})
+  {
+    FontCache::font_t const f = cache.acquire(key);
+    for (const std::wstring& s : corpus())
+      EXPECT_EQ(provider.extent(f->Handle, s.c_str(), uint32_t(s.size())), cache.measure(f, s.c_str(), uint32_t(s.size())))
+        << "height " << key.Height << " string #" << (&s - corpus().data());
+  }
+}
+
+TEST(FontCache, NarrowExtentsMatchWideExtents)
+{
+  FakeFontMetrics provider;
+  FontCache cache(provider);
+  FontCache::font_t const f = cache.acquire(font(16));
+
+  for (const char* s : {"", "OK", "Save As...", "100%"})
+  {
+    std::wstring const wide(s, s + strlen(s));
+    EXPECT_EQ(cache.measure(f, wide.c_str(), uint32_t(wide.size())), cache.measure(f, s, uint32_t(strlen(s)))) << s;
+  }
+}
+
+TEST(FontCache, SumsLatinTextWithoutProvider)
+{
+  FakeFontMetrics provider;
+  FontCache cache(provider);
+  FontCache::font_t const f = cache.acquire(font(16));
+
+  cache.measure(f, L"Café", 4);
+  cache.measure(f, L"Ștefan", 6);
+
+  EXPECT_EQ(0u, provider.Measured);
+  EXPECT_EQ(2u, cache.statistics().Extents.Hits);
+}
+
+TEST(FontCache, MeasuresOtherTextOnce)
+{
+  FakeFontMetrics provider;
+  FontCache cache(provider);
+  FontCache::font_t const f = cache.acquire(font(16));
+
+  for (int repeat = 0; repeat < 10; ++repeat)
+  {
+    cache.measure(f, L"日本語", 3);
+    cache.measure(f, L"При", 3);
+  }
+
+  EXPECT_EQ(2u, provider.Measured);
+  EXPECT_EQ(18u, cache.statistics().Extents.Hits);
+  EXPECT_EQ(2u, cache.statistics().Extents.Misses);
+}
+
+TEST(FontCache, EvictsLeastRecentlyUsedExtent)
+{
+  FakeFontMetrics provider;
+  FontCache cache(provider, 2);
+  FontCache::font_t const f = cache.acquire(font(16));
+
+  cache.measure(f, L"一", 1);
+  cache.measure(f, L"丁", 1);
+  cache.measure(f, L"一", 1);     // Promote first
+  cache.measure(f, L"丂", 1);     // Evicts second
+  cache.measure(f, L"一", 1);
+  EXPECT_EQ(3u, provider.Measured);
+
+  cache.measure(f, L"丁", 1);
+  EXPECT_EQ(4u, provider.Measured);
+}
+
+TEST(FontCache, TrimDestroysUnreferencedFontsAndTheirExtents)
+{
+  FakeFontMetrics provider;
+  provider.ReuseHandles = true;
+  FontCache cache(provider);
+
+  {
+    FontCache::font_t const small = cache.acquire(font(10));
+    EXPECT_EQ(SizeL(5 + int32_t(0x65e5 % 7), 10), cache.measure(small, L"日", 1));
+  }
+  EXPECT_EQ(1u, cache.trim());
+  EXPECT_EQ(0u, cache.size());
+  EXPECT_EQ(1u, provider.Destroyed);
+
+  // New font receives the same handle; its extent must not be the former font's
+  FontCache::font_t const large = cache.acquire(font(30));
+  EXPECT_EQ(provider.extent(large->Handle, L"日", 1), cache.measure(large, L"日", 1));
+  EXPECT_EQ(0u, cache.trim());
+}
+
+TEST(FontCache, RealisticWorkloadHitRate)
+{
+  FakeFontMetrics provider;
+  FontCache cache(provider);
+
+  // Repaint 100 frames of the corpus, acquiring the font by attributes each time
+  for (int frame = 0; frame < 100; ++frame)
+  {
+    FontCache::font_t const f = cache.acquire(font(16));
+    for (const std::wstring& s : corpus())
+      cache.measure(f, s.c_str(), uint32_t(s.size()));
+  }
+
+  FontCache::Statistics const stats = cache.statistics();
+  EXPECT_EQ(1u, provider.Created);
+  EXPECT_EQ(6u, provider.Measured);     // Cyrillic, CJK, Arabic, mixed, control character and Latin boundary
+  EXPECT_GE(stats.Fonts.ratio(), 0.99);
+  EXPECT_GE(stats.Extents.ratio(), 0.99);
+}
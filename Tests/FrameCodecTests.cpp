@@ -0,0 +1,313 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\FrameCodecTests.cpp
+//! \brief Unit tests for the frame codecs, FrameReader and FrameWriter
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/io/FrameCodec.hpp>              //!< FrameReader, FrameWriter, LengthPrefixCodec, VarintPrefixCodec, DelimiterCodec
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! Result of measuring a corrupt stream  (Copied, as EXPECT_EQ would odr-use the codec constants)
+  size_t const  Malformed = VarintPrefixCodec::Malformed;
+
+  static_assert(LengthPrefixCodec<uint64_t>::Malformed == VarintPrefixCodec::Malformed, "Codecs share a sentinel");
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct Sink - Collects batches flushed by a FrameWriter
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct Sink
+  {
+    std::vector<byte>  Data;
+    size_t             Writes = 0;
+
+    bool  send(ChunkedStream&& s)
+    {
+      s.segments([this] (const BufferSegment& seg) { Data.insert(Data.end(), seg.Data, seg.Data + seg.Length); });
+      ++Writes;
+      return true;
+    }
+  };
+
+  //! Encode payloads with a FrameWriter
+  template <typename CODEC>
+  std::vector<byte>  encode(const std::vector<std::string>& payloads, CODEC codec = CODEC())
+  {
+    FrameWriter<CODEC> writer(std::make_shared<SocketBufferPool>(64), codec);
+    for (const std::string& p : payloads)
+      writer.write(reinterpret_cast<const byte*>(p.data()), p.size());
+
+    Sink sink;
+    EXPECT_TRUE(writer.flush(sink));
+    return sink.Data;
+  }
+
+  //! Feed a stream to a reader in receives of 'chunk' bytes, collecting each payload
+  template <typename CODEC>
+  std::vector<std::string>  decode(FrameReader<CODEC>& reader, std::vector<byte> stream, size_t chunk, bool* ok = nullptr)
+  {
+    std::vector<std::string> payloads;
+    bool result = true;
+    for (size_t pos = 0; pos < stream.size() && result; pos += chunk)
+      result = reader.feed(stream.data() + pos, std::min(chunk, stream.size() - pos), [&] (FrameView& v) {
+        payloads.emplace_back(reinterpret_cast<const char*>(v.data()), v.size());
+      });
+    if (ok)
+      *ok = result;
+    return payloads;
+  }
+
+  //! Payloads of assorted lengths, including empty
+  std::vector<std::string>  payloads()
+  {
+    return { "alpha", "", std::string(300, 'x'), "b", std::string(70000, 'y'), "gamma" };
+  }
+}
+
+// ---------------------------------- LENGTH PREFIX CODEC ---------------------------------
+
+TEST(LengthPrefixCodec, EncodesBigEndianLength)
+{
+  LengthPrefixCodec<uint16_t> codec;
+  byte header[2];
+  byte const frame[] = { 0x01, 0x02 };
+
+  EXPECT_EQ(2u, codec.header(0x0102, header));
+  EXPECT_EQ(0x01, header[0]);
+  EXPECT_EQ(0x02, header[1]);
+  EXPECT_EQ(0x0104u, codec.measure(frame, 2));
+  EXPECT_EQ(0u, codec.measure(frame, 1)) << "incomplete header";
+  EXPECT_THROW(codec.header(0x10000, header), length_error);
+}
+
+TEST(LengthPrefixCodec, RejectsLengthOverflowingFrame)
+{
+  LengthPrefixCodec<uint64_t> codec;
+  byte frame[8];
+  std::memset(frame, 0xFF, sizeof(frame));
+  EXPECT_EQ(Malformed, codec.measure(frame, sizeof(frame)));
+
+  // Largest length which can be measured
+  uint64_t const largest = std::numeric_limits<size_t>::max() - sizeof(uint64_t);
+  codec.header(static_cast<size_t>(largest), frame);
+  EXPECT_EQ(std::numeric_limits<size_t>::max(), codec.measure(frame, sizeof(frame)));
+  frame[7] += 1;
+  EXPECT_EQ(Malformed, codec.measure(frame, sizeof(frame)));
+}
+
+TEST(LengthPrefixCodec, RoundTripsFrames)
+{
+  std::vector<byte> const stream = encode<LengthPrefixCodec<>>(payloads());
+  for (size_t chunk : {size_t(1), size_t(3), size_t(4096), stream.size()})
+  {
+    FrameReader<LengthPrefixCodec<>> reader;
+    EXPECT_EQ(payloads(), decode(reader, stream, chunk)) << "receives of " << chunk << " bytes";
+    EXPECT_EQ(0u, reader.buffered());
+  }
+}
+
+// ---------------------------------- VARINT PREFIX CODEC ---------------------------------
+
+TEST(VarintPrefixCodec, EncodesLeb128Length)
+{
+  VarintPrefixCodec codec;
+  byte header[VarintPrefixCodec::MaxHeader];
+
+  struct { size_t Length; size_t Bytes; } const cases[] = { {0, 1}, {127, 1}, {128, 2}, {16383, 2}, {16384, 3}, {0xFFFFFFFF, 5} };
+  for (auto const& c : cases)
+  {
+    ASSERT_EQ(c.Bytes, codec.header(c.Length, header)) << c.Length;
+    EXPECT_EQ(c.Bytes + c.Length, codec.measure(header, c.Bytes)) << c.Length;
+    EXPECT_EQ(0u, codec.measure(header, c.Bytes - 1)) << "incomplete header of " << c.Length;
+    EXPECT_EQ(c.Bytes, codec.payload(header, c.Bytes + c.Length).first);
+  }
+}
+
+TEST(VarintPrefixCodec, RejectsOverlongHeader)
+{
+  VarintPrefixCodec codec;
+  byte header[11];
+  std::memset(header, 0x80, sizeof(header));
+
+  EXPECT_EQ(0u, codec.measure(header, 9));
+  EXPECT_EQ(Malformed, codec.measure(header, 10)) << "tenth byte continues";
+  EXPECT_EQ(Malformed, codec.measure(header, 11));
+}
+
+TEST(VarintPrefixCodec, RejectsTenthByteBeyondSixtyFourBits)
+{
+  VarintPrefixCodec codec;
+  byte header[10];
+  std::memset(header, 0x80, sizeof(header));
+
+  for (byte last : {byte(0x02), byte(0x7E), byte(0x7F)})
+  {
+    header[9] = last;
+    EXPECT_EQ(Malformed, codec.measure(header, 10)) << "tenth byte " << int(last);
+  }
+
+  // 2^63 is representable, but a frame of 2^64-1 bytes cannot be measured
+  header[9] = 0x01;
+  if (sizeof(size_t) == 8)
+  {
+    EXPECT_EQ(10u + (size_t(1) << 63), codec.measure(header, 10));
+  }
+  std::memset(header, 0xFF, 9);
+  EXPECT_EQ(Malformed, codec.measure(header, 10));
+}
+
+TEST(VarintPrefixCodec, RoundTripsFrames)
+{
+  std::vector<byte> const stream = encode<VarintPrefixCodec>(payloads());
+  for (size_t chunk : {size_t(1), size_t(2), size_t(4096), stream.size()})
+  {
+    FrameReader<VarintPrefixCodec> reader;
+    EXPECT_EQ(payloads(), decode(reader, stream, chunk)) << "receives of " << chunk << " bytes";
+  }
+}
+
+// ------------------------------------ DELIMITER CODEC -----------------------------------
+
+TEST(DelimiterCodec, RejectsInvalidDelimiter)
+{
+  EXPECT_THROW(DelimiterCodec(""), invalid_argument);
+  EXPECT_THROW(DelimiterCodec("123456789"), invalid_argument);
+  EXPECT_NO_THROW(DelimiterCodec("12345678"));
+}
+
+TEST(DelimiterCodec, FindsDelimiterStraddlingReceives)
+{
+  std::string const text = "GET / HTTP/1.1\r\nHost: x\r\n\r\n";
+  std::vector<byte> const stream(text.begin(), text.end());
+  std::vector<std::string> const lines = { "GET / HTTP/1.1", "Host: x", "" };
+
+  for (size_t chunk : {size_t(1), size_t(2), size_t(15), stream.size()})
+  {
+    FrameReader<DelimiterCodec> reader(DelimiterCodec("\r\n"));
+    EXPECT_EQ(lines, decode(reader, stream, chunk)) << "receives of " << chunk << " bytes";
+  }
+}
+
+TEST(DelimiterCodec, RoundTripsFrames)
+{
+  std::vector<std::string> const lines = { "one", "", "three" };
+  std::vector<byte> const stream = encode<DelimiterCodec>(lines, DelimiterCodec("\r\n"));
+
+  EXPECT_EQ("one\r\n\r\nthree\r\n", std::string(stream.begin(), stream.end()));
+  FrameReader<DelimiterCodec> reader(DelimiterCodec("\r\n"));
+  EXPECT_EQ(lines, decode(reader, stream, 1));
+}
+
+// ------------------------------------- FRAME READER -------------------------------------
+
+TEST(FrameReader, DeliversCompleteFramesInPlace)
+{
+  std::vector<byte> stream = encode<LengthPrefixCodec<>>({ "one", "two", "three" });
+  stream.resize(stream.size() - 2);
+
+  FrameReader<LengthPrefixCodec<>> reader;
+  std::vector<const byte*> payloads;
+  EXPECT_TRUE(reader.feed(stream.data(), stream.size(), [&] (FrameView& v) { payloads.push_back(v.data()); }));
+
+  ASSERT_EQ(2u, payloads.size());
+  EXPECT_EQ(stream.data() + 4, payloads[0]);
+  EXPECT_EQ(stream.data() + 11, payloads[1]);
+  EXPECT_EQ(7u, reader.buffered()) << "partial frame is retained";
+
+  reader.reset();
+  EXPECT_EQ(0u, reader.buffered());
+}
+
+TEST(FrameReader, ResumesInPlaceAfterStraddlingFrame)
+{
+  std::string const text = "first\nsecond\nthird\n";
+  std::vector<byte> stream(text.begin(), text.end());
+
+  FrameReader<DelimiterCodec> reader;
+  std::vector<std::string> lines;
+  std::vector<const byte*> payloads;
+  auto const handler = [&] (FrameView& v) {
+    lines.emplace_back(reinterpret_cast<const char*>(v.data()), v.size());
+    payloads.push_back(v.data());
+  };
+  EXPECT_TRUE(reader.feed(stream.data(), 3, handler));
+  EXPECT_TRUE(reader.feed(stream.data() + 3, stream.size() - 3, handler));
+
+  EXPECT_EQ((std::vector<std::string>{ "first", "second", "third" }), lines);
+  ASSERT_EQ(3u, payloads.size());
+  EXPECT_EQ(stream.data() + 6, payloads[1]) << "frames after the straddling frame are not buffered";
+  EXPECT_EQ(stream.data() + 13, payloads[2]);
+  EXPECT_EQ(0u, reader.buffered());
+}
+
+TEST(FrameReader, RejectsFrameAboveMaximum)
+{
+  std::vector<byte> const stream = encode<LengthPrefixCodec<>>({ std::string(100, 'z') });
+  for (size_t chunk : {size_t(1), stream.size()})
+  {
+    bool ok = true;
+    FrameReader<LengthPrefixCodec<>> reader(LengthPrefixCodec<>(), 64);
+    EXPECT_TRUE(decode(reader, stream, chunk, &ok).empty());
+    EXPECT_FALSE(ok) << "receives of " << chunk << " bytes";
+  }
+}
+
+TEST(FrameReader, RejectsMalformedStream)
+{
+  std::vector<byte> stream(10, 0x80);
+  for (size_t chunk : {size_t(1), stream.size()})
+  {
+    bool ok = true;
+    FrameReader<VarintPrefixCodec> reader(VarintPrefixCodec(), std::numeric_limits<size_t>::max());
+    decode(reader, stream, chunk, &ok);
+    EXPECT_FALSE(ok) << "receives of " << chunk << " bytes";
+  }
+}
+
+// ------------------------------------- FRAME WRITER -------------------------------------
+
+TEST(FrameWriter, BatchesFramesUntilFlushed)
+{
+  FrameWriter<VarintPrefixCodec> writer(std::make_shared<SocketBufferPool>(64), VarintPrefixCodec(), 100);
+  byte const payload[40] = {};
+
+  EXPECT_FALSE(writer.write(payload, sizeof(payload)));
+  EXPECT_FALSE(writer.write(payload, sizeof(payload)));
+  EXPECT_TRUE(writer.write(payload, sizeof(payload))) << "threshold reached";
+  EXPECT_EQ(3u, writer.frames());
+  EXPECT_EQ(3 * 41u, writer.size());
+
+  Sink sink;
+  EXPECT_TRUE(writer.flush(sink));
+  EXPECT_TRUE(writer.flush(sink)) << "empty batch";
+  EXPECT_EQ(1u, sink.Writes) << "single write per batch";
+  EXPECT_EQ(3 * 41u, sink.Data.size());
+  EXPECT_EQ(0u, writer.frames());
+  EXPECT_FALSE(writer.full());
+}
+
+TEST(FrameWriter, WritesStreamPayloads)
+{
+  auto pool = std::make_shared<SocketBufferPool>(16);
+  ChunkedStream payload(pool);
+  std::string const text(50, 'q');
+  payload.write(reinterpret_cast<const byte*>(text.data()), text.size());
+
+  FrameWriter<LengthPrefixCodec<>> writer(pool);
+  writer.write(payload);
+  Sink sink;
+  writer.flush(sink);
+
+  FrameReader<LengthPrefixCodec<>> reader;
+  EXPECT_EQ(std::vector<std::string>{text}, decode(reader, sink.Data, sink.Data.size()));
+}
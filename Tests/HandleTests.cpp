@@ -0,0 +1,309 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\HandleTests.cpp
+//! \brief Unit tests for UniqueHandle, SharedHandle and HandlePool
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/utils/HandlePool.hpp>           //!< HandlePool
+#include <wtl/utils/SharedHandle.hpp>         //!< SharedHandle
+#include <wtl/utils/UniqueHandle.hpp>         //!< UniqueHandle
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct FakeAlloc - Allocator of sequentially numbered handles, counting creation and destruction
+  //!
+  //! \remarks Negative arguments fail creation. Like the native allocators, only created handles are destroyed.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct FakeAlloc
+  {
+    static constexpr int  npos = -1;
+
+    static std::atomic<int>  Next,
+                             Created,
+                             Destroyed;
+    static int               Failing;      //!< Handle whose destruction fails
+
+    static NativeHandle<int>  create(int arg)
+    {
+      if (arg < 0)
+        return NativeHandle<int>(npos, AllocType::WeakRef);
+      ++Created;
+      return NativeHandle<int>(Next++, AllocType::Create);
+    }
+
+    static bool  destroy(NativeHandle<int> h) noexcept
+    {
+      if (h.Method != AllocType::Create)
+        return true;
+      if (h.Handle == Failing)
+        return false;
+      ++Destroyed;
+      return true;
+    }
+
+    //! Reset counters
+    static void  reset()
+    {
+      Next = 100;
+      Created = Destroyed = 0;
+      Failing = npos;
+    }
+  };
+
+  std::atomic<int>  FakeAlloc::Next {100},
+                    FakeAlloc::Created {0},
+                    FakeAlloc::Destroyed {0};
+  int               FakeAlloc::Failing = FakeAlloc::npos;
+
+  //! \alias unique_t - Unique fake handle
+  using unique_t = UniqueHandle<int,FakeAlloc>;
+
+  //! \alias shared_t - Shared fake handle
+  using shared_t = SharedHandle<int,FakeAlloc>;
+
+  //! \alias pool_t - Pool of fake handles keyed by creation argument
+  using pool_t = HandlePool<int,int,FakeAlloc>;
+
+  //! Fixture resetting the allocator counters
+  struct HandleTest : ::testing::Test
+  {
+    void SetUp() override
+    {
+      FakeAlloc::reset();
+    }
+  };
+
+  using UniqueHandleTest = HandleTest;
+  using SharedHandleTest = HandleTest;
+  using HandlePoolTest = HandleTest;
+}
+
+// ------------------------------------- UNIQUE HANDLE ------------------------------------
+
+TEST_F(UniqueHandleTest, StoresHandleInline)
+{
+  EXPECT_EQ(sizeof(NativeHandle<int>), sizeof(unique_t));
+  EXPECT_FALSE(unique_t().exists());
+}
+
+TEST_F(UniqueHandleTest, DestroysCreatedHandle)
+{
+  {
+    unique_t h(1);
+    EXPECT_TRUE(h);
+    EXPECT_EQ(100, h.get());
+    EXPECT_EQ(AllocType::Create, h.method());
+  }
+  EXPECT_EQ(1, FakeAlloc::Created);
+  EXPECT_EQ(1, FakeAlloc::Destroyed);
+}
+
+TEST_F(UniqueHandleTest, ThrowsWhenCreationFails)
+{
+  EXPECT_THROW(unique_t(-1), platform_error);
+  EXPECT_EQ(0, FakeAlloc::Created);
+}
+
+TEST_F(UniqueHandleTest, TransfersOwnershipByMoving)
+{
+  unique_t a(1), b(2);
+  unique_t c(std::move(a));
+  EXPECT_FALSE(a);
+  EXPECT_EQ(100, c.get());
+
+  c = std::move(b);
+  EXPECT_EQ(1, FakeAlloc::Destroyed) << "existing handle destroyed by assignment";
+  EXPECT_EQ(101, c.get());
+  EXPECT_FALSE(b);
+}
+
+TEST_F(UniqueHandleTest, DetachRelinquishesOwnership)
+{
+  NativeHandle<int> h(FakeAlloc::npos, AllocType::WeakRef);
+  {
+    unique_t u(1);
+    h = u.detach();
+    EXPECT_FALSE(u);
+  }
+  EXPECT_EQ(0, FakeAlloc::Destroyed);
+  EXPECT_EQ(100, h.Handle);
+
+  unique_t owner;
+  owner.reset(h);
+  owner.reset(NativeHandle<int>(7, AllocType::WeakRef));
+  EXPECT_EQ(1, FakeAlloc::Destroyed);
+}
+
+TEST_F(UniqueHandleTest, ReleaseReportsFailure)
+{
+  unique_t h(1);
+  FakeAlloc::Failing = h.get();
+  EXPECT_THROW(h.release(), platform_error);
+  EXPECT_FALSE(h) << "empty even when destruction fails";
+}
+
+// ------------------------------------- SHARED HANDLE ------------------------------------
+
+TEST_F(SharedHandleTest, CountsOnlyOnceCopied)
+{
+  shared_t a(1);
+  EXPECT_EQ(1u, a.owners());
+  EXPECT_EQ(1u, HandleShareTable<int>::owners(a.get())) << "no table entry until copied";
+  {
+    shared_t b(a), c = b;
+    EXPECT_EQ(3u, a.owners());
+    EXPECT_EQ(3u, c.owners());
+    EXPECT_EQ(a, c);
+  }
+  EXPECT_EQ(1u, a.owners());
+  EXPECT_EQ(0, FakeAlloc::Destroyed);
+
+  a.release();
+  EXPECT_EQ(1, FakeAlloc::Destroyed);
+  EXPECT_EQ(0u, a.owners());
+}
+
+TEST_F(SharedHandleTest, DestroysAfterLastOwner)
+{
+  shared_t* last = nullptr;
+  {
+    shared_t a(1);
+    shared_t b = a;
+    last = new shared_t(b);
+  }
+  EXPECT_EQ(0, FakeAlloc::Destroyed);
+  delete last;
+  EXPECT_EQ(1, FakeAlloc::Destroyed);
+}
+
+TEST_F(SharedHandleTest, AssignmentReleasesPreviousHandle)
+{
+  shared_t a(1), b(2);
+  a = b;
+  EXPECT_EQ(1, FakeAlloc::Destroyed);
+  EXPECT_EQ(2u, b.owners());
+
+  a = shared_t();
+  EXPECT_EQ(1u, b.owners());
+  EXPECT_EQ(1, FakeAlloc::Destroyed);
+}
+
+TEST_F(SharedHandleTest, AdoptsUniqueHandle)
+{
+  unique_t u(1);
+  shared_t s(std::move(u));
+  EXPECT_FALSE(u);
+  EXPECT_EQ(100, s.get());
+  s = shared_t();
+  EXPECT_EQ(1, FakeAlloc::Destroyed);
+}
+
+TEST_F(SharedHandleTest, NeverCountsUnownedHandles)
+{
+  shared_t weak(42, AllocType::WeakRef);
+  shared_t copy(weak);
+  EXPECT_EQ(1u, copy.owners());
+  EXPECT_EQ(1u, HandleShareTable<int>::owners(42));
+}
+
+TEST_F(SharedHandleTest, SharesAcrossThreads)
+{
+  shared_t const origin(1);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+    threads.emplace_back([&origin] {
+      for (int i = 0; i < 10000; ++i)
+      {
+        shared_t copy(origin);
+        shared_t another = copy;
+      }
+    });
+  for (auto& t : threads)
+    t.join();
+
+  EXPECT_EQ(1u, origin.owners());
+  EXPECT_EQ(0, FakeAlloc::Destroyed);
+}
+
+// -------------------------------------- HANDLE POOL -------------------------------------
+
+TEST_F(HandlePoolTest, ReusesReleasedHandle)
+{
+  pool_t pool;
+  int first;
+  {
+    auto lease = pool.acquire(1);
+    first = lease.get();
+    EXPECT_EQ(1, lease.key());
+  }
+  EXPECT_EQ(1u, pool.idle());
+  EXPECT_EQ(first, pool.acquire(1).get());
+  EXPECT_EQ(1u, pool.hits());
+  EXPECT_EQ(1u, pool.misses());
+  EXPECT_EQ(1, FakeAlloc::Created);
+}
+
+TEST_F(HandlePoolTest, MatchesCreationArguments)
+{
+  pool_t pool;
+  pool.acquire(1);
+  pool.acquire(2);
+  auto const lease = pool.acquire(2);
+
+  EXPECT_EQ(101, lease.get()) << "most recently released first";
+  EXPECT_EQ(1u, pool.idle());
+  EXPECT_EQ(2, FakeAlloc::Created);
+}
+
+TEST_F(HandlePoolTest, DestroysBeyondCapacity)
+{
+  {
+    pool_t pool(2);
+    {
+      auto a = pool.acquire(1), b = pool.acquire(1), c = pool.acquire(1);
+    }
+    EXPECT_EQ(2u, pool.idle());
+    EXPECT_EQ(1, FakeAlloc::Destroyed);
+  }
+  EXPECT_EQ(3, FakeAlloc::Destroyed) << "idle handles destroyed with the pool";
+}
+
+TEST_F(HandlePoolTest, DetachedHandlesLeaveThePool)
+{
+  pool_t pool;
+  unique_t owner;
+  owner.reset(pool.acquire(1).detach());
+
+  EXPECT_EQ(0u, pool.idle());
+  EXPECT_EQ(100, owner.get());
+  EXPECT_EQ(0, FakeAlloc::Destroyed);
+}
+
+TEST_F(HandlePoolTest, MoveAssignmentReturnsPreviousLease)
+{
+  pool_t pool;
+  auto a = pool.acquire(1);
+  a = pool.acquire(2);
+  EXPECT_EQ(1u, pool.idle());
+  EXPECT_EQ(2, a.key());
+
+  pool.clear();
+  EXPECT_EQ(0u, pool.idle());
+  EXPECT_EQ(1, FakeAlloc::Destroyed);
+}
+
+TEST_F(HandlePoolTest, ThrowsWhenCreationFails)
+{
+  pool_t pool;
+  EXPECT_THROW(pool.acquire(-1), platform_error);
+  EXPECT_EQ(1u, pool.misses());
+}
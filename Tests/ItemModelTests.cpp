@@ -0,0 +1,240 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\ItemModelTests.cpp
+//! \brief Unit tests for ItemModel
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/utils/ItemModel.hpp>            //!< ItemModel
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! \alias model_t - Narrow character model
+  using model_t = ItemModel<char>;
+
+  //! Get the text of every row
+  std::vector<std::string>  rows(const model_t& m)
+  {
+    std::vector<std::string> r;
+    for (uint32_t row = 0; row < m.size(); ++row)
+      r.emplace_back(m[row].Text, m[row].Length);
+    return r;
+  }
+
+  //! Filter accepting items whose text does not begin with 'x'
+  bool  notX(const model_t::ItemView& v)
+  {
+    return v.Length == 0 || v.Text[0] != 'x';
+  }
+
+  //! \alias strings - Define expected rows
+  using strings = std::vector<std::string>;
+}
+
+// --------------------------------------- APPEND ---------------------------------------
+
+TEST(ItemModel, AppendsItemsWithTextAndData)
+{
+  model_t m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(0u, m.append("alpha", 10));
+  EXPECT_EQ(1u, m.append(std::string("beta"), 20));
+  EXPECT_EQ(2u, m.append("gamma!", 5, 30));
+
+  ASSERT_EQ(3u, m.size());
+  EXPECT_EQ(strings({"alpha", "beta", "gamma"}), rows(m));
+  EXPECT_EQ(20u, m[1].Data);
+  EXPECT_EQ(1u, m[1].Index);
+  EXPECT_EQ('\0', m[2].Text[5]) << "null terminated";
+}
+
+TEST(ItemModel, AppendsRangesInBulk)
+{
+  std::vector<std::string> const names {"one", "two", "three"};
+  const char* const more[] = {"four", "five"};
+
+  model_t m;
+  m.append("zero");
+  m.append(names.begin(), names.end());
+  m.append(std::begin(more), std::end(more));
+
+  EXPECT_EQ(strings({"zero", "one", "two", "three", "four", "five"}), rows(m));
+  EXPECT_EQ(6u, m.total());
+  EXPECT_EQ(4u, m.item(4).Index);
+}
+
+TEST(ItemModel, BulkAppendRespectsFilter)
+{
+  std::vector<std::string> const names {"a", "xb", "c", "xd"};
+  model_t m;
+  m.filter(notX);
+  m.append(names.begin(), names.end());
+
+  EXPECT_EQ(strings({"a", "c"}), rows(m));
+  EXPECT_EQ(4u, m.total());
+}
+
+TEST(ItemModel, ChecksBounds)
+{
+  model_t m;
+  m.append("only");
+  EXPECT_EQ(std::string("only"), m.at(0).Text);
+  EXPECT_THROW(m.at(1), out_of_range);
+  EXPECT_THROW(m.item(1), out_of_range);
+}
+
+// ---------------------------------- SORT & FILTER -------------------------------------
+
+TEST(ItemModel, SortsByText)
+{
+  model_t m;
+  for (const char* s : {"pear", "apple", "fig", "apple pie", "Banana"})
+    m.append(s);
+
+  m.sort();
+  EXPECT_EQ(strings({"Banana", "apple", "apple pie", "fig", "pear"}), rows(m)) << "ordinal comparison";
+  EXPECT_EQ(0u, m.item(0).Index) << "items retain their index";
+}
+
+TEST(ItemModel, SortIsStable)
+{
+  model_t m;
+  for (const char* s : {"b1", "a1", "b2", "a2", "b3", "a3"})
+    m.append(s);
+
+  // Compare by first character only
+  auto const byLetter = [] (const model_t::ItemView& a, const model_t::ItemView& b) { return a.Text[0] < b.Text[0]; };
+  m.sort(byLetter);
+  EXPECT_EQ(strings({"a1", "a2", "a3", "b1", "b2", "b3"}), rows(m));
+
+  // Re-sorting an ordered model changes nothing
+  m.sort(byLetter);
+  EXPECT_EQ(strings({"a1", "a2", "a3", "b1", "b2", "b3"}), rows(m));
+}
+
+TEST(ItemModel, FilterRetainsSortOrder)
+{
+  model_t m;
+  for (const char* s : {"xz", "c", "xa", "a", "b"})
+    m.append(s);
+
+  m.sort();
+  m.filter(notX);
+  EXPECT_EQ(strings({"a", "b", "c"}), rows(m));
+  EXPECT_TRUE(m.filtered());
+  EXPECT_EQ(5u, m.total());
+
+  m.filter(nullptr);
+  EXPECT_EQ(strings({"a", "b", "c", "xa", "xz"}), rows(m)) << "excluded items were sorted too";
+  EXPECT_FALSE(m.filtered());
+}
+
+TEST(ItemModel, SortRetainsFilter)
+{
+  model_t m;
+  for (const char* s : {"xz", "c", "xa", "a", "b"})
+    m.append(s);
+
+  m.filter(notX);
+  EXPECT_EQ(strings({"c", "a", "b"}), rows(m));
+  m.sort();
+  EXPECT_EQ(strings({"a", "b", "c"}), rows(m));
+}
+
+TEST(ItemModel, AppendsAfterSortedRows)
+{
+  model_t m;
+  m.append("b");
+  m.append("a");
+  m.sort();
+  m.append("0");
+  EXPECT_EQ(strings({"a", "b", "0"}), rows(m)) << "appended regardless of sort order";
+
+  m.sort();
+  EXPECT_EQ(strings({"0", "a", "b"}), rows(m));
+}
+
+TEST(ItemModel, ClearRetainsFilter)
+{
+  model_t m;
+  m.filter(notX);
+  m.append("xa");
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(0u, m.total());
+
+  m.append("xb");
+  m.append("c");
+  EXPECT_EQ(strings({"c"}), rows(m));
+}
+
+// --------------------------------------- SEARCH ---------------------------------------
+
+TEST(ItemModel, FindsPrefixWrappingAtEnd)
+{
+  model_t m;
+  for (const char* s : {"apple", "banana", "avocado", "cherry"})
+    m.append(s);
+
+  EXPECT_EQ(0, m.find("a"));
+  EXPECT_EQ(2, m.find("a", 1));
+  EXPECT_EQ(0, m.find("a", 3)) << "wraps to first row";
+  EXPECT_EQ(1, m.find("ban", 2));
+  EXPECT_EQ(-1, m.find("date"));
+  EXPECT_EQ(-1, m.find("applesauce")) << "prefix longer than text";
+  EXPECT_EQ(3, m.find("", 3)) << "empty prefix matches start row";
+}
+
+TEST(ItemModel, FindsRowsOfSortedAndFilteredView)
+{
+  model_t m;
+  for (const char* s : {"xapple", "cherry", "apple", "banana"})
+    m.append(s);
+  m.sort();
+  m.filter(notX);
+
+  EXPECT_EQ(0, m.find("apple"));
+  EXPECT_EQ(2, m.find("ch"));
+  EXPECT_EQ(-1, m.find("x"));
+  EXPECT_EQ(-1, model_t().find("a")) << "empty model";
+}
+
+// -------------------------------------- REVISION --------------------------------------
+
+TEST(ItemModel, RevisionChangesWithRows)
+{
+  model_t m;
+  uint32_t rev = m.revision();
+  auto changed = [&] { bool const r = m.revision() != rev; rev = m.revision(); return r; };
+
+  m.filter(notX);
+  EXPECT_TRUE(changed()) << "filter";
+  m.append("a");
+  EXPECT_TRUE(changed()) << "visible append";
+  m.append("xb");
+  EXPECT_FALSE(changed()) << "filtered append";
+  m.sort();
+  EXPECT_TRUE(changed()) << "sort";
+  m.clear();
+  EXPECT_TRUE(changed()) << "clear";
+  m.reserve(100, 1000);
+  EXPECT_FALSE(changed()) << "reserve";
+}
+
+TEST(ItemModel, CopiesDeeply)
+{
+  model_t m;
+  m.append("one");
+  model_t copy(m);
+  m.clear();
+  m.append("two");
+
+  EXPECT_EQ(strings({"one"}), rows(copy));
+  EXPECT_EQ(strings({"two"}), rows(m));
+}
@@ -0,0 +1,197 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\LazyTests.cpp
+//! \brief Unit tests for Lazy
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/utils/Lazy.hpp>                 //!< Lazy
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct Counted - Object counting its live instances
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct Counted
+  {
+    static std::atomic<int>  Live;
+
+    int  Value;
+
+    explicit Counted(int v) : Value(v)          { ++Live; }
+    Counted(const Counted& r) : Value(r.Value)  { ++Live; }
+    ~Counted()                                  { --Live; }
+  };
+
+  std::atomic<int>  Counted::Live {0};
+
+  //! Start 'n' threads executing 'fn' simultaneously, then join them
+  template <typename FUNCTION>
+  void  race(unsigned n, FUNCTION fn)
+  {
+    std::atomic<bool> go {false};
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < n; ++t)
+      threads.emplace_back([&go, &fn, t] {
+        while (!go.load())
+          std::this_thread::yield();
+        fn(t);
+      });
+    go = true;
+    for (auto& t : threads)
+      t.join();
+  }
+}
+
+// ---------------------------------------- CREATION --------------------------------------
+
+TEST(Lazy, StoresObjectInline)
+{
+  EXPECT_LE(sizeof(Lazy<int>), 2 * sizeof(int));
+  EXPECT_FALSE(Lazy<int>().exists());
+}
+
+TEST(Lazy, CreatesAndDestroysObject)
+{
+  {
+    Lazy<Counted> lazy;
+    EXPECT_FALSE(lazy);
+    lazy.create(42);
+    EXPECT_TRUE(lazy);
+    EXPECT_EQ(42, lazy->Value);
+    EXPECT_EQ(1, Counted::Live);
+
+    lazy.destroy();
+    EXPECT_TRUE(!lazy);
+    EXPECT_EQ(0, Counted::Live);
+
+    lazy.create(7);
+    EXPECT_EQ(7, (*lazy).Value);
+  }
+  EXPECT_EQ(0, Counted::Live) << "destroyed with the Lazy";
+}
+
+TEST(Lazy, ThrowsWhenCreatedTwice)
+{
+  Lazy<Counted> lazy;
+  lazy.create(1);
+  EXPECT_THROW(lazy.create(2), logic_error);
+  EXPECT_EQ(1, lazy->Value) << "existing object untouched";
+  EXPECT_EQ(1, Counted::Live);
+}
+
+TEST(Lazy, CopiesAndMovesObject)
+{
+  Lazy<std::string> a, empty;
+  a.create("value");
+
+  Lazy<std::string> b(a), c(std::move(b)), d(empty);
+  EXPECT_EQ("value", *a);
+  EXPECT_EQ("value", *c);
+  EXPECT_FALSE(d);
+
+  d = a;
+  EXPECT_EQ("value", *d);
+  d = empty;
+  EXPECT_FALSE(d);
+}
+
+// ------------------------------------- GET OR CREATE ------------------------------------
+
+TEST(Lazy, InvokesFactoryOnlyWhenEmpty)
+{
+  Lazy<int> lazy;
+  int calls = 0;
+  auto factory = [&calls] { return ++calls; };
+
+  EXPECT_EQ(1, lazy.get_or_create(factory));
+  EXPECT_EQ(1, lazy.get_or_create(factory));
+  EXPECT_EQ(1, calls);
+}
+
+TEST(Lazy, RemainsEmptyWhenFactoryThrows)
+{
+  Lazy<int> lazy;
+  EXPECT_THROW(lazy.get_or_create([] () -> int { throw std::runtime_error("failed"); }), std::runtime_error);
+  EXPECT_FALSE(lazy);
+  EXPECT_EQ(3, lazy.get_or_create([] { return 3; })) << "retried after failure";
+}
+
+// -------------------------------------- CONCURRENCY -------------------------------------
+
+TEST(Lazy, CreatesOnceAcrossThreads)
+{
+  for (int round = 0; round < 20; ++round)
+  {
+    Lazy<Counted> lazy;
+    std::atomic<int> calls {0};
+    std::atomic<int> mismatches {0};
+
+    race(8, [&] (unsigned) {
+      Counted& obj = lazy.get_or_create([&calls] {
+        ++calls;
+        std::this_thread::yield();
+        return Counted(99);
+      });
+      mismatches += obj.Value != 99;
+    });
+
+    EXPECT_EQ(1, calls);
+    EXPECT_EQ(0, mismatches);
+    EXPECT_EQ(1, Counted::Live);
+  }
+  EXPECT_EQ(0, Counted::Live);
+}
+
+TEST(Lazy, WaitersRetryWhenCreatorThrows)
+{
+  Lazy<int> lazy;
+  std::atomic<int> failures {0};
+
+  race(8, [&] (unsigned) {
+    try {
+      lazy.get_or_create([&failures] () -> int {
+        if (failures++ == 0)
+          throw std::runtime_error("first attempt fails");
+        return 5;
+      });
+    }
+    catch (std::runtime_error&) {
+    }
+  });
+
+  EXPECT_EQ(5, *lazy);
+  EXPECT_EQ(2, failures) << "exactly one retry";
+}
+
+TEST(Lazy, ExactlyOneConcurrentCreateSucceeds)
+{
+  for (int round = 0; round < 20; ++round)
+  {
+    Lazy<Counted> lazy;
+    std::atomic<int> created {0}, refused {0};
+
+    race(8, [&] (unsigned t) {
+      try {
+        lazy.create(int(t));
+        ++created;
+      }
+      catch (logic_error&) {
+        ++refused;
+      }
+    });
+
+    EXPECT_EQ(1, created);
+    EXPECT_EQ(7, refused);
+    EXPECT_EQ(1, Counted::Live);
+  }
+}
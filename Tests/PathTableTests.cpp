@@ -0,0 +1,182 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\PathTableTests.cpp
+//! \brief Unit tests for PathTable and InternedPath
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/utils/PathTable.hpp>            //!< PathTable, InternedPath
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! \alias table_t - Narrow path table
+  using table_t = PathTable<Encoding::ANSI>;
+
+  //! Convert '/' separators to native separators
+  std::string  native(std::string path)
+  {
+    for (char& c : path)
+      if (c == '/')
+        c = table_t::separator;
+    return path;
+  }
+
+  //! Copy a view
+  std::string  text(const table_t::view_t& v)
+  {
+    return v.str();
+  }
+}
+
+TEST(PathTable, InternsEachPathOnce)
+{
+  table_t table;
+  table_t::id_t const a = table.intern("C:\\Windows\\System32\\kernel32.dll"),
+                      b = table.intern("C:/Windows/System32/kernel32.dll");
+
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(5u, table.size()) << "empty path, three folders and one file";
+  EXPECT_EQ(native("C:/Windows/System32/kernel32.dll"), table.str(a));
+  EXPECT_EQ(4u, table.depth(a));
+  EXPECT_EQ(table.str(a).size(), table.length(a));
+}
+
+TEST(PathTable, SharesParentFolders)
+{
+  table_t table;
+  table_t::id_t const one = table.intern("src/gdi/FontCache.hpp"),
+                      two = table.intern("src/gdi/ThemeCache.hpp"),
+                      folder = table.intern("src/gdi");
+
+  EXPECT_EQ(folder, table.parent(one));
+  EXPECT_EQ(folder, table.parent(two));
+  EXPECT_EQ(5u, table.size());
+  EXPECT_TRUE(table.isAncestor(folder, one));
+  EXPECT_TRUE(table.isAncestor(table.intern("src"), two));
+  EXPECT_FALSE(table.isAncestor(one, two));
+  EXPECT_FALSE(table.isAncestor(folder, folder));
+}
+
+TEST(PathTable, DiscardsRedundantSeparatorsAndDots)
+{
+  table_t table;
+  table_t::id_t const id = table.intern("a/b/c");
+
+  for (const char* alias : {"a//b/c", "a/b/c/", "./a/b/./c", "a/x/../b/c", "a/b/c/d/..", "a\\b\\\\c\\"})
+    EXPECT_EQ(id, table.intern(alias)) << alias;
+}
+
+TEST(PathTable, RetainsLeadingParentComponents)
+{
+  table_t table;
+  table_t::id_t const id = table.intern("../../include/wtl");
+
+  EXPECT_EQ(4u, table.depth(id));
+  EXPECT_EQ(native("../../include/wtl"), table.str(id));
+  EXPECT_EQ(table.intern(".."), table.intern("a/../.."));
+}
+
+TEST(PathTable, RetainsRootComponent)
+{
+  table_t table;
+  table_t::id_t const posix = table.intern("/usr/lib/libc.so"),
+                      unc = table.intern("\\\\server\\share\\file.txt");
+
+  EXPECT_EQ(native("/usr/lib/libc.so"), table.str(posix));
+  EXPECT_EQ(native("//server/share/file.txt"), table.str(unc));
+  EXPECT_EQ(native("/"), text(*table.components(posix).begin()));
+  EXPECT_EQ(unc, table.intern("///server/share/file.txt")) << "excess leading separators are ignored";
+  EXPECT_NE(table.intern("usr/lib/libc.so"), posix);
+}
+
+TEST(PathTable, QueriesComponentsWithoutCopying)
+{
+  table_t table;
+  InternedPath<> const path(table, "docs/archive.tar.gz");
+
+  EXPECT_EQ("archive.tar.gz", text(path.fileName()));
+  EXPECT_EQ(".gz", text(path.extension()));
+  EXPECT_EQ("docs", text(path.folder().fileName()));
+  EXPECT_TRUE(path.folder().extension().empty());
+  EXPECT_EQ(table_t::empty, path.folder().folder().id());
+
+  std::vector<std::string> parts;
+  for (auto const& c : path.components())
+    parts.push_back(c.str());
+  EXPECT_EQ((std::vector<std::string>{"docs", "archive.tar.gz"}), parts);
+}
+
+TEST(PathTable, FindsWithoutInterning)
+{
+  table_t table;
+  table.intern("a/b");
+  uint32_t const size = table.size();
+
+  EXPECT_EQ(table.intern("a/b"), table.find("a/b", 3));
+  EXPECT_EQ(table_t::npos, table.find("a/c", 3));
+  EXPECT_EQ(table_t::npos, table.find("x/y/z", 5));
+  EXPECT_EQ(size, table.size());
+}
+
+TEST(PathTable, CopiesIntoCallerBuffer)
+{
+  table_t table;
+  table_t::id_t const id = table.intern("one/two");
+  char buffer[8];
+
+  EXPECT_EQ(7u, table.copy(id, buffer, sizeof(buffer)));
+  EXPECT_EQ(native("one/two"), buffer);
+  EXPECT_THROW(table.copy(id, buffer, 7), length_error);
+  EXPECT_EQ(0u, table.copy(table_t::empty, buffer, 1));
+  EXPECT_STREQ("", buffer);
+}
+
+TEST(PathTable, CombinesRelativeAndAbsolutePaths)
+{
+  table_t table;
+  InternedPath<> const folder(table, "C:\\Program Files");
+
+  EXPECT_EQ(native("C:/Program Files/App/app.exe"), (folder + "App\\app.exe").str());
+  EXPECT_EQ(native("C:/app.exe"), (folder + "..\\app.exe").str());
+  EXPECT_EQ(native("D:/data"), (folder + "D:\\data").str());
+  EXPECT_EQ(native("/etc"), (folder + "/etc").str());
+}
+
+TEST(PathTable, ComparesPathsAcrossTables)
+{
+  table_t first, second;
+  InternedPath<> const a(first, "x/y"),
+                       b(second, "q/x/y"),
+                       c(second, "x/y");
+
+  EXPECT_EQ(a, c);
+  EXPECT_NE(a, b);
+  EXPECT_NE(b, c);
+}
+
+TEST(PathTable, RejectsOverlongComponent)
+{
+  table_t table;
+  std::string const name(0x10000, 'x');
+
+  EXPECT_THROW(table.intern(name.c_str()), length_error);
+  EXPECT_NO_THROW(table.intern(name.c_str(), 0xFFFF));
+}
+
+TEST(PathTable, SurvivesRehashing)
+{
+  table_t table;
+  std::vector<table_t::id_t> ids;
+  for (int i = 0; i < 5000; ++i)
+    ids.push_back(table.intern(("root/d" + std::to_string(i % 50) + "/f" + std::to_string(i)).c_str()));
+
+  EXPECT_EQ(1u + 1 + 50 + 5000, table.size());
+  for (int i = 0; i < 5000; ++i)
+    ASSERT_EQ(native("root/d" + std::to_string(i % 50) + "/f" + std::to_string(i)), table.str(ids[i]));
+}
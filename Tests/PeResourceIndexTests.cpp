@@ -0,0 +1,302 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\PeResourceIndexTests.cpp
+//! \brief Unit tests for PeResourceIndex, using synthetic images
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/resources/PeResourceIndex.hpp>  //!< PeResourceIndex
+#include <gtest/gtest.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct ImageBuilder - Builds a minimal 32-bit PE image, laid out as loaded, with a resource section
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct ImageBuilder
+  {
+    static constexpr uint32_t  root = 0x200;       //!< Offset (and RVA) of resource section
+    static constexpr uint32_t  optional = 0x98;    //!< Offset of optional header
+
+    std::vector<uint8_t>  Bytes;      //!< Image
+    uint32_t              Next;       //!< Next free offset within resource section
+
+    explicit ImageBuilder(uint32_t length = 0x1000) : Bytes(root + length), Next(0)
+    {
+      put16(0, 0x5A4D);                     // 'MZ'
+      put32(0x3C, 0x80);                    // e_lfanew
+      put32(0x80, 0x00004550);              // 'PE\0\0'
+      put16(0x84 + 16, 224);                // SizeOfOptionalHeader
+      put16(optional, 0x10B);               // PE32
+      put32(optional + 92, 16);             // NumberOfRvaAndSizes
+      put32(optional + 96 + 2*8, root);     // Resource directory RVA
+      put32(optional + 96 + 2*8 + 4, length);
+    }
+
+    void  put16(size_t at, uint16_t v)    { std::memcpy(&Bytes[at], &v, 2); }
+    void  put32(size_t at, uint32_t v)    { std::memcpy(&Bytes[at], &v, 4); }
+
+    //! Reserve bytes within the resource section
+    uint32_t  alloc(uint32_t length)
+    {
+      uint32_t const at = Next;
+      Next += (length + 3) & ~3u;
+      return at;
+    }
+
+    //! Write a directory with 'count' entries, returning its offset  (Entries are populated by 'entry')
+    uint32_t  directory(uint16_t named, uint16_t numbered)
+    {
+      uint32_t const at = alloc(16 + 8 * (named + numbered));
+      put16(root + at + 12, named);
+      put16(root + at + 14, numbered);
+      return at;
+    }
+
+    //! Populate an entry of a directory
+    void  entry(uint32_t dir, uint32_t idx, uint32_t ident, uint32_t target, bool subdirectory)
+    {
+      put32(root + dir + 16 + idx * 8, ident);
+      put32(root + dir + 16 + idx * 8 + 4, subdirectory ? target | 0x80000000 : target);
+    }
+
+    //! Write a data entry and its data, returning the offset of the data entry
+    uint32_t  data(const std::string& content, uint32_t codepage = 1252)
+    {
+      uint32_t const at = alloc(16);
+      uint32_t const bytes = alloc(static_cast<uint32_t>(content.size()));
+      std::memcpy(&Bytes[root + bytes], content.data(), content.size());
+      put32(root + at, root + bytes);
+      put32(root + at + 4, static_cast<uint32_t>(content.size()));
+      put32(root + at + 8, codepage);
+      return at;
+    }
+
+    //! Write a UTF-16 name, returning its offset
+    uint32_t  name(const char* text)
+    {
+      uint16_t const chars = static_cast<uint16_t>(std::strlen(text));
+      uint32_t const at = alloc(2 + chars * 2);
+      put16(root + at, chars);
+      for (uint16_t idx = 0; idx < chars; ++idx)
+        put16(root + at + 2 + idx * 2, static_cast<uint16_t>(text[idx]));
+      return at;
+    }
+
+    //! Write a type with one name, in several languages
+    void  resource(uint32_t typeDir, uint32_t typeIdx, uint32_t type, uint32_t name, std::vector<std::pair<uint16_t,std::string>> languages)
+    {
+      uint32_t const names = directory(0, 1);
+      uint32_t const langs = directory(0, static_cast<uint16_t>(languages.size()));
+      entry(typeDir, typeIdx, type, names, true);
+      entry(names, 0, name, langs, true);
+      for (uint32_t idx = 0; idx < languages.size(); ++idx)
+        entry(langs, idx, languages[idx].first, data(languages[idx].second), false);
+    }
+
+    bool  index(PeResourceIndex& idx) const
+    {
+      return idx.add(Bytes.data(), Bytes.size(), PeResourceIndex::Layout::Image);
+    }
+  };
+
+  //! Get the content of a resource
+  std::string  content(const ResourceView* view)
+  {
+    return view ? std::string(static_cast<const char*>(view->Data), view->Size) : std::string("<missing>");
+  }
+}
+
+// ------------------------------------- WELL FORMED ------------------------------------
+
+TEST(PeResourceIndex, IndexesOrdinalResourcesByLanguage)
+{
+  ImageBuilder img;
+  uint32_t const types = img.directory(0, 2);
+  img.resource(types, 0, 6, 1, { {0x0407, "german"}, {0x0409, "english"} });
+  img.resource(types, 1, 5, 100, { {0x0000, "dialog"} });
+
+  PeResourceIndex idx;
+  ASSERT_TRUE(img.index(idx));
+
+  EXPECT_EQ(3u, idx.size());
+  EXPECT_EQ("english", content(idx.find(6, 1, 0x0409)));
+  EXPECT_EQ("german", content(idx.find(6, 1, 0x0407)));
+  EXPECT_EQ("dialog", content(idx.find(5, 100, 0)));
+  EXPECT_EQ(nullptr, idx.find(6, 2, 0x0409));
+  EXPECT_EQ(nullptr, idx.find(6, 1, 0x040C));
+  EXPECT_EQ(1252u, idx.find(5, 100, 0)->CodePage);
+}
+
+TEST(PeResourceIndex, MatchesNamesCaseInsensitively)
+{
+  ImageBuilder img;
+  uint32_t const types = img.directory(1, 0);
+  uint32_t const names = img.directory(1, 0);
+  uint32_t const langs = img.directory(0, 1);
+  img.entry(types, 0, img.name("PNG") | 0x80000000, names, true);
+  img.entry(names, 0, img.name("Logo") | 0x80000000, langs, true);
+  img.entry(langs, 0, 0x0409, img.data("image"), false);
+
+  PeResourceIndex idx;
+  ASSERT_TRUE(img.index(idx));
+
+  char16_t const type[] = u"png", name[] = u"LOGO";
+  EXPECT_EQ("image", content(idx.find(ResourceName(type, 3), ResourceName(name, 4), 0x0409)));
+}
+
+TEST(PeResourceIndex, NeutralLookupFallsBackToFirstLanguage)
+{
+  ImageBuilder img;
+  uint32_t const types = img.directory(0, 1);
+  img.resource(types, 0, 6, 1, { {0x0407, "german"}, {0x0409, "english"} });
+
+  PeResourceIndex idx;
+  ASSERT_TRUE(img.index(idx));
+
+  EXPECT_EQ("german", content(idx.find(6, 1, 0)));
+}
+
+TEST(PeResourceIndex, SearchesLanguagesInOrderOfPreference)
+{
+  ImageBuilder img;
+  uint32_t const types = img.directory(0, 1);
+  img.resource(types, 0, 6, 1, { {0x0000, "neutral"}, {0x0407, "german"}, {0x0409, "english"} });
+
+  PeResourceIndex idx;
+  ASSERT_TRUE(img.index(idx));
+
+  uint16_t const french[] = { 0x040C, 0x0409, 0x0000 },
+                 unknown[] = { 0x040C, 0x0411 };
+  EXPECT_EQ("english", content(idx.find(6, 1, french, 3)));
+  EXPECT_EQ("neutral", content(idx.find(6, 1, unknown, 2)));
+  EXPECT_EQ(nullptr, idx.find(6, 2, french, 3));
+}
+
+TEST(PeResourceIndex, EarlierImagesTakePrecedence)
+{
+  ImageBuilder first, second;
+  first.resource(first.directory(0, 1), 0, 6, 1, { {0x0409, "first"} });
+  second.resource(second.directory(0, 1), 0, 6, 1, { {0x0409, "second"} });
+
+  PeResourceIndex idx;
+  ASSERT_TRUE(first.index(idx));
+  ASSERT_TRUE(second.index(idx));
+
+  EXPECT_EQ("first", content(idx.find(6, 1, 0x0409)));
+}
+
+TEST(PeResourceIndex, AcceptsImageWithoutResources)
+{
+  ImageBuilder img;
+  img.put32(ImageBuilder::optional + 96 + 2*8, 0);
+
+  PeResourceIndex idx;
+  EXPECT_TRUE(img.index(idx));
+  EXPECT_TRUE(idx.empty());
+}
+
+// -------------------------------------- MALFORMED -------------------------------------
+
+TEST(PeResourceIndex, RejectsMissingSignatures)
+{
+  ImageBuilder img;
+  img.resource(img.directory(0, 1), 0, 6, 1, { {0x0409, "text"} });
+  img.put32(0x80, 0x00004551);
+
+  PeResourceIndex idx;
+  EXPECT_FALSE(img.index(idx));
+  EXPECT_FALSE(idx.add(img.Bytes.data(), 0x40, PeResourceIndex::Layout::Image));
+  EXPECT_FALSE(idx.add(nullptr, 0, PeResourceIndex::Layout::Image));
+  EXPECT_TRUE(idx.empty());
+}
+
+TEST(PeResourceIndex, RejectsCyclicDirectories)
+{
+  ImageBuilder img;
+  uint32_t const types = img.directory(0, 2);
+  img.resource(types, 0, 6, 1, { {0x0409, "text"} });
+  img.entry(types, 1, 7, types, true);
+
+  PeResourceIndex idx;
+  EXPECT_FALSE(img.index(idx));
+  EXPECT_TRUE(idx.empty());
+}
+
+TEST(PeResourceIndex, RejectsSharedDirectories)
+{
+  // Several types referencing one name directory, which would otherwise multiply the cost of indexing
+  ImageBuilder img;
+  uint32_t const types = img.directory(0, 3);
+  img.resource(types, 0, 6, 1, { {0x0409, "text"} });
+  uint32_t target;
+  std::memcpy(&target, &img.Bytes[ImageBuilder::root + types + 16 + 4], 4);
+  img.entry(types, 1, 7, target & 0x7FFFFFFF, true);
+  img.entry(types, 2, 8, target & 0x7FFFFFFF, true);
+
+  PeResourceIndex idx;
+  EXPECT_FALSE(img.index(idx));
+  EXPECT_TRUE(idx.empty());
+}
+
+TEST(PeResourceIndex, RejectsEntriesBeyondSection)
+{
+  ImageBuilder img(0x100);
+  uint32_t const types = img.directory(0, 1);
+  img.resource(types, 0, 6, 1, { {0x0409, "text"} });
+  img.put16(ImageBuilder::root + types + 14, 0xFFFF);
+
+  PeResourceIndex idx;
+  EXPECT_FALSE(img.index(idx));
+}
+
+TEST(PeResourceIndex, RejectsDirectoriesDeeperThanLanguage)
+{
+  ImageBuilder img;
+  uint32_t const types = img.directory(0, 1);
+  uint32_t const names = img.directory(0, 1);
+  uint32_t const langs = img.directory(0, 1);
+  uint32_t const extra = img.directory(0, 0);
+  img.entry(types, 0, 6, names, true);
+  img.entry(names, 0, 1, langs, true);
+  img.entry(langs, 0, 0x0409, extra, true);
+
+  PeResourceIndex idx;
+  EXPECT_FALSE(img.index(idx));
+}
+
+TEST(PeResourceIndex, RejectsDataOutsideImage)
+{
+  ImageBuilder img;
+  uint32_t const types = img.directory(0, 1);
+  img.resource(types, 0, 6, 1, { {0x0409, "text"} });
+
+  // Point data entry beyond the image
+  uint32_t const dataEntry = img.Next - 16 - 4;
+  img.put32(ImageBuilder::root + dataEntry, static_cast<uint32_t>(img.Bytes.size()) - 2);
+
+  PeResourceIndex idx;
+  EXPECT_FALSE(img.index(idx));
+}
+
+TEST(PeResourceIndex, RejectsTruncatedNames)
+{
+  ImageBuilder img;
+  uint32_t const types = img.directory(1, 0);
+  uint32_t const names = img.directory(0, 1);
+  uint32_t const langs = img.directory(0, 1);
+  img.entry(types, 0, img.name("PNG") | 0x80000000, names, true);
+  img.entry(names, 0, 1, langs, true);
+  img.entry(langs, 0, 0x0409, img.data("image"), false);
+  img.put32(ImageBuilder::root + types + 16, (0x1000 - 2) | 0x80000000);
+  img.put16(ImageBuilder::root + 0x1000 - 2, 0x7FFF);
+
+  PeResourceIndex idx;
+  EXPECT_FALSE(img.index(idx));
+}
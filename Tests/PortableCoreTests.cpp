@@ -0,0 +1,134 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\PortableCoreTests.cpp
+//! \brief Unit tests for the binary/text writers, binary reader and xml reader of the portable core
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/io/BinaryReader.hpp>            //!< BinaryReader
+#include <wtl/io/BinaryWriter.hpp>            //!< BinaryWriter
+#include <wtl/io/ChunkedStream.hpp>           //!< ChunkedStream
+#include <wtl/io/FrameCodec.hpp>              //!< FrameView
+#include <wtl/io/TextBuffer.hpp>              //!< TextBuffer
+#include <wtl/io/TextWriter.hpp>              //!< TextWriter
+#include <wtl/io/XmlReader.hpp>               //!< XmlReader
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  enum class Colour : uint16_t { Red = 3, Green = 7 };
+
+  //! Copy the contents of a chunked stream into a contiguous buffer
+  std::vector<byte>  flatten(const ChunkedStream& s)
+  {
+    std::vector<byte> buf;
+    s.segments([&](BufferSegment seg) { buf.insert(buf.end(), seg.Data, seg.Data + seg.Length); });
+    return buf;
+  }
+}
+
+// ------------------------------------ BINARY WRITER -----------------------------------
+
+TEST(BinaryWriter, RoundTripsValuesThroughBinaryReader)
+{
+  BinaryWriter<ChunkedStream> w(std::make_shared<SocketBufferPool>(4096));
+  DynamicArray<int32_t,8> arr;
+  arr.emplace_back(1);
+  arr.emplace_back(2);
+  DynamicBitset bits;
+  bits.resize(300);
+  bits.set(5);
+  bits.set(299);
+
+  w << int32_t(42) << 3.5 << true << Colour::Green << arr << Bitset<uint16_t>(0x81) << bits;
+
+  std::vector<byte> buf = flatten(w.stream());
+  EXPECT_EQ(buf.size(), w.stream().size());
+
+  BinaryReader<FrameView> r(buf.data(), buf.size());
+  int32_t n = 0;
+  double d = 0;
+  bool b = false;
+  Colour c = Colour::Red;
+  DynamicArray<int32_t,8> arr2;
+  Bitset<uint16_t> mask;
+  DynamicBitset bits2;
+  r >> n >> d >> b >> c >> arr2 >> mask >> bits2;
+
+  EXPECT_EQ(42, n);
+  EXPECT_EQ(3.5, d);
+  EXPECT_TRUE(b);
+  EXPECT_EQ(Colour::Green, c);
+  ASSERT_EQ(2u, arr2.size());
+  EXPECT_EQ(1, arr2[0]);
+  EXPECT_EQ(2, arr2[1]);
+  EXPECT_EQ(0x81, static_cast<uint16_t>(mask));
+  EXPECT_TRUE(bits2 == bits);
+}
+
+TEST(BinaryReader, ThrowsWhenStreamIsExhausted)
+{
+  byte buf[2] = {1, 2};
+  BinaryReader<FrameView> r(buf, sizeof(buf));
+  int32_t n = 0;
+  EXPECT_ANY_THROW(r >> n);
+}
+
+// ------------------------------------- TEXT WRITER ------------------------------------
+
+TEST(TextWriter, FormatsValuesAndRanges)
+{
+  TextWriter<TextBuffer<char>> w(64);
+  DynamicArray<int32_t,8> arr;
+  arr.emplace_back(1);
+  arr.emplace_back(2);
+
+  w << "abc " << 42 << ' ' << 3.5 << ' ' << CharArray<Encoding::ANSI,16>("hello") << ' ' << delimited_range(arr, ',');
+
+  EXPECT_STREQ("abc 42 3.500000 hello 1,2", w.str());
+  EXPECT_EQ(std::strlen(w.str()), w.stream().used());
+}
+
+TEST(TextWriter, WritefGrowsBeyondLocalBuffer)
+{
+  TextWriter<TextBuffer<char>> w;
+  std::string const text(500, 'x');
+
+  w.writef("%s-%d", text.c_str(), 7);
+
+  EXPECT_EQ(text + "-7", w.str());
+}
+
+// ------------------------------------- XML READER -------------------------------------
+
+TEST(XmlReader, ReadsValuesAndStringsByXPath)
+{
+  char doc[] = "<root><item id='17'>3.5</item><item id='18'/><flag>yes</flag><n>42</n></root>";
+  XmlReader<FrameView> r(reinterpret_cast<byte*>(doc), std::strlen(doc));
+  double d = 0;
+  bool b = false;
+  int32_t n = 0;
+  CharArray<Encoding::UTF8,16> id;
+
+  r.getValue("/root/item", d);
+  r.getValue("/root/flag", b);
+  r.getValue("/root/n", n);
+  r.getString("/root/item/@id", id);
+
+  EXPECT_EQ(3.5, d);
+  EXPECT_TRUE(b);
+  EXPECT_EQ(42, n);
+  EXPECT_STREQ("17", id.c_str());
+  EXPECT_EQ(2u, r.selectNodes("//item").size());
+}
+
+TEST(XmlReader, ThrowsOnMalformedDocument)
+{
+  char doc[] = "<root><item></root>";
+  EXPECT_ANY_THROW((XmlReader<FrameView>(reinterpret_cast<byte*>(doc), std::strlen(doc))));
+}
@@ -0,0 +1,130 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\PumpSchedulerTests.cpp
+//! \brief Unit tests for PumpScheduler
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/threads/PumpScheduler.hpp>      //!< PumpScheduler
+#include <gtest/gtest.h>
+#include <chrono>
+#include <deque>
+#include <vector>
+
+using namespace wtl;
+using namespace std::chrono;
+
+namespace
+{
+  //! Message source which yields queued messages then quits when next asked to wait
+  struct ScriptedSource
+  {
+    using message_t = int32_t;
+
+    std::deque<int32_t>                     Queue;          //!< Waiting messages  (Negative terminates)
+    std::vector<int32_t>                    Dispatched;     //!< Messages dispatched
+    std::vector<PumpScheduler::duration_t>  Waits;          //!< Timeouts requested
+    uint32_t                                QuitAfter = 1;  //!< Number of waits before quitting
+
+    bool peek(int32_t& msg)             { if (Queue.empty()) return false; msg = Queue.front(); Queue.pop_front(); return true; }
+    bool pending() const                { return !Queue.empty(); }
+    bool quit(int32_t msg) const        { return msg < 0; }
+    int32_t result(int32_t msg) const   { return -msg; }
+    void dispatch(int32_t& msg)         { Dispatched.push_back(msg); }
+
+    void wait(PumpScheduler::duration_t timeout)
+    {
+      Waits.push_back(timeout);
+      if (Waits.size() >= QuitAfter)
+        Queue.push_back(-7);
+    }
+  };
+
+  //! Exposes the deadline heap
+  struct InspectableScheduler : PumpScheduler
+  {
+    size_t  heapSize() const    { return Heap.size(); }
+  };
+}
+
+TEST(PumpScheduler, DispatchesMessagesUntilQuit)
+{
+  PumpScheduler scheduler;
+  ScriptedSource source;
+  source.Queue = {1, 2, 3};
+
+  EXPECT_EQ(7, scheduler.pump(source));
+  EXPECT_EQ((std::vector<int32_t>{1, 2, 3}), source.Dispatched);
+  EXPECT_EQ(3u, scheduler.Metrics.Messages);
+}
+
+TEST(PumpScheduler, CancelledEarliestTimerDoesNotShortenWait)
+{
+  PumpScheduler scheduler;
+  ScriptedSource source;
+
+  auto early = scheduler.schedule(milliseconds(5), [] {});
+  scheduler.schedule(seconds(60), [] {});
+  EXPECT_TRUE(scheduler.cancel(early));
+  EXPECT_FALSE(scheduler.cancel(early));
+
+  EXPECT_GT(scheduler.timeout(PumpScheduler::clock_t::now()), seconds(59));
+
+  scheduler.pump(source);
+  ASSERT_EQ(1u, source.Waits.size());
+  EXPECT_GT(source.Waits[0], seconds(59));
+}
+
+TEST(PumpScheduler, WaitsIndefinitelyOnceAllTimersCancelled)
+{
+  PumpScheduler scheduler;
+  auto id = scheduler.schedule(milliseconds(5), [] {});
+  scheduler.cancel(id);
+
+  EXPECT_EQ(PumpScheduler::duration_t::max(), scheduler.timeout(PumpScheduler::clock_t::now()));
+}
+
+TEST(PumpScheduler, CancelledEntriesAreCompacted)
+{
+  InspectableScheduler scheduler;
+  std::vector<PumpScheduler::timer_t> ids;
+
+  scheduler.schedule(milliseconds(1), [] {});
+  for (int i = 0; i < 10000; ++i)
+    ids.push_back(scheduler.schedule(seconds(10 + i), [] {}));
+  for (auto id : ids)
+    scheduler.cancel(id);
+
+  EXPECT_LE(scheduler.heapSize(), 2 + PumpScheduler::compaction);
+}
+
+TEST(PumpScheduler, ExpiredTimersExecuteInDeadlineOrder)
+{
+  PumpScheduler scheduler;
+  ScriptedSource source;
+  std::vector<int32_t> order;
+  auto const now = PumpScheduler::clock_t::now();
+
+  scheduler.schedule(now - milliseconds(1), [&] { order.push_back(2); });
+  scheduler.schedule(now - milliseconds(3), [&] { order.push_back(1); });
+  auto cancelled = scheduler.schedule(now - milliseconds(2), [&] { order.push_back(99); });
+  scheduler.cancel(cancelled);
+
+  scheduler.pump(source);
+  EXPECT_EQ((std::vector<int32_t>{1, 2}), order);
+  EXPECT_EQ(2u, scheduler.Metrics.TimersFired);
+}
+
+TEST(PumpScheduler, IdleTasksRunUntilComplete)
+{
+  PumpScheduler scheduler;
+  ScriptedSource source;
+  int32_t slices = 0;
+
+  scheduler.whenIdle([&] (PumpScheduler::time_point_t) { return ++slices < 5; });
+  scheduler.pump(source);
+
+  EXPECT_EQ(5, slices);
+  EXPECT_FALSE(scheduler.idle());
+}
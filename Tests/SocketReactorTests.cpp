@@ -0,0 +1,522 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\SocketReactorTests.cpp
+//! \brief Unit tests for SocketReactor over loopback connections
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/io/SocketReactor.hpp>           //!< SocketReactor
+#include <gtest/gtest.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! \alias Connection - Reactor connection
+  using Connection = SocketReactor::Connection;
+
+  //! Maximum time to wait for any event
+  constexpr std::chrono::seconds  Timeout {10};
+
+  //! Create a blocking listening socket bound to an ephemeral loopback port
+  int  listening(uint16_t& port)
+  {
+    int s = ::socket(AF_INET, int(SOCK_STREAM) | int(SOCK_CLOEXEC), 0);
+    ::sockaddr_in addr = {};
+    ::socklen_t length = sizeof(addr);
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (s == -1 || ::bind(s, reinterpret_cast<::sockaddr*>(&addr), sizeof(addr)) == -1 || ::listen(s, 16) == -1
+     || ::getsockname(s, reinterpret_cast<::sockaddr*>(&addr), &length) == -1)
+      throw platform_error(HERE, "Unable to create listening socket");
+    port = ntohs(addr.sin_port);
+    return s;
+  }
+
+  //! Connect a blocking socket to a loopback port  (Receives time out, so failing tests cannot hang)
+  int  connectTo(uint16_t port)
+  {
+    int s = ::socket(AF_INET, int(SOCK_STREAM) | int(SOCK_CLOEXEC), 0);
+    ::sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+    ::timeval tv = {10, 0};
+    if (s == -1 || ::setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) == -1
+     || ::connect(s, reinterpret_cast<::sockaddr*>(&addr), sizeof(addr)) == -1)
+      throw platform_error(HERE, "Unable to connect loopback socket");
+    return s;
+  }
+
+  //! Create a connected pair of loopback sockets: (client, server)
+  std::pair<int,int>  loopback()
+  {
+    uint16_t port;
+    int const listener = listening(port),
+              client = connectTo(port),
+              server = ::accept4(listener, nullptr, nullptr, int(SOCK_CLOEXEC));
+    ::close(listener);
+    return {client, server};
+  }
+
+  //! Generate recognisable data
+  std::vector<uint8_t>  pattern(size_t length, uint8_t seed = 0)
+  {
+    std::vector<uint8_t> data(length);
+    for (size_t i = 0; i < length; ++i)
+      data[i] = static_cast<uint8_t>(i * 31 + (i >> 8) + seed);
+    return data;
+  }
+
+  //! Send every byte from a blocking socket
+  void  sendAll(int s, const uint8_t* data, size_t length)
+  {
+    for (ssize_t n; length; data += n, length -= n)
+      if ((n = ::send(s, data, length, int(MSG_NOSIGNAL))) <= 0)
+        throw platform_error(HERE, "Unable to send test data");
+  }
+
+  //! Receive an exact number of bytes into a blocking socket  (Fewer if the peer closes or times out)
+  std::vector<uint8_t>  receiveAll(int s, size_t length)
+  {
+    std::vector<uint8_t> data(length);
+    size_t received = 0;
+    for (ssize_t n; received < length; received += n)
+      if ((n = ::recv(s, data.data() + received, length - received, 0)) <= 0)
+        break;
+    data.resize(received);
+    return data;
+  }
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct Inbox - Collects the data and closure reported by reactor handlers
+  //!
+  //! \remarks Must outlive the reactor, whose destructor notifies the close handler of open connections
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct Inbox
+  {
+    std::mutex                Lock;
+    std::condition_variable   Signal;
+    std::vector<uint8_t>      Data;
+    std::thread::id           Thread;             //!< Thread which executed the last handler
+    int32_t                   Error = -1;         //!< Close error, or -1 while open
+
+    SocketReactor::receive_t  receiver()
+    {
+      return [this] (Connection&, uint8_t* data, uint32_t length) {
+        std::lock_guard<std::mutex> lock(Lock);
+        Data.insert(Data.end(), data, data + length);
+        Thread = std::this_thread::get_id();
+        Signal.notify_all();
+      };
+    }
+
+    SocketReactor::close_t  closer()
+    {
+      return [this] (Connection&, int32_t error) {
+        std::lock_guard<std::mutex> lock(Lock);
+        Error = error;
+        Signal.notify_all();
+      };
+    }
+
+    bool  waitFor(size_t length)
+    {
+      std::unique_lock<std::mutex> lock(Lock);
+      return Signal.wait_for(lock, Timeout, [&] { return Data.size() >= length; });
+    }
+
+    bool  waitClosed()
+    {
+      std::unique_lock<std::mutex> lock(Lock);
+      return Signal.wait_for(lock, Timeout, [&] { return Error != -1; });
+    }
+  };
+
+  //! Receive handler which echoes data back to the peer
+  void  echo(Connection& c, uint8_t* data, uint32_t length)
+  {
+    c.send(data, length);
+  }
+}
+
+TEST(SocketReactor, RejectsZeroThreads)
+{
+  EXPECT_THROW(SocketReactor(0), invalid_argument);
+}
+
+TEST(SocketReactor, DeliversReceivedData)
+{
+  Inbox inbox;
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  reactor.attach(sockets.second, inbox.receiver(), inbox.closer());
+
+  std::vector<uint8_t> const data = pattern(300000);
+  sendAll(sockets.first, data.data(), data.size());
+
+  ASSERT_TRUE(inbox.waitFor(data.size()));
+  EXPECT_EQ(data, inbox.Data);
+  EXPECT_NE(std::this_thread::get_id(), inbox.Thread) << "handlers execute upon I/O threads by default";
+  ::close(sockets.first);
+}
+
+TEST(SocketReactor, EchoesLargeTransfer)
+{
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  reactor.attach(sockets.second, echo);
+
+  // Send from another thread, the echo is only read once sending completes
+  std::vector<uint8_t> const data = pattern(4 << 20);
+  std::thread sender([&] { sendAll(sockets.first, data.data(), data.size()); });
+  std::vector<uint8_t> const received = receiveAll(sockets.first, data.size());
+  sender.join();
+
+  EXPECT_EQ(data, received);
+  ::close(sockets.first);
+}
+
+TEST(SocketReactor, QueuesDataUntilPeerReads)
+{
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  auto const conn = reactor.attach(sockets.second, nullptr);
+
+  // Exceed the socket buffers while the peer is not reading
+  std::vector<uint8_t> const data = pattern(16 << 20, 7);
+  ASSERT_TRUE(conn->send(data.data(), data.size()));
+  EXPECT_GT(conn->pending(), 0u);
+
+  EXPECT_EQ(data, receiveAll(sockets.first, data.size()));
+  EXPECT_EQ(0u, conn->pending());
+  ::close(sockets.first);
+}
+
+TEST(SocketReactor, AcceptsConnections)
+{
+  SocketReactor reactor;
+  uint16_t port;
+  reactor.listen(listening(port), [&reactor] (SocketReactor::native_t s) { reactor.attach(s, echo); });
+
+  // Several clients, concurrently connected
+  std::vector<int> clients;
+  for (uint8_t i = 0; i < 4; ++i)
+  {
+    clients.push_back(connectTo(port));
+    std::vector<uint8_t> const data = pattern(1000, i);
+    sendAll(clients.back(), data.data(), data.size());
+  }
+  for (uint8_t i = 0; i < 4; ++i)
+  {
+    EXPECT_EQ(pattern(1000, i), receiveAll(clients[i], 1000)) << "client " << int(i);
+    ::close(clients[i]);
+  }
+}
+
+TEST(SocketReactor, NotifiesGracefulClosure)
+{
+  Inbox inbox;
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  auto const conn = reactor.attach(sockets.second, inbox.receiver(), inbox.closer());
+
+  ::close(sockets.first);
+
+  ASSERT_TRUE(inbox.waitClosed());
+  EXPECT_EQ(0, inbox.Error);
+  EXPECT_TRUE(conn->closed());
+  EXPECT_FALSE(conn->send("x", 1));
+}
+
+TEST(SocketReactor, ClosesConnectionLocally)
+{
+  Inbox inbox;
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  auto const conn = reactor.attach(sockets.second, inbox.receiver(), inbox.closer());
+
+  conn->close();
+  conn->close();
+
+  ASSERT_TRUE(inbox.waitClosed());
+  EXPECT_EQ(0, inbox.Error);
+  EXPECT_TRUE(receiveAll(sockets.first, 1).empty()) << "peer observes end of stream";
+  ::close(sockets.first);
+}
+
+TEST(SocketReactor, MarshalsHandlersThroughDispatcher)
+{
+  std::mutex lock;
+  std::deque<SocketReactor::work_t> queue;
+  Inbox inbox;
+  SocketReactor reactor(2, [&] (SocketReactor::work_t w) { std::lock_guard<std::mutex> l(lock); queue.push_back(std::move(w)); });
+
+  auto const sockets = loopback();
+  reactor.attach(sockets.second, inbox.receiver(), inbox.closer());
+
+  std::vector<uint8_t> const data = pattern(200000, 3);
+  sendAll(sockets.first, data.data(), data.size());
+  ::close(sockets.first);
+
+  // Pump marshalled handlers upon this thread until closure
+  auto const deadline = std::chrono::steady_clock::now() + Timeout;
+  while (inbox.Error == -1 && std::chrono::steady_clock::now() < deadline)
+  {
+    SocketReactor::work_t w;
+    {
+      std::lock_guard<std::mutex> l(lock);
+      if (!queue.empty())
+        w = std::move(queue.front()), queue.pop_front();
+    }
+    if (w)
+      w();
+    else
+      std::this_thread::yield();
+  }
+
+  EXPECT_EQ(0, inbox.Error);
+  EXPECT_EQ(data, inbox.Data) << "marshalled blocks arrive in order";
+  EXPECT_EQ(std::this_thread::get_id(), inbox.Thread);
+}
+
+TEST(SocketReactor, EchoesUponSeveralThreads)
+{
+  SocketReactor reactor(4);
+  std::vector<std::pair<int,int>> pairs;
+  for (int i = 0; i < 8; ++i)
+  {
+    pairs.push_back(loopback());
+    reactor.attach(pairs.back().second, echo);
+  }
+
+  std::vector<std::thread> clients;
+  std::vector<char> intact(pairs.size());
+  for (size_t i = 0; i < pairs.size(); ++i)
+    clients.emplace_back([&, i] {
+      std::vector<uint8_t> const data = pattern(512 << 10, uint8_t(i));
+      std::thread sender([&] { sendAll(pairs[i].first, data.data(), data.size()); });
+      intact[i] = receiveAll(pairs[i].first, data.size()) == data;
+      sender.join();
+      ::close(pairs[i].first);
+    });
+  for (auto& c : clients)
+    c.join();
+
+  for (size_t i = 0; i < pairs.size(); ++i)
+    EXPECT_TRUE(intact[i]) << "connection " << i;
+}
+
+TEST(SocketReactor, ReturnsBuffersToPool)
+{
+  std::weak_ptr<Connection> weak;
+  Inbox inbox;
+  SocketReactor reactor;
+  {
+    auto const sockets = loopback();
+    auto const conn = reactor.attach(sockets.second, echo, inbox.closer());
+    weak = conn;
+
+    std::vector<uint8_t> const data = pattern(1 << 20);
+    std::thread sender([&] { sendAll(sockets.first, data.data(), data.size()); });
+    EXPECT_EQ(data.size(), receiveAll(sockets.first, data.size()).size());
+    sender.join();
+    ::close(sockets.first);
+    ASSERT_TRUE(inbox.waitClosed());
+  }
+
+  // Connection is released once closed, and its blocks with it
+  auto const deadline = std::chrono::steady_clock::now() + Timeout;
+  while (!weak.expired() && std::chrono::steady_clock::now() < deadline)
+    std::this_thread::yield();
+  EXPECT_TRUE(weak.expired());
+  EXPECT_EQ(0u, reactor.buffers().used());
+}
+
+// -------------------------------------- SEND PATHS --------------------------------------
+
+namespace
+{
+  //! Wait until a pool has a given number of blocks in use
+  bool  waitUsed(const SocketBufferPool& pool, size_t blocks)
+  {
+    auto const deadline = std::chrono::steady_clock::now() + Timeout;
+    while (pool.used() != blocks && std::chrono::steady_clock::now() < deadline)
+      std::this_thread::yield();
+    return pool.used() == blocks;
+  }
+
+  //! Deliver a byte from the peer, so the connection's receive block is acquired before the pool is measured
+  size_t  primed(SocketReactor& reactor, int peer, Inbox& inbox)
+  {
+    uint8_t const b = 0;
+    sendAll(peer, &b, 1);
+    if (!inbox.waitFor(1))
+      throw logic_error(HERE, "Connection did not receive data");
+    return reactor.buffers().used();
+  }
+
+  //! Create an unlinked temporary file containing data
+  int  temporaryFile(const std::vector<uint8_t>& data)
+  {
+    char path[] = "/tmp/wtl_reactor_XXXXXX";
+    int const fd = ::mkstemp(path);
+    if (fd == -1)
+      throw platform_error(HERE, "Unable to create temporary file");
+    ::unlink(path);
+    if (::write(fd, data.data(), data.size()) != ssize_t(data.size()))
+      throw platform_error(HERE, "Unable to write temporary file");
+    return fd;
+  }
+}
+
+TEST(SocketReactor, SendsSegmentsInOrder)
+{
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  auto const conn = reactor.attach(sockets.second, nullptr);
+
+  std::vector<uint8_t> const a = pattern(100, 1),
+                             b = pattern(70000, 2),
+                             c = pattern(1, 3);
+  BufferSegment const segments[] = { {a.data(), a.size()}, {b.data(), 0}, {b.data(), b.size()}, {c.data(), c.size()} };
+  ASSERT_TRUE(conn->send(segments, 4));
+
+  std::vector<uint8_t> expected(a);
+  expected.insert(expected.end(), b.begin(), b.end());
+  expected.insert(expected.end(), c.begin(), c.end());
+  EXPECT_EQ(expected, receiveAll(sockets.first, expected.size()));
+  ::close(sockets.first);
+}
+
+TEST(SocketReactor, QueuesSegmentsBehindPendingData)
+{
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  auto const conn = reactor.attach(sockets.second, nullptr);
+
+  // Fill the socket buffers, so the segments must be queued and copied
+  std::vector<uint8_t> const first = pattern(16 << 20, 4),
+                             second = pattern(300000, 5);
+  ASSERT_TRUE(conn->send(first.data(), first.size()));
+  ASSERT_GT(conn->pending(), 0u);
+  {
+    std::vector<uint8_t> transient(second);
+    BufferSegment const segments[] = { {transient.data(), 1000}, {transient.data() + 1000, transient.size() - 1000} };
+    ASSERT_TRUE(conn->send(segments, 2));
+    std::fill(transient.begin(), transient.end(), 0);
+  }
+
+  EXPECT_EQ(first, receiveAll(sockets.first, first.size()));
+  EXPECT_EQ(second, receiveAll(sockets.first, second.size())) << "caller's buffers are not retained";
+  ::close(sockets.first);
+}
+
+TEST(SocketReactor, SplicesStreamFromOwnPool)
+{
+  Inbox inbox;
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  auto const conn = reactor.attach(sockets.second, inbox.receiver());
+  size_t const idle = primed(reactor, sockets.first, inbox);
+
+  std::vector<uint8_t> const data = pattern(1 << 20, 6);
+  ChunkedStream stream(reactor.pool());
+  stream.write(data.data(), data.size());
+  size_t const blocks = reactor.buffers().used() - idle;
+
+  ASSERT_TRUE(conn->send(std::move(stream)));
+  EXPECT_TRUE(stream.empty());
+  EXPECT_LE(reactor.buffers().used(), idle + blocks) << "blocks were transferred, not copied";
+
+  EXPECT_EQ(data, receiveAll(sockets.first, data.size()));
+  EXPECT_TRUE(waitUsed(reactor.buffers(), idle)) << "sent blocks return to the pool";
+  ::close(sockets.first);
+}
+
+TEST(SocketReactor, CopiesStreamFromForeignPool)
+{
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  auto const conn = reactor.attach(sockets.second, nullptr);
+
+  auto const foreign = std::make_shared<SocketBufferPool>(4096);
+  std::vector<uint8_t> const data = pattern(1 << 20, 7);
+  ChunkedStream stream(foreign);
+  stream.write(data.data(), data.size());
+
+  ASSERT_TRUE(conn->send(std::move(stream)));
+  EXPECT_TRUE(stream.empty());
+  EXPECT_EQ(0u, foreign->used()) << "foreign blocks are released immediately";
+
+  EXPECT_EQ(data, receiveAll(sockets.first, data.size()));
+  ::close(sockets.first);
+}
+
+TEST(SocketReactor, SendsFileRegionInOrder)
+{
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  auto const conn = reactor.attach(sockets.second, nullptr);
+
+  std::vector<uint8_t> const file = pattern(3 << 20, 8),
+                             before = pattern(5000, 9),
+                             after = pattern(7000, 10);
+  uint64_t const offset = 12345,
+                 length = file.size() - 2 * offset;
+
+  ASSERT_TRUE(conn->send(before.data(), before.size()));
+  ASSERT_TRUE(conn->sendFile(temporaryFile(file), offset, length));
+  ASSERT_TRUE(conn->send(after.data(), after.size()));
+
+  EXPECT_EQ(before, receiveAll(sockets.first, before.size()));
+  EXPECT_EQ(std::vector<uint8_t>(file.begin() + offset, file.begin() + offset + length), receiveAll(sockets.first, size_t(length)));
+  EXPECT_EQ(after, receiveAll(sockets.first, after.size()));
+  ::close(sockets.first);
+}
+
+TEST(SocketReactor, RefusesFileOnceClosed)
+{
+  Inbox inbox;
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  auto const conn = reactor.attach(sockets.second, nullptr, inbox.closer());
+  conn->close();
+  ASSERT_TRUE(inbox.waitClosed());
+
+  int const fd = temporaryFile(pattern(10));
+  EXPECT_FALSE(conn->sendFile(fd, 0, 10));
+  EXPECT_EQ(-1, ::fcntl(fd, F_GETFD)) << "file is closed even when refused";
+  ::close(sockets.first);
+}
+
+TEST(SocketReactor, SendsStreamWithZeroCopy)
+{
+  Inbox inbox;
+  SocketReactor reactor;
+  auto const sockets = loopback();
+  auto const conn = reactor.attach(sockets.second, inbox.receiver());
+  if (!conn->zeroCopy())
+    GTEST_SKIP() << "MSG_ZEROCOPY unsupported";
+  size_t const idle = primed(reactor, sockets.first, inbox);
+
+  std::vector<uint8_t> const data = pattern(8 << 20, 11);
+  ChunkedStream stream(reactor.pool());
+  stream.write(data.data(), data.size());
+  ASSERT_TRUE(conn->send(std::move(stream)));
+
+  EXPECT_EQ(data, receiveAll(sockets.first, data.size()));
+  EXPECT_TRUE(waitUsed(reactor.buffers(), idle)) << "blocks are released once the kernel reports completion";
+  ::close(sockets.first);
+}
@@ -0,0 +1,341 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\SoftwareSurfaceTests.cpp
+//! \brief Unit tests for PixelBuffer and SoftwareSurface
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/gdi/SoftwareSurface.hpp>        //!< SoftwareSurface, PixelBuffer
+#include <gtest/gtest.h>
+#include <map>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! Colours
+  constexpr uint32_t  White = 0xFFFFFFFF,
+                      Black = 0xFF000000,
+                      Red   = 0xFFFF0000,
+                      Green = 0xFF00FF00,
+                      Blue  = 0xFF0000FF;
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct BlockFont - Bitmap font whose glyphs are solid 3x5 blocks, advancing by 5 pixels
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct BlockFont : IBitmapFont
+  {
+    std::vector<uint8_t>  Mask = std::vector<uint8_t>(3*5, 0xFF);
+    RasterGlyph           Block {3, 5, 1, 2, 5, Mask.data()};
+
+    int32_t  height() const override
+    {
+      return 8;
+    }
+
+    //! Spaces have no glyph
+    const RasterGlyph*  glyph(uint32_t ch) const override
+    {
+      return ch != ' ' ? &Block : nullptr;
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct FakeResources - Brush and pen handles are their own ARGB colours
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct FakeResources : IRasterResources
+  {
+    std::map<uintptr_t,PixelBuffer>   Icons;
+    BlockFont                         Font;
+
+    uint32_t  brush(uintptr_t brush) const override   { return static_cast<uint32_t>(brush); }
+    uint32_t  pen(uintptr_t pen) const override       { return static_cast<uint32_t>(pen); }
+
+    const PixelBuffer*  icon(uintptr_t icon) const override
+    {
+      auto const pos = Icons.find(icon);
+      return pos != Icons.end() ? &pos->second : nullptr;
+    }
+
+    const IBitmapFont*  font(uintptr_t font) const override
+    {
+      return font ? &Font : nullptr;
+    }
+
+    uint32_t  part(uintptr_t, int32_t, int32_t) const override        { return Green; }
+    uint32_t  partText(uintptr_t, int32_t, int32_t) const override    { return Blue; }
+  };
+
+  //! Pseudo-random pixels, including fully transparent and opaque channels
+  std::vector<uint32_t>  noise(size_t count, uint32_t seed)
+  {
+    std::vector<uint32_t> pixels(count);
+    for (uint32_t& p : pixels)
+    {
+      seed = seed * 1664525u + 1013904223u;
+      p = seed;
+    }
+    pixels[0] = 0x00000000;
+    pixels[1] = 0xFFFFFFFF;
+    return pixels;
+  }
+
+  //! Count the pixels of a colour within a rectangle
+  int32_t  count(const PixelBuffer& buffer, const RectL& rc, uint32_t colour)
+  {
+    int32_t n = 0;
+    for (long32_t y = rc.Top; y < rc.Bottom; ++y)
+      for (long32_t x = rc.Left; x < rc.Right; ++x)
+        n += buffer.pixel(x, y) == colour;
+    return n;
+  }
+
+  //! Create a single-byte text command
+  DisplayCommand  textCommand(const RectL& rc, const char* text, uint32_t flags)
+  {
+    DisplayCommand cmd = DisplayList::command(DisplayOp::Text, rc, 0, 1);
+    cmd.CharSize = 1;
+    cmd.TextLength = static_cast<uint32_t>(strlen(text));
+    cmd.Flags = flags;
+    cmd.Fore = 0x000000FF;      // Native red
+    return cmd;
+  }
+}
+
+// ------------------------------------ PIXEL BUFFER ------------------------------------
+
+TEST(PixelBuffer, RejectsNegativeDimensions)
+{
+  EXPECT_THROW(PixelBuffer(-1, 4), invalid_argument);
+  EXPECT_EQ(0, PixelBuffer().width());
+  EXPECT_EQ(Red, PixelBuffer(3, 2, Red).pixel(2, 1));
+}
+
+TEST(PixelBuffer, BlendRoundsToNearest)
+{
+  // Every channel value against every other, at a spread of opacities
+  for (uint32_t alpha = 0; alpha <= 0xFF; alpha += 15)
+    for (uint32_t s = 0; s <= 0xFF; ++s)
+      for (uint32_t d = 0; d <= 0xFF; ++d)
+      {
+        uint32_t const expected = (s*alpha + d*(0xFF - alpha) + 127) / 255,
+                       result = PixelBuffer::blend(0x7F000000 | d << 8, alpha << 24 | s << 8);
+        ASSERT_EQ(0x7F000000 | expected << 8, result) << "alpha " << alpha << " src " << s << " dest " << d;
+      }
+}
+
+TEST(PixelBuffer, BlendAppliesCoverage)
+{
+  EXPECT_EQ(Black, PixelBuffer::blend(Black, White, 0));
+  EXPECT_EQ(White, PixelBuffer::blend(Black, White, 0xFF));
+  EXPECT_EQ(0xFF808080, PixelBuffer::blend(Black, White, 0x80));
+  EXPECT_EQ(0xFF808080, PixelBuffer::blend(Black, 0x80FFFFFF));
+}
+
+TEST(PixelBuffer, VectorFillMatchesScalar)
+{
+  // Every length and misalignment of the four-pixel loop and its tail
+  for (int32_t offset = 0; offset < 4; ++offset)
+    for (int32_t length = 0; length <= 19; ++length)
+    {
+      std::vector<uint32_t> pixels = noise(32, length),
+                            expected = pixels;
+      PixelBuffer::fillSpan(pixels.data() + offset, length, 0x12345678);
+      for (int32_t idx = 0; idx < length; ++idx)
+        expected[offset + idx] = 0x12345678;
+      ASSERT_EQ(expected, pixels) << "offset " << offset << " length " << length;
+    }
+}
+
+TEST(PixelBuffer, VectorBlendMatchesScalar)
+{
+  std::vector<uint32_t> const source = noise(67, 42);
+
+  // Every opacity, over random pixels  (The SSE2 path must produce identical results to the scalar path)
+  for (uint32_t alpha = 0; alpha <= 0xFF; ++alpha)
+    for (uint32_t colour : {0x000000u, 0xFFFFFFu, 0x80FF01u, 0x123456u})
+    {
+      uint32_t const argb = alpha << 24 | colour;
+      std::vector<uint32_t> pixels = source,
+                            expected = source;
+      PixelBuffer::blendSpan(pixels.data() + 1, 65, argb);
+      for (size_t idx = 1; idx < 66; ++idx)
+        expected[idx] = PixelBuffer::blend(expected[idx], argb);
+      ASSERT_EQ(expected, pixels) << std::hex << "colour " << argb;
+    }
+}
+
+TEST(PixelBuffer, SpanIgnoresTransparentColour)
+{
+  PixelBuffer buffer(8, 1, Black);
+  buffer.span(0, 0, 8, 0x00FFFFFF);
+  EXPECT_EQ(8, count(buffer, RectL(0, 0, 8, 1), Black));
+
+  buffer.span(2, 0, 3, Red);
+  EXPECT_EQ(3, count(buffer, RectL(0, 0, 8, 1), Red));
+  EXPECT_EQ(Black, buffer.pixel(5, 0));
+}
+
+// ---------------------------------- SOFTWARE SURFACE ----------------------------------
+
+TEST(SoftwareSurface, ConvertsColorRef)
+{
+  EXPECT_EQ(0xFF112233u, SoftwareSurface::fromColorRef(0x00332211));
+}
+
+TEST(SoftwareSurface, ClipsToDamagedRectangle)
+{
+  PixelBuffer buffer(10, 10, Black);
+  FakeResources resources;
+  SoftwareSurface surface(buffer, resources);
+
+  surface.begin(RectL(2, 2, 6, 6));
+  EXPECT_EQ(16, count(buffer, surface.bounds(), White)) << "damage is erased";
+
+  surface.fill(RectL(-5, -5, 50, 50), Red);
+  EXPECT_EQ(16, count(buffer, RectL(2, 2, 6, 6), Red));
+  EXPECT_EQ(84, count(buffer, surface.bounds(), Black));
+
+  surface.end();
+  surface.fill(RectL(0, 0, 1, 1), Green);
+  EXPECT_EQ(Green, buffer.pixel(0, 0));
+}
+
+TEST(SoftwareSurface, FramesAndInvertsOutline)
+{
+  PixelBuffer buffer(6, 6, White);
+  FakeResources resources;
+  SoftwareSurface surface(buffer, resources);
+
+  surface.frame(RectL(0, 0, 6, 6), Red);
+  EXPECT_EQ(20, count(buffer, surface.bounds(), Red));
+  EXPECT_EQ(16, count(buffer, RectL(1, 1, 5, 5), White));
+
+  // Focus pattern inverts alternate pixels, preserving alpha
+  surface.focus(RectL(1, 1, 5, 5));
+  EXPECT_EQ(Black, buffer.pixel(1, 1));
+  EXPECT_EQ(White, buffer.pixel(2, 1));
+  EXPECT_EQ(Black, buffer.pixel(3, 1));
+  EXPECT_EQ(White, buffer.pixel(2, 2)) << "interior untouched";
+
+  EXPECT_EQ(6, count(buffer, RectL(1, 1, 5, 5), Black));
+
+  // Drawing twice restores the outline
+  surface.focus(RectL(1, 1, 5, 5));
+  EXPECT_EQ(16, count(buffer, RectL(1, 1, 5, 5), White));
+}
+
+TEST(SoftwareSurface, FillsAndOutlinesEllipse)
+{
+  PixelBuffer buffer(9, 9, White);
+  FakeResources resources;
+  SoftwareSurface surface(buffer, resources);
+
+  surface.ellipse(RectL(0, 0, 9, 9), Blue, Red);
+
+  EXPECT_EQ(Blue, buffer.pixel(4, 4));
+  EXPECT_EQ(Blue, buffer.pixel(4, 1));
+  EXPECT_EQ(Red, buffer.pixel(4, 0));
+  EXPECT_EQ(Red, buffer.pixel(0, 4));
+  EXPECT_EQ(Red, buffer.pixel(1, 1));
+  EXPECT_EQ(White, buffer.pixel(0, 0));
+
+  // Symmetric about both axes
+  for (int32_t y = 0; y < 9; ++y)
+    for (int32_t x = 0; x < 9; ++x)
+    {
+      EXPECT_EQ(buffer.pixel(x, y), buffer.pixel(8-x, y)) << x << "," << y;
+      EXPECT_EQ(buffer.pixel(x, y), buffer.pixel(x, 8-y)) << x << "," << y;
+    }
+}
+
+TEST(SoftwareSurface, ScalesAndBlendsIcons)
+{
+  PixelBuffer buffer(4, 4, Black);
+  FakeResources resources;
+  PixelBuffer& icon = resources.Icons[7] = PixelBuffer(2, 2, Red);
+  icon.row(1)[1] = 0x80FFFFFF;
+  SoftwareSurface surface(buffer, resources);
+
+  surface.execute(DisplayList::command(DisplayOp::Icon, RectL(0, 0, 4, 4), 7), nullptr);
+
+  EXPECT_EQ(12, count(buffer, surface.bounds(), Red));
+  EXPECT_EQ(4, count(buffer, RectL(2, 2, 4, 4), 0xFF808080));
+
+  // Unknown icons are ignored
+  surface.execute(DisplayList::command(DisplayOp::Icon, RectL(0, 0, 4, 4), 8), nullptr);
+  EXPECT_EQ(12, count(buffer, surface.bounds(), Red));
+}
+
+TEST(SoftwareSurface, AlignsText)
+{
+  FakeResources resources;
+  RectL const area(0, 0, 20, 10);
+
+  // Glyphs are 3x5 at (+1,+2) and advance by 5; the line is 10 pixels wide and 8 high
+  for (auto const& c : std::vector<std::pair<uint32_t,long32_t>> { {0, 1}, {SoftwareSurface::Centre, 6}, {SoftwareSurface::Right, 11} })
+  {
+    PixelBuffer buffer(20, 10, White);
+    SoftwareSurface surface(buffer, resources);
+    surface.execute(textCommand(area, "AB", c.first), "AB");
+
+    EXPECT_EQ(30, count(buffer, area, Red)) << "flags " << c.first;
+    EXPECT_EQ(15, count(buffer, RectL(c.second, 2, c.second+3, 7), Red)) << "flags " << c.first;
+    EXPECT_EQ(15, count(buffer, RectL(c.second+5, 2, c.second+8, 7), Red)) << "flags " << c.first;
+  }
+
+  PixelBuffer buffer(20, 10, White);
+  SoftwareSurface surface(buffer, resources);
+  surface.execute(textCommand(area, "A", SoftwareSurface::VCentre), "A");
+  EXPECT_EQ(15, count(buffer, RectL(1, 3, 4, 8), Red));
+}
+
+TEST(SoftwareSurface, ClipsTextToDrawingRectangle)
+{
+  PixelBuffer buffer(20, 10, White);
+  FakeResources resources;
+  SoftwareSurface surface(buffer, resources);
+
+  // Spaces have no glyph and so no advance; third glyph overhangs the rectangle
+  surface.execute(textCommand(RectL(0, 0, 8, 4), "A BC", 0), "A BC");
+
+  EXPECT_EQ(3*2 + 2*2, count(buffer, surface.bounds(), Red));
+}
+
+TEST(SoftwareSurface, FillsOpaqueTextBackground)
+{
+  PixelBuffer buffer(20, 10, White);
+  FakeResources resources;
+  SoftwareSurface surface(buffer, resources);
+
+  DisplayCommand cmd = textCommand(RectL(0, 0, 20, 10), "A", 0);
+  cmd.Mode = SoftwareSurface::Opaque;
+  cmd.Back = 0x00FF0000;      // Native blue
+  surface.execute(cmd, "A");
+
+  EXPECT_EQ(15, count(buffer, surface.bounds(), Red));
+  EXPECT_EQ(185, count(buffer, surface.bounds(), Blue));
+}
+
+TEST(SoftwareSurface, ReplaysOnlyDamagedRectangles)
+{
+  PixelBuffer buffer(20, 10, Black);
+  FakeResources resources;
+  SoftwareSurface surface(buffer, resources, White);
+
+  DisplayList list;
+  list.record(DisplayList::command(DisplayOp::ThemeFill, RectL(0, 0, 20, 10), 1));
+  DisplayCommand cmd = DisplayList::command(DisplayOp::ThemeText, RectL(10, 0, 20, 10), 1, 1);
+  list.record(cmd, L"AB", 2);
+
+  DamageRegion damage;
+  damage.add(RectL(0, 0, 5, 5));
+  damage.add(RectL(10, 0, 20, 10));
+  list.replay(surface, damage);
+
+  EXPECT_EQ(25 + 70, count(buffer, surface.bounds(), Green));
+  EXPECT_EQ(30, count(buffer, RectL(10, 0, 20, 10), Blue));
+  EXPECT_EQ(200 - 25 - 100, count(buffer, surface.bounds(), Black));
+}
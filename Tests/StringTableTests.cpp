@@ -0,0 +1,181 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\StringTableTests.cpp
+//! \brief Unit tests for StringTable, using synthetic string table blocks
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/resources/StringTable.hpp>      //!< StringTable
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace wtl;
+
+namespace
+{
+  //! Language ids
+  constexpr uint16_t  English = 0x0409,
+                      French = 0x040C;
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct BlockBuilder - Builds the resource data of a block of 16 length-prefixed strings
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct BlockBuilder
+  {
+    std::vector<char16_t>  Data;      //!< Resource data
+
+    //! Encode strings by position  (Absent positions are empty)
+    explicit BlockBuilder(const std::map<int,std::u16string>& strings)
+    {
+      for (int idx = 0; idx < 16; ++idx)
+      {
+        auto pos = strings.find(idx);
+        std::u16string const text = pos != strings.end() ? pos->second : u"";
+        Data.push_back(static_cast<char16_t>(text.size()));
+        Data.insert(Data.end(), text.begin(), text.end());
+      }
+    }
+
+    //! Decode into a table
+    StringTable::Block  decode(StringTable& table, uint32_t block, uint16_t lang = English, uint32_t generation = 0) const
+    {
+      table.cached(block, lang, generation);
+      return table.decode(block, lang, generation, Data.data(), Data.size());
+    }
+  };
+
+  //! Get the text of an entry
+  std::u16string  text(const StringTable::Entry& e)
+  {
+    return std::u16string(e.Text, e.Length);
+  }
+}
+
+// --------------------------------------- DECODING --------------------------------------
+
+TEST(StringTable, DecodesLengthPrefixedStrings)
+{
+  StringTable table;
+  auto const block = BlockBuilder({{0, u"First"}, {3, u"Fourth"}, {15, u"Last"}}).decode(table, 2);
+
+  EXPECT_EQ(u"First", text(block.Strings[0]));
+  EXPECT_EQ(u"Fourth", text(block.Strings[3]));
+  EXPECT_EQ(u"Last", text(block.Strings[15]));
+  EXPECT_EQ(0u, block.Strings[1].Length);
+  EXPECT_NE(nullptr, block.Strings[1].Text) << "block exists, string does not";
+  EXPECT_EQ(u'\0', block.Strings[3].Text[6]) << "null-terminated";
+}
+
+TEST(StringTable, TreatsTruncatedStringsAsEmpty)
+{
+  StringTable table;
+  BlockBuilder builder({{0, u"Complete"}, {1, u"Truncated"}});
+  builder.Data.resize(1 + 8 + 1 + 4);
+
+  auto const block = builder.decode(table, 0);
+  EXPECT_EQ(u"Complete", text(block.Strings[0]));
+  EXPECT_EQ(0u, block.Strings[1].Length) << "extends beyond data";
+  for (int idx = 2; idx < 16; ++idx)
+    EXPECT_EQ(0u, block.Strings[idx].Length) << "missing entirely";
+}
+
+TEST(StringTable, TreatsEmptyDataAsEmptyStrings)
+{
+  StringTable table;
+  char16_t const none[1] = {};
+  auto const block = table.decode(0, English, 0, none, 0);
+  for (auto const& str : block.Strings)
+    EXPECT_EQ(0u, str.Length);
+}
+
+TEST(StringTable, RemembersMissingBlocks)
+{
+  StringTable table;
+  auto const block = table.decode(7, English, 0, nullptr, 0);
+  EXPECT_EQ(nullptr, block.Strings[0].Text);
+
+  const StringTable::Block* cached = table.cached(7, English, 0);
+  ASSERT_NE(nullptr, cached);
+  EXPECT_EQ(nullptr, cached->Strings[15].Text);
+}
+
+// --------------------------------------- CACHING ---------------------------------------
+
+TEST(StringTable, CachesBlocksByLanguage)
+{
+  StringTable table;
+  EXPECT_EQ(nullptr, table.cached(2, English, 0));
+
+  BlockBuilder({{1, u"Hello"}}).decode(table, 2, English);
+  const StringTable::Block* cached = table.cached(2, English, 0);
+  ASSERT_NE(nullptr, cached);
+  EXPECT_EQ(u"Hello", text(cached->Strings[1]));
+
+  EXPECT_EQ(nullptr, table.cached(2, French, 0));
+  EXPECT_EQ(nullptr, table.cached(3, English, 0));
+}
+
+TEST(StringTable, InternsDuplicatesAcrossBlocksAndLanguages)
+{
+  StringTable table;
+  auto const a = BlockBuilder({{0, u"OK"}, {1, u"Cancel"}}).decode(table, 0, English);
+  auto const b = BlockBuilder({{5, u"OK"}}).decode(table, 9, English);
+  auto const c = BlockBuilder({{0, u"OK"}, {1, u"Annuler"}}).decode(table, 0, French);
+
+  EXPECT_EQ(a.Strings[0].Text, b.Strings[5].Text);
+  EXPECT_EQ(a.Strings[0].Text, c.Strings[0].Text);
+  EXPECT_NE(a.Strings[1].Text, c.Strings[1].Text);
+  EXPECT_EQ(4u, table.size()) << "OK, Cancel, Annuler and the empty string";
+}
+
+TEST(StringTable, InternsStringsLongerThanAChunk)
+{
+  StringTable table;
+  std::u16string const huge(StringTable::ChunkSize + 10, u'x');
+  auto const block = BlockBuilder({{0, u"Small"}, {1, huge}, {2, u"After"}}).decode(table, 0);
+
+  EXPECT_EQ(huge, text(block.Strings[1]));
+  EXPECT_EQ(u"Small", text(block.Strings[0]));
+  EXPECT_EQ(u"After", text(block.Strings[2]));
+}
+
+// -------------------------------------- GENERATIONS ------------------------------------
+
+TEST(StringTable, GenerationChangeDiscardsBlocksButKeepsText)
+{
+  StringTable table(1);
+  auto const before = BlockBuilder({{0, u"Persistent"}}).decode(table, 4, English, 1);
+  table.decode(5, English, 1, nullptr, 0);
+
+  EXPECT_EQ(nullptr, table.cached(4, English, 2)) << "decoded block discarded";
+  EXPECT_EQ(nullptr, table.cached(5, English, 2)) << "missing block discarded";
+  EXPECT_EQ(u"Persistent", text(before.Strings[0])) << "interned text remains valid";
+
+  auto const after = BlockBuilder({{0, u"Persistent"}}).decode(table, 4, English, 2);
+  EXPECT_EQ(before.Strings[0].Text, after.Strings[0].Text) << "re-decoded text shares storage";
+  EXPECT_NE(nullptr, table.cached(4, English, 2));
+}
+
+TEST(StringTable, DoesNotCacheBlocksLocatedInEarlierGeneration)
+{
+  StringTable table(2);
+  auto const stale = BlockBuilder({{0, u"Stale"}}).decode(table, 4, English, 1);
+
+  EXPECT_EQ(u"Stale", text(stale.Strings[0])) << "returned";
+  EXPECT_EQ(nullptr, table.cached(4, English, 2)) << "but not cached";
+
+  table.decode(5, English, 1, nullptr, 0);
+  EXPECT_EQ(nullptr, table.cached(5, English, 2));
+}
+
+TEST(StringTable, ClearDiscardsEverything)
+{
+  StringTable table;
+  BlockBuilder({{0, u"Text"}}).decode(table, 0);
+  table.clear();
+  EXPECT_EQ(0u, table.size());
+  EXPECT_EQ(nullptr, table.cached(0, English, 0));
+}
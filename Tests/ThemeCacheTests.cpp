@@ -0,0 +1,224 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\ThemeCacheTests.cpp
+//! \brief Unit tests for ThemeCache
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/gdi/ThemeCache.hpp>             //!< ThemeCache, IThemeProvider
+#include <gtest/gtest.h>
+#include <map>
+#include <set>
+#include <string>
+
+using namespace wtl;
+
+namespace
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct FakeThemeProvider - Counts calls and derives measurements from their arguments
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct FakeThemeProvider : IThemeProvider
+  {
+    std::set<uintptr_t>           Open;           //!< Open theme handles
+    std::map<uintptr_t,FontKey>   Fonts;          //!< Attributes of each font handle
+    uintptr_t                     Next = 0x100;   //!< Next theme handle
+    uint32_t                      Opened = 0,
+                                  Closed = 0,
+                                  PartsMeasured = 0,
+                                  TextMeasured = 0;
+
+    uintptr_t  open(const wchar_t*, uint32_t) override
+    {
+      ++Opened;
+      Open.insert(Next);
+      return Next++;
+    }
+
+    void  close(uintptr_t theme) override
+    {
+      ++Closed;
+      Open.erase(theme);
+    }
+
+    void  describe(uintptr_t font, FontKey& key) override
+    {
+      key = Fonts.at(font);
+    }
+
+    SizeL  measure(uintptr_t, uintptr_t, int32_t part, int32_t state) override
+    {
+      ++PartsMeasured;
+      return SizeL(part, state);
+    }
+
+    //! Width is proportional to the height of the selected font  (As identified by the device context)
+    SizeL  measure(uintptr_t, uintptr_t dc, int32_t, int32_t, const wchar_t*, uint32_t length, uint32_t) override
+    {
+      ++TextMeasured;
+      int32_t const height = Fonts.at(dc).Height;
+      return SizeL(static_cast<int32_t>(length) * height / 2, height);
+    }
+
+    //! Register a font
+    void  font(uintptr_t handle, int32_t height, int32_t weight = 400)
+    {
+      Fonts[handle] = FontKey {L"Segoe UI", height, weight, false, false, false, 0, 0};
+    }
+  };
+
+  //! Measure text within a button, where the device context is identified by its font
+  SizeL  measureText(ThemeCache& cache, uintptr_t font, const std::wstring& text)
+  {
+    return cache.measure(L"Button", 96, font, font, 1, 1, text.c_str(), static_cast<uint32_t>(text.size()), 0);
+  }
+}
+
+TEST(ThemeCache, SharesHandlesByClassAndDpi)
+{
+  FakeThemeProvider provider;
+  {
+    ThemeCache cache(provider);
+
+    uintptr_t const button = cache.open(L"Button", 96);
+    EXPECT_EQ(button, cache.open(L"Button", 96));
+    EXPECT_NE(button, cache.open(L"Button", 144));
+    EXPECT_NE(button, cache.open(L"Edit", 96));
+
+    ThemeCache::Statistics const stats = cache.statistics();
+    EXPECT_EQ(1u, stats.Themes.Hits);
+    EXPECT_EQ(3u, stats.Themes.Misses);
+  }
+  // Destructor closes every handle
+  EXPECT_EQ(3u, provider.Closed);
+  EXPECT_TRUE(provider.Open.empty());
+}
+
+TEST(ThemeCache, MeasuresEachPartOnce)
+{
+  FakeThemeProvider provider;
+  ThemeCache cache(provider);
+
+  for (int repeat = 0; repeat < 10; ++repeat)
+    for (int32_t part = 1; part <= 5; ++part)
+      EXPECT_EQ(SizeL(part, 2), cache.measure(L"Button", 96, 0, part, 2));
+
+  EXPECT_EQ(5u, provider.PartsMeasured);
+  EXPECT_DOUBLE_EQ(0.9, cache.statistics().Parts.ratio());
+}
+
+TEST(ThemeCache, MeasuresEachTextOncePerFont)
+{
+  FakeThemeProvider provider;
+  provider.font(1, 16);
+  ThemeCache cache(provider);
+
+  for (int repeat = 0; repeat < 4; ++repeat)
+  {
+    EXPECT_EQ(SizeL(16, 16), measureText(cache, 1, L"OK"));
+    EXPECT_EQ(SizeL(48, 16), measureText(cache, 1, L"Cancel"));
+  }
+
+  EXPECT_EQ(2u, provider.TextMeasured);
+  EXPECT_EQ(6u, cache.statistics().Extents.Hits);
+  EXPECT_EQ(2u, cache.statistics().Extents.Misses);
+}
+
+TEST(ThemeCache, SharesExtentsBetweenHandlesOfIdenticalFonts)
+{
+  FakeThemeProvider provider;
+  provider.font(1, 16);
+  provider.font(2, 16);
+  ThemeCache cache(provider);
+
+  measureText(cache, 1, L"Apply");
+  measureText(cache, 2, L"Apply");
+
+  EXPECT_EQ(1u, provider.TextMeasured);
+}
+
+TEST(ThemeCache, ReusedFontHandleDoesNotReturnStaleExtent)
+{
+  FakeThemeProvider provider;
+  provider.font(1, 16);
+  ThemeCache cache(provider);
+
+  EXPECT_EQ(SizeL(40, 16), measureText(cache, 1, L"Apply"));
+
+  // Font is deleted and its handle re-used by a larger font
+  provider.font(1, 24);
+  EXPECT_EQ(SizeL(60, 24), measureText(cache, 1, L"Apply"));
+
+  // ...or a bolder font of the same height
+  provider.font(1, 24, 700);
+  measureText(cache, 1, L"Apply");
+  EXPECT_EQ(3u, provider.TextMeasured);
+}
+
+TEST(ThemeCache, DiscardsExtentsWhenFull)
+{
+  FakeThemeProvider provider;
+  provider.font(1, 10);
+  ThemeCache cache(provider, 4);
+
+  for (int i = 0; i < 5; ++i)
+    measureText(cache, 1, std::wstring(i + 1, L'x'));
+  measureText(cache, 1, L"x");
+
+  // Fifth extent discarded the first four
+  EXPECT_EQ(6u, provider.TextMeasured);
+}
+
+TEST(ThemeCache, RepeatedInvalidationEmptiesCacheOnce)
+{
+  FakeThemeProvider provider;
+  provider.font(1, 16);
+  ThemeCache cache(provider);
+
+  cache.open(L"Button", 96);
+  cache.open(L"Edit", 96);
+  cache.measure(L"Button", 96, 0, 1, 1);
+  measureText(cache, 1, L"OK");
+
+  // Every window is notified of a theme change
+  for (int window = 0; window < 50; ++window)
+    cache.invalidate();
+
+  EXPECT_EQ(0u, provider.Closed) << "handles closed before next use";
+
+  cache.open(L"Button", 96);
+  cache.open(L"Edit", 96);
+
+  EXPECT_EQ(2u, provider.Closed);
+  EXPECT_EQ(4u, provider.Opened);
+  EXPECT_EQ(1u, cache.statistics().Flushes);
+
+  // Measurements were discarded with the handles
+  cache.measure(L"Button", 96, 0, 1, 1);
+  measureText(cache, 1, L"OK");
+  EXPECT_EQ(2u, provider.PartsMeasured);
+  EXPECT_EQ(2u, provider.TextMeasured);
+}
+
+TEST(ThemeCache, RealisticWorkloadHitRate)
+{
+  FakeThemeProvider provider;
+  provider.font(1, 16);
+  provider.font(2, 16);     // Identical font, different handle
+  ThemeCache cache(provider);
+
+  // Repaint a dialog of 20 controls 100 times, alternating between two handles of the same font
+  for (int frame = 0; frame < 100; ++frame)
+    for (int control = 0; control < 20; ++control)
+    {
+      cache.measure(L"Button", 96, 0, 3, 1);
+      measureText(cache, 1 + frame % 2, L"Control " + std::to_wstring(control));
+    }
+
+  ThemeCache::Statistics const stats = cache.statistics();
+  EXPECT_EQ(1u, stats.Themes.Misses);
+  EXPECT_EQ(1u, provider.PartsMeasured);
+  EXPECT_EQ(20u, provider.TextMeasured);
+  EXPECT_GE(stats.Extents.ratio(), 0.99);
+}
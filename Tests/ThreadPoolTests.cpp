@@ -0,0 +1,109 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\ThreadPoolTests.cpp
+//! \brief Unit tests for ThreadPool and Task
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/threads/ThreadPool.hpp>         //!< ThreadPool
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace wtl;
+
+TEST(ThreadPool, AsyncReturnsResultAndContinuations)
+{
+  ThreadPool pool(2);
+
+  auto task = pool.async([] { return 20; }).then([] (const int& n) { return n + 1; }).then([] (const int& n) { return n * 2; });
+
+  EXPECT_EQ(42, task.get());
+}
+
+TEST(ThreadPool, AsyncPropagatesExceptionsThroughContinuations)
+{
+  ThreadPool pool(2);
+  bool executed = false;
+
+  auto task = pool.async([] () -> int { throw std::runtime_error("failed"); }).then([&] (const int&) { executed = true; });
+
+  EXPECT_THROW(task.get(), std::runtime_error);
+  EXPECT_FALSE(executed);
+}
+
+TEST(ThreadPool, TakeMovesMoveOnlyResult)
+{
+  ThreadPool pool(2);
+
+  auto task = pool.async([] { return std::unique_ptr<int>(new int(7)); });
+  EXPECT_EQ(7, *task.get());
+
+  std::unique_ptr<int> value = task.take();
+  ASSERT_TRUE(value != nullptr);
+  EXPECT_EQ(7, *value);
+}
+
+TEST(ThreadPool, ParallelForVisitsEveryIndexOnce)
+{
+  ThreadPool pool(4);
+  std::vector<std::atomic<int32_t>> visits(10000);
+  for (auto& v : visits)
+    v = 0;
+
+  pool.parallel_for<int32_t>(0, 10000, [&] (int32_t i) { ++visits[i]; }, 64);
+
+  for (auto& v : visits)
+    ASSERT_EQ(1, v.load());
+}
+
+TEST(ThreadPool, NestedWaitsUponWorkersDoNotExhaustPool)
+{
+  ThreadPool pool(2);
+
+  auto outer = pool.async([&pool]
+  {
+    std::vector<Task<int>> inner;
+    for (int i = 0; i < 16; ++i)
+      inner.push_back(pool.async([i] { return i; }));
+
+    int sum = 0;
+    for (auto& t : inner)
+      sum += t.get();
+    return sum;
+  });
+
+  EXPECT_EQ(120, outer.get());
+}
+
+TEST(ThreadPool, ExternalWaiterParksUntilWorkCompletes)
+{
+  ThreadPool pool(1);
+  std::atomic<bool> done{false};
+
+  pool.post([&] { std::this_thread::sleep_for(std::chrono::milliseconds(50)); done = true; });
+
+  auto const start = std::chrono::steady_clock::now();
+  pool.wait([&] { return done.load(); });
+
+  EXPECT_TRUE(done);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+TEST(ThreadPool, WaiterObservesConditionSatisfiedOutsidePool)
+{
+  ThreadPool pool(1);
+  std::atomic<bool> done{false};
+
+  std::thread other([&] { std::this_thread::sleep_for(std::chrono::milliseconds(20)); done = true; });
+  pool.wait([&] { return done.load(); });
+  other.join();
+
+  EXPECT_TRUE(done);
+}
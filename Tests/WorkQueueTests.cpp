@@ -0,0 +1,79 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file Tests\WorkQueueTests.cpp
+//! \brief Unit tests for WorkQueue
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#include <wtl/WTL.hpp>
+#include <wtl/threads/WorkQueue.hpp>          //!< WorkQueue
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace wtl;
+
+TEST(WorkQueue, NotifiesOncePerBatch)
+{
+  int32_t wakes = 0, executed = 0;
+  WorkQueue queue([&] { ++wakes; return true; });
+
+  queue.post([&] { ++executed; });
+  queue.post([&] { ++executed; });
+  EXPECT_EQ(1, wakes);
+
+  EXPECT_EQ(2u, queue.drain(std::chrono::seconds(1)));
+  queue.post([&] { ++executed; });
+  EXPECT_EQ(2, wakes);
+  EXPECT_EQ(2, executed);
+}
+
+TEST(WorkQueue, FailedNotificationIsRetriedByNextPost)
+{
+  bool accept = false;
+  int32_t attempts = 0;
+  WorkQueue queue([&] { ++attempts; return accept; });
+
+  queue.post([] {});
+  EXPECT_FALSE(queue.signalled());
+
+  accept = true;
+  queue.post([] {});
+  EXPECT_EQ(2, attempts);
+  EXPECT_TRUE(queue.signalled());
+  EXPECT_EQ(2u, queue.drain(std::chrono::seconds(1)));
+}
+
+TEST(WorkQueue, CoalescesWaitingItemsByKey)
+{
+  int32_t executed = 0;
+  WorkQueue queue([] { return true; });
+
+  EXPECT_TRUE(queue.post(1, [&] { ++executed; }));
+  EXPECT_FALSE(queue.post(1, [&] { ++executed; }));
+  EXPECT_TRUE(queue.post(2, [&] { ++executed; }));
+  queue.drain(std::chrono::seconds(1));
+  EXPECT_EQ(2, executed);
+
+  EXPECT_TRUE(queue.post(1, [&] { ++executed; }));
+  queue.drain(std::chrono::seconds(1));
+  EXPECT_EQ(3, executed);
+}
+
+TEST(WorkQueue, ExecutesEveryItemPostedConcurrently)
+{
+  std::atomic<int32_t> wakes{0};
+  int32_t executed = 0;
+  WorkQueue queue([&] { ++wakes; return true; });
+
+  std::vector<std::thread> producers;
+  for (int32_t t = 0; t < 4; ++t)
+    producers.emplace_back([&] { for (int32_t i = 0; i < 1000; ++i) queue.post([&] { ++executed; }); });
+  for (auto& p : producers)
+    p.join();
+
+  while (queue.drain(std::chrono::seconds(1)))
+  {}
+  EXPECT_EQ(4000, executed);
+}
@@ -9,6 +9,7 @@
 #define WTL_MACROS_HPP
 
 #include "WTL.hpp"
+#include <type_traits>                      //!< std::common_type_t
 
 // --------------------------------------------------------------------------------------------------------
 // ------------------------------------------ CONDITIONAL BUILDS ------------------------------------------
@@ -17,6 +18,11 @@
 //! \def DEVELOPMENT_MODE - Activate boundary, domain/logic invariant, iterator, and function argument verification
 #define DEVELOPMENT_MODE
 
+//! \def DISPATCH_TRACING - Activate message dispatch latency tracing  (Define as 1 before including the library)
+#ifndef DISPATCH_TRACING
+  #define DISPATCH_TRACING 0
+#endif
+
 // --------------------------------------------------------------------------------------------------------
 // ----------------------------------------------- COMPILER -----------------------------------------------
 // --------------------------------------------------------------------------------------------------------
@@ -189,13 +195,36 @@
 
 //! \if CHECKED_BOUNDARIES - Activates boundary verification
 #if CHECKED_BOUNDARIES
+  //! \namespace wtl - Windows template library
+  namespace wtl
+  {
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // wtl::checked_index constexpr
+    //! Query whether an index lies within a range
+    //!
+    //! \param[in] idx - Index
+    //! \param[in] min - Inclusive lower bounds
+    //! \param[in] max - Exclusive upper bounds
+    //! \return bool - True iff 'min' <= 'idx' < 'max'
+    //!
+    //! \remarks Compares in the common type of all three, so unsigned indices may be checked against a lower bound of zero
+    //! \remarks without comparisons that are always true, and negative signed indices fail against unsigned bounds.
+    //////////////////////////////////////////////////////////////////////////////////////////
+    template <typename IDX, typename MIN, typename MAX> constexpr
+    bool checked_index(IDX idx, MIN min, MAX max) noexcept
+    {
+      using common_t = std::common_type_t<IDX,MIN,MAX>;
+      return !(static_cast<common_t>(idx) < static_cast<common_t>(min)) && static_cast<common_t>(idx) < static_cast<common_t>(max);
+    }
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////
   //! \def CHECKED_INDEX - Throws an exception when an index is outside of an implementation defined range
   //! \param[in] idx - Index
   //! \param[in] min - Inclusive lower bounds
   //! \param[in] max - Exclusive upper bounds
   //////////////////////////////////////////////////////////////////////////////////////////
-  #define CHECKED_INDEX(idx, min, max)  { if (((idx) >= (min) && (idx) < (max)) == false) throw wtl::out_of_range(HERE, "Index ", idx, " outside of range ", min, " to ", max); }
+  #define CHECKED_INDEX(idx, min, max)  { if (wtl::checked_index(idx, min, max) == false) throw wtl::out_of_range(HERE, "Index ", idx, " outside of range ", min, " to ", max); }
 
   //////////////////////////////////////////////////////////////////////////////////////////
   //! \def CHECKED_LENGTH - Throws an exception when an implementation defined length is exceeded
@@ -249,6 +278,31 @@
 #endif
 
 
+// --------------------------------------------------------------------------------------------------------
+// ------------------------------------------- DISPATCH TRACING -------------------------------------------
+// --------------------------------------------------------------------------------------------------------
+
+//! \def TRACE_CONCAT - Concatenates two tokens after expansion
+#define TRACE_CONCAT_IMPL(a,b)        a##b
+#define TRACE_CONCAT(a,b)             TRACE_CONCAT_IMPL(a,b)
+
+//! \if DISPATCH_TRACING - Activates dispatch tracing  (Requires <wtl/utils/DispatchTrace.hpp>)
+#if DISPATCH_TRACING
+  //! \def TRACE_SCOPE - Records the duration of the enclosing scope as a span of a dispatch stage
+  #define TRACE_SCOPE(stage,id)         ::wtl::TraceScope TRACE_CONCAT(traceScope,__COUNTER__)(::wtl::TraceCategory::stage, static_cast<uintptr_t>(id))
+
+  //! \def TRACE_HANDLER - Records the duration of the enclosing scope as a span of an event handler
+  #define TRACE_HANDLER(dgt)            ::wtl::TraceScope TRACE_CONCAT(traceScope,__COUNTER__)(::wtl::TraceCategory::Handler, reinterpret_cast<uintptr_t>(&(dgt)), (dgt).target_type().name())
+
+//! \ifnot DISPATCH_TRACING - Deactivates dispatch tracing
+#else
+  //! \def TRACE_SCOPE - Deactivated
+  #define TRACE_SCOPE(stage,id)
+
+  //! \def TRACE_HANDLER - Deactivated
+  #define TRACE_HANDLER(dgt)
+#endif
+
 
 #endif // WTL_MACROS_HPP
 
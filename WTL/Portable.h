@@ -0,0 +1,323 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\Portable.h
+//! \brief Minimal definitions of the Win32 types and functions used by the platform-neutral core
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//!
+//! \remarks Included by WTL.hpp in place of <windows.h> when WTL_PORTABLE is defined. Only the core listed in WTL.hpp
+//! \remarks is supported; windowing, GDI, modules and the remaining MSVC-specific utilities are not.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_PORTABLE_HPP
+#define WTL_PORTABLE_HPP
+
+#include <cerrno>           //!< errno
+#include <cstdarg>          //!< va_list
+#include <cstdint>          //!< int32_t
+#include <cstddef>          //!< size_t
+#include <cstdio>           //!< std::snprintf
+#include <cstring>          //!< std::strerror, std::strlen
+#include <cwchar>           //!< std::wcslen, std::vswprintf
+
+// --------------------------------------------------------------------------------------------------------
+// ------------------------------------------------ TYPES -------------------------------------------------
+// --------------------------------------------------------------------------------------------------------
+
+typedef int             BOOL;
+typedef unsigned char   BYTE;
+typedef unsigned short  WORD;
+typedef uint32_t        DWORD;
+typedef unsigned int    UINT;
+typedef int32_t         LONG;
+typedef void*           HANDLE;
+typedef intptr_t        LPARAM;
+typedef uintptr_t       WPARAM;
+typedef intptr_t        LRESULT;
+
+//! Layout-compatible geometry
+struct POINT      { LONG x, y; };
+struct POINTS     { short x, y; };
+struct SIZE       { LONG cx, cy; };
+struct RECT       { LONG left, top, right, bottom; };
+struct COORD      { short X, Y; };
+struct SMALL_RECT { short Left, Top, Right, Bottom; };
+
+//! Console screen buffer
+struct CONSOLE_SCREEN_BUFFER_INFO { COORD dwSize, dwCursorPosition; WORD wAttributes; SMALL_RECT srWindow; COORD dwMaximumWindowSize; };
+
+// --------------------------------------------------------------------------------------------------------
+// ---------------------------------------------- CONSTANTS -----------------------------------------------
+// --------------------------------------------------------------------------------------------------------
+
+#define TRUE              1
+#define FALSE             0
+
+//! Code pages
+#define CP_ACP            0
+#define CP_OEMCP          1
+#define CP_MACCP          2
+#define CP_THREAD_ACP     3
+#define CP_SYMBOL         42
+#define CP_UTF7           65000
+#define CP_UTF8           65001
+
+//! Console text attributes
+#define FOREGROUND_BLUE         0x0001
+#define FOREGROUND_GREEN        0x0002
+#define FOREGROUND_RED          0x0004
+#define FOREGROUND_INTENSITY    0x0008
+#define BACKGROUND_BLUE         0x0010
+#define BACKGROUND_GREEN        0x0020
+#define BACKGROUND_RED          0x0040
+#define BACKGROUND_INTENSITY    0x0080
+
+//! Dialog template styles
+#define DS_SETFONT              0x40L
+
+//! Handles
+#define INVALID_HANDLE_VALUE    (reinterpret_cast<HANDLE>(static_cast<intptr_t>(-1)))
+#define STD_OUTPUT_HANDLE       (static_cast<DWORD>(-11))
+
+// --------------------------------------------------------------------------------------------------------
+// ---------------------------------------------- FUNCTIONS -----------------------------------------------
+// --------------------------------------------------------------------------------------------------------
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// ::GetLastError
+//! Get the calling thread's last error code
+//!
+//! \return DWORD - Value of 'errno'
+/////////////////////////////////////////////////////////////////////////////////////////
+inline DWORD  GetLastError()
+{
+  return static_cast<DWORD>(errno);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// ::WSAGetLastError
+//! Get the calling thread's last socket error code
+//!
+//! \return int - Value of 'errno'
+/////////////////////////////////////////////////////////////////////////////////////////
+inline int  WSAGetLastError()
+{
+  return errno;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// ::FormatMessageA
+//! Format the description of a system error code  (Only 'FORMAT_MESSAGE_FROM_SYSTEM' is supported)
+//!
+//! \param[in] flags - Ignored
+//! \param[in] const* source - Ignored
+//! \param[in] code - Value of 'errno'
+//! \param[in] language - Ignored
+//! \param[in,out] *buffer - Output buffer
+//! \param[in] size - Size of output buffer, in characters
+//! \param[in] args - Ignored
+//! \return DWORD - Number of characters written, excluding the null terminator
+/////////////////////////////////////////////////////////////////////////////////////////
+inline DWORD  FormatMessageA(DWORD /*flags*/, const void* /*source*/, DWORD code, DWORD /*language*/, char* buffer, DWORD size, void* /*args*/)
+{
+  int n = std::snprintf(buffer, size, "%s", std::strerror(static_cast<int>(code)));
+  return n < 0 ? 0 : (static_cast<DWORD>(n) < size ? n : size - 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// ::_snprintf
+//! Write formatted narrow characters into a buffer
+//!
+//! \param[in,out] *buffer - Output buffer
+//! \param[in] size - Capacity of output buffer, in characters
+//! \param[in] const* format - Format string
+//! \param[in] ... - Format arguments
+//! \return int - Number of characters written, or -1 if truncated
+/////////////////////////////////////////////////////////////////////////////////////////
+inline int  _snprintf(char* buffer, size_t size, const char* format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  int n = std::vsnprintf(buffer, size, format, args);
+  va_end(args);
+  return n >= 0 && static_cast<size_t>(n) < size ? n : -1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// ::_snwprintf
+//! Write formatted wide characters into a buffer
+//!
+//! \param[in,out] *buffer - Output buffer
+//! \param[in] size - Capacity of output buffer, in characters
+//! \param[in] const* format - Format string
+//! \param[in] ... - Format arguments
+//! \return int - Number of characters written, or -1 if truncated
+/////////////////////////////////////////////////////////////////////////////////////////
+inline int  _snwprintf(wchar_t* buffer, size_t size, const wchar_t* format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  int n = std::vswprintf(buffer, size, format, args);
+  va_end(args);
+  return n;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// ::MultiByteToWideChar
+//! Convert narrow characters to wide characters  (UTF-8 if 'CP_UTF8', otherwise Latin-1)
+//!
+//! \param[in] codepage - Input code page
+//! \param[in] flags - Ignored
+//! \param[in] const* src - Input characters
+//! \param[in] srcLen - Number of input characters, or -1 if null terminated
+//! \param[in,out] *dest - [optional] Output characters
+//! \param[in] destLen - Capacity of output, or zero to query the required capacity
+//! \return int - Number of output characters, or zero upon failure
+//!
+//! \remarks Output is UTF-16 or UTF-32 according to the width of wchar_t
+/////////////////////////////////////////////////////////////////////////////////////////
+inline int  MultiByteToWideChar(UINT codepage, DWORD /*flags*/, const char* src, int srcLen, wchar_t* dest, int destLen)
+{
+  const unsigned char *pos = reinterpret_cast<const unsigned char*>(src),
+                      *end = pos + (srcLen >= 0 ? srcLen : std::strlen(src) + 1);
+  int out = 0;
+
+  // Emit one output character, or count it
+  auto emit = [&](uint32_t ch) -> bool {
+    int const units = (sizeof(wchar_t) == 2 && ch >= 0x10000) ? 2 : 1;
+    if (dest)
+    {
+      if (out + units > destLen)
+        return false;
+      
+      if (units == 1)
+        dest[out] = static_cast<wchar_t>(ch);
+      else
+      {
+        dest[out]   = static_cast<wchar_t>(0xD800 + ((ch - 0x10000) >> 10));
+        dest[out+1] = static_cast<wchar_t>(0xDC00 + ((ch - 0x10000) & 0x3FF));
+      }
+    }
+    out += units;
+    return true;
+  };
+
+  while (pos < end)
+  {
+    uint32_t ch = *pos++;
+
+    // [UTF-8] Decode multi-byte sequences  (Malformed sequences are replaced with U+FFFD)
+    if (codepage == CP_UTF8 && ch >= 0x80)
+    {
+      int extra = ch >= 0xF8 ? -1 : ch >= 0xF0 ? 3 : ch >= 0xE0 ? 2 : ch >= 0xC0 ? 1 : -1;
+      ch &= 0x3F >> (extra > 0 ? extra : 0);
+      for (int n = 0; n < extra; ++n)
+      {
+        // [TRUNCATED] Leave the offending byte to be decoded next
+        if (pos == end || (*pos & 0xC0) != 0x80)
+        {
+          extra = -1;
+          break;
+        }
+        ch = (ch << 6) | (*pos++ & 0x3F);
+      }
+      if (extra < 0 || ch > 0x10FFFF)
+        ch = 0xFFFD;
+    }
+
+    // [INSUFFICIENT BUFFER] Fail
+    if (!emit(ch))
+    {
+      errno = ENOBUFS;
+      return 0;
+    }
+  }
+  return out;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// ::WideCharToMultiByte
+//! Convert wide characters to narrow characters  (UTF-8 if 'CP_UTF8', otherwise Latin-1)
+//!
+//! \param[in] codepage - Output code page
+//! \param[in] flags - Ignored
+//! \param[in] const* src - Input characters
+//! \param[in] srcLen - Number of input characters, or -1 if null terminated
+//! \param[in,out] *dest - [optional] Output characters
+//! \param[in] destLen - Capacity of output, or zero to query the required capacity
+//! \param[in] const* defChar - [optional] Replacement for unmappable characters  (Default is '?')
+//! \param[in,out] *usedDefault - [optional] Set to TRUE if any character was replaced
+//! \return int - Number of output characters, or zero upon failure
+/////////////////////////////////////////////////////////////////////////////////////////
+inline int  WideCharToMultiByte(UINT codepage, DWORD /*flags*/, const wchar_t* src, int srcLen, char* dest, int destLen, const char* defChar, BOOL* usedDefault)
+{
+  const wchar_t *pos = src,
+                *end = src + (srcLen >= 0 ? srcLen : std::wcslen(src) + 1);
+  int out = 0;
+
+  if (usedDefault)
+    *usedDefault = FALSE;
+
+  while (pos < end)
+  {
+    uint32_t ch = static_cast<uint32_t>(*pos++);
+    char     bytes[4];
+    int      count = 1;
+
+    // Combine surrogate pairs
+    if (sizeof(wchar_t) == 2 && ch >= 0xD800 && ch < 0xDC00 && pos < end && *pos >= 0xDC00 && *pos < 0xE000)
+      ch = 0x10000 + ((ch - 0xD800) << 10) + (static_cast<uint32_t>(*pos++) - 0xDC00);
+
+    // [UTF-8] Encode
+    if (codepage == CP_UTF8 && ch >= 0x80)
+    {
+      count = ch < 0x800 ? 2 : ch < 0x10000 ? 3 : 4;
+      for (int n = count - 1; n > 0; --n, ch >>= 6)
+        bytes[n] = static_cast<char>(0x80 | (ch & 0x3F));
+      bytes[0] = static_cast<char>((0xF00 >> count) | ch);
+    }
+    // [LATIN-1] Replace unmappable characters
+    else if (codepage != CP_UTF8 && ch > 0xFF)
+    {
+      bytes[0] = defChar ? *defChar : '?';
+      if (usedDefault)
+        *usedDefault = TRUE;
+    }
+    else
+      bytes[0] = static_cast<char>(ch);
+
+    // [INSUFFICIENT BUFFER] Fail
+    if (dest && out + count > destLen)
+    {
+      errno = ENOBUFS;
+      return 0;
+    }
+    for (int n = 0; n < count; ++n, ++out)
+      if (dest)
+        dest[out] = bytes[n];
+  }
+  return out;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// Console  (The debug console writes to stdout, without colour or cursor positioning)
+/////////////////////////////////////////////////////////////////////////////////////////
+inline BOOL    AllocConsole()                                  { return TRUE;   }
+inline BOOL    FreeConsole()                                   { return TRUE;   }
+inline HANDLE  GetStdHandle(DWORD)                             { return stdout; }
+inline BOOL    SetConsoleCursorPosition(HANDLE, COORD)         { return FALSE;  }
+inline BOOL    SetConsoleTextAttribute(HANDLE, WORD)           { return TRUE;   }
+
+inline BOOL  GetConsoleScreenBufferInfo(HANDLE, CONSOLE_SCREEN_BUFFER_INFO* info)
+{
+  *info = CONSOLE_SCREEN_BUFFER_INFO {};
+  info->wAttributes = 0x0007;
+  return TRUE;
+}
+
+inline BOOL  WriteConsoleA(HANDLE handle, const void* buffer, DWORD length, DWORD* written, void*)
+{
+  *written = static_cast<DWORD>(std::fwrite(buffer, 1, length, static_cast<std::FILE*>(handle)));
+  return *written == length ? TRUE : FALSE;
+}
+
+#endif // WTL_PORTABLE_HPP
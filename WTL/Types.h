@@ -10,6 +10,7 @@
 
 #include "WTL.hpp"
 #include <cstdint>
+#include <climits>
 
 // Remove 'CHAR' typedef
 #ifdef CHAR
@@ -23,11 +24,19 @@ namespace wtl
   // ----------------------------------------- FUNDEMENTAL TYPES ---------------------------------------------
   // ---------------------------------------------------------------------------------------------------------
 
+#if LONG_MAX == INT32_MAX
   //! \alias ulong32_t - Signed 32-bit long integer
   using long32_t  = signed long int;
 
   //! \alias ulong32_t - Unsigned 32-bit long integer
   using ulong32_t = unsigned long int;
+#else
+  //! \alias long32_t - Signed 32-bit integer  (LP64 platforms, where 'long' is 64-bit)
+  using long32_t  = int32_t;
+
+  //! \alias ulong32_t - Unsigned 32-bit integer  (LP64 platforms, where 'long' is 64-bit)
+  using ulong32_t = uint32_t;
+#endif
 
   //! \alias long64_t - Signed 64-bit long long integer
   using long64_t = int64_t;
@@ -12,6 +12,12 @@
 // ---------------------------------------------- PLATFORM ------------------------------------------------
 // --------------------------------------------------------------------------------------------------------
 
+//! \def WTL_PORTABLE - Build only the platform-neutral core  (Defined automatically on non-Windows platforms)
+//! \remarks The core comprises the array, string, encoding, exception and item-model utilities, memory streams, events/delegates and pugixml
+#if !defined(_WIN32) && !defined(WTL_PORTABLE)
+  #define WTL_PORTABLE
+#endif
+
 //! \def STRSAFE_NO_DEPRECATE - Disable the StringSafe library depreciation warnings
 #define STRSAFE_NO_DEPRECATE
 
@@ -39,13 +45,17 @@
   #define _WIN32_WINNT    _WIN32_WINNT_WINXP
 #endif
 
-#include <windows.h>        // Main windows header
-#include <commctrl.h>       // Common controls library
-#include <windowsx.h>       // Window helper macros
-#include <tchar.h>          // Defines narrow/wide char Win32 entry points
-//#include <strsafe.h>      // StringSafe library - Secure string handling
-#include <shlwapi.h>        // Shell light-weight API - Path handling
-//#include <Shellapi.h>     // Shell API - FileSystem-Shell COM interop  
+#ifndef WTL_PORTABLE
+  #include <windows.h>        // Main windows header
+  #include <commctrl.h>       // Common controls library
+  #include <windowsx.h>       // Window helper macros
+  #include <tchar.h>          // Defines narrow/wide char Win32 entry points
+  //#include <strsafe.h>      // StringSafe library - Secure string handling
+  #include <shlwapi.h>        // Shell light-weight API - Path handling
+  //#include <Shellapi.h>     // Shell API - FileSystem-Shell COM interop  
+#else
+  #include "Portable.h"     // Minimal definitions of the Win32 types used by the core
+#endif
 
 // --------------------------------------------------------------------------------------------------------
 // ----------------------------------------------- LIBRARY ------------------------------------------------
@@ -59,7 +69,9 @@
 #include "Constants.h"
 
 // Windows API functors
-#include "WinAPI.h"
+#ifndef WTL_PORTABLE
+  #include "WinAPI.h"
+#endif
 
 #endif // WTL_HPP
 
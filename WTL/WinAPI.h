@@ -29,6 +29,7 @@ namespace wtl
 
     //! Functions 'C'
     static constexpr auto callWindowProc = choose<encoding>(::CallWindowProcA,::CallWindowProcW);
+    static constexpr auto createFile = choose<encoding>(::CreateFileA,::CreateFileW);
     static constexpr auto createFont = choose<encoding>(::CreateFontA,::CreateFontW);
     static constexpr auto createWindowEx = choose<encoding>(::CreateWindowExA,::CreateWindowExW);
     
@@ -39,6 +40,7 @@ namespace wtl
     
     //! Functions 'F'
     static constexpr auto findFirstFile = choose<encoding>(::FindFirstFileA,::FindFirstFileW);
+    static constexpr auto findFirstFileEx = choose<encoding>(::FindFirstFileExA,::FindFirstFileExW);
     static constexpr auto findNextFile = choose<encoding>(::FindNextFileA,::FindNextFileW);
     static constexpr auto findResourceEx = choose<encoding>(::FindResourceExA,::FindResourceExW);
     static constexpr auto formatMessage = choose<encoding>(::FormatMessageA,::FormatMessageW);
@@ -47,6 +49,7 @@ namespace wtl
     static constexpr auto getClassInfoEx = choose<encoding>(::GetClassInfoExA,::GetClassInfoExW);
     static constexpr auto getDateFormat = choose<encoding>(::GetDateFormatA,::GetDateFormatW);
     static constexpr auto getFileAttributes = choose<encoding>(::GetFileAttributesA,::GetFileAttributesW);
+    static constexpr auto getFileAttributesEx = choose<encoding>(::GetFileAttributesExA,::GetFileAttributesExW);
     static constexpr auto getMessage = choose<encoding>(::GetMessageA,::GetMessageW);
     static constexpr auto getModuleFileName = choose<encoding>(::GetModuleFileNameA,::GetModuleFileNameW);
     static constexpr auto getTempPath = choose<encoding>(::GetTempPathA,::GetTempPathW);
@@ -82,7 +85,9 @@ namespace wtl
     static constexpr auto pathRemoveExtension = choose<encoding>(::PathRemoveExtensionA,::PathRemoveExtensionW);
     static constexpr auto pathRenameExtension = choose<encoding>(::PathRenameExtensionA,::PathRenameExtensionW);
     static constexpr auto pathRemoveFileSpec = choose<encoding>(::PathRemoveFileSpecA,::PathRemoveFileSpecW);
+    static constexpr auto peekMessage = choose<encoding>(::PeekMessageA,::PeekMessageW);
     static constexpr auto postMessage = choose<encoding>(::PostMessageA,::PostMessageW);
+    static constexpr auto postThreadMessage = choose<encoding>(::PostThreadMessageA,::PostThreadMessageW);
 
     //! Functions 'R'
     static constexpr auto registerClassEx = choose<encoding>(::RegisterClassExA,::RegisterClassExW);
@@ -0,0 +1,304 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\gdi\DamageRegion.hpp
+//! \brief Accumulates the areas of a surface which must be repainted
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_DAMAGE_REGION_HPP
+#define WTL_DAMAGE_REGION_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/utils/Rectangle.hpp>                //!< RectL
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct DamageRegion - Bounded set of non-overlapping rectangles requiring repaint
+  //!
+  //! \remarks Overlapping rectangles are merged as they are added. Once the capacity is reached, the pair
+  //! \remarks of rectangles whose union wastes the least area are merged, so the region only ever grows.
+  //!
+  //! \remarks Does not depend upon any Win32 API
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct DamageRegion
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = DamageRegion;
+
+    //! \alias const_iterator - Rectangle iterator
+    using const_iterator = const RectL*;
+
+    //! \var Capacity - Maximum number of rectangles
+    static constexpr uint32_t  Capacity = 16;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    RectL      Rects[Capacity];      //!< Damaged rectangles
+    uint32_t   Count;                //!< Number of rectangles
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DamageRegion::DamageRegion
+    //! Create empty region
+    /////////////////////////////////////////////////////////////////////////////////////////
+    DamageRegion() : Count(0)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    ENABLE_COPY(DamageRegion);      //!< Can be copied
+    ENABLE_MOVE(DamageRegion);      //!< Can be moved
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DamageRegion::area
+    //! Calculate the number of pixels within a rectangle
+    //!
+    //! \param[in] const& rc - Rectangle
+    //! \return size_t - Area, or zero if empty
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static size_t  area(const RectL& rc)
+    {
+      if (rc.Right <= rc.Left || rc.Bottom <= rc.Top)
+        return 0;
+
+      return static_cast<size_t>(rc.Right - rc.Left) * static_cast<size_t>(rc.Bottom - rc.Top);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DamageRegion::intersects
+    //! Query whether two rectangles overlap
+    //!
+    //! \param[in] const& a - First rectangle
+    //! \param[in] const& b - Second rectangle
+    //! \return bool - True iff rectangles share at least one pixel
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static bool  intersects(const RectL& a, const RectL& b)
+    {
+      return a.Left < b.Right && b.Left < a.Right
+          && a.Top < b.Bottom && b.Top < a.Bottom;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DamageRegion::intersection
+    //! Calculate the overlap of two rectangles
+    //!
+    //! \param[in] const& a - First rectangle
+    //! \param[in] const& b - Second rectangle
+    //! \return RectL - Overlap, or an empty rectangle if they do not intersect
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static RectL  intersection(const RectL& a, const RectL& b)
+    {
+      if (!intersects(a, b))
+        return RectL::EMPTY;
+
+      return RectL(a.Left > b.Left ? a.Left : b.Left,         a.Top > b.Top ? a.Top : b.Top,
+                   a.Right < b.Right ? a.Right : b.Right,     a.Bottom < b.Bottom ? a.Bottom : b.Bottom);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DamageRegion::unite
+    //! Calculate the smallest rectangle enclosing two rectangles
+    //!
+    //! \param[in] const& a - First rectangle
+    //! \param[in] const& b - Second rectangle
+    //! \return RectL - Bounding rectangle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static RectL  unite(const RectL& a, const RectL& b)
+    {
+      return RectL(a.Left < b.Left ? a.Left : b.Left,         a.Top < b.Top ? a.Top : b.Top,
+                   a.Right > b.Right ? a.Right : b.Right,     a.Bottom > b.Bottom ? a.Bottom : b.Bottom);
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DamageRegion::begin const
+    //! Get position of first rectangle
+    //!
+    //! \return const_iterator - Position of first rectangle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const_iterator  begin() const
+    {
+      return Rects;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DamageRegion::end const
+    //! Get position beyond last rectangle
+    //!
+    //! \return const_iterator - Position beyond last rectangle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const_iterator  end() const
+    {
+      return Rects + Count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DamageRegion::area const
+    //! Get the number of damaged pixels
+    //!
+    //! \return size_t - Sum of the areas of every rectangle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t  area() const
+    {
+      size_t total = 0;
+      for (uint32_t idx = 0; idx < Count; ++idx)
+        total += area(Rects[idx]);
+      return total;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DamageRegion::bounds const
+    //! Get the smallest rectangle enclosing the region
+    //!
+    //! \return RectL - Bounding rectangle, or an empty rectangle if undamaged
+    /////////////////////////////////////////////////////////////////////////////////////////
+    RectL  bounds() const
+    {
+      if (!Count)
+        return RectL::EMPTY;
+
+      RectL rc = Rects[0];
+      for (uint32_t idx = 1; idx < Count; ++idx)
+        rc = unite(rc, Rects[idx]);
+      return rc;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DamageRegion::empty const
+    //! Query whether region is undamaged
+    //!
+    //! \return bool - True iff no rectangles
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  empty() const
+    {
+      return Count == 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DamageRegion::intersects const
+    //! Query whether a rectangle overlaps the region
+    //!
+    //! \param[in] const& rc - Rectangle
+    //! \return bool - True iff rectangle overlaps any damaged rectangle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  intersects(const RectL& rc) const
+    {
+      for (uint32_t idx = 0; idx < Count; ++idx)
+        if (intersects(Rects[idx], rc))
+          return true;
+      return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DamageRegion::size const
+    //! Get the number of rectangles
+    //!
+    //! \return uint32_t - Number of rectangles
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  size() const
+    {
+      return Count;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DamageRegion::add
+    //! Add a rectangle to the region
+    //!
+    //! \param[in] rc - Damaged rectangle  (Empty rectangles are ignored)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  add(RectL rc)
+    {
+      // [EMPTY] Ignore
+      if (rc.Right <= rc.Left || rc.Bottom <= rc.Top)
+        return;
+
+      // Absorb every overlapping rectangle  (Repeat since the union may overlap others)
+      for (uint32_t idx = 0; idx < Count; )
+        if (intersects(Rects[idx], rc))
+        {
+          rc = unite(rc, Rects[idx]);
+          Rects[idx] = Rects[--Count];
+          idx = 0;
+        }
+        else
+          ++idx;
+
+      // [FULL] Merge the cheapest pair to make room, then re-add since the merged pair may now overlap
+      if (Count == Capacity)
+      {
+        compact();
+        add(rc);
+        return;
+      }
+
+      Rects[Count++] = rc;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DamageRegion::clear
+    //! Remove all rectangles
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clear()
+    {
+      Count = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DamageRegion::clip
+    //! Restrict the region to the extent of a surface
+    //!
+    //! \param[in] const& surface - Extent of surface
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clip(const RectL& surface)
+    {
+      for (uint32_t idx = 0; idx < Count; )
+        if (intersects(Rects[idx], surface))
+        {
+          Rects[idx] = intersection(Rects[idx], surface);
+          ++idx;
+        }
+        else
+          Rects[idx] = Rects[--Count];
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DamageRegion::compact
+    //! Merge the pair of rectangles whose union adds the least undamaged area
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  compact()
+    {
+      uint32_t first = 0,
+               second = 1;
+      size_t   waste = static_cast<size_t>(-1);
+
+      // Find cheapest pair
+      for (uint32_t a = 0; a < Count; ++a)
+        for (uint32_t b = a+1; b < Count; ++b)
+        {
+          size_t const cost = area(unite(Rects[a], Rects[b])) - area(Rects[a]) - area(Rects[b]);
+          if (cost < waste)
+            first = a, second = b, waste = cost;
+        }
+
+      // Merge pair, then absorb any rectangles it now overlaps
+      RectL merged = unite(Rects[first], Rects[second]);
+      Rects[second] = Rects[--Count];
+      Rects[first] = Rects[--Count];
+      add(merged);
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_DAMAGE_REGION_HPP
@@ -16,8 +16,10 @@
 #include <wtl/traits/DeviceContextTraits.hpp>     //!< HDeviceContext
 #include <wtl/traits/BrushTraits.hpp>             //!< HBrush
 #include <wtl/traits/FontTraits.hpp>              //!< HFont
+#include <wtl/gdi/NativeFontMetrics.hpp>          //!< NativeFontMetrics, FontCache
+#include <wtl/gdi/DisplayFrame.hpp>               //!< DisplayFrame
 #include <wtl/traits/PenTraits.hpp>               //!< HPen
-#include <wtl/traits/WindowTraits.hpp>            //!< HWnd
+#include <wtl/traits/windowtraits.hpp>            //!< HWnd
 #include <wtl/platform/Colours.hpp>               //!< Colours
 #include <wtl/platform/DrawingFlags.hpp>          //!< DrawTextFlags
 #include <wtl/utils/Rectangle.hpp>                //!< Rectangle
@@ -161,7 +163,8 @@ namespace wtl
     
     // ----------------------------------- REPRESENTATION -----------------------------------
   protected:
-    HDeviceContext   Handle;    //!< DC Handle
+    HDeviceContext   Handle;      //!< DC Handle
+    DisplayFrame*    Recorder;    //!< Frame recording drawing operations, if any
       
     // ------------------------------------ CONSTRUCTION ------------------------------------
   public:
@@ -183,7 +186,8 @@ namespace wtl
     DeviceContext(const HDeviceContext& dc) : ObjectStack<HBrush>(dc),
                                               ObjectStack<HPen>(dc),
                                               ObjectStack<HFont>(dc),
-                                              Handle(dc)
+                                              Handle(dc),
+                                              Recorder(nullptr)
     {}
     
     // -------------------------------- COPY, MOVE & DESTROY --------------------------------
@@ -219,12 +223,18 @@ namespace wtl
     //! \param[in] underline - Underlined
     //! \param[in] quality - Output quality
     //! \param[in] charSet - Character set
-    //! \return HFont - Handle to new font
+    //! \return HFont - Shared handle to font  (Fonts with identical attributes are shared via the process-wide FontCache)
+    //!
+    //! \throw wtl::platform_error - Unable to create font
     /////////////////////////////////////////////////////////////////////////////////////////
     template <Encoding ENC>
     HFont getFont(const String<ENC>& name, int32_t points, FontWeight weight = FontWeight::Normal, bool italic = false, bool underline = false, FontQuality quality = FontQuality::AntiAliased, FontCharSet charSet = FontCharSet::Default)
     {
-      return HFont(name, getFontHeight(points), weight, italic, underline, false, charSet, quality);
+      FontKey key {String<Encoding::UTF16>(name), getFontHeight(points), static_cast<int32_t>(enum_cast(weight)), italic, underline, false, 
+                   static_cast<uint8_t>(enum_cast(charSet)), static_cast<uint8_t>(enum_cast(quality))};
+
+      // Lookup/create font 
+      return NativeFontMetrics::instance().get(NativeFontMetrics::cache().acquire(key)->Handle);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////
@@ -293,6 +303,16 @@ namespace wtl
     template <typename P, typename S>
     void draw(const HIcon& icon, const Point<P>& pt, const Size<S>& sz)
     {
+      // [RECORDING] Append to display list  (Resolve default extent now, so bounds are known)
+      if (Recorder)
+      {
+        long32_t const width = sz.Width ? static_cast<long32_t>(sz.Width) : ::GetSystemMetrics(SM_CXICON),
+                       height = sz.Height ? static_cast<long32_t>(sz.Height) : ::GetSystemMetrics(SM_CYICON);
+        Recorder->retain(icon);
+        Recorder->List.record(DisplayList::command(DisplayOp::Icon, RectL(pt.X, pt.Y, pt.X+width, pt.Y+height), opaque(icon)));
+        return;
+      }
+
       // [ICON] Draw icon
       if (::DrawIconEx(Handle, pt.X, pt.Y, icon, sz.Width, sz.Height, 0, nullptr, DI_IMAGE | DI_MASK) == False)
         throw platform_error(HERE, "Unable to draw icon");
@@ -310,6 +330,14 @@ namespace wtl
     template <typename T>
     void draw(const HIcon& icon, const Rect<T>& rc)
     {
+      // [RECORDING] Append to display list
+      if (Recorder)
+      {
+        Recorder->retain(icon);
+        Recorder->List.record(DisplayList::command(DisplayOp::Icon, RectL(rc), opaque(icon)));
+        return;
+      }
+
       // [ICON] Draw icon
       if (::DrawIconEx(Handle, rc.Left, rc.Top, icon, rc.width(), rc.height(), 0, nullptr, DI_IMAGE | DI_MASK) == False)
         throw platform_error(HERE, "Unable to draw icon");
@@ -326,6 +354,10 @@ namespace wtl
     template <typename T>
     void  ellipse(const Rect<T>& rc)
     {
+      // [RECORDING] Append to display list
+      if (Recorder)
+        return Recorder->List.record(DisplayList::command(DisplayOp::Ellipse, RectL(rc), current(DrawObjectType::Brush), current(DrawObjectType::Pen)));
+
       // Fill & outline ellipse 
       if (::Ellipse(Handle, rc.Left, rc.Top, rc.Right, rc.Bottom) == False)
         throw platform_error(HERE, "Unable to draw ellipse");
@@ -342,6 +374,10 @@ namespace wtl
     template <typename T>
     void  fill(const Rect<T>& rc)
     {
+      // [RECORDING] Append to display list
+      if (Recorder)
+        return Recorder->List.record(DisplayList::command(DisplayOp::Fill, RectL(rc), current(DrawObjectType::Brush)));
+
       // Fill target rectangle with current brush
       if (::FillRect(Handle, rc, (HBRUSH)::GetCurrentObject(Handle, enum_cast(DrawObjectType::Brush))) == False)
         throw platform_error(HERE, "Unable to fill rect");
@@ -359,6 +395,14 @@ namespace wtl
     template <typename T>
     void  fill(const Rect<T>& rc, const HBrush& brush)
     {
+      // [RECORDING] Append to display list
+      if (Recorder)
+      {
+        Recorder->retain(brush);
+        Recorder->List.record(DisplayList::command(DisplayOp::Fill, RectL(rc), opaque(brush)));
+        return;
+      }
+
       // Fill target rectangle with custom brush
       if (::FillRect(Handle, rc, brush) == False)
         throw platform_error(HERE, "Unable to fill custom rect");
@@ -375,6 +419,10 @@ namespace wtl
     template <typename T>
     void  focus(const Rect<T>& rc)
     {
+      // [RECORDING] Append to display list
+      if (Recorder)
+        return Recorder->List.record(DisplayList::command(DisplayOp::Focus, RectL(rc)));
+
       if (::DrawFocusRect(Handle, rc) == False)
         throw platform_error(HERE, "Unable to draw focus rect");
     }
@@ -391,6 +439,14 @@ namespace wtl
     template <typename T>
     void  frame(const Rect<T>& rc, const HBrush& brush)
     {
+      // [RECORDING] Append to display list
+      if (Recorder)
+      {
+        Recorder->retain(brush);
+        Recorder->List.record(DisplayList::command(DisplayOp::Frame, RectL(rc), opaque(brush)));
+        return;
+      }
+
       // Draw frame rectangle with custom brush
       if (::FrameRect(Handle, rc, brush) == False)
         throw platform_error(HERE, "Unable to draw frame rect");
@@ -412,6 +468,10 @@ namespace wtl
     {
       SizeL sz;   //!< Text size
 
+      // [CACHED] Measure using font cache
+      if (auto font = cachedFont(txt.c_str(), txt.size()))
+        return NativeFontMetrics::cache().measure(font, txt.c_str(), static_cast<uint32_t>(txt.size()));
+
       // Measure text
       if (WinAPI<ENC>::getTextExtentPoint32(Handle, txt.c_str(), txt.size(), sz) == False)
         throw platform_error(HERE, "Unable to measure text");
@@ -436,6 +496,10 @@ namespace wtl
     {
       SizeL sz;   //!< Text size
 
+      // [CACHED] Measure using font cache
+      if (auto font = cachedFont(txt, strlen(txt)))
+        return NativeFontMetrics::cache().measure(font, txt, static_cast<uint32_t>(strlen(txt)));
+
       // Measure text
       if (WinAPI<ENC>::getTextExtentPoint32(Handle, txt, strlen(txt), sz) == False)
         throw platform_error(HERE, "Unable to measure text");
@@ -465,8 +529,123 @@ namespace wtl
     template <typename OBJ>
     void push(const OBJ& obj)
     {
+      // [RECORDING] Retain object until frame is replayed
+      if (Recorder)
+        Recorder->retain(obj);
+
       ObjectStack<OBJ>::push(obj);
     }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::record
+    //! Start or stop recording drawing operations into a display list, instead of executing them
+    //! 
+    //! \param[in] *frame - Frame receiving subsequent operations, or nullptr to resume drawing
+    //! 
+eturn DisplayFrame* - Previous recording frame, if any
+    //!
+    //! 
+emarks Rectangles, polygons and triangles cannot be recorded
+    /////////////////////////////////////////////////////////////////////////////////////////
+    DisplayFrame* record(DisplayFrame* frame)
+    {
+      std::swap(Recorder, frame);
+      return frame;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::recorder const
+    //! Get the frame recording drawing operations, if any
+    //! 
+    //! 
+eturn DisplayFrame* - Recording frame, or nullptr if drawing
+    /////////////////////////////////////////////////////////////////////////////////////////
+    DisplayFrame* recorder() const
+    {
+      return Recorder;
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::cachedFont const
+    //! Get the current font from the font cache, provided text drawn with it can be measured by the cache
+    //! 
+    //! \tparam CHR - Character type
+    //!
+    //! \param[in] const* txt - Text to be measured
+    //! \param[in] length - Length of text, in characters
+    //! \return FontCache::font_t - Current font, or nullptr if not cached or text must be measured by the device
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename CHR>
+    FontCache::font_t cachedFont(const CHR* txt, size_t length) const
+    {
+      // [NARROW] Cache assumes ASCII 
+      if (sizeof(CHR) == 1)
+        for (size_t idx = 0; idx < length; ++idx)
+          if (static_cast<uint8_t>(txt[idx]) > 0x7F)
+            return nullptr;
+
+      // [DEVICE] Cache measures using display metrics in the MM_TEXT mapping mode, without character spacing
+      if (::GetDeviceCaps(Handle, TECHNOLOGY) != DT_RASDISPLAY || ::GetMapMode(Handle) != MM_TEXT || ::GetTextCharacterExtra(Handle) != 0)
+        return nullptr;
+
+      // Lookup current font
+      return NativeFontMetrics::cache().find(reinterpret_cast<uintptr_t>(::GetCurrentObject(Handle, OBJ_FONT)));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::current const
+    //! Get the currently selected drawing object
+    //! 
+    //! \param[in] type - Object type
+    //! 
+eturn uintptr_t - Native handle of selected object
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uintptr_t current(DrawObjectType type) const
+    {
+      return reinterpret_cast<uintptr_t>(::GetCurrentObject(Handle, enum_cast(type)));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::opaque const
+    //! Get the native handle of a drawing object as an opaque value
+    //! 
+    //! 	param OBJ - Drawing object handle type
+    //!
+    //! \param[in] const& obj - Drawing object
+    //! 
+eturn uintptr_t - Native handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename OBJ>
+    static uintptr_t opaque(const OBJ& obj)
+    {
+      return reinterpret_cast<uintptr_t>(obj.get());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::record
+    //! Append text to the recording frame, using the current font, colours and background mode
+    //! 
+    //! 	param CHR - Character type
+    //!
+    //! \param[in] const* txt - Text
+    //! \param[in] len - Text length, in characters
+    //! \param[in] const& rc - Drawing rectangle
+    //! \param[in] flags - Drawing flags
+    //! 
+eturn int32_t - Height of drawing rectangle  (Text is not measured while recording)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename CHR>
+    int32_t record(const CHR* txt, int32_t len, const RectL& rc, DrawTextFlags flags)
+    {
+      DisplayCommand cmd = DisplayList::command(DisplayOp::Text, rc, 0, current(DrawObjectType::Font));
+      cmd.Flags = static_cast<uint32_t>(enum_cast(flags));
+      cmd.Fore = ::GetTextColor(Handle);
+      cmd.Back = ::GetBkColor(Handle);
+      cmd.Mode = static_cast<uint8_t>(::GetBkMode(Handle));
+      Recorder->List.record(cmd, txt, static_cast<uint32_t>(len >= 0 ? len : strlen(txt)));
+      return rc.height();
+    }
     
     /////////////////////////////////////////////////////////////////////////////////////////
     // DeviceContext::rect
@@ -474,11 +653,16 @@ namespace wtl
     //! 
     //! \param[in] rc - Drawing rectangle
     //!
+    //! \throw wtl::logic_error - Device context is recording
     //! \throw wtl::platform_error - Unable to draw rectangle
     /////////////////////////////////////////////////////////////////////////////////////////
     template <typename T>
     void  rect(const Rect<T>& rc)
     {
+      // [RECORDING] Not supported
+      if (Recorder)
+        throw logic_error(HERE, "Cannot record rectangle");
+
       // Outline target rectangle with current pen
       if (::Rectangle(Handle, rc.Left, rc.Top, rc.Right, rc.Bottom) == False)
         throw platform_error(HERE, "Unable to draw rectangle");
@@ -490,11 +674,16 @@ namespace wtl
     //! 
     //! \param[in] rc - Drawing rectangle in which to centre the ellipse
     //!
+    //! \throw wtl::logic_error - Device context is recording
     //! \throw wtl::platform_error - Unable to draw polygon
     /////////////////////////////////////////////////////////////////////////////////////////
     template <unsigned LENGTH>
     void  polygon(::POINT (&points)[LENGTH])
     {
+      // [RECORDING] Not supported
+      if (Recorder)
+        throw logic_error(HERE, "Cannot record polygon");
+
       // Fill & outline polygon
       if (::Polygon(Handle, points, lengthof(points)) == False)
         throw platform_error(HERE, "Unable to draw polygon");
@@ -506,11 +695,16 @@ namespace wtl
     //! 
     //! \param[in] rc - Drawing rectangle
     //!
+    //! \throw wtl::logic_error - Device context is recording
     //! \throw wtl::platform_error - Unable to draw rectangle
     /////////////////////////////////////////////////////////////////////////////////////////
     template <typename T>
     void  triangle(const Triangle<T>& triangle)
     {
+      // [RECORDING] Not supported
+      if (Recorder)
+        throw logic_error(HERE, "Cannot record triangle");
+
       // Draw triangle with current pen and brush
       if (::Polygon(Handle, triangle, 3) == False)
         throw platform_error(HERE, "Unable to draw triangle");
@@ -601,12 +795,17 @@ namespace wtl
     //! \param[in] flags - Drawing flags
     //! \return int32_t - Height of the text in logical units iff successful. (If DT_VCENTER or DT_BOTTOM is specified then the offset from lpRect->top to the bottom of the drawn text)
     //!                 Zero upon failure.
+    //!                 Height of the drawing rectangle while recording.
     //!
     //! \throw wtl::platform_error - Unable to draw text
     /////////////////////////////////////////////////////////////////////////////////////////
     template <Encoding ENC>
     int32_t write(const String<ENC>& txt, RectL& rc, DrawTextFlags flags = DrawTextFlags::Left|DrawTextFlags::VCentre)
     {
+      // [RECORDING] Append to display list  (Unless only measuring)
+      if (Recorder && !(flags && DrawTextFlags::CalcRect))
+        return record(txt.c_str(), static_cast<int32_t>(txt.size()), rc, flags);
+
       // Draw text
       if (int32_t height = WinAPI<ENC>::drawText(Handle, txt.c_str(), txt.size(), rc, enum_cast(flags)))
         return height;
@@ -625,12 +824,17 @@ namespace wtl
     //! \param[in] flags - Drawing flags
     //! \return int32_t - Height of the text in logical units iff successful. (If DT_VCENTER or DT_BOTTOM is specified then the offset from lpRect->top to the bottom of the drawn text)
     //!                 Zero upon failure.
+    //!                 Height of the drawing rectangle while recording.
     //!
     //! \throw wtl::platform_error - Unable to draw text
     /////////////////////////////////////////////////////////////////////////////////////////
     template <typename CHR>
     int32_t write(const CHR* txt, int32_t len, RectL& rc, DrawTextFlags flags = DrawTextFlags::Left|DrawTextFlags::VCentre)
     {
+      // [RECORDING] Append to display list  (Unless only measuring)
+      if (Recorder && !(flags && DrawTextFlags::CalcRect))
+        return record(txt, len, rc, flags);
+
       // Draw text
       if (int32_t height = choose<default_encoding<CHR>>(::DrawTextA,::DrawTextW)(Handle, txt, len, rc, enum_cast(flags)))
         return height;
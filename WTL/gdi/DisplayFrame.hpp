@@ -0,0 +1,110 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\gdi\DisplayFrame.hpp
+//! \brief Display list recorded by a device context, with the drawing objects it refers to
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_DISPLAY_FRAME_HPP
+#define WTL_DISPLAY_FRAME_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/gdi/DisplayList.hpp>                //!< DisplayList
+#include <wtl/traits/BrushTraits.hpp>             //!< HBrush
+#include <wtl/traits/FontTraits.hpp>              //!< HFont
+#include <wtl/traits/IconTraits.hpp>              //!< HIcon
+#include <wtl/traits/PenTraits.hpp>               //!< HPen
+#include <wtl/traits/ThemeTraits.hpp>             //!< HTheme
+#include <vector>                                 //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct DisplayFrame - Display list recorded during one paint, and the drawing objects it refers to
+  //!
+  //! \remarks Shared handles of every drawing object used are retained until the frame is cleared, so commands
+  //! \remarks can be replayed after the caller has released them, and their handle values cannot be re-used
+  //! \remarks by other objects while the frame is compared against its successor.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct DisplayFrame
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = DisplayFrame;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    DisplayList            List;         //!< Recorded commands
+
+  protected:
+    std::vector<HBrush>    Brushes;      //!< Brushes referred to by commands
+    std::vector<HFont>     Fonts;        //!< Fonts referred to by commands
+    std::vector<HIcon>     Icons;        //!< Icons referred to by commands
+    std::vector<HPen>      Pens;         //!< Pens referred to by commands
+    std::vector<HTheme>    Themes;       //!< Themes referred to by commands
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayFrame::DisplayFrame
+    //! Create empty frame
+    /////////////////////////////////////////////////////////////////////////////////////////
+    DisplayFrame() = default;
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(DisplayFrame);      //!< Cannot be copied
+    ENABLE_MOVE(DisplayFrame);       //!< Can be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayFrame::clear
+    //! Remove all commands and release all drawing objects  (Retains capacity)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clear()
+    {
+      List.clear();
+      Brushes.clear();
+      Fonts.clear();
+      Icons.clear();
+      Pens.clear();
+      Themes.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayFrame::retain
+    //! Retain a drawing object until the frame is cleared
+    //!
+    //! \param[in] const& obj - Shared handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  retain(const HBrush& obj)   { Brushes.push_back(obj); }
+    void  retain(const HFont& obj)    { Fonts.push_back(obj);   }
+    void  retain(const HIcon& obj)    { Icons.push_back(obj);   }
+    void  retain(const HPen& obj)     { Pens.push_back(obj);    }
+    void  retain(const HTheme& obj)   { Themes.push_back(obj);  }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayFrame::swap
+    //! Exchange contents with another frame
+    //!
+    //! \param[in,out] &r - Other frame
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  swap(DisplayFrame& r)
+    {
+      List.swap(r.List);
+      Brushes.swap(r.Brushes);
+      Fonts.swap(r.Fonts);
+      Icons.swap(r.Icons);
+      Pens.swap(r.Pens);
+      Themes.swap(r.Themes);
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_DISPLAY_FRAME_HPP
@@ -0,0 +1,378 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\gdi\DisplayList.hpp
+//! \brief Records drawing operations so that successive frames can be compared and partially replayed
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_DISPLAY_LIST_HPP
+#define WTL_DISPLAY_LIST_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/gdi/DamageRegion.hpp>               //!< DamageRegion
+#include <wtl/utils/Rectangle.hpp>                //!< RectL
+#include <cstring>                                //!< std::memcmp
+#include <vector>                                 //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \enum DisplayOp - Defines the kinds of recorded drawing operation
+  /////////////////////////////////////////////////////////////////////////////////////////
+  enum class DisplayOp : uint8_t
+  {
+    Fill,           //!< Fill rectangle with brush
+    Frame,          //!< Outline rectangle with brush
+    Focus,          //!< Draw focus rectangle
+    Ellipse,        //!< Fill and outline ellipse with brush and pen
+    Icon,           //!< Draw icon into rectangle
+    Text,           //!< Write text into rectangle
+    ThemeFill,      //!< Draw visual style part background
+    ThemeText,      //!< Write text using visual style part
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct DisplayCommand - Recorded drawing operation
+  //!
+  //! \remarks Handles are opaque and colours are native RGB values, so commands may be recorded and compared
+  //! \remarks without a device. Text is held by the owning list.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct DisplayCommand
+  {
+    DisplayOp   Op;             //!< Operation
+    uint8_t     CharSize;       //!< [Text] Character size, in bytes
+    uint8_t     Mode;           //!< [Text] Background mode
+    uint8_t     Reserved;       //!< Reserved  (Zero)
+    uint32_t    Flags;          //!< [Text] Drawing flags
+    int32_t     Part,           //!< [Theme] Part
+                State;          //!< [Theme] State
+    uint32_t    Fore,           //!< [Text] Text colour
+                Back;           //!< [Text] Background colour
+    uintptr_t   Object,         //!< Brush, icon or theme handle
+                Extra;          //!< Font or pen handle
+    RectL       Area,           //!< Drawing rectangle
+                Bounds;         //!< Rectangle affected by drawing  (Within 'Area')
+    uint32_t    TextOffset,     //!< [Text] Offset of text within owning list, in bytes
+                TextLength;     //!< [Text] Length of text, in characters
+    uint64_t    Hash;           //!< Hash of operation and text
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct IDisplaySurface - Interface for the target of a replayed display list
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct IDisplaySurface
+  {
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+
+    ENABLE_POLY(IDisplaySurface);     //!< Abstract base class
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+
+    //! Clipping  (Surface erases the damaged rectangle upon beginning)
+    virtual void  begin(const RectL& damage) = 0;
+    virtual void  end() = 0;
+
+    //! Drawing
+    virtual void  execute(const DisplayCommand& cmd, const void* text) = 0;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct DisplayList - Compact buffer of drawing operations recorded during one frame
+  //!
+  //! \remarks Commands and their text are held in two contiguous buffers whose capacity is retained
+  //! \remarks between frames, so recording a frame of similar complexity does not allocate.
+  //!
+  //! \remarks Does not depend upon any Win32 API
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct DisplayList
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = DisplayList;
+
+    //! \alias const_iterator - Command iterator
+    using const_iterator = std::vector<DisplayCommand>::const_iterator;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::vector<DisplayCommand>   Commands;     //!< Commands, in drawing order
+    std::vector<uint8_t>          Text;         //!< Text of every command
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayList::DisplayList
+    //! Create empty list
+    /////////////////////////////////////////////////////////////////////////////////////////
+    DisplayList() = default;
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    ENABLE_COPY(DisplayList);      //!< Can be deep copied
+    ENABLE_MOVE(DisplayList);      //!< Can be moved
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayList::command
+    //! Create a command without text
+    //!
+    //! \param[in] op - Operation
+    //! \param[in] const& rc - Drawing rectangle
+    //! \param[in] object - [optional] Brush, icon or theme handle
+    //! \param[in] extra - [optional] Font or pen handle
+    //! \return DisplayCommand - Command with every other field zeroed
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static DisplayCommand  command(DisplayOp op, const RectL& rc, uintptr_t object = 0, uintptr_t extra = 0)
+    {
+      DisplayCommand cmd {};
+      cmd.Op = op;
+      cmd.Area = cmd.Bounds = rc;
+      cmd.Object = object;
+      cmd.Extra = extra;
+      return cmd;
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayList::begin const
+    //! Get position of first command
+    //!
+    //! \return const_iterator - Position of first command
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const_iterator  begin() const
+    {
+      return Commands.begin();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayList::end const
+    //! Get position beyond last command
+    //!
+    //! \return const_iterator - Position beyond last command
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const_iterator  end() const
+    {
+      return Commands.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayList::diff const
+    //! Accumulate the rectangles whose contents differ from a previous frame
+    //!
+    //! \param[in] const& previous - Previous frame
+    //! \param[in,out] &damage - Damaged region
+    //!
+    //! \remarks Commands are aligned by their common prefix and suffix, then compared pairwise; so a single
+    //! \remarks insertion or removal does not damage everything drawn after it. Both the previous and current
+    //! \remarks bounds of every unmatched command are damaged, which preserves drawing order wherever they overlap.
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  diff(const DisplayList& previous, DamageRegion& damage) const
+    {
+      size_t const count = Commands.size(),
+                   prevCount = previous.Commands.size(),
+                   shortest = count < prevCount ? count : prevCount;
+
+      // Match common prefix
+      size_t first = 0;
+      while (first < shortest && equal(Commands[first], previous, previous.Commands[first]))
+        ++first;
+
+      // Match common suffix
+      size_t last = 0;
+      while (last < shortest - first && equal(Commands[count-last-1], previous, previous.Commands[prevCount-last-1]))
+        ++last;
+
+      // Compare remainder pairwise
+      for (size_t idx = first, prev = first; idx < count-last || prev < prevCount-last; ++idx, ++prev)
+      {
+        bool const current = idx < count-last,
+                   former = prev < prevCount-last;
+
+        if (current && former && equal(Commands[idx], previous, previous.Commands[prev]))
+          continue;
+
+        if (current)
+          damage.add(Commands[idx].Bounds);
+        if (former)
+          damage.add(previous.Commands[prev].Bounds);
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayList::empty const
+    //! Query whether list contains any commands
+    //!
+    //! \return bool - True iff no commands
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  empty() const
+    {
+      return Commands.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayList::replay const
+    //! Replay every command which intersects a damaged region
+    //!
+    //! \param[in,out] &surface - Drawing surface
+    //! \param[in] const& damage - Damaged region  (Each rectangle is replayed separately, clipped to itself)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  replay(IDisplaySurface& surface, const DamageRegion& damage) const
+    {
+      for (const RectL& rc : damage)
+      {
+        surface.begin(rc);
+        for (const DisplayCommand& cmd : Commands)
+          if (DamageRegion::intersects(cmd.Bounds, rc))
+            surface.execute(cmd, text(cmd));
+        surface.end();
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayList::size const
+    //! Get the number of commands
+    //!
+    //! \return uint32_t - Number of commands
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  size() const
+    {
+      return static_cast<uint32_t>(Commands.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayList::text const
+    //! Get the text of a command
+    //!
+    //! \param[in] const& cmd - Command within this list
+    //! \return const void* - Text, or nullptr if none  (Not null-terminated)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const void*  text(const DisplayCommand& cmd) const
+    {
+      return cmd.TextLength ? &Text[cmd.TextOffset] : nullptr;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayList::clear
+    //! Remove all commands  (Retains capacity)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clear()
+    {
+      Commands.clear();
+      Text.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayList::record
+    //! Append a command without text
+    //!
+    //! \param[in] cmd - Command
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  record(DisplayCommand cmd)
+    {
+      cmd.TextOffset = cmd.TextLength = 0;
+      cmd.CharSize = 0;
+      cmd.Hash = hash(cmd, nullptr, 0);
+      Commands.push_back(cmd);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayList::record
+    //! Append a command with text
+    //!
+    //! \tparam CHR - Character type
+    //!
+    //! \param[in] cmd - Command
+    //! \param[in] const* txt - Text  (Need not be null-terminated)
+    //! \param[in] length - Length of text, in characters
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename CHR>
+    void  record(DisplayCommand cmd, const CHR* txt, uint32_t length)
+    {
+      auto const* bytes = reinterpret_cast<const uint8_t*>(txt);
+      size_t const size = length * sizeof(CHR);
+
+      // Append text
+      cmd.CharSize = static_cast<uint8_t>(sizeof(CHR));
+      cmd.TextOffset = static_cast<uint32_t>(Text.size());
+      cmd.TextLength = length;
+      Text.insert(Text.end(), bytes, bytes + size);
+
+      cmd.Hash = hash(cmd, bytes, size);
+      Commands.push_back(cmd);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayList::swap
+    //! Exchange contents with another list
+    //!
+    //! \param[in,out] &r - Other list
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  swap(DisplayList& r)
+    {
+      Commands.swap(r.Commands);
+      Text.swap(r.Text);
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayList::equal const
+    //! Query whether a command of this list is identical to a command of another list
+    //!
+    //! \param[in] const& cmd - Command within this list
+    //! \param[in] const& other - Other list
+    //! \param[in] const& r - Command within other list
+    //! \return bool - True iff operation, parameters, bounds and text are identical
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  equal(const DisplayCommand& cmd, const DisplayList& other, const DisplayCommand& r) const
+    {
+      return cmd.Hash == r.Hash
+          && cmd.Op == r.Op && cmd.CharSize == r.CharSize && cmd.Mode == r.Mode && cmd.Flags == r.Flags
+          && cmd.Part == r.Part && cmd.State == r.State && cmd.Fore == r.Fore && cmd.Back == r.Back
+          && cmd.Object == r.Object && cmd.Extra == r.Extra && cmd.Area == r.Area && cmd.Bounds == r.Bounds
+          && cmd.TextLength == r.TextLength
+          && (!cmd.TextLength || !std::memcmp(&Text[cmd.TextOffset], &other.Text[r.TextOffset], cmd.TextLength * cmd.CharSize));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DisplayList::hash
+    //! Calculate the FNV-1a hash of a command and its text
+    //!
+    //! \param[in] const& cmd - Command  (Excluding text offset and hash)
+    //! \param[in] const* text - [optional] Text
+    //! \param[in] size - Length of text, in bytes
+    //! \return uint64_t - Hash
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint64_t  hash(const DisplayCommand& cmd, const uint8_t* text, size_t size)
+    {
+      uint64_t h = 14695981039346656037ULL;
+      auto mix = [&h] (uint64_t value) {
+        for (int byte = 0; byte < 8; ++byte, value >>= 8)
+          h = (h ^ (value & 0xFF)) * 1099511628211ULL;
+      };
+
+      mix(static_cast<uint64_t>(cmd.Op) | (uint64_t(cmd.CharSize) << 8) | (uint64_t(cmd.Mode) << 16) | (uint64_t(cmd.Flags) << 32));
+      mix(static_cast<uint32_t>(cmd.Part) | (uint64_t(static_cast<uint32_t>(cmd.State)) << 32));
+      mix(cmd.Fore | (uint64_t(cmd.Back) << 32));
+      mix(cmd.Object);
+      mix(cmd.Extra);
+      mix(static_cast<uint32_t>(cmd.Area.Left) | (uint64_t(static_cast<uint32_t>(cmd.Area.Top)) << 32));
+      mix(static_cast<uint32_t>(cmd.Area.Right) | (uint64_t(static_cast<uint32_t>(cmd.Area.Bottom)) << 32));
+      mix(static_cast<uint32_t>(cmd.Bounds.Left) | (uint64_t(static_cast<uint32_t>(cmd.Bounds.Top)) << 32));
+      mix(static_cast<uint32_t>(cmd.Bounds.Right) | (uint64_t(static_cast<uint32_t>(cmd.Bounds.Bottom)) << 32));
+      mix(cmd.TextLength);
+
+      for (size_t idx = 0; idx < size; ++idx)
+        h = (h ^ text[idx]) * 1099511628211ULL;
+      return h;
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_DISPLAY_LIST_HPP
@@ -0,0 +1,396 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\gdi\FontCache.hpp
+//! \brief Shares fonts between their users, and caches the text extents measured with them
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_FONT_CACHE_HPP
+#define WTL_FONT_CACHE_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/gdi/FontKey.hpp>                    //!< FontKey
+#include <wtl/utils/CacheCounters.hpp>            //!< CacheCounters
+#include <wtl/utils/Exception.hpp>                //!< platform_error
+#include <wtl/utils/Size.hpp>                     //!< SizeL
+#include <list>                                   //!< std::list
+#include <memory>                                 //!< std::shared_ptr, std::unique_ptr
+#include <mutex>                                  //!< std::mutex
+#include <string>                                 //!< std::wstring
+#include <type_traits>                            //!< std::make_unsigned_t
+#include <unordered_map>                          //!< std::unordered_map
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct IFontMetrics - Interface for the source of fonts and their metrics
+  //!
+  //! \remarks Font handles are opaque to the cache, so that a synthetic font can be substituted.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct IFontMetrics
+  {
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+
+    ENABLE_POLY(IFontMetrics);      //!< Abstract base class
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+
+    //! Handles
+    virtual uintptr_t  create(const FontKey& key) = 0;
+    virtual void       destroy(uintptr_t font) = 0;
+
+    //! Measuring
+    virtual int32_t  height(uintptr_t font) = 0;
+    virtual int32_t  overhang(uintptr_t font) = 0;
+    virtual void     advances(uintptr_t font, wchar_t first, wchar_t last, int32_t* widths) = 0;
+    virtual SizeL    measure(uintptr_t font, const wchar_t* text, uint32_t length) = 0;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct FontCache - Shares fonts with identical attributes, and measures text drawn with them
+  //!
+  //! \remarks Text consisting entirely of Latin characters (U+0020 to U+024F) is measured by summing the advance
+  //! \remarks widths of its characters, which are queried once per font, plus the overhang of synthesized fonts;
+  //! \remarks as GetTextExtentPoint32 does without kerning. Other text is measured by the provider and its extent
+  //! \remarks retained by a least-recently-used cache.
+  //!
+  //! \remarks Fonts are reference counted; those no longer referenced outside the cache are destroyed by 'trim'.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct FontCache
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = FontCache;
+
+    //! \var FirstGlyph - First character within the advance table
+    static constexpr wchar_t  FirstGlyph = 0x0020;
+
+    //! \var LastGlyph - Last character within the advance table
+    static constexpr wchar_t  LastGlyph = 0x024F;
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Font - Cached font
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Font
+    {
+      FontKey                     Key;          //!< Attributes
+      uintptr_t                   Handle;       //!< Font handle
+      int32_t                     Height;       //!< Line height
+      int32_t                     Overhang;     //!< Extra width added to each string  (Synthesized bold/italic only)
+      std::unique_ptr<int32_t[]>  Advances;     //!< Advance widths of 'FirstGlyph' through 'LastGlyph'
+    };
+
+    //! \alias font_t - Shared font reference
+    using font_t = std::shared_ptr<const Font>;
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Statistics - Counters of each kind of lookup
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+      CacheCounters  Fonts,        //!< Fonts  (Misses create a font)
+                     Extents;      //!< Text extents  (Hits include those summed from advance tables)
+    };
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct ExtentKey - Font and text
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct ExtentKey
+    {
+      uintptr_t     Font;       //!< Font handle
+      std::wstring  Text;       //!< Text
+
+      bool operator == (const ExtentKey& r) const
+      {
+        return Font == r.Font && Text == r.Text;
+      }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Extent - Measured text, in order of use
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Extent
+    {
+      ExtentKey  Key;       //!< Font and text
+      SizeL      Size;      //!< Extent of text
+    };
+
+    //! \alias extent_list_t - Extents in order of use  (Most recent first)
+    using extent_list_t = std::list<Extent>;
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct KeyHash - Hashes fonts and extents
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct KeyHash
+    {
+      size_t operator () (const FontKey& k) const
+      {
+        return k.hash();
+      }
+
+      size_t operator () (const ExtentKey* k) const
+      {
+        return combine(std::hash<std::wstring>()(k->Text), k->Font);
+      }
+
+      static size_t combine(size_t seed, size_t value)
+      {
+        return seed ^ (value + 0x9e3779b9u + (seed << 6) + (seed >> 2));
+      }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct KeyEqual - Compares extent keys by value
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct KeyEqual
+    {
+      bool operator () (const ExtentKey* l, const ExtentKey* r) const
+      {
+        return *l == *r;
+      }
+    };
+
+    //! \alias font_map_t - Fonts by attributes
+    using font_map_t = std::unordered_map<FontKey,std::shared_ptr<Font>,KeyHash>;
+
+    //! \alias handle_map_t - Fonts by handle
+    using handle_map_t = std::unordered_map<uintptr_t,std::shared_ptr<Font>>;
+
+    //! \alias extent_map_t - Extents by font and text  (Keys refer to list elements)
+    using extent_map_t = std::unordered_map<const ExtentKey*,extent_list_t::iterator,KeyHash,KeyEqual>;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    IFontMetrics&         Provider;     //!< Source of fonts and metrics
+    mutable std::mutex    Lock;         //!< Protects all state
+    font_map_t            Fonts;        //!< Fonts by attributes
+    handle_map_t          Handles;      //!< Fonts by handle
+    extent_list_t         Recent;       //!< Extents, most recently used first
+    extent_map_t          Extents;      //!< Extents by font and text
+    ExtentKey             Probe;        //!< Reusable lookup key  (Avoids allocating per lookup)
+    uint32_t              Capacity;     //!< Maximum number of extents
+    Statistics            Stats;        //!< Hit and miss counters
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FontCache::FontCache
+    //! Create empty cache
+    //!
+    //! \param[in] &provider - Source of fonts and metrics
+    //! \param[in] capacity - [optional] Maximum number of extents retained
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit
+    FontCache(IFontMetrics& provider, uint32_t capacity = 2048) : Provider(provider),
+                                                                  Capacity(capacity),
+                                                                  Stats {}
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(FontCache);      //!< Cannot be copied
+    DISABLE_MOVE(FontCache);      //!< Cannot be moved
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FontCache::~FontCache
+    //! Destroys all fonts
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~FontCache()
+    {
+      for (auto& f : Handles)
+        Provider.destroy(f.first);
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FontCache::find const
+    //! Find a cached font by handle
+    //!
+    //! \param[in] handle - Font handle
+    //! \return font_t - Shared font, or nullptr if the font was not created by this cache
+    /////////////////////////////////////////////////////////////////////////////////////////
+    font_t  find(uintptr_t handle) const
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      auto pos = Handles.find(handle);
+      return pos != Handles.end() ? pos->second : nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FontCache::size const
+    //! Get the number of fonts
+    //!
+    //! \return uint32_t - Number of fonts
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  size() const
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      return static_cast<uint32_t>(Fonts.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FontCache::statistics const
+    //! Get the hit and miss counters
+    //!
+    //! \return Statistics - Counters of each kind of lookup
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Statistics  statistics() const
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      return Stats;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FontCache::acquire
+    //! Get a font with the specified attributes, creating it upon first use
+    //!
+    //! \param[in] const& key - Font attributes
+    //! \return font_t - Shared font
+    //!
+    //! \throw wtl::platform_error - Unable to create font
+    /////////////////////////////////////////////////////////////////////////////////////////
+    font_t  acquire(const FontKey& key)
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+
+      // [CACHED] Share existing font
+      auto pos = Fonts.find(key);
+      if (pos != Fonts.end())
+      {
+        ++Stats.Fonts.Hits;
+        return pos->second;
+      }
+
+      // Create font
+      ++Stats.Fonts.Misses;
+      uintptr_t const handle = Provider.create(key);
+      if (!handle)
+        throw platform_error(HERE, "Unable to create font");
+
+      // Query line height and advance widths once
+      std::shared_ptr<Font> font = std::make_shared<Font>();
+      font->Key = key;
+      font->Handle = handle;
+      font->Height = Provider.height(handle);
+      font->Overhang = Provider.overhang(handle);
+      font->Advances.reset(new int32_t[LastGlyph - FirstGlyph + 1]);
+      Provider.advances(handle, FirstGlyph, LastGlyph, font->Advances.get());
+
+      Handles.emplace(handle, font);
+      return Fonts.emplace(key, font).first->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FontCache::measure
+    //! Measure text drawn in a cached font
+    //!
+    //! \tparam CHR - Character type  (Narrow strings must be ASCII)
+    //!
+    //! \param[in] const& font - Font
+    //! \param[in] const* text - Text  (Need not be null-terminated)
+    //! \param[in] length - Length of text, in characters
+    //! \return SizeL - Extent of text
+    //!
+    //! \throw wtl::invalid_argument - [Debug only] Missing font
+    //! \throw wtl::platform_error - Unable to measure text
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename CHR>
+    SizeL  measure(const font_t& font, const CHR* text, uint32_t length)
+    {
+      REQUIRED_PARAM(font);
+
+      // [LATIN] Sum advance widths
+      int32_t width = 0;
+      uint32_t idx = 0;
+      for (; idx < length; ++idx)
+      {
+        auto const ch = static_cast<std::make_unsigned_t<CHR>>(text[idx]);
+        if (ch < FirstGlyph || ch > (sizeof(CHR) == 1 ? 0x7F : LastGlyph))
+          break;
+        width += font->Advances[ch - FirstGlyph];
+      }
+
+      std::lock_guard<std::mutex> guard(Lock);
+      if (idx == length)
+      {
+        ++Stats.Extents.Hits;
+        return SizeL(length ? width + font->Overhang : 0, font->Height);
+      }
+
+      // Populate probe key  (Re-uses its capacity)
+      Probe.Font = font->Handle;
+      Probe.Text.assign(text, text + length);
+
+      // [CACHED] Promote to most recent
+      auto pos = Extents.find(&Probe);
+      if (pos != Extents.end())
+      {
+        ++Stats.Extents.Hits;
+        Recent.splice(Recent.begin(), Recent, pos->second);
+        return pos->second->Size;
+      }
+
+      // [FULL] Evict least recently used
+      ++Stats.Extents.Misses;
+      if (Capacity && Extents.size() >= Capacity)
+      {
+        Extents.erase(&Recent.back().Key);
+        Recent.pop_back();
+      }
+
+      // Measure and remember
+      Recent.push_front(Extent {Probe, Provider.measure(font->Handle, Probe.Text.c_str(), length)});
+      Extents.emplace(&Recent.front().Key, Recent.begin());
+      return Recent.front().Size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FontCache::trim
+    //! Destroys fonts which are no longer referenced outside the cache, and their extents
+    //!
+    //! \return uint32_t - Number of fonts destroyed
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  trim()
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      uint32_t count = 0;
+
+      for (auto f = Handles.begin(); f != Handles.end(); )
+      {
+        // [IN USE] Referenced by 'Fonts', 'Handles' and elsewhere
+        if (f->second.use_count() > 2)
+        {
+          ++f;
+          continue;
+        }
+
+        // Discard extents  (Handles may be re-used)
+        for (auto e = Recent.begin(); e != Recent.end(); )
+          if (e->Key.Font == f->first)
+          {
+            Extents.erase(&e->Key);
+            e = Recent.erase(e);
+          }
+          else
+            ++e;
+
+        // Destroy font
+        Provider.destroy(f->first);
+        Fonts.erase(f->second->Key);
+        f = Handles.erase(f);
+        ++count;
+      }
+
+      return count;
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_FONT_CACHE_HPP
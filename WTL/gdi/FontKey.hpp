@@ -0,0 +1,65 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\gdi\FontKey.hpp
+//! \brief Identifies a font by its attributes rather than its handle
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_FONT_KEY_HPP
+#define WTL_FONT_KEY_HPP
+
+#include <wtl/WTL.hpp>
+#include <functional>                             //!< std::hash
+#include <string>                                 //!< std::wstring
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct FontKey - Attributes which distinguish one font from another
+  //!
+  //! \remarks Font handles may be re-used once deleted, so measurements cached beyond the lifetime of a font
+  //! \remarks should be keyed by its attributes instead.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct FontKey
+  {
+    std::wstring  Face;         //!< Typeface name
+    int32_t       Height;       //!< Height, in logical units
+    int32_t       Weight;       //!< Weight  (eg. FW_NORMAL)
+    bool          Italic,       //!< Whether italic
+                  Underline,    //!< Whether underlined
+                  StrikeOut;    //!< Whether struck out
+    uint8_t       CharSet,      //!< Character set
+                  Quality;      //!< Output quality
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FontKey::hash const
+    //! Calculate a hash of every attribute
+    //!
+    //! \return size_t - Hash
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t  hash() const
+    {
+      size_t hash = std::hash<std::wstring>()(Face);
+      hash = combine(hash, static_cast<uint32_t>(Height));
+      hash = combine(hash, static_cast<uint32_t>(Weight));
+      return combine(hash, (Italic << 0) | (Underline << 1) | (StrikeOut << 2) | (CharSet << 8) | (Quality << 16));
+    }
+
+    bool operator == (const FontKey& r) const
+    {
+      return Height == r.Height && Weight == r.Weight
+          && Italic == r.Italic && Underline == r.Underline && StrikeOut == r.StrikeOut
+          && CharSet == r.CharSet && Quality == r.Quality && Face == r.Face;
+    }
+
+  protected:
+    static size_t combine(size_t seed, size_t value)
+    {
+      return seed ^ (value + 0x9e3779b9u + (seed << 6) + (seed >> 2));
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_FONT_KEY_HPP
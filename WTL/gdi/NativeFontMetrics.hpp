@@ -0,0 +1,254 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\gdi\NativeFontMetrics.hpp
+//! \brief Provides fonts and their metrics from GDI
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_NATIVE_FONT_METRICS_HPP
+#define WTL_NATIVE_FONT_METRICS_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/gdi/FontCache.hpp>                  //!< IFontMetrics, FontCache
+#include <wtl/traits/FontTraits.hpp>              //!< HFont
+#include <wtl/utils/Exception.hpp>                //!< platform_error
+#include <wtl/utils/Size.hpp>                     //!< SizeL
+#include <wtl/utils/String.hpp>                   //!< String
+#include <mutex>                                  //!< std::mutex
+#include <unordered_map>                          //!< std::unordered_map
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct NativeFontMetrics - Provides fonts and their metrics from GDI
+  //!
+  //! \remarks Fonts are measured within a private memory device context, using the MM_TEXT mapping mode
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct NativeFontMetrics : IFontMetrics
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = NativeFontMetrics;
+
+    //! \alias base - Define base type
+    using base = IFontMetrics;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    ::HDC                                  Memory;     //!< Memory device context
+    std::mutex                             Lock;       //!< Protects 'Memory' and 'Fonts'
+    std::unordered_map<uintptr_t,HFont>    Fonts;      //!< Shared handles of created fonts
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NativeFontMetrics::NativeFontMetrics
+    //! Create provider
+    //!
+    //! \throw wtl::platform_error - Unable to create memory device context
+    /////////////////////////////////////////////////////////////////////////////////////////
+    NativeFontMetrics() : Memory(::CreateCompatibleDC(nullptr))
+    {
+      if (!Memory)
+        throw platform_error(HERE, "Unable to create memory device context");
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(NativeFontMetrics);      //!< Cannot be copied
+    DISABLE_MOVE(NativeFontMetrics);      //!< Cannot be moved
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NativeFontMetrics::~NativeFontMetrics
+    //! Destroys the memory device context
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~NativeFontMetrics()
+    {
+      ::DeleteDC(Memory);
+    }
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NativeFontMetrics::instance
+    //! Get the process-wide provider
+    //!
+    //! \return NativeFontMetrics& - Shared provider
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static NativeFontMetrics&  instance()
+    {
+      static NativeFontMetrics  provider;
+      return provider;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NativeFontMetrics::cache
+    //! Get the process-wide font cache, which uses the process-wide provider
+    //!
+    //! \return FontCache& - Shared font cache
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static FontCache&  cache()
+    {
+      static FontCache  fonts(instance());
+      return fonts;
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NativeFontMetrics::get
+    //! Get the shared handle of a font created by this provider
+    //!
+    //! \param[in] font - Font handle
+    //! \return HFont - Shared font handle  (Remains valid after the font is destroyed by the cache)
+    //!
+    //! \throw wtl::logic_error - Font not created by this provider
+    /////////////////////////////////////////////////////////////////////////////////////////
+    HFont  get(uintptr_t font)
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      auto pos = Fonts.find(font);
+      if (pos == Fonts.end())
+        throw logic_error(HERE, "Font not created by this provider");
+      return pos->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NativeFontMetrics::create
+    //! Create a font
+    //!
+    //! \param[in] const& key - Font attributes
+    //! \return uintptr_t - Font handle
+    //!
+    //! \throw wtl::platform_error - Unable to create font
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uintptr_t  create(const FontKey& key) override
+    {
+      HFont font(String<Encoding::UTF16>(key.Face), key.Height, static_cast<FontWeight>(key.Weight), key.Italic, key.Underline, key.StrikeOut,
+                 static_cast<FontCharSet>(key.CharSet), static_cast<FontQuality>(key.Quality));
+
+      std::lock_guard<std::mutex> guard(Lock);
+      uintptr_t const handle = reinterpret_cast<uintptr_t>(font.get());
+      Fonts.emplace(handle, std::move(font));
+      return handle;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NativeFontMetrics::destroy
+    //! Release a font  (The font is deleted once every shared handle is released)
+    //!
+    //! \param[in] font - Font handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  destroy(uintptr_t font) override
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      Fonts.erase(font);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NativeFontMetrics::height
+    //! Query the line height of a font
+    //!
+    //! \param[in] font - Font handle
+    //! \return int32_t - Line height
+    //!
+    //! \throw wtl::platform_error - Unable to query font metrics
+    /////////////////////////////////////////////////////////////////////////////////////////
+    int32_t  height(uintptr_t font) override
+    {
+      ::TEXTMETRICW metrics;
+      std::lock_guard<std::mutex> guard(Lock);
+      Selection select(Memory, font);
+
+      if (!::GetTextMetricsW(Memory, &metrics))
+        throw platform_error(HERE, "Unable to query font metrics");
+      return metrics.tmHeight;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NativeFontMetrics::overhang
+    //! Query the extra width added to each string by a synthesized font
+    //!
+    //! \param[in] font - Font handle
+    //! \return int32_t - Overhang  (Zero for TrueType fonts)
+    //!
+    //! \throw wtl::platform_error - Unable to query font metrics
+    /////////////////////////////////////////////////////////////////////////////////////////
+    int32_t  overhang(uintptr_t font) override
+    {
+      ::TEXTMETRICW metrics;
+      std::lock_guard<std::mutex> guard(Lock);
+      Selection select(Memory, font);
+
+      if (!::GetTextMetricsW(Memory, &metrics))
+        throw platform_error(HERE, "Unable to query font metrics");
+      return metrics.tmOverhang;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NativeFontMetrics::advances
+    //! Query the advance widths of a range of characters
+    //!
+    //! \param[in] font - Font handle
+    //! \param[in] first - First character
+    //! \param[in] last - Last character  (Inclusive)
+    //! \param[in,out] *widths - Advance widths  (Capacity must be 'last-first+1')
+    //!
+    //! \throw wtl::platform_error - Unable to query character widths
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  advances(uintptr_t font, wchar_t first, wchar_t last, int32_t* widths) override
+    {
+      static_assert(sizeof(::INT) == sizeof(int32_t), "Advance widths must be 32-bit");
+      std::lock_guard<std::mutex> guard(Lock);
+      Selection select(Memory, font);
+
+      if (!::GetCharWidth32W(Memory, first, last, reinterpret_cast<::INT*>(widths)))
+        throw platform_error(HERE, "Unable to query character widths");
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NativeFontMetrics::measure
+    //! Measure text
+    //!
+    //! \param[in] font - Font handle
+    //! \param[in] const* text - Text  (Need not be null-terminated)
+    //! \param[in] length - Length of text, in characters
+    //! \return SizeL - Extent of text
+    //!
+    //! \throw wtl::platform_error - Unable to measure text
+    /////////////////////////////////////////////////////////////////////////////////////////
+    SizeL  measure(uintptr_t font, const wchar_t* text, uint32_t length) override
+    {
+      SizeL sz;
+      std::lock_guard<std::mutex> guard(Lock);
+      Selection select(Memory, font);
+
+      if (!::GetTextExtentPoint32W(Memory, text, static_cast<int>(length), sz))
+        throw platform_error(HERE, "Unable to measure text");
+      return sz;
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Selection - Selects a font into a device context for the lifetime of the object
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Selection
+    {
+      ::HDC      DC;          //!< Device context
+      ::HGDIOBJ  Previous;    //!< Previously selected font
+
+      Selection(::HDC dc, uintptr_t font) : DC(dc), Previous(::SelectObject(dc, reinterpret_cast<::HFONT>(font)))
+      {}
+
+      ~Selection()
+      {
+        ::SelectObject(DC, Previous);
+      }
+    };
+  };
+
+} // namespace wtl
+
+#endif // WTL_NATIVE_FONT_METRICS_HPP
@@ -0,0 +1,158 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\gdi\NativeThemeProvider.hpp
+//! \brief Provides visual style handles and metrics from the UxTheme library
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_NATIVE_THEME_PROVIDER_HPP
+#define WTL_NATIVE_THEME_PROVIDER_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/gdi/ThemeCache.hpp>                 //!< IThemeProvider
+#include <wtl/utils/Exception.hpp>                //!< platform_error
+#include <wtl/utils/Rectangle.hpp>                //!< RectL
+#include <wtl/utils/Size.hpp>                     //!< SizeL
+#include <wtl/platform/HResult.hpp>               //!< HResult
+#include <Uxtheme.h>                              //!< Visual styles
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct NativeThemeProvider - Provides visual style handles and metrics from the UxTheme library
+  //!
+  //! \remarks DPI-specific handles require Windows 10 (1703); earlier versions receive handles for the system DPI.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct NativeThemeProvider : IThemeProvider
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = NativeThemeProvider;
+
+    //! \alias base - Define base type
+    using base = IThemeProvider;
+
+  protected:
+    //! \alias OpenThemeDataForDpiFunc - OpenThemeDataForDpi() signature
+    using OpenThemeDataForDpiFunc = ::HTHEME (WINAPI*)(::HWND, ::LPCWSTR, ::UINT);
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NativeThemeProvider::NativeThemeProvider
+    //! Create provider
+    /////////////////////////////////////////////////////////////////////////////////////////
+    NativeThemeProvider()
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(NativeThemeProvider);      //!< Cannot be copied
+    DISABLE_MOVE(NativeThemeProvider);      //!< Cannot be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NativeThemeProvider::open
+    //! Opens a theme handle
+    //!
+    //! \param[in] const* classes - Semi-colon separated class list
+    //! \param[in] dpi - Dots per inch
+    //! \return uintptr_t - Theme handle, or zero upon failure
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uintptr_t  open(const wchar_t* classes, uint32_t dpi) override
+    {
+      static OpenThemeDataForDpiFunc const openForDpi = reinterpret_cast<OpenThemeDataForDpiFunc>(::GetProcAddress(::GetModuleHandleW(L"uxtheme.dll"), "OpenThemeDataForDpi"));
+
+      // [DPI-AWARE] Open handle for specific DPI, otherwise the system DPI
+      return reinterpret_cast<uintptr_t>(openForDpi ? openForDpi(nullptr, classes, dpi)
+                                                    : ::OpenThemeData(nullptr, classes));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NativeThemeProvider::close
+    //! Closes a theme handle
+    //!
+    //! \param[in] theme - Theme handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  close(uintptr_t theme) override
+    {
+      ::CloseThemeData(reinterpret_cast<::HTHEME>(theme));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NativeThemeProvider::describe
+    //! Queries the attributes of a font
+    //!
+    //! \param[in] font - Font handle
+    //! \param[in,out] &key - On return, the attributes of the font
+    //!
+    //! \throw wtl::platform_error - Unable to query font
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  describe(uintptr_t font, FontKey& key) override
+    {
+      ::LOGFONTW attr;
+      if (!::GetObjectW(reinterpret_cast<::HFONT>(font), sizeof(attr), &attr))
+        throw platform_error(HERE, "Unable to query font attributes");
+
+      key.Face.assign(attr.lfFaceName);
+      key.Height = attr.lfHeight;
+      key.Weight = attr.lfWeight;
+      key.Italic = attr.lfItalic != FALSE;
+      key.Underline = attr.lfUnderline != FALSE;
+      key.StrikeOut = attr.lfStrikeOut != FALSE;
+      key.CharSet = attr.lfCharSet;
+      key.Quality = attr.lfQuality;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NativeThemeProvider::measure
+    //! Measures the true size of a part
+    //!
+    //! \param[in] theme - Theme handle
+    //! \param[in] dc - Device context
+    //! \param[in] part - Part id
+    //! \param[in] state - State id
+    //! \return SizeL - Size of part
+    //!
+    //! \throw wtl::platform_error - Unable to measure part
+    /////////////////////////////////////////////////////////////////////////////////////////
+    SizeL  measure(uintptr_t theme, uintptr_t dc, int32_t part, int32_t state) override
+    {
+      SizeL sz;
+      // Query size
+      if (!HResult(::GetThemePartSize(reinterpret_cast<::HTHEME>(theme), reinterpret_cast<::HDC>(dc), part, state, nullptr, TS_TRUE, sz)))
+        throw platform_error(HERE, "Unable to query size of themed control part");
+      return sz;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // NativeThemeProvider::measure
+    //! Measures the extent of text drawn within a part
+    //!
+    //! \param[in] theme - Theme handle
+    //! \param[in] dc - Device context
+    //! \param[in] part - Part id
+    //! \param[in] state - State id
+    //! \param[in] const* text - Text  (Need not be null-terminated)
+    //! \param[in] length - Length of text, in characters
+    //! \param[in] flags - Drawing flags
+    //! \return SizeL - Extent of text
+    //!
+    //! \throw wtl::platform_error - Unable to measure text
+    /////////////////////////////////////////////////////////////////////////////////////////
+    SizeL  measure(uintptr_t theme, uintptr_t dc, int32_t part, int32_t state, const wchar_t* text, uint32_t length, uint32_t flags) override
+    {
+      RectL rc;
+      // Query text rectangle
+      if (!HResult(::GetThemeTextExtent(reinterpret_cast<::HTHEME>(theme), reinterpret_cast<::HDC>(dc), part, state, text, static_cast<int>(length), flags, nullptr, rc)))
+        throw platform_error(HERE, "Unable to measure themed control text");
+      return rc.size();
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_NATIVE_THEME_PROVIDER_HPP
@@ -0,0 +1,331 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\gdi\PaintBuffer.hpp
+//! \brief Double-buffered painting which only repaints what changed since the previous frame
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_PAINT_BUFFER_HPP
+#define WTL_PAINT_BUFFER_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/gdi/DamageRegion.hpp>               //!< DamageRegion
+#include <wtl/gdi/DeviceContext.hpp>              //!< DeviceContext
+#include <wtl/gdi/DisplayFrame.hpp>               //!< DisplayFrame
+#include <wtl/gdi/DisplayList.hpp>                //!< DisplayList, IDisplaySurface
+#include <wtl/utils/Exception.hpp>                //!< platform_error
+#include <wtl/utils/Rectangle.hpp>                //!< RectL
+#include <wtl/utils/Size.hpp>                     //!< SizeL
+#include <Uxtheme.h>                              //!< DrawThemeBackground
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct DeviceContextSurface - Replays display lists into a native device context
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct DeviceContextSurface : IDisplaySurface
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = DeviceContextSurface;
+
+    //! \alias base - Define base type
+    using base = IDisplaySurface;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    ::HDC   DC;         //!< Target device context
+    int     State;      //!< Saved device context state
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DeviceContextSurface::DeviceContextSurface
+    //! Create surface
+    //!
+    //! \param[in] dc - Target device context
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit
+    DeviceContextSurface(::HDC dc) : DC(dc), State(0)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(DeviceContextSurface);      //!< Cannot be copied
+    DISABLE_MOVE(DeviceContextSurface);      //!< Cannot be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DeviceContextSurface::begin
+    //! Clip subsequent drawing to a damaged rectangle, and erase it
+    //!
+    //! \param[in] const& damage - Damaged rectangle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  begin(const RectL& damage) override
+    {
+      State = ::SaveDC(DC);
+      ::IntersectClipRect(DC, damage.Left, damage.Top, damage.Right, damage.Bottom);
+      ::FillRect(DC, damage, ::GetSysColorBrush(COLOR_WINDOW));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DeviceContextSurface::end
+    //! Restore clipping region and drawing objects
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  end() override
+    {
+      ::RestoreDC(DC, State);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DeviceContextSurface::execute
+    //! Execute a recorded command
+    //!
+    //! \param[in] const& cmd - Command
+    //! \param[in] const* text - [optional] Text of command
+    //!
+    //! \throw wtl::platform_error - Unable to execute command
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  execute(const DisplayCommand& cmd, const void* text) override
+    {
+      RectL rc = cmd.Area;
+      bool success = true;
+
+      switch (cmd.Op)
+      {
+      case DisplayOp::Fill:
+        success = ::FillRect(DC, rc, handle<::HBRUSH>(cmd.Object)) != False;
+        break;
+
+      case DisplayOp::Frame:
+        success = ::FrameRect(DC, rc, handle<::HBRUSH>(cmd.Object)) != False;
+        break;
+
+      case DisplayOp::Focus:
+        success = ::DrawFocusRect(DC, rc) != False;
+        break;
+
+      case DisplayOp::Icon:
+        success = ::DrawIconEx(DC, rc.Left, rc.Top, handle<::HICON>(cmd.Object), rc.width(), rc.height(), 0, nullptr, DI_IMAGE|DI_MASK) != False;
+        break;
+
+      case DisplayOp::Ellipse:
+        ::SelectObject(DC, handle<::HBRUSH>(cmd.Object));
+        ::SelectObject(DC, handle<::HPEN>(cmd.Extra));
+        success = ::Ellipse(DC, rc.Left, rc.Top, rc.Right, rc.Bottom) != False;
+        break;
+
+      case DisplayOp::Text:
+        ::SelectObject(DC, handle<::HFONT>(cmd.Extra));
+        ::SetTextColor(DC, cmd.Fore);
+        ::SetBkColor(DC, cmd.Back);
+        ::SetBkMode(DC, cmd.Mode);
+        success = (cmd.CharSize == sizeof(wchar_t) ? ::DrawTextW(DC, static_cast<const wchar_t*>(text), static_cast<int>(cmd.TextLength), rc, cmd.Flags)
+                                                   : ::DrawTextA(DC, static_cast<const char*>(text), static_cast<int>(cmd.TextLength), rc, cmd.Flags)) != 0;
+        break;
+
+      case DisplayOp::ThemeFill:
+        success = SUCCEEDED(::DrawThemeBackground(handle<::HTHEME>(cmd.Object), DC, cmd.Part, cmd.State, rc,
+                                                  cmd.Bounds != cmd.Area ? static_cast<const ::RECT*>(cmd.Bounds) : nullptr));
+        break;
+
+      case DisplayOp::ThemeText:
+        ::SelectObject(DC, handle<::HFONT>(cmd.Extra));
+        success = SUCCEEDED(::DrawThemeText(handle<::HTHEME>(cmd.Object), DC, cmd.Part, cmd.State, static_cast<const wchar_t*>(text), static_cast<int>(cmd.TextLength), cmd.Flags, 0, rc));
+        break;
+      }
+
+      if (!success)
+        throw platform_error(HERE, "Unable to replay drawing command");
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DeviceContextSurface::handle
+    //! Convert an opaque handle into a native handle
+    //!
+    //! \tparam NATIVE - Native handle type
+    //!
+    //! \param[in] value - Opaque handle
+    //! \return NATIVE - Native handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename NATIVE>
+    static NATIVE  handle(uintptr_t value)
+    {
+      return reinterpret_cast<NATIVE>(value);
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct PaintBuffer - Retains the previous frame of a window, and repaints only what has changed
+  //!
+  //! \remarks Each paint records the window's drawing into a display list, compares it with the previous frame,
+  //! \remarks replays the damaged rectangles into an off-screen bitmap, then copies the update rectangle to the window.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct PaintBuffer
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = PaintBuffer;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    ::HDC          Memory;        //!< Off-screen device context
+    ::HBITMAP      Bitmap;        //!< Off-screen bitmap
+    ::HGDIOBJ      Original;      //!< Bitmap originally selected into 'Memory'
+    SizeL          Extent;        //!< Size of off-screen bitmap
+    DisplayFrame   Current,       //!< Frame being painted
+                   Previous;      //!< Frame last painted
+    DamageRegion   Damage;        //!< Rectangles damaged by the most recent paint
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PaintBuffer::PaintBuffer
+    //! Create empty buffer  (The bitmap is created upon first paint)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    PaintBuffer() : Memory(nullptr), Bitmap(nullptr), Original(nullptr)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(PaintBuffer);      //!< Cannot be copied
+    DISABLE_MOVE(PaintBuffer);      //!< Cannot be moved
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PaintBuffer::~PaintBuffer
+    //! Destroys the off-screen bitmap
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~PaintBuffer()
+    {
+      release();
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PaintBuffer::damage const
+    //! Get the rectangles repainted by the most recent paint
+    //!
+    //! \return const DamageRegion& - Damaged rectangles
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const DamageRegion&  damage() const
+    {
+      return Damage;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PaintBuffer::invalidate
+    //! Discard the previous frame, so the next paint repaints everything  (eg. Upon theme change)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  invalidate()
+    {
+      Previous.clear();
+      Extent = SizeL();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PaintBuffer::paint
+    //! Paint a frame
+    //!
+    //! \tparam DRAW - Callable with signature 'void (DeviceContext&, const RectL&)'
+    //!
+    //! \param[in,out] &target - Window device context
+    //! \param[in] const& client - Client rectangle
+    //! \param[in] const& update - Rectangle requiring update
+    //! \param[in] draw - Draws the entire client area  (Recorded rather than executed)
+    //!
+    //! \throw wtl::logic_error - Drawing operation cannot be recorded
+    //! \throw wtl::platform_error - Unable to create off-screen bitmap or replay frame
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename DRAW>
+    void  paint(DeviceContext& target, const RectL& client, const RectL& update, DRAW&& draw)
+    {
+      SizeL const size(client.width(), client.height());
+
+      // [RESIZED] Recreate bitmap and repaint everything
+      Damage.clear();
+      if (!(size == Extent))
+      {
+        resize(target, size);
+        Previous.clear();
+        Damage.add(client);
+      }
+
+      // Record frame
+      Current.clear();
+      {
+        DeviceContext dc(Memory);
+        dc.record(&Current);
+        draw(dc, client);
+        dc.record(nullptr);
+      }
+
+      // Replay only what changed
+      Current.List.diff(Previous.List, Damage);
+      Damage.clip(client);
+      DeviceContextSurface surface(Memory);
+      Current.List.replay(surface, Damage);
+
+      // Copy update rectangle to window
+      if (!::BitBlt(target.handle(), update.Left, update.Top, update.width(), update.height(), Memory, update.Left, update.Top, SRCCOPY))
+        throw platform_error(HERE, "Unable to copy off-screen bitmap");
+
+      // Retain frame for comparison
+      Previous.swap(Current);
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PaintBuffer::release
+    //! Destroys the off-screen bitmap and device context
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  release()
+    {
+      if (Memory)
+      {
+        ::SelectObject(Memory, Original);
+        ::DeleteObject(Bitmap);
+        ::DeleteDC(Memory);
+      }
+      Memory = nullptr;
+      Bitmap = nullptr;
+      Extent = SizeL();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PaintBuffer::resize
+    //! Create an off-screen bitmap compatible with a window
+    //!
+    //! \param[in] const& target - Window device context
+    //! \param[in] const& size - Size of client area
+    //!
+    //! \throw wtl::platform_error - Unable to create off-screen bitmap
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  resize(const DeviceContext& target, const SizeL& size)
+    {
+      release();
+
+      // Create device context & bitmap
+      Memory = ::CreateCompatibleDC(target.handle());
+      Bitmap = Memory ? ::CreateCompatibleBitmap(target.handle(), size.Width, size.Height) : nullptr;
+      if (!Bitmap)
+      {
+        release();
+        throw platform_error(HERE, "Unable to create off-screen bitmap");
+      }
+
+      Original = ::SelectObject(Memory, Bitmap);
+      Extent = size;
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_PAINT_BUFFER_HPP
@@ -0,0 +1,268 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\gdi\PixelBuffer.hpp
+//! \brief 32-bit pixel buffer with vectorized span fills and alpha blending
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_PIXEL_BUFFER_HPP
+#define WTL_PIXEL_BUFFER_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/utils/Exception.hpp>                //!< invalid_argument
+#include <vector>                                 //!< std::vector
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>                          //!< SSE2
+  #define WTL_PIXEL_SSE2
+#endif
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct PixelBuffer - Row-major buffer of 32-bit ARGB pixels  (0xAARRGGBB, not premultiplied)
+  //!
+  //! \remarks Spans are filled four pixels at a time using SSE2, where available.
+  //!
+  //! \remarks Does not depend upon any Win32 API
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct PixelBuffer
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = PixelBuffer;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    int32_t                 Width,        //!< Width, in pixels
+                            Height;       //!< Height, in pixels
+    std::vector<uint32_t>   Pixels;       //!< Pixels, top row first
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PixelBuffer::PixelBuffer
+    //! Create empty buffer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    PixelBuffer() : Width(0), Height(0)
+    {}
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PixelBuffer::PixelBuffer
+    //! Create buffer filled with a colour
+    //!
+    //! \param[in] width - Width, in pixels
+    //! \param[in] height - Height, in pixels
+    //! \param[in] colour - [optional] Initial colour
+    //!
+    //! \throw wtl::invalid_argument - Negative dimension
+    /////////////////////////////////////////////////////////////////////////////////////////
+    PixelBuffer(int32_t width, int32_t height, uint32_t colour = 0) : Width(width), Height(height)
+    {
+      if (width < 0 || height < 0)
+        throw invalid_argument(HERE, "Pixel buffer dimensions cannot be negative");
+
+      Pixels.assign(static_cast<size_t>(width) * height, colour);
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    ENABLE_COPY(PixelBuffer);      //!< Can be deep copied
+    ENABLE_MOVE(PixelBuffer);      //!< Can be moved
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PixelBuffer::blend
+    //! Blend a colour over a pixel
+    //!
+    //! \param[in] dest - Existing pixel
+    //! \param[in] src - Colour
+    //! \param[in] coverage - Additional opacity  (0-255)
+    //! \return uint32_t - Blended pixel  (Alpha of destination is retained)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t  blend(uint32_t dest, uint32_t src, uint32_t coverage = 0xFF)
+    {
+      uint32_t const alpha = ((src >> 24) * coverage + 0x80) * 0x101 >> 16,    //!< (a*c)/255, rounded
+                     inverse = 0xFF - alpha;
+
+      // Blend red+blue and green channels in parallel
+      uint32_t rb = (src & 0x00FF00FF) * alpha + (dest & 0x00FF00FF) * inverse + 0x00800080,
+               g  = (src & 0x0000FF00) * alpha + (dest & 0x0000FF00) * inverse + 0x00008000;
+      rb = ((rb + ((rb >> 8) & 0x00FF00FF)) >> 8) & 0x00FF00FF;
+      g  = ((g + ((g >> 8) & 0x0000FF00)) >> 8) & 0x0000FF00;
+      return (dest & 0xFF000000) | rb | g;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PixelBuffer::fillSpan
+    //! Set a span of pixels to a colour
+    //!
+    //! \param[in,out] *dest - First pixel
+    //! \param[in] count - Number of pixels
+    //! \param[in] colour - Colour
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void  fillSpan(uint32_t* dest, int32_t count, uint32_t colour)
+    {
+      int32_t idx = 0;
+#ifdef WTL_PIXEL_SSE2
+      __m128i const quad = _mm_set1_epi32(static_cast<int>(colour));
+      for (; idx + 4 <= count; idx += 4)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + idx), quad);
+#endif
+      for (; idx < count; ++idx)
+        dest[idx] = colour;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PixelBuffer::blendSpan
+    //! Blend a translucent colour over a span of pixels
+    //!
+    //! \param[in,out] *dest - First pixel
+    //! \param[in] count - Number of pixels
+    //! \param[in] colour - Colour  (Including alpha)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void  blendSpan(uint32_t* dest, int32_t count, uint32_t colour)
+    {
+      int32_t idx = 0;
+#ifdef WTL_PIXEL_SSE2
+      uint16_t const alpha = static_cast<uint16_t>(colour >> 24),
+                     inverse = static_cast<uint16_t>(0xFF - alpha);
+
+      // Pre-multiply source channels, widened to 16-bits  (Alpha lane yields destination alpha)
+      __m128i const zero = _mm_setzero_si128(),
+                    src = _mm_mullo_epi16(_mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(colour & 0x00FFFFFF)), zero), _mm_set1_epi16(static_cast<short>(alpha))),
+                    weight = _mm_set_epi16(0xFF, inverse, inverse, inverse, 0xFF, inverse, inverse, inverse),
+                    round = _mm_set1_epi16(0x80);
+
+      for (; idx + 4 <= count; idx += 4)
+      {
+        __m128i const pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dest + idx));
+        __m128i lo = _mm_unpacklo_epi8(pixels, zero),
+                hi = _mm_unpackhi_epi8(pixels, zero);
+
+        // (src*a + dest*(255-a) + 128) / 255  ==  (x + (x >> 8)) >> 8
+        lo = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(lo, weight), src), round);
+        hi = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(hi, weight), src), round);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + idx), _mm_packus_epi16(lo, hi));
+      }
+#endif
+      for (; idx < count; ++idx)
+        dest[idx] = blend(dest[idx], colour);
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PixelBuffer::data const
+    //! Get the pixels
+    //!
+    //! \return const uint32_t* - First pixel of top row
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const uint32_t*  data() const
+    {
+      return Pixels.data();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PixelBuffer::height const
+    //! Get the height
+    //!
+    //! \return int32_t - Height, in pixels
+    /////////////////////////////////////////////////////////////////////////////////////////
+    int32_t  height() const
+    {
+      return Height;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PixelBuffer::pixel const
+    //! Get a pixel
+    //!
+    //! \param[in] x - Column
+    //! \param[in] y - Row
+    //! \return uint32_t - Pixel
+    //!
+    //! \throw wtl::invalid_argument - [Debug only] Position out of bounds
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  pixel(int32_t x, int32_t y) const
+    {
+      LOGIC_INVARIANT(x >= 0 && x < Width && y >= 0 && y < Height);
+      return Pixels[static_cast<size_t>(y) * Width + x];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PixelBuffer::row const
+    //! Get a row of pixels
+    //!
+    //! \param[in] y - Row
+    //! \return const uint32_t* - First pixel of row
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const uint32_t*  row(int32_t y) const
+    {
+      return Pixels.data() + static_cast<size_t>(y) * Width;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PixelBuffer::width const
+    //! Get the width
+    //!
+    //! \return int32_t - Width, in pixels
+    /////////////////////////////////////////////////////////////////////////////////////////
+    int32_t  width() const
+    {
+      return Width;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PixelBuffer::data
+    //! Get the pixels
+    //!
+    //! \return uint32_t* - First pixel of top row
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t*  data()
+    {
+      return Pixels.data();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PixelBuffer::row
+    //! Get a row of pixels
+    //!
+    //! \param[in] y - Row
+    //! \return uint32_t* - First pixel of row
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t*  row(int32_t y)
+    {
+      return Pixels.data() + static_cast<size_t>(y) * Width;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PixelBuffer::span
+    //! Paint a horizontal span, blending if the colour is translucent
+    //!
+    //! \param[in] x - First column  (Must be within buffer)
+    //! \param[in] y - Row  (Must be within buffer)
+    //! \param[in] count - Number of pixels  (Must be within buffer)
+    //! \param[in] colour - Colour
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  span(int32_t x, int32_t y, int32_t count, uint32_t colour)
+    {
+      if (count <= 0 || (colour >> 24) == 0)
+        return;
+
+      if ((colour >> 24) == 0xFF)
+        fillSpan(row(y) + x, count, colour);
+      else
+        blendSpan(row(y) + x, count, colour);
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_PIXEL_BUFFER_HPP
@@ -0,0 +1,521 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\gdi\SoftwareSurface.hpp
+//! \brief Rasterises display lists into a pixel buffer, without a device
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_SOFTWARE_SURFACE_HPP
+#define WTL_SOFTWARE_SURFACE_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/gdi/DamageRegion.hpp>               //!< DamageRegion
+#include <wtl/gdi/DisplayList.hpp>                //!< DisplayList, IDisplaySurface
+#include <wtl/gdi/PixelBuffer.hpp>                //!< PixelBuffer
+#include <wtl/utils/Rectangle.hpp>                //!< RectL
+#include <cmath>                                  //!< std::sqrt
+#include <type_traits>                            //!< std::make_unsigned_t
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct RasterGlyph - Coverage mask of a character within a bitmap font
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct RasterGlyph
+  {
+    int32_t          Width,        //!< Width of mask, in pixels
+                     Height,       //!< Height of mask, in pixels
+                     OffsetX,      //!< Horizontal offset of mask from pen position
+                     OffsetY,      //!< Vertical offset of mask from top of line
+                     Advance;      //!< Horizontal distance to next pen position
+    const uint8_t*   Coverage;     //!< Opacity of each pixel of mask  (0-255, top row first)
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct IBitmapFont - Interface for fonts rendered by the software rasteriser
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct IBitmapFont
+  {
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+
+    ENABLE_POLY(IBitmapFont);     //!< Abstract base class
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+
+    //! Metrics
+    virtual int32_t             height() const = 0;
+
+    //! Glyphs  (Returns nullptr if character is not supported)
+    virtual const RasterGlyph*  glyph(uint32_t ch) const = 0;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct IRasterResources - Interface for resolving the drawing objects referred to by display lists
+  //!
+  //! \remarks Colours are ARGB  (0xAARRGGBB)
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct IRasterResources
+  {
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+
+    ENABLE_POLY(IRasterResources);     //!< Abstract base class
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+
+    //! Drawing objects
+    virtual uint32_t              brush(uintptr_t brush) const = 0;
+    virtual uint32_t              pen(uintptr_t pen) const = 0;
+    virtual const PixelBuffer*    icon(uintptr_t icon) const = 0;
+    virtual const IBitmapFont*    font(uintptr_t font) const = 0;
+
+    //! Visual styles
+    virtual uint32_t              part(uintptr_t theme, int32_t part, int32_t state) const = 0;
+    virtual uint32_t              partText(uintptr_t theme, int32_t part, int32_t state) const = 0;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct SoftwareSurface - Rasterises display lists into a pixel buffer
+  //!
+  //! \remarks Drawing recorded from a DeviceContext (see DeviceContext::record) can be replayed here rather than
+  //! \remarks through GDI, producing identical pixels on every platform. Text is single-line and is aligned using
+  //! \remarks the horizontal and vertical DrawText flags; focus rectangles invert alternate pixels of the outline.
+  //!
+  //! \remarks Does not depend upon any Win32 API
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct SoftwareSurface : IDisplaySurface
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = SoftwareSurface;
+
+    //! \alias base - Define base type
+    using base = IDisplaySurface;
+
+    //! \enum TextFlag - DrawText flags honoured by the rasteriser
+    enum TextFlag : uint32_t
+    {
+      Centre = 0x01,      //!< DT_CENTER
+      Right = 0x02,       //!< DT_RIGHT
+      VCentre = 0x04,     //!< DT_VCENTER
+      Bottom = 0x08,      //!< DT_BOTTOM
+    };
+
+    //! \var Opaque - Background mode which fills behind text  (OPAQUE)
+    static constexpr uint8_t  Opaque = 2;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    PixelBuffer&              Target;         //!< Pixel buffer
+    const IRasterResources&   Resources;      //!< Drawing object resolver
+    uint32_t                  Background;     //!< Colour used to erase damaged rectangles
+    RectL                     Clip;           //!< Current clipping rectangle
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SoftwareSurface::SoftwareSurface
+    //! Create surface
+    //!
+    //! \param[in,out] &target - Pixel buffer
+    //! \param[in] const& resources - Drawing object resolver
+    //! \param[in] background - [optional] Colour used to erase damaged rectangles
+    /////////////////////////////////////////////////////////////////////////////////////////
+    SoftwareSurface(PixelBuffer& target, const IRasterResources& resources, uint32_t background = 0xFFFFFFFF)
+      : Target(target),
+        Resources(resources),
+        Background(background),
+        Clip(bounds())
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(SoftwareSurface);      //!< Cannot be copied
+    DISABLE_MOVE(SoftwareSurface);      //!< Cannot be moved
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SoftwareSurface::fromColorRef
+    //! Convert a native RGB value into an opaque ARGB colour
+    //!
+    //! \param[in] rgb - Native RGB value  (0x00BBGGRR)
+    //! \return uint32_t - ARGB colour
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t  fromColorRef(uint32_t rgb)
+    {
+      return 0xFF000000 | ((rgb & 0xFF) << 16) | (rgb & 0xFF00) | ((rgb >> 16) & 0xFF);
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SoftwareSurface::bounds const
+    //! Get the extent of the pixel buffer
+    //!
+    //! \return RectL - Rectangle enclosing every pixel
+    /////////////////////////////////////////////////////////////////////////////////////////
+    RectL  bounds() const
+    {
+      return RectL(0, 0, Target.width(), Target.height());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SoftwareSurface::measure const
+    //! Measure the width of a single line of text
+    //!
+    //! \tparam CHR - Character type
+    //!
+    //! \param[in] const& font - Font
+    //! \param[in] const* text - Text
+    //! \param[in] length - Length of text, in characters
+    //! \return int32_t - Sum of advance widths
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename CHR>
+    static int32_t  measure(const IBitmapFont& font, const CHR* text, uint32_t length)
+    {
+      int32_t width = 0;
+      for (uint32_t idx = 0; idx < length; ++idx)
+        if (const RasterGlyph* g = font.glyph(static_cast<std::make_unsigned_t<CHR>>(text[idx])))
+          width += g->Advance;
+      return width;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SoftwareSurface::begin
+    //! Clip subsequent drawing to a damaged rectangle, and erase it
+    //!
+    //! \param[in] const& damage - Damaged rectangle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  begin(const RectL& damage) override
+    {
+      Clip = DamageRegion::intersection(damage, bounds());
+      fill(Clip, Background | 0xFF000000);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SoftwareSurface::end
+    //! Remove clipping rectangle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  end() override
+    {
+      Clip = bounds();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SoftwareSurface::execute
+    //! Rasterise a recorded command
+    //!
+    //! \param[in] const& cmd - Command
+    //! \param[in] const* text - [optional] Text of command
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  execute(const DisplayCommand& cmd, const void* text) override
+    {
+      switch (cmd.Op)
+      {
+      case DisplayOp::Fill:       fill(cmd.Area, Resources.brush(cmd.Object));                                 break;
+      case DisplayOp::Frame:      frame(cmd.Area, Resources.brush(cmd.Object));                                break;
+      case DisplayOp::Focus:      focus(cmd.Area);                                                              break;
+      case DisplayOp::Ellipse:    ellipse(cmd.Area, Resources.brush(cmd.Object), Resources.pen(cmd.Extra));    break;
+      case DisplayOp::Icon:       blit(cmd.Area, Resources.icon(cmd.Object));                                  break;
+      case DisplayOp::ThemeFill:  fill(cmd.Bounds, Resources.part(cmd.Object, cmd.Part, cmd.State));          break;
+
+      case DisplayOp::Text:
+        if (cmd.Mode == Opaque)
+          fill(cmd.Area, fromColorRef(cmd.Back));
+        write(cmd, text, fromColorRef(cmd.Fore));
+        break;
+
+      case DisplayOp::ThemeText:
+        write(cmd, text, Resources.partText(cmd.Object, cmd.Part, cmd.State));
+        break;
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SoftwareSurface::blit
+    //! Draw an image scaled into a rectangle, blending by its alpha channel
+    //!
+    //! \param[in] const& rc - Drawing rectangle
+    //! \param[in] const* image - [optional] Image
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  blit(const RectL& rc, const PixelBuffer* image)
+    {
+      RectL const area = DamageRegion::intersection(rc, Clip);
+      if (!image || !image->width() || !image->height() || DamageRegion::area(area) == 0)
+        return;
+
+      // Nearest-neighbour scale
+      for (long32_t y = area.Top; y < area.Bottom; ++y)
+      {
+        const uint32_t* src = image->row(static_cast<int32_t>((y - rc.Top) * image->height() / rc.height()));
+        uint32_t* dest = Target.row(y);
+
+        for (long32_t x = area.Left; x < area.Right; ++x)
+        {
+          uint32_t const pixel = src[(x - rc.Left) * image->width() / rc.width()];
+          dest[x] = (pixel >> 24) == 0xFF ? pixel : PixelBuffer::blend(dest[x], pixel);
+        }
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SoftwareSurface::ellipse
+    //! Fill an ellipse and outline it with a one pixel pen
+    //!
+    //! \param[in] const& rc - Bounding rectangle
+    //! \param[in] brush - Fill colour
+    //! \param[in] pen - Outline colour
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  ellipse(const RectL& rc, uint32_t brush, uint32_t pen)
+    {
+      if (rc.width() <= 0 || rc.height() <= 0)
+        return;
+
+      // Measure in half-pixels, so pixel centres are integral
+      int64_t const cx = int64_t(rc.Left) + rc.Right,
+                    cy = int64_t(rc.Top) + rc.Bottom,
+                    rx = rc.width(),
+                    ry = rc.height();
+
+      for (long32_t y = rc.Top; y < rc.Bottom; ++y)
+      {
+        int64_t const dy = 2*int64_t(y) + 1 - cy,
+                      outer = extent(rx, ry, dy),
+                      inner = rx > 2 && ry > 2 ? extent(rx-2, ry-2, dy) : -1;
+        if (outer < 0)
+          continue;
+
+        // Pixels whose centres lie within the ellipse are outlined; those within the inset ellipse are filled
+        long32_t const left = first(cx, outer),
+                       right = last(cx, outer) + 1,
+                       innerLeft = inner >= 0 ? first(cx, inner) : right,
+                       innerRight = inner >= 0 ? last(cx, inner) + 1 : right;
+
+        hline(left, innerLeft, y, pen);
+        hline(innerLeft, innerRight, y, brush);
+        hline(innerRight, right, y, pen);
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SoftwareSurface::fill
+    //! Fill a rectangle
+    //!
+    //! \param[in] const& rc - Rectangle
+    //! \param[in] colour - Colour  (Blended if translucent)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  fill(const RectL& rc, uint32_t colour)
+    {
+      RectL const area = DamageRegion::intersection(rc, Clip);
+      for (long32_t y = area.Top; y < area.Bottom; ++y)
+        Target.span(area.Left, y, area.Right - area.Left, colour);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SoftwareSurface::focus
+    //! Invert alternate pixels of a rectangle outline
+    //!
+    //! \param[in] const& rc - Rectangle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  focus(const RectL& rc)
+    {
+      if (rc.width() <= 0 || rc.height() <= 0)
+        return;
+
+      for (long32_t x = rc.Left; x < rc.Right; ++x)
+      {
+        invert(x, rc.Top);
+        if (rc.Bottom-1 != rc.Top)
+          invert(x, rc.Bottom-1);
+      }
+      for (long32_t y = rc.Top+1; y < rc.Bottom-1; ++y)
+      {
+        invert(rc.Left, y);
+        if (rc.Right-1 != rc.Left)
+          invert(rc.Right-1, y);
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SoftwareSurface::frame
+    //! Outline a rectangle with a one pixel border
+    //!
+    //! \param[in] const& rc - Rectangle
+    //! \param[in] colour - Colour  (Blended if translucent)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  frame(const RectL& rc, uint32_t colour)
+    {
+      if (rc.width() <= 0 || rc.height() <= 0)
+        return;
+
+      fill(RectL(rc.Left, rc.Top, rc.Right, rc.Top+1), colour);
+      if (rc.height() > 1)
+        fill(RectL(rc.Left, rc.Bottom-1, rc.Right, rc.Bottom), colour);
+      fill(RectL(rc.Left, rc.Top+1, rc.Left+1, rc.Bottom-1), colour);
+      if (rc.width() > 1)
+        fill(RectL(rc.Right-1, rc.Top+1, rc.Right, rc.Bottom-1), colour);
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SoftwareSurface::extent
+    //! Calculate the horizontal extent of an ellipse at a vertical offset from its centre
+    //!
+    //! \param[in] rx - Width of ellipse  (ie. Radius, in half-pixels)
+    //! \param[in] ry - Height of ellipse  (ie. Radius, in half-pixels)
+    //! \param[in] dy - Vertical offset from centre, in half-pixels
+    //! \return int64_t - Largest horizontal offset within the ellipse, in half-pixels, or -1 if none
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static int64_t  extent(int64_t rx, int64_t ry, int64_t dy)
+    {
+      // Offset (dx,dy) lies within iff dx^2*ry^2 <= rx^2*(ry^2 - dy^2)
+      int64_t const limit = rx*rx*(ry*ry - dy*dy);
+      if (limit < 0)
+        return -1;
+
+      // Estimate, then correct rounding error
+      auto dx = static_cast<int64_t>(std::sqrt(static_cast<double>(limit)) / static_cast<double>(ry));
+      while (dx > 0 && dx*dx*ry*ry > limit)
+        --dx;
+      while ((dx+1)*(dx+1)*ry*ry <= limit)
+        ++dx;
+      return dx;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SoftwareSurface::first
+    //! Calculate the first column whose centre lies within a horizontal extent
+    //!
+    //! \param[in] cx - Centre, in half-pixels
+    //! \param[in] dx - Extent either side of centre, in half-pixels
+    //! \return long32_t - Smallest 'x' such that |2x+1-cx| <= dx
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static long32_t  first(int64_t cx, int64_t dx)
+    {
+      int64_t const v = cx - 1 - dx;      //!< ceil(v/2)
+      return static_cast<long32_t>(v >= 0 ? (v + 1) / 2 : -((-v) / 2));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SoftwareSurface::last
+    //! Calculate the last column whose centre lies within a horizontal extent
+    //!
+    //! \param[in] cx - Centre, in half-pixels
+    //! \param[in] dx - Extent either side of centre, in half-pixels
+    //! \return long32_t - Largest 'x' such that |2x+1-cx| <= dx
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static long32_t  last(int64_t cx, int64_t dx)
+    {
+      int64_t const v = cx - 1 + dx;      //!< floor(v/2)
+      return static_cast<long32_t>(v >= 0 ? v / 2 : -((-v + 1) / 2));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SoftwareSurface::hline
+    //! Paint a horizontal span, clipped
+    //!
+    //! \param[in] left - First column
+    //! \param[in] right - Column beyond last
+    //! \param[in] y - Row
+    //! \param[in] colour - Colour
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  hline(long32_t left, long32_t right, long32_t y, uint32_t colour)
+    {
+      if (y < Clip.Top || y >= Clip.Bottom)
+        return;
+
+      left = left < Clip.Left ? Clip.Left : left;
+      right = right > Clip.Right ? Clip.Right : right;
+      if (left < right)
+        Target.span(left, y, right - left, colour);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SoftwareSurface::invert
+    //! Invert the colour of a pixel on the focus pattern  (Pixels whose co-ordinates sum to an even number)
+    //!
+    //! \param[in] x - Column
+    //! \param[in] y - Row
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  invert(long32_t x, long32_t y)
+    {
+      if (((x + y) & 1) == 0 && x >= Clip.Left && x < Clip.Right && y >= Clip.Top && y < Clip.Bottom)
+        Target.row(y)[x] ^= 0x00FFFFFF;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SoftwareSurface::write
+    //! Rasterise a single line of text, clipped to its drawing rectangle
+    //!
+    //! \param[in] const& cmd - Text command
+    //! \param[in] const* text - Text
+    //! \param[in] colour - Text colour
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  write(const DisplayCommand& cmd, const void* text, uint32_t colour)
+    {
+      const IBitmapFont* font = Resources.font(cmd.Extra);
+      if (!font || !text)
+        return;
+
+      // Decode characters
+      auto const charAt = [&] (uint32_t idx) -> uint32_t {
+        switch (cmd.CharSize)
+        {
+        case 1:  return static_cast<const uint8_t*>(text)[idx];
+        case 2:  return static_cast<const uint16_t*>(text)[idx];
+        default: return static_cast<const uint32_t*>(text)[idx];
+        }
+      };
+
+      // Align line within drawing rectangle
+      int32_t width = 0;
+      for (uint32_t idx = 0; idx < cmd.TextLength; ++idx)
+        if (const RasterGlyph* g = font->glyph(charAt(idx)))
+          width += g->Advance;
+
+      long32_t x = cmd.Area.Left,
+               y = cmd.Area.Top;
+      if (cmd.Flags & Centre)
+        x += (cmd.Area.width() - width) / 2;
+      else if (cmd.Flags & Right)
+        x = cmd.Area.Right - width;
+      if (cmd.Flags & VCentre)
+        y += (cmd.Area.height() - font->height()) / 2;
+      else if (cmd.Flags & Bottom)
+        y = cmd.Area.Bottom - font->height();
+
+      // Blend coverage of each glyph
+      RectL const area = DamageRegion::intersection(cmd.Area, Clip);
+      for (uint32_t idx = 0; idx < cmd.TextLength; ++idx)
+      {
+        const RasterGlyph* g = font->glyph(charAt(idx));
+        if (!g)
+          continue;
+
+        for (int32_t gy = 0; gy < g->Height; ++gy)
+        {
+          long32_t const py = y + g->OffsetY + gy;
+          if (py < area.Top || py >= area.Bottom)
+            continue;
+
+          uint32_t* dest = Target.row(py);
+          for (int32_t gx = 0; gx < g->Width; ++gx)
+          {
+            long32_t const px = x + g->OffsetX + gx;
+            if (px >= area.Left && px < area.Right)
+              if (uint8_t const coverage = g->Coverage[gy * g->Width + gx])
+                dest[px] = PixelBuffer::blend(dest[px], colour, coverage);
+          }
+        }
+        x += g->Advance;
+      }
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_SOFTWARE_SURFACE_HPP
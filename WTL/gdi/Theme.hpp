@@ -14,8 +14,9 @@
 #include <wtl/utils/Size.hpp>                     //!< Size
 #include <wtl/utils/Rectangle.hpp>                //!< Rect
 #include <wtl/gdi/DeviceContext.hpp>              //!< DeviceContext
+#include <wtl/gdi/DisplayFrame.hpp>               //!< DisplayFrame
 #include <wtl/traits/ThemeTraits.hpp>             //!< HTheme
-#include <wtl/traits/WindowTraits.hpp>            //!< HWnd
+#include <wtl/traits/windowtraits.hpp>            //!< HWnd
 #include <wtl/platform/HResult.hpp>               //!< HResult
 #include <wtl/platform/DrawingFlags.hpp>          //!< DrawTextFlags
 #include <vsstyle.h>                              //!< Parts and States
@@ -58,7 +59,17 @@ namespace wtl
     /////////////////////////////////////////////////////////////////////////////////////////
     Theme(const HWnd& wnd, const String<Encoding::UTF16>& names) : Handle(wnd, names)
     {}
-    
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Theme::Theme
+    //! Create from a theme handle owned elsewhere  (eg. by a ThemeCache)
+    //!
+    //! \param[in] theme - Theme handle  (Not closed upon destruction)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit
+    Theme(::HTHEME theme) : Handle(theme, AllocType::WeakRef)
+    {}
+
     // -------------------------------- COPY, MOVE & DESTROY --------------------------------
 
     // ----------------------------------- STATIC METHODS -----------------------------------
@@ -130,6 +141,10 @@ namespace wtl
     template <typename PART, typename STATE>
     void fill(const DeviceContext& dc, PART part, STATE state, const RectL& rc) const
     {
+      // [RECORDING] Append to display list
+      if (DisplayFrame* frame = dc.recorder())
+        return record(*frame, DisplayList::command(DisplayOp::ThemeFill, rc, reinterpret_cast<uintptr_t>(Handle.get())), part, state);
+
       if (!HResult(::DrawThemeBackground(Handle, dc.handle(), part, state, const_cast<RectL&>(rc), nullptr)))
         throw platform_error(HERE, "Unable to draw themed control background");
     }
@@ -149,6 +164,14 @@ namespace wtl
     template <typename PART, typename STATE>
     void fill(const DeviceContext& dc, PART part, STATE state, const RectL& rc, const RectL& clip) const
     {
+      // [RECORDING] Append to display list  (Only the clipped area is affected)
+      if (DisplayFrame* frame = dc.recorder())
+      {
+        DisplayCommand cmd = DisplayList::command(DisplayOp::ThemeFill, rc, reinterpret_cast<uintptr_t>(Handle.get()));
+        cmd.Bounds = DamageRegion::intersection(rc, clip);
+        return record(*frame, cmd, part, state);
+      }
+
       if (!HResult(::DrawThemeBackground(Handle, dc.handle(), part, state, const_cast<RectL&>(rc), const_cast<RectL&>(clip))))
         throw platform_error(HERE, "Unable to draw themed control background");
     }
@@ -260,12 +283,43 @@ namespace wtl
     template <typename PART, typename STATE>
     void write(const DeviceContext& dc, PART part, STATE state, const String<Encoding::UTF16>& str, const RectL& rc, DrawTextFlags flags = DrawTextFlags::VCentre|DrawTextFlags::SingleLine) const
     {
+      // [RECORDING] Append to display list
+      if (DisplayFrame* frame = dc.recorder())
+      {
+        DisplayCommand cmd = DisplayList::command(DisplayOp::ThemeText, rc, reinterpret_cast<uintptr_t>(Handle.get()), 
+                                                  reinterpret_cast<uintptr_t>(::GetCurrentObject(dc.handle(), OBJ_FONT)));
+        cmd.Part = static_cast<int32_t>(part);
+        cmd.State = static_cast<int32_t>(state);
+        cmd.Flags = static_cast<uint32_t>(enum_cast(flags));
+        frame->retain(Handle);
+        frame->List.record(cmd, str.c_str(), static_cast<uint32_t>(str.size()));
+        return;
+      }
+
       if (!HResult(::DrawThemeText(Handle, dc.handle(), part, state, str.c_str(), static_cast<int>(str.size()), enum_cast(flags), 0, const_cast<RectL&>(rc))))
         throw platform_error(HERE, "Unable to draw themed control text");
     }
     
     // ----------------------------------- MUTATOR METHODS ----------------------------------
     
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Theme::record const
+    //! Append a part to a recording frame
+    //!
+    //! \param[in,out] &frame - Recording frame
+    //! \param[in] cmd - Command
+    //! \param[in] part - Part to draw
+    //! \param[in] state - State of specified part
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename PART, typename STATE>
+    void record(DisplayFrame& frame, DisplayCommand cmd, PART part, STATE state) const
+    {
+      cmd.Part = static_cast<int32_t>(part);
+      cmd.State = static_cast<int32_t>(state);
+      frame.retain(Handle);
+      frame.List.record(cmd);
+    }
   };
 
   
@@ -0,0 +1,380 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\gdi\ThemeCache.hpp
+//! \brief Caches visual style handles, part sizes and text extents
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_THEME_CACHE_HPP
+#define WTL_THEME_CACHE_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/gdi/FontKey.hpp>                    //!< FontKey
+#include <wtl/utils/CacheCounters.hpp>            //!< CacheCounters
+#include <wtl/utils/Exception.hpp>                //!< platform_error
+#include <wtl/utils/Size.hpp>                     //!< SizeL
+#include <atomic>                                 //!< std::atomic
+#include <mutex>                                  //!< std::mutex
+#include <string>                                 //!< std::wstring
+#include <unordered_map>                          //!< std::unordered_map
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct IThemeProvider - Interface for the source of visual style handles and metrics
+  //!
+  //! \remarks Handles, device contexts and fonts are opaque to the cache, so that a fake provider can be substituted.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct IThemeProvider
+  {
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+
+    ENABLE_POLY(IThemeProvider);      //!< Abstract base class
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+
+    //! Handles
+    virtual uintptr_t  open(const wchar_t* classes, uint32_t dpi) = 0;
+    virtual void       close(uintptr_t theme) = 0;
+
+    //! Fonts  (Overwrites every attribute of 'key')
+    virtual void  describe(uintptr_t font, FontKey& key) = 0;
+
+    //! Measuring
+    virtual SizeL  measure(uintptr_t theme, uintptr_t dc, int32_t part, int32_t state) = 0;
+    virtual SizeL  measure(uintptr_t theme, uintptr_t dc, int32_t part, int32_t state, const wchar_t* text, uint32_t length, uint32_t flags) = 0;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct ThemeCache - Caches visual style handles by class list and DPI, and the part sizes and text extents
+  //!  measured with them
+  //!
+  //! \remarks Handles remain open until the cache is invalidated, which should occur whenever the system theme
+  //! \remarks changes. Invalidation takes effect upon the next lookup, so the cache is only emptied once however
+  //! \remarks many windows report the same change.
+  //!
+  //! \remarks Text extents are keyed by the attributes of the font selected into the device context, rather than
+  //! \remarks its handle, since handles are re-used once fonts are deleted. They are discarded en masse once the
+  //! \remarks capacity is reached.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct ThemeCache
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = ThemeCache;
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Statistics - Counters of each kind of lookup
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+      CacheCounters  Themes,       //!< Theme handles
+                     Parts,        //!< Part sizes
+                     Extents;      //!< Text extents
+      uint64_t       Flushes;      //!< Number of times the cache was emptied upon invalidation
+    };
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct ThemeKey - Class list and DPI
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct ThemeKey
+    {
+      std::wstring  Classes;    //!< Semi-colon separated class list
+      uint32_t      Dpi;        //!< Dots per inch
+
+      bool operator == (const ThemeKey& r) const
+      {
+        return Dpi == r.Dpi && Classes == r.Classes;
+      }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct PartKey - Theme, part and state
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct PartKey
+    {
+      uintptr_t  Theme;       //!< Theme handle
+      int32_t    Part,        //!< Part id
+                 State;       //!< State id
+
+      bool operator == (const PartKey& r) const
+      {
+        return Theme == r.Theme && Part == r.Part && State == r.State;
+      }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct ExtentKey - Theme, part, state, font, flags and text
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct ExtentKey : PartKey
+    {
+      FontKey       Font;       //!< Font attributes
+      uint32_t      Flags;      //!< Drawing flags
+      std::wstring  Text;       //!< Text
+
+      bool operator == (const ExtentKey& r) const
+      {
+        return PartKey::operator==(r) && Font == r.Font && Flags == r.Flags && Text == r.Text;
+      }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct KeyHash - Hashes each type of key
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct KeyHash
+    {
+      size_t operator () (const ThemeKey& k) const
+      {
+        return combine(std::hash<std::wstring>()(k.Classes), k.Dpi);
+      }
+
+      size_t operator () (const PartKey& k) const
+      {
+        return combine(combine(std::hash<uintptr_t>()(k.Theme), k.Part), k.State);
+      }
+
+      size_t operator () (const ExtentKey& k) const
+      {
+        return combine(combine(combine((*this)(static_cast<const PartKey&>(k)), k.Font.hash()), k.Flags), std::hash<std::wstring>()(k.Text));
+      }
+
+      static size_t combine(size_t seed, size_t value)
+      {
+        return seed ^ (value + 0x9e3779b9u + (seed << 6) + (seed >> 2));
+      }
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    IThemeProvider&                                   Provider;     //!< Source of handles and metrics
+    mutable std::mutex                                Lock;         //!< Protects all state
+    std::unordered_map<ThemeKey,uintptr_t,KeyHash>    Themes;       //!< Open theme handles
+    std::unordered_map<PartKey,SizeL,KeyHash>         Parts;        //!< Part sizes
+    std::unordered_map<ExtentKey,SizeL,KeyHash>       Extents;      //!< Text extents
+    ThemeKey                                          ThemeProbe;   //!< Reusable lookup key  (Avoids allocating per lookup)
+    ExtentKey                                         ExtentProbe;  //!< Reusable lookup key  (Avoids allocating per lookup)
+    uint32_t                                          Capacity;     //!< Maximum number of text extents
+    Statistics                                        Stats;        //!< Hit and miss counters
+    std::atomic<bool>                                 Stale;        //!< Whether to empty the cache upon next lookup
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThemeCache::ThemeCache
+    //! Create empty cache
+    //!
+    //! \param[in] &provider - Source of handles and metrics
+    //! \param[in] capacity - [optional] Maximum number of text extents
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit
+    ThemeCache(IThemeProvider& provider, uint32_t capacity = 4096) : Provider(provider),
+                                                                     Capacity(capacity),
+                                                                     Stats {},
+                                                                     Stale(false)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(ThemeCache);      //!< Cannot be copied
+    DISABLE_MOVE(ThemeCache);      //!< Cannot be moved
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThemeCache::~ThemeCache
+    //! Closes all theme handles
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~ThemeCache()
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      flush();
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThemeCache::statistics const
+    //! Get the hit and miss counters
+    //!
+    //! \return Statistics - Counters of each kind of lookup
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Statistics  statistics() const
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      return Stats;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThemeCache::invalidate
+    //! Closes all theme handles and discards all measurements upon the next lookup  (eg. upon WM_THEMECHANGED)
+    //!
+    //! \remarks Repeated invalidation before the next lookup empties the cache only once
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  invalidate()
+    {
+      Stale.store(true, std::memory_order_release);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThemeCache::open
+    //! Get the theme handle for a class list at a DPI, opening it upon first use
+    //!
+    //! \param[in] const* classes - Semi-colon separated class list
+    //! \param[in] dpi - Dots per inch
+    //! \return uintptr_t - Theme handle  (Owned by the cache)
+    //!
+    //! \throw wtl::platform_error - Unable to open theme
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uintptr_t  open(const wchar_t* classes, uint32_t dpi)
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      refresh();
+      return theme(classes, dpi);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThemeCache::measure
+    //! Get the size of a part, measuring it upon first use
+    //!
+    //! \param[in] const* classes - Semi-colon separated class list
+    //! \param[in] dpi - Dots per inch
+    //! \param[in] dc - Device context
+    //! \param[in] part - Part id
+    //! \param[in] state - State id
+    //! \return SizeL - Size of part
+    //!
+    //! \throw wtl::platform_error - Unable to open theme -or- Unable to measure part
+    /////////////////////////////////////////////////////////////////////////////////////////
+    SizeL  measure(const wchar_t* classes, uint32_t dpi, uintptr_t dc, int32_t part, int32_t state)
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      refresh();
+      PartKey const key {theme(classes, dpi), part, state};
+
+      // [CACHED] Return previous measurement
+      auto pos = Parts.find(key);
+      if (pos != Parts.end())
+      {
+        ++Stats.Parts.Hits;
+        return pos->second;
+      }
+
+      // Measure and remember
+      ++Stats.Parts.Misses;
+      return Parts.emplace(key, Provider.measure(key.Theme, dc, part, state)).first->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThemeCache::measure
+    //! Get the extent of text drawn within a part, measuring it upon first use
+    //!
+    //! \param[in] const* classes - Semi-colon separated class list
+    //! \param[in] dpi - Dots per inch
+    //! \param[in] dc - Device context
+    //! \param[in] font - Font selected into 'dc'  (Identified by its attributes)
+    //! \param[in] part - Part id
+    //! \param[in] state - State id
+    //! \param[in] const* text - Text  (Need not be null-terminated)
+    //! \param[in] length - Length of text, in characters
+    //! \param[in] flags - Drawing flags
+    //! \return SizeL - Extent of text
+    //!
+    //! \throw wtl::platform_error - Unable to open theme -or- Unable to measure text
+    /////////////////////////////////////////////////////////////////////////////////////////
+    SizeL  measure(const wchar_t* classes, uint32_t dpi, uintptr_t dc, uintptr_t font, int32_t part, int32_t state, const wchar_t* text, uint32_t length, uint32_t flags)
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      refresh();
+
+      // Populate probe key  (Re-uses its capacity)
+      ExtentProbe.Theme = theme(classes, dpi);
+      ExtentProbe.Part = part;
+      ExtentProbe.State = state;
+      Provider.describe(font, ExtentProbe.Font);
+      ExtentProbe.Flags = flags;
+      ExtentProbe.Text.assign(text, length);
+
+      // [CACHED] Return previous measurement
+      auto pos = Extents.find(ExtentProbe);
+      if (pos != Extents.end())
+      {
+        ++Stats.Extents.Hits;
+        return pos->second;
+      }
+
+      // [FULL] Discard all extents
+      ++Stats.Extents.Misses;
+      if (Extents.size() >= Capacity)
+        Extents.clear();
+
+      // Measure and remember
+      return Extents.emplace(ExtentProbe, Provider.measure(ExtentProbe.Theme, dc, part, state, text, length, flags)).first->second;
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThemeCache::flush
+    //! Closes all theme handles and discards all measurements  (Caller must hold 'Lock')
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  flush()
+    {
+      for (auto& t : Themes)
+        Provider.close(t.second);
+
+      Themes.clear();
+      Parts.clear();
+      Extents.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThemeCache::refresh
+    //! Empties the cache if invalidated since the last lookup  (Caller must hold 'Lock')
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  refresh()
+    {
+      if (Stale.load(std::memory_order_acquire) && Stale.exchange(false, std::memory_order_acq_rel))
+      {
+        ++Stats.Flushes;
+        flush();
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThemeCache::theme
+    //! Get the theme handle for a class list at a DPI, opening it upon first use  (Caller must hold 'Lock')
+    //!
+    //! \param[in] const* classes - Semi-colon separated class list
+    //! \param[in] dpi - Dots per inch
+    //! \return uintptr_t - Theme handle
+    //!
+    //! \throw wtl::platform_error - Unable to open theme
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uintptr_t  theme(const wchar_t* classes, uint32_t dpi)
+    {
+      ThemeProbe.Classes.assign(classes);
+      ThemeProbe.Dpi = dpi;
+
+      // [CACHED] Return open handle
+      auto pos = Themes.find(ThemeProbe);
+      if (pos != Themes.end())
+      {
+        ++Stats.Themes.Hits;
+        return pos->second;
+      }
+
+      // Open and remember
+      ++Stats.Themes.Misses;
+      if (uintptr_t handle = Provider.open(classes, dpi))
+        return Themes.emplace(ThemeProbe, handle).first->second;
+
+      // [FAILED] Unable to open theme
+      throw platform_error(HERE, "Unable to open visual style");
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_THEME_CACHE_HPP
@@ -10,6 +10,12 @@
 #define WTL_BINARY_READER_HPP
 
 #include <wtl/WTL.hpp>
+#include <wtl/utils/Exception.hpp>          //!< length_error
+#include <wtl/utils/Bitset.hpp>             //!< Bitset
+#include <wtl/utils/DynamicBitset.hpp>      //!< DynamicBitset
+#include <wtl/utils/DynamicArray.hpp>       //!< Array
+#include <wtl/utils/SFINAE.hpp>             //!< enable_if_enum_t
+#include <utility>                          //!< std::forward
 
 //! \namespace wtl - Windows template library
 namespace wtl
@@ -98,8 +104,7 @@ namespace wtl
     //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
     //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
     //////////////////////////////////////////////////////////////////////////////////////////
-    template <>
-    void read<bool>(bool& b)
+    void read(bool& b)
     {
       CHECKED_LENGTH(1, Stream.remaining());
 
@@ -195,7 +200,7 @@ namespace wtl
   //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
   //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
   //////////////////////////////////////////////////////////////////////////////////////////
-  template <typename STREAM, typename U, typename = enable_if_enum_t<U>>
+  template <typename STREAM, typename U, typename = enable_if_enum_t<U>, typename = void>
   BinaryReader<STREAM>& operator >> (BinaryReader<STREAM>& r, U& val)
   {
     r.read( reinterpret_cast<std::underlying_type_t<U>&>(val) );  // sizeof(underlying(U)) <= sizeof(U) 
@@ -297,6 +302,40 @@ namespace wtl
     return r;
   }
 
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::operator >>
+  //! Read a dynamic bitset from an input stream as its width followed by its words
+  //!
+  //! \tparam STREAM - Stream type
+  //!
+  //! \param[in,out] &r - Binary reader
+  //! \param[in,out] &bs - Dynamic bitset
+  //! \return BinaryReader<STREAM>& : Reference to 'r'
+  //!
+  //! \throw std::bad_alloc - Insufficient memory
+  //! \throw wtl::length_error - [Debug Only] Insufficient buffer space remaining
+  //! \throw wtl::logic_error - [Debug only] Stream has been closed
+  //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM>
+  BinaryReader<STREAM>& operator >> (BinaryReader<STREAM>& r, DynamicBitset& bs) 
+  {
+    uint32_t  bits;      //!< Bitset width
+
+    // Read width
+    r >> bits;
+    bs.resize(0);
+    bs.resize(bits);
+
+    // Read words, then clear any bits beyond the width
+    for (uint32_t i = 0UL; i < bs.words(); ++i) 
+      r >> bs.data()[i];
+    bs.resize(bits);
+    
+    // Return
+    return r;
+  }
+
 
 
 } //namespace wtl
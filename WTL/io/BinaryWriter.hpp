@@ -10,6 +10,12 @@
 #define WTL_BINARY_WRITER_HPP
 
 #include <wtl/WTL.hpp>
+#include <wtl/utils/Exception.hpp>          //!< length_error
+#include <wtl/utils/Bitset.hpp>             //!< Bitset
+#include <wtl/utils/DynamicBitset.hpp>      //!< DynamicBitset
+#include <wtl/utils/DynamicArray.hpp>       //!< Array
+#include <wtl/utils/SFINAE.hpp>             //!< enable_if_enum_t
+#include <utility>                          //!< std::forward
 
 //! \namespace wtl - Windows template library
 namespace wtl
@@ -77,9 +83,31 @@ namespace wtl
     {
       return Stream.remaining();
     }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryWriter::stream const
+    //! Get the output stream
+    //! 
+    //! \return const stream_t& - Output stream
+    //////////////////////////////////////////////////////////////////////////////////////////
+    const stream_t& stream() const
+    {
+      return Stream;
+    }
     
     // ----------------------------------- MUTATOR METHODS ----------------------------------
   
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // BinaryWriter::stream
+    //! Get the output stream, eg. to transfer its contents to a socket
+    //! 
+    //! \return stream_t& - Output stream
+    //////////////////////////////////////////////////////////////////////////////////////////
+    stream_t& stream()
+    {
+      return Stream;
+    }
+    
     //////////////////////////////////////////////////////////////////////////////////////////
     // BinaryWriter::write
     //! Writes any object to the output stream
@@ -187,7 +215,7 @@ namespace wtl
   template <typename STREAM, typename U, typename = std::enable_if_t<std::is_integral<U>::value || std::is_floating_point<U>::value>>
   BinaryWriter<STREAM>& operator << (BinaryWriter<STREAM>& w, U val)
   {
-    CHECKED_LENGTH(size_of<U>::value, w.remaining());
+    CHECKED_LENGTH(sizeof(U), w.remaining());
 
     w.write(val);
     return w;
@@ -207,7 +235,7 @@ namespace wtl
   //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
   //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
   //////////////////////////////////////////////////////////////////////////////////////////
-  template <typename STREAM, typename U, typename = enable_if_enum_t<U>>
+  template <typename STREAM, typename U, typename = enable_if_enum_t<U>, typename = void>
   BinaryWriter<STREAM>& operator << (BinaryWriter<STREAM>& w, U val)
   {
     // Write as underlying type
@@ -315,7 +343,34 @@ namespace wtl
   BinaryWriter<STREAM>& operator << (BinaryWriter<STREAM>& w, const Bitset<DATA>& r) 
   {
     // Write mask
-    return w << r.Mask;
+    return w << static_cast<typename Bitset<DATA>::mask_t>(r);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::operator << 
+  //! Write a dynamic bitset to an output stream as its width followed by its words
+  //!
+  //! \tparam STREAM - Stream type
+  //!
+  //! \param[in,out] &w - Binary writer
+  //! \param[in] const &r - Immutable reference to a dynamic bitset
+  //! \return BinaryWriter<STREAM>& : Reference to 'w'
+  //!
+  //! \throw wtl::length_error - [Debug Only] Insufficient buffer space remaining
+  //! \throw wtl::logic_error - [Debug only] Stream has been closed
+  //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
+  //////////////////////////////////////////////////////////////////////////////////////////
+  template <typename STREAM>
+  BinaryWriter<STREAM>& operator << (BinaryWriter<STREAM>& w, const DynamicBitset& r) 
+  {
+    // Write width
+    w << r.size();
+
+    // Write words, least significant first
+    for (uint32_t i = 0UL; i < r.words(); ++i) 
+      w << r.data()[i];
+
+    return w;
   }
 
 
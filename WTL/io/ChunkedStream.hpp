@@ -0,0 +1,271 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\ChunkedStream.hpp
+//! \brief Provides an unbounded output stream stored as a chain of pooled blocks
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_CHUNKED_STREAM_HPP
+#define WTL_CHUNKED_STREAM_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/io/SocketBufferPool.hpp>        //!< SocketBufferPool
+#include <algorithm>                          //!< std::min
+#include <cstring>                            //!< std::memcpy
+#include <limits>                             //!< std::numeric_limits
+#include <memory>                             //!< std::shared_ptr
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct BufferSegment - Contiguous region of an outbound message
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct BufferSegment
+  {
+    const byte*  Data;        //!< First byte
+    size_t       Length;      //!< Number of bytes
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct ChunkedStream - Output stream which grows by appending blocks drawn from a pool
+  //!
+  //! \remarks Satisfies the stream requirements of BinaryWriter. The blocks can be sent with a single vectored write,
+  //! \remarks or transferred to a SocketReactor connection sharing the same pool without copying.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct ChunkedStream
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = ChunkedStream;
+
+    //! \alias block_t - Block type
+    using block_t = SocketBufferPool::Block;
+
+    //! \alias distance_t - Stream distance type
+    using distance_t = size_t;
+
+    //! \alias element_t - Stream element type
+    using element_t = byte;
+
+    //! \alias position_t - Stream position type
+    using position_t = size_t;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::shared_ptr<SocketBufferPool>  Pool;        //!< Source of blocks
+    block_t*                           Head;        //!< First block
+    block_t*                           Tail;        //!< Last block
+    size_t                             Length;      //!< Number of bytes written
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ChunkedStream::ChunkedStream
+    //! Create empty stream
+    //!
+    //! \param[in] pool - Source of blocks
+    //!
+    //! \throw wtl::invalid_argument - Missing pool
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit ChunkedStream(std::shared_ptr<SocketBufferPool> pool) : Pool(std::move(pool)),
+                                                                     Head(nullptr),
+                                                                     Tail(nullptr),
+                                                                     Length(0)
+    {
+      REQUIRED_PARAM(Pool);
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(ChunkedStream);      //!< Blocks are uniquely owned
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ChunkedStream::ChunkedStream
+    //! Move-construct, leaving the source empty
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ChunkedStream(ChunkedStream&& r) : Pool(r.Pool),
+                                       Head(r.Head),
+                                       Tail(r.Tail),
+                                       Length(r.Length)
+    {
+      r.Head = r.Tail = nullptr;
+      r.Length = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ChunkedStream::operator=
+    //! Move-assign, releasing existing blocks and leaving the source empty
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ChunkedStream& operator=(ChunkedStream&& r)
+    {
+      if (this != &r)
+      {
+        clear();
+        Pool = r.Pool;
+        std::swap(Head, r.Head);
+        std::swap(Tail, r.Tail);
+        std::swap(Length, r.Length);
+      }
+      return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ChunkedStream::~ChunkedStream
+    //! Release blocks to the pool
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~ChunkedStream()
+    {
+      clear();
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ChunkedStream::empty const
+    //! Query whether the stream is empty
+    //!
+    //! \return bool - True iff nothing has been written
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  empty() const
+    {
+      return Length == 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ChunkedStream::pool const
+    //! Get the source of blocks
+    //!
+    //! \return const std::shared_ptr<SocketBufferPool>& - Pool
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const std::shared_ptr<SocketBufferPool>&  pool() const
+    {
+      return Pool;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ChunkedStream::remaining const
+    //! Get the number of elements which may be written
+    //!
+    //! \return distance_t - Unbounded
+    /////////////////////////////////////////////////////////////////////////////////////////
+    distance_t  remaining() const
+    {
+      return std::numeric_limits<distance_t>::max();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ChunkedStream::segments const
+    //! Enumerate the contiguous segments of the stream
+    //!
+    //! \tparam FUNC - Callable accepting a BufferSegment
+    //!
+    //! \param[in] fn - Function object
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename FUNC>
+    void  segments(FUNC&& fn) const
+    {
+      for (block_t* b = Head; b; b = b->Next)
+        fn(BufferSegment{b->data() + b->Begin, b->End - b->Begin});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ChunkedStream::size const
+    //! Get the number of bytes written
+    //!
+    //! \return size_t - Number of bytes
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t  size() const
+    {
+      return Length;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ChunkedStream::clear
+    //! Release all blocks
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clear()
+    {
+      if (Pool)
+        Pool->release(Head);
+      Head = Tail = nullptr;
+      Length = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ChunkedStream::detach
+    //! Transfer ownership of the blocks to the caller, leaving the stream empty
+    //!
+    //! \return block_t* - First block of chain  (Must be released to the pool)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    block_t*  detach()
+    {
+      block_t* chain = Head;
+      Head = Tail = nullptr;
+      Length = 0;
+      return chain;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ChunkedStream::put
+    //! Write a single element
+    //!
+    //! \param[in] b - Element
+    //!
+    //! \throw std::bad_alloc - Unable to allocate block
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  put(element_t b)
+    {
+      write(&b, 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ChunkedStream::write
+    //! Write elements of a statically allocated array
+    //!
+    //! \param[in] const (&)[] arr - Array
+    //!
+    //! \throw std::bad_alloc - Unable to allocate block
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <unsigned LENGTH>
+    void  write(const element_t (&arr)[LENGTH])
+    {
+      write(arr, LENGTH);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ChunkedStream::write
+    //! Write elements, appending blocks as necessary
+    //!
+    //! \param[in] const* data - Elements
+    //! \param[in] length - Number of elements
+    //!
+    //! \throw std::bad_alloc - Unable to allocate block
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  write(const element_t* data, size_t length)
+    {
+      uint32_t const capacity = Pool->capacity();
+      Length += length;
+
+      while (length)
+      {
+        if (!Tail || Tail->End == capacity)
+        {
+          block_t* b = Pool->acquire();
+          (Tail ? Tail->Next : Head) = b;
+          Tail = b;
+        }
+        size_t n = std::min<size_t>(length, capacity - Tail->End);
+        std::memcpy(Tail->data() + Tail->End, data, n);
+        Tail->End += static_cast<uint32_t>(n);
+        data += n, length -= n;
+      }
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_CHUNKED_STREAM_HPP
@@ -15,8 +15,8 @@
 #include <deque>                      //!< std::deque
 #include <sstream>                    //!< std::basic_stringstream
 #include <ios>                        //!< std::ios_base
-#include <WTL/utils/Point.hpp>        //!< Point
-#include <WTL/utils/exception.hpp>    //!< caught-exception
+#include <wtl/utils/Point.hpp>        //!< Point
+#include <wtl/utils/Exception.hpp>    //!< caught-exception
 
 //////////////////////////////////////////////////////////////////////////////////////////
 //! \namespace wtl - Windows template library
@@ -322,7 +322,7 @@ namespace wtl
     //! \param[in] mode - [optional] Whether to seek the get and/or put position
     //! \return pos_type - New absolute position
     //////////////////////////////////////////////////////////////////////////////////////////
-	  pos_type seekoff(off_type offset, seekdir origin, openmode mode = std::ios_base::in | std::ios_base::out) override
+	  pos_type seekoff(off_type offset, seekdir /*origin*/, openmode /*mode*/ = std::ios_base::in | std::ios_base::out) override
 	  {	
       ::CONSOLE_SCREEN_BUFFER_INFO sb;
 
@@ -350,7 +350,7 @@ namespace wtl
     //! \param[in] mode - [optional] Whether to seek the get and/or put position
     //! \return pos_type - New absolute position
     //////////////////////////////////////////////////////////////////////////////////////////
-    pos_type seekpos(pos_type pos, openmode mode = std::ios_base::in | std::ios_base::out) override
+    pos_type seekpos(pos_type pos, openmode /*mode*/ = std::ios_base::in | std::ios_base::out) override
 	  {	
       // Flush existing buffer
       sync();
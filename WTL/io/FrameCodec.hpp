@@ -0,0 +1,665 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\FrameCodec.hpp
+//! \brief Provides message framing over byte streams, with length-prefix, varint-prefix and delimiter codecs
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_FRAME_CODEC_HPP
+#define WTL_FRAME_CODEC_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/io/ChunkedStream.hpp>           //!< ChunkedStream, BufferSegment
+#include <wtl/utils/Exception.hpp>            //!< invalid_argument
+#include <algorithm>                          //!< std::min
+#include <cstring>                            //!< std::memchr, std::memcmp, std::memcpy
+#include <limits>                             //!< std::numeric_limits
+#include <vector>                             //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct FrameView - Input stream over the payload of a single frame, without copying
+  //!
+  //! \remarks Satisfies the stream requirements of BinaryReader and XmlReader. The payload is only valid until the
+  //! \remarks frame handler returns, but may be modified in-place (eg. by XmlReader).
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct FrameView
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias distance_t - Stream distance type
+    using distance_t = size_t;
+
+    //! \alias element_t - Stream element type
+    using element_t = byte;
+
+    //! \alias position_t - Stream position type
+    using position_t = size_t;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    byte*   Data;         //!< Payload
+    size_t  Length;       //!< Length of payload
+    size_t  Position;     //!< Read position
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    FrameView(byte* data, size_t length) : Data(data), Length(length), Position(0)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    ENABLE_COPY(FrameView);      //!< Shallow copy
+    ENABLE_MOVE(FrameView);      //!< Shallow copy
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    //! Get the unread payload
+    byte*  buffer() const                { return Data + Position;       }
+
+    //! Get the entire payload
+    byte*  data() const                  { return Data;                  }
+
+    //! Get the number of unread bytes
+    distance_t  remaining() const        { return Length - Position;     }
+
+    //! Get the length of the payload
+    size_t  size() const                 { return Length;                }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FrameView::get
+    //! Read a single element
+    //!
+    //! \return element_t - Element
+    //!
+    //! \throw wtl::length_error - [Debug only] Payload exhausted
+    /////////////////////////////////////////////////////////////////////////////////////////
+    element_t  get()
+    {
+      CHECKED_LENGTH(1u, remaining());
+      return Data[Position++];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FrameView::read
+    //! Read elements into a statically allocated array
+    //!
+    //! \param[in,out] (&)[] arr - Array
+    //!
+    //! \throw wtl::length_error - [Debug only] Payload exhausted
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <unsigned LENGTH>
+    void  read(element_t (&arr)[LENGTH])
+    {
+      read(arr, LENGTH);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FrameView::read
+    //! Read elements
+    //!
+    //! \param[in,out] *out - Output buffer
+    //! \param[in] length - Number of elements
+    //!
+    //! \throw wtl::length_error - [Debug only] Payload exhausted
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  read(element_t* out, size_t length)
+    {
+      CHECKED_LENGTH(length, remaining());
+      std::memcpy(out, Data + Position, length);
+      Position += length;
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct LengthPrefixCodec - Frames prefixed by their payload length, as a big-endian integer
+  //!
+  //! \tparam LENGTH - Unsigned integer type of the prefix
+  //!
+  //! \remarks Codecs measure frames at the start of a buffer, locate their payload, and encode headers and trailers.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename LENGTH = uint32_t>
+  struct LengthPrefixCodec
+  {
+    static_assert(std::is_unsigned<LENGTH>::value, "Length prefix must be an unsigned integer");
+
+    //! \var Malformed - Returned by measure() when the stream is corrupt
+    static constexpr size_t Malformed = ~size_t(0);
+
+    //! \var MaxHeader - Maximum length of header
+    static constexpr size_t MaxHeader = sizeof(LENGTH);
+
+    //! \var MaxTrailer - Maximum length of trailer
+    static constexpr size_t MaxTrailer = 0;
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LengthPrefixCodec::measure const
+    //! Measure the frame at the start of a buffer
+    //!
+    //! \param[in] const* data - Buffer
+    //! \param[in] available - Length of buffer
+    //! \return size_t - Length of entire frame, zero if the header is incomplete, or Malformed if the length overflows
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t  measure(const byte* data, size_t available, size_t = 0) const
+    {
+      if (available < sizeof(LENGTH))
+        return 0;
+
+      uint64_t length = 0;
+      for (size_t i = 0; i < sizeof(LENGTH); ++i)
+        length = length << 8 | data[i];
+      if (length > std::numeric_limits<size_t>::max() - sizeof(LENGTH))
+        return Malformed;
+      return sizeof(LENGTH) + static_cast<size_t>(length);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LengthPrefixCodec::lookahead const
+    //! Get the number of bytes to buffer when a frame cannot yet be measured
+    //!
+    //! \param[in] buffered - Number of bytes buffered
+    //! \return size_t - Number of additional bytes
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t  lookahead(size_t buffered) const
+    {
+      return sizeof(LENGTH) - buffered;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LengthPrefixCodec::payload const
+    //! Locate the payload of a complete frame
+    //!
+    //! \param[in] const* frame - Frame
+    //! \param[in] size - Length of frame
+    //! \return std::pair<size_t,size_t> - Offset and length of payload
+    /////////////////////////////////////////////////////////////////////////////////////////
+    std::pair<size_t,size_t>  payload(const byte*, size_t size) const
+    {
+      return { sizeof(LENGTH), size - sizeof(LENGTH) };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LengthPrefixCodec::header const
+    //! Encode the header of a frame
+    //!
+    //! \param[in] length - Length of payload
+    //! \param[in,out] *out - Buffer of at least MaxHeader bytes
+    //! \return size_t - Length of header
+    //!
+    //! \throw wtl::length_error - Payload too long for prefix
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t  header(size_t length, byte* out) const
+    {
+      if (length > std::numeric_limits<LENGTH>::max())
+        throw length_error(HERE, "Payload too long for length prefix");
+
+      for (size_t i = sizeof(LENGTH); i-- > 0; length >>= 8)
+        out[i] = static_cast<byte>(length);
+      return sizeof(LENGTH);
+    }
+
+    //! Encode the trailer of a frame  (None)
+    size_t  trailer(byte*) const
+    {
+      return 0;
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct VarintPrefixCodec - Frames prefixed by their payload length, as an unsigned LEB128 varint
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct VarintPrefixCodec
+  {
+    //! \var Malformed - Returned by measure() when the stream is corrupt
+    static constexpr size_t Malformed = ~size_t(0);
+
+    //! \var MaxHeader - Maximum length of header
+    static constexpr size_t MaxHeader = 10;
+
+    //! \var MaxTrailer - Maximum length of trailer
+    static constexpr size_t MaxTrailer = 0;
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // VarintPrefixCodec::measure const
+    //! Measure the frame at the start of a buffer
+    //!
+    //! \param[in] const* data - Buffer
+    //! \param[in] available - Length of buffer
+    //! \return size_t - Length of entire frame, zero if the header is incomplete, or Malformed
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t  measure(const byte* data, size_t available, size_t = 0) const
+    {
+      size_t const limit = available < MaxHeader ? available : MaxHeader;
+      uint64_t length = 0;
+      for (size_t i = 0; i < limit; ++i)
+      {
+        // [OVERFLOW] Final byte holds only the 64th bit, and must not be continued
+        if (i == MaxHeader-1 && data[i] > 1)
+          return Malformed;
+
+        length |= uint64_t(data[i] & 0x7F) << (7 * i);
+        if (!(data[i] & 0x80))
+          return length > std::numeric_limits<size_t>::max() - (i+1) ? Malformed : (i+1) + static_cast<size_t>(length);
+      }
+      return available >= MaxHeader ? Malformed : 0;
+    }
+
+    //! Buffer one byte at a time until the header is complete
+    size_t  lookahead(size_t) const
+    {
+      return 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // VarintPrefixCodec::payload const
+    //! Locate the payload of a complete frame
+    //!
+    //! \param[in] const* frame - Frame
+    //! \param[in] size - Length of frame
+    //! \return std::pair<size_t,size_t> - Offset and length of payload
+    /////////////////////////////////////////////////////////////////////////////////////////
+    std::pair<size_t,size_t>  payload(const byte* frame, size_t size) const
+    {
+      size_t header = 1;
+      while (frame[header-1] & 0x80)
+        ++header;
+      return { header, size - header };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // VarintPrefixCodec::header const
+    //! Encode the header of a frame
+    //!
+    //! \param[in] length - Length of payload
+    //! \param[in,out] *out - Buffer of at least MaxHeader bytes
+    //! \return size_t - Length of header
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t  header(size_t length, byte* out) const
+    {
+      size_t n = 0;
+      for (; length >= 0x80; length >>= 7)
+        out[n++] = static_cast<byte>(length | 0x80);
+      out[n++] = static_cast<byte>(length);
+      return n;
+    }
+
+    //! Encode the trailer of a frame  (None)
+    size_t  trailer(byte*) const
+    {
+      return 0;
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct DelimiterCodec - Frames terminated by a delimiter sequence, eg. "\r\n"
+  //!
+  //! \remarks Payloads must not contain the delimiter.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct DelimiterCodec
+  {
+    //! \var Malformed - Returned by measure() when the stream is corrupt
+    static constexpr size_t Malformed = ~size_t(0);
+
+    //! \var MaxHeader - Maximum length of header
+    static constexpr size_t MaxHeader = 0;
+
+    //! \var MaxTrailer - Maximum length of trailer
+    static constexpr size_t MaxTrailer = 8;
+
+    byte    Delimiter[MaxTrailer];    //!< Delimiter sequence
+    size_t  Length;                   //!< Length of delimiter
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DelimiterCodec::DelimiterCodec
+    //! Create codec
+    //!
+    //! \param[in] const* delim - Null-terminated delimiter
+    //!
+    //! \throw wtl::invalid_argument - Delimiter is empty or longer than MaxTrailer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit DelimiterCodec(const char* delim = "\n") : Length(std::strlen(delim))
+    {
+      if (!Length || Length > MaxTrailer)
+        throw invalid_argument(HERE, "Delimiter must be between 1 and 8 characters");
+      std::memcpy(Delimiter, delim, Length);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DelimiterCodec::measure const
+    //! Measure the frame at the start of a buffer
+    //!
+    //! \param[in] const* data - Buffer
+    //! \param[in] available - Length of buffer
+    //! \param[in] scanned - [optional] Number of leading bytes already known not to complete a frame
+    //! \return size_t - Length of entire frame, or zero if the delimiter has not been received
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t  measure(const byte* data, size_t available, size_t scanned = 0) const
+    {
+      // Resume search, allowing for a delimiter straddling the previous end
+      const byte* from = data + (scanned >= Length ? scanned - (Length-1) : 0);
+      const byte* const end = data + available;
+
+      // Locate each candidate first byte with memchr, which is vectorised, then compare the remainder
+      while (static_cast<size_t>(end - from) >= Length)
+      {
+        const byte* pos = static_cast<const byte*>(std::memchr(from, Delimiter[0], (end - from) - (Length-1)));
+        if (!pos)
+          break;
+        if (std::memcmp(pos + 1, Delimiter + 1, Length-1) == 0)
+          return static_cast<size_t>(pos - data) + Length;
+        from = pos + 1;
+      }
+      return 0;
+    }
+
+    //! Buffer everything available until the delimiter is found
+    size_t  lookahead(size_t) const
+    {
+      return std::numeric_limits<size_t>::max();
+    }
+
+    //! Locate the payload of a complete frame
+    std::pair<size_t,size_t>  payload(const byte*, size_t size) const
+    {
+      return { 0, size - Length };
+    }
+
+    //! Encode the header of a frame  (None)
+    size_t  header(size_t, byte*) const
+    {
+      return 0;
+    }
+
+    //! Encode the trailer of a frame
+    size_t  trailer(byte* out) const
+    {
+      std::memcpy(out, Delimiter, Length);
+      return Length;
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct FrameReader - Splits a received byte stream into frames
+  //!
+  //! \tparam CODEC - Framing codec
+  //!
+  //! \remarks Frames lying entirely within received data are delivered in-place. Only a frame straddling two receives
+  //! \remarks is assembled in an internal buffer, which retains its capacity between frames.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename CODEC>
+  struct FrameReader
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = FrameReader<CODEC>;
+
+    //! \alias codec_t - Codec type
+    using codec_t = CODEC;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    codec_t            Codec;        //!< Codec
+    std::vector<byte>  Pending;      //!< Partial frame
+    size_t             Scanned;      //!< Number of pending bytes known not to complete a frame
+    size_t             MaxFrame;     //!< Maximum length of a frame
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FrameReader::FrameReader
+    //! Create reader
+    //!
+    //! \param[in] codec - [optional] Codec
+    //! \param[in] maxFrame - [optional] Maximum length of a frame, including header and trailer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit FrameReader(codec_t codec = codec_t(), size_t maxFrame = 1 << 20) : Codec(std::move(codec)),
+                                                                                 Scanned(0),
+                                                                                 MaxFrame(maxFrame)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    ENABLE_COPY(FrameReader);      //!< Can be copied
+    ENABLE_MOVE(FrameReader);      //!< Can be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FrameReader::buffered const
+    //! Get the number of bytes of an incomplete frame
+    //!
+    //! \return size_t - Number of buffered bytes
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t  buffered() const
+    {
+      return Pending.size();
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FrameReader::feed
+    //! Extract and deliver each complete frame from received data
+    //!
+    //! \tparam FUNC - Callable accepting a FrameView&
+    //!
+    //! \param[in,out] *data - Received data  (Payloads are delivered in-place, and may be modified)
+    //! \param[in] length - Length of received data
+    //! \param[in] fn - Frame handler
+    //! \return bool - False if the stream is malformed or a frame exceeds the maximum length
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename FUNC>
+    bool  feed(byte* data, size_t length, FUNC&& fn)
+    {
+      // [STRADDLING] Complete the buffered frame first, copying only what it requires
+      while (!Pending.empty())
+      {
+        size_t const total = Codec.measure(Pending.data(), Pending.size(), Scanned);
+        if (total == codec_t::Malformed || total > MaxFrame)
+          return false;
+
+        if (total && total <= Pending.size())
+        {
+          // Return surplus lookahead (taken from this receive) so following frames are delivered in-place
+          size_t const surplus = Pending.size() - total;
+          deliver(Pending.data(), total, fn);
+          data -= surplus, length += surplus;
+          Pending.clear();
+          Scanned = 0;
+          continue;
+        }
+        if (!length)
+          return true;
+
+        size_t const take = std::min(length, total ? total - Pending.size() : Codec.lookahead(Pending.size()));
+        if (Pending.size() + take > MaxFrame)
+          return false;
+
+        Scanned = Pending.size();
+        Pending.insert(Pending.end(), data, data + take);
+        data += take, length -= take;
+      }
+
+      // [IN-PLACE] Deliver frames directly from received data
+      while (length)
+      {
+        size_t const total = Codec.measure(data, length);
+        if (total == codec_t::Malformed || total > MaxFrame)
+          return false;
+        if (!total || total > length)
+          break;
+
+        deliver(data, total, fn);
+        data += total, length -= total;
+      }
+
+      // Buffer trailing partial frame
+      if (length > MaxFrame)
+        return false;
+      Pending.assign(data, data + length);
+      Scanned = 0;
+      return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FrameReader::reset
+    //! Discard any partial frame
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  reset()
+    {
+      Pending.clear();
+      Scanned = 0;
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FrameReader::deliver
+    //! Deliver the payload of a complete frame
+    //!
+    //! \param[in,out] *frame - Frame
+    //! \param[in] size - Length of frame
+    //! \param[in] fn - Frame handler
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename FUNC>
+    void  deliver(byte* frame, size_t size, FUNC& fn)
+    {
+      auto const range = Codec.payload(frame, size);
+      FrameView view(frame + range.first, range.second);
+      fn(view);
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct FrameWriter - Encodes outbound frames into a batch which is sent with a single write
+  //!
+  //! \tparam CODEC - Framing codec
+  //!
+  //! \remarks The application decides when to flush, eg. after answering every request within a receive, or once
+  //! \remarks full() reports that the batch has reached its threshold.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename CODEC>
+  struct FrameWriter
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = FrameWriter<CODEC>;
+
+    //! \alias codec_t - Codec type
+    using codec_t = CODEC;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    codec_t        Codec;          //!< Codec
+    ChunkedStream  Batch;          //!< Encoded frames awaiting flush
+    size_t         Frames;         //!< Number of frames in batch
+    size_t         Threshold;      //!< Batch length considered full
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FrameWriter::FrameWriter
+    //! Create writer
+    //!
+    //! \param[in] pool - Source of batch blocks  (Use SocketReactor::pool() to send without copying)
+    //! \param[in] codec - [optional] Codec
+    //! \param[in] threshold - [optional] Batch length considered full
+    //!
+    //! \throw wtl::invalid_argument - Missing pool
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit FrameWriter(std::shared_ptr<SocketBufferPool> pool, codec_t codec = codec_t(), size_t threshold = 64 * 1024)
+      : Codec(std::move(codec)),
+        Batch(std::move(pool)),
+        Frames(0),
+        Threshold(threshold)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(FrameWriter);      //!< Batch is uniquely owned
+    ENABLE_MOVE(FrameWriter);       //!< Can be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    //! Query whether the batch has reached its threshold
+    bool  full() const              { return Batch.size() >= Threshold;   }
+
+    //! Get the number of frames awaiting flush
+    size_t  frames() const          { return Frames;                      }
+
+    //! Get the number of bytes awaiting flush
+    size_t  size() const            { return Batch.size();                }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FrameWriter::flush
+    //! Send every batched frame with a single write
+    //!
+    //! \tparam SINK - Socket or SocketReactor::Connection
+    //!
+    //! \param[in,out] &sink - Destination  (Sockets must be blocking, as unsent frames are discarded)
+    //! \return bool - True if the batch was empty or accepted by the sink
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename SINK>
+    bool  flush(SINK& sink)
+    {
+      if (Batch.empty())
+        return true;
+
+      bool const sent = sink.send(std::move(Batch)) != 0;
+      Batch.clear();
+      Frames = 0;
+      return sent;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FrameWriter::write
+    //! Append a frame to the batch
+    //!
+    //! \param[in] const* payload - Payload
+    //! \param[in] length - Length of payload
+    //! \return bool - True if the batch has reached its threshold
+    //!
+    //! \throw wtl::length_error - Payload too long for codec
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  write(const byte* payload, size_t length)
+    {
+      byte edge[CODEC::MaxHeader + CODEC::MaxTrailer + 1];
+
+      Batch.write(edge, Codec.header(length, edge));
+      Batch.write(payload, length);
+      Batch.write(edge, Codec.trailer(edge));
+      ++Frames;
+      return full();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FrameWriter::write
+    //! Append a frame whose payload is a stream, eg. produced by BinaryWriter<ChunkedStream>
+    //!
+    //! \param[in] const& payload - Payload
+    //! \return bool - True if the batch has reached its threshold
+    //!
+    //! \throw wtl::length_error - Payload too long for codec
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  write(const ChunkedStream& payload)
+    {
+      byte edge[CODEC::MaxHeader + CODEC::MaxTrailer + 1];
+
+      Batch.write(edge, Codec.header(payload.size(), edge));
+      payload.segments([this] (const BufferSegment& s) { Batch.write(s.Data, s.Length); });
+      Batch.write(edge, Codec.trailer(edge));
+      ++Frames;
+      return full();
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_FRAME_CODEC_HPP
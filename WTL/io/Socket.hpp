@@ -14,6 +14,9 @@
 #include <wtl/traits/SocketTraits.hpp>          //!< handle_alloc<::SOCKET>
 #include <wtl/platform/SocketFlags.hpp>         //!< AddressFamily,SocketType,SocketProtocol
 #include <wtl/windows/Window.hpp>               //!< Window
+#include <wtl/io/ChunkedStream.hpp>             //!< ChunkedStream, BufferSegment
+#include <vector>                               //!< std::vector
+#include <mswsock.h>                            //!< TransmitFile
 
 //! \namespace wtl - Windows template library
 namespace wtl
@@ -193,6 +196,89 @@ namespace wtl
       return n;
     }
     
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Socket::send
+    //! Send several buffers using vectored writes, continuing after partial writes
+    //!
+    //! \param[in] const* segments - Buffers
+    //! \param[in] count - Number of buffers
+    //! \param[in] flags - [optional] Flags
+    //! \return int32_t - Number of bytes sent  (Less than requested only when asynchronous and the socket would block)
+    //! 
+    //! \throw wtl::socket_error - Failed to send data
+    //////////////////////////////////////////////////////////////////////////////////////////
+    int32_t send(const BufferSegment* segments, uint32_t count, int32_t flags = 0)
+    {
+      std::vector<::WSABUF> bufs;
+      int32_t total = 0;
+
+      // Build gather list
+      bufs.reserve(count);
+      for (uint32_t i = 0; i < count; ++i)
+        if (segments[i].Length)
+          bufs.push_back({ static_cast<::ULONG>(segments[i].Length), reinterpret_cast<char*>(const_cast<byte*>(segments[i].Data)) });
+
+      for (size_t first = 0; first < bufs.size(); )
+      {
+        ::DWORD sent = 0;
+        if (::WSASend(handle(), &bufs[first], static_cast<::DWORD>(bufs.size() - first), &sent, flags, nullptr, nullptr) == SOCKET_ERROR)
+        {
+          if (Async && ::WSAGetLastError() == WSAEWOULDBLOCK)
+            break;
+          throw socket_error(HERE, "Unable to send data");
+        }
+        total += sent;
+
+        // [PARTIAL] Advance past whatever was sent
+        while (first < bufs.size() && sent >= bufs[first].len)
+          sent -= bufs[first++].len;
+        if (first < bufs.size())
+        {
+          bufs[first].buf += sent;
+          bufs[first].len -= sent;
+        }
+      }
+      return total;
+    }
+    
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Socket::send
+    //! Send the contents of a stream directly from its blocks
+    //!
+    //! \param[in] const& stream - Stream
+    //! \param[in] flags - [optional] Flags
+    //! \return int32_t - Number of bytes sent  (Less than requested only when asynchronous and the socket would block)
+    //! 
+    //! \throw wtl::socket_error - Failed to send data
+    //////////////////////////////////////////////////////////////////////////////////////////
+    int32_t send(const ChunkedStream& stream, int32_t flags = 0)
+    {
+      std::vector<BufferSegment> segments;
+      stream.segments([&segments] (const BufferSegment& s) { segments.push_back(s); });
+      return send(segments.data(), static_cast<uint32_t>(segments.size()), flags);
+    }
+    
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // Socket::transmitFile
+    //! Send a file from its current position without copying it through user memory
+    //!
+    //! \param[in] file - File handle
+    //! \param[in] length - [optional] Number of bytes to send, or zero to send the remainder of the file
+    //! 
+    //! \throw wtl::socket_error - Failed to send file
+    //////////////////////////////////////////////////////////////////////////////////////////
+    void transmitFile(::HANDLE file, uint32_t length = 0)
+    {
+      ::GUID guid = WSAID_TRANSMITFILE;
+      ::LPFN_TRANSMITFILE transmit = nullptr;
+      ::DWORD bytes = 0;
+
+      // Lookup extension function and send file
+      if (::WSAIoctl(handle(), SIO_GET_EXTENSION_FUNCTION_POINTER, &guid, sizeof(guid), &transmit, sizeof(transmit), &bytes, nullptr, nullptr) == SOCKET_ERROR
+       || !transmit(handle(), file, length, 0, nullptr, nullptr, 0))
+        throw socket_error(HERE, "Unable to transmit file");
+    }
+    
   };
 
 }
@@ -0,0 +1,181 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\SocketBufferPool.hpp
+//! \brief Provides a slab-allocated pool of fixed-size I/O buffers
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_SOCKET_BUFFER_POOL_HPP
+#define WTL_SOCKET_BUFFER_POOL_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/utils/Exception.hpp>            //!< invalid_argument
+#include <memory>                             //!< std::unique_ptr
+#include <mutex>                              //!< std::mutex
+#include <vector>                             //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct SocketBufferPool - Thread-safe pool of fixed-size I/O buffers, allocated in slabs
+  //!
+  //! \remarks Buffers are never returned to the heap until the pool is destroyed.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct SocketBufferPool
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = SocketBufferPool;
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Block - Buffer header, immediately followed by its data
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Block
+    {
+      Block*    Next;       //!< Next block in free-list or write queue
+      uint32_t  Begin;      //!< Offset of first unsent byte
+      uint32_t  End;        //!< Offset beyond last valid byte
+
+      uint8_t*  data()      { return reinterpret_cast<uint8_t*>(this + 1); }
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    mutable std::mutex                       Lock;           //!< Guards free-list and slabs
+    std::vector<std::unique_ptr<uint8_t[]>>  Slabs;          //!< Allocated slabs
+    Block*                                   Free;           //!< Free-list
+    size_t                                   Used;           //!< Number of blocks acquired
+    uint32_t const                           BlockSize;      //!< Capacity of each block, in bytes
+    uint32_t const                           SlabBlocks;     //!< Number of blocks per slab
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketBufferPool::SocketBufferPool
+    //! Create empty pool
+    //!
+    //! \param[in] blockSize - Capacity of each block, in bytes
+    //! \param[in] slabBlocks - [optional] Number of blocks allocated at once
+    //!
+    //! \throw wtl::invalid_argument - Block size or slab size is zero
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit SocketBufferPool(uint32_t blockSize, uint32_t slabBlocks = 64) : Free(nullptr),
+                                                                              Used(0),
+                                                                              BlockSize(blockSize),
+                                                                              SlabBlocks(slabBlocks)
+    {
+      if (!blockSize || !slabBlocks)
+        throw invalid_argument(HERE, "Block and slab sizes must be non-zero");
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(SocketBufferPool);      //!< Cannot be copied
+    DISABLE_MOVE(SocketBufferPool);      //!< Cannot be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketBufferPool::allocated const
+    //! Get the number of blocks allocated
+    //!
+    //! \return size_t - Number of blocks, whether free or in use
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t  allocated() const
+    {
+      std::lock_guard<std::mutex> lock(Lock);
+      return Slabs.size() * SlabBlocks;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketBufferPool::capacity const
+    //! Get the capacity of each block
+    //!
+    //! \return uint32_t - Number of bytes
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  capacity() const
+    {
+      return BlockSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketBufferPool::used const
+    //! Get the number of blocks in use
+    //!
+    //! \return size_t - Number of blocks acquired and not yet released
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t  used() const
+    {
+      std::lock_guard<std::mutex> lock(Lock);
+      return Used;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketBufferPool::acquire
+    //! Acquire an empty block
+    //!
+    //! \return Block* - Block  (Must be released to this pool)
+    //!
+    //! \throw std::bad_alloc - Unable to allocate slab
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Block*  acquire()
+    {
+      std::lock_guard<std::mutex> lock(Lock);
+      if (!Free)
+        grow();
+
+      Block* b = Free;
+      Free = b->Next;
+      b->Next = nullptr;
+      b->Begin = b->End = 0;
+      ++Used;
+      return b;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketBufferPool::release
+    //! Release a chain of blocks
+    //!
+    //! \param[in] *b - First block  (May be nullptr)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  release(Block* b)
+    {
+      std::lock_guard<std::mutex> lock(Lock);
+      while (b)
+      {
+        Block* next = b->Next;
+        b->Next = Free;
+        Free = b;
+        --Used;
+        b = next;
+      }
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketBufferPool::grow
+    //! Allocate another slab and add its blocks to the free-list  (Lock must be held)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  grow()
+    {
+      // Keep each block cache-line aligned relative to its slab
+      size_t const stride = (sizeof(Block) + BlockSize + 63) & ~size_t(63);
+      std::unique_ptr<uint8_t[]> slab(new uint8_t[stride * SlabBlocks]);
+
+      for (uint32_t i = SlabBlocks; i-- > 0; )
+      {
+        Block* b = reinterpret_cast<Block*>(slab.get() + i*stride);
+        b->Next = Free;
+        Free = b;
+      }
+      Slabs.push_back(std::move(slab));
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_SOCKET_BUFFER_POOL_HPP
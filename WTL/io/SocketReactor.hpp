@@ -0,0 +1,1349 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\SocketReactor.hpp
+//! \brief Provides an event-driven I/O loop for non-blocking sockets
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_SOCKET_REACTOR_HPP
+#define WTL_SOCKET_REACTOR_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/io/ChunkedStream.hpp>           //!< ChunkedStream, BufferSegment
+#include <wtl/io/SocketBufferPool.hpp>        //!< SocketBufferPool
+#include <wtl/utils/Exception.hpp>            //!< socket_error, logic_error
+#include <algorithm>                          //!< std::min
+#include <atomic>                             //!< std::atomic
+#include <cstring>                            //!< std::memcpy
+#include <deque>                              //!< std::deque
+#include <functional>                         //!< std::function
+#include <memory>                             //!< std::shared_ptr, std::unique_ptr
+#include <mutex>                              //!< std::mutex
+#include <thread>                             //!< std::thread
+#include <unordered_map>                      //!< std::unordered_map
+#include <vector>                             //!< std::vector
+#if defined(WTL_PORTABLE) && defined(__linux__)
+  #include <cerrno>                           //!< errno
+  #include <fcntl.h>                          //!< ::fcntl
+  #include <linux/errqueue.h>                 //!< sock_extended_err, SO_EE_ORIGIN_ZEROCOPY
+  #include <netinet/in.h>                     //!< IP_RECVERR, IPV6_RECVERR
+  #include <sys/epoll.h>                      //!< ::epoll_create1, ::epoll_ctl, ::epoll_wait
+  #include <sys/eventfd.h>                    //!< ::eventfd
+  #include <sys/sendfile.h>                   //!< ::sendfile
+  #include <sys/socket.h>                     //!< ::recv, ::sendmsg, ::accept4, ::shutdown
+  #include <unistd.h>                         //!< ::close
+  #define WTL_SOCKET_REACTOR_EPOLL
+#elif defined(WTL_PORTABLE)
+  #error SocketReactor requires the Winsock or Linux socket API
+#else
+  #include <winsock2.h>                       //!< WSARecv, WSASend
+  #include <mswsock.h>                        //!< AcceptEx, TransmitFile
+#endif
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct SocketReactor - Event-driven I/O loop for non-blocking stream sockets
+  //!
+  //! \remarks Sockets are serviced by a fixed set of I/O threads, using edge-triggered epoll on Linux and an I/O
+  //! \remarks completion port on Windows. Each connection reads into, and queues outbound data within, blocks drawn
+  //! \remarks from a shared slab pool.
+  //!
+  //! \remarks Receive, close and accept handlers execute upon an I/O thread, unless a dispatcher is supplied, in which
+  //! \remarks case they are marshalled through it in order, eg. to the GUI thread with [&pump](auto w) { pump.post(std::move(w)); }.
+  //! \remarks Data received by an I/O thread handler is only valid until the handler returns.
+  //!
+  //! \remarks Outbound data may be supplied as a gather list, as a ChunkedStream whose blocks are transferred to the
+  //! \remarks write queue, or as a file region sent by the kernel. Partial writes are continued internally.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct SocketReactor
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = SocketReactor;
+
+    //! \alias native_t - Native socket handle type
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+    using native_t = int;
+#else
+    using native_t = ::SOCKET;
+#endif
+
+    //! \var ListenEvents - Edge-triggered readiness for listeners  (epoll only)
+    //! \var ConnectionEvents - Edge-triggered readiness for connections  (epoll only)
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+    static constexpr uint32_t ListenEvents = uint32_t(EPOLLIN) | uint32_t(EPOLLET),
+                              ConnectionEvents = uint32_t(EPOLLIN) | uint32_t(EPOLLOUT) | uint32_t(EPOLLRDHUP) | uint32_t(EPOLLET);
+#else
+    static constexpr uint32_t ListenEvents = 0,
+                              ConnectionEvents = 0;
+#endif
+
+    //! \alias file_t - Native file handle type
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+    using file_t = int;
+#else
+    using file_t = ::HANDLE;
+#endif
+
+    //! \alias block_t - Buffer type
+    using block_t = SocketBufferPool::Block;
+
+    //! \alias work_t - Completion work item type
+    using work_t = std::function<void ()>;
+
+    //! \alias dispatch_t - Marshals completion work to another thread
+    using dispatch_t = std::function<void (work_t)>;
+
+    //! Forward declarations
+    struct Connection;
+
+    //! \alias accept_t - Accept handler  (Receives ownership of the accepted socket)
+    using accept_t = std::function<void (native_t)>;
+
+    //! \alias receive_t - Receive handler  (Data may be modified in-place, eg. by in-situ parsers)
+    using receive_t = std::function<void (Connection&, uint8_t*, uint32_t)>;
+
+    //! \alias close_t - Close handler  (Receives zero upon graceful closure, otherwise the socket error)
+    using close_t = std::function<void (Connection&, int32_t)>;
+
+#ifndef WTL_SOCKET_REACTOR_EPOLL
+    struct Source;
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Operation - Overlapped operation, which keeps its source alive until completion
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Operation : ::OVERLAPPED
+    {
+      std::shared_ptr<Source>  Pin;       //!< Source which issued the operation
+
+      void  reset(std::shared_ptr<Source> src)   { static_cast<::OVERLAPPED&>(*this) = {}; Pin = std::move(src); }
+    };
+#endif
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Source - Socket registered with the reactor
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Source : std::enable_shared_from_this<Source>
+    {
+      type&              Reactor;      //!< Owning reactor
+      native_t const     Handle;       //!< Socket  (Owned)
+      uint64_t const     Id;           //!< Registration key
+      std::atomic<bool>  Closed;       //!< Whether shutdown has begun
+
+      Source(type& r, native_t s, uint64_t id) : Reactor(r), Handle(s), Id(id), Closed(false)
+      {}
+
+      virtual ~Source()
+      {
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+        ::close(Handle);
+#else
+        ::closesocket(Handle);
+#endif
+      }
+
+      DISABLE_COPY(Source);      //!< Cannot be copied
+      DISABLE_MOVE(Source);      //!< Cannot be moved
+
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+      //! Service readiness events
+      virtual void  ready(uint32_t events) = 0;
+#else
+      //! Service completion of an operation
+      virtual void  complete(Operation& op, uint32_t bytes, uint32_t error) = 0;
+
+      //! Issue initial operations
+      virtual void  start() = 0;
+#endif
+      //! Deregister and notify the owner
+      virtual void  shutdown(int32_t error) = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Connection - Connected stream socket
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Connection : Source
+    {
+      friend type;
+
+      // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+    protected:
+      /////////////////////////////////////////////////////////////////////////////////////////
+      //! \struct Transfer - Queued outbound data: either a block, or a region of a file
+      /////////////////////////////////////////////////////////////////////////////////////////
+      struct Transfer
+      {
+        block_t*  Block;        //!< Block, or nullptr for a file region
+        file_t    File;         //!< File  (Owned)
+        uint64_t  Offset;       //!< Offset of first unsent byte of file
+        uint64_t  Length;       //!< Number of unsent bytes of file
+      };
+
+      // ----------------------------------- REPRESENTATION -----------------------------------
+    protected:
+      std::shared_ptr<SocketBufferPool>  Pool;         //!< Buffer pool
+      receive_t                          OnReceive;    //!< Receive handler
+      close_t                            OnClose;      //!< Close handler
+      block_t*                           Input;        //!< Receive buffer  (I/O thread only)
+      std::mutex                         ReadLock;     //!< Serializes receive edges across I/O threads
+      std::mutex                         WriteLock;    //!< Guards write queue
+      std::deque<Transfer>               Queue;        //!< Outbound data
+      size_t                             Queued;       //!< Number of queued outbound bytes
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+      bool                               ZeroCopy;     //!< Whether blocks are sent with MSG_ZEROCOPY
+      uint32_t                           ZeroCopyNext; //!< Identifier of the next zero-copy send
+      uint32_t                           ZeroCopyDone; //!< Every zero-copy send below this identifier has completed
+      std::deque<std::pair<uint32_t,block_t*>>      Retired;      //!< Sent blocks awaiting zero-copy completion, by send
+      std::vector<std::pair<uint32_t,uint32_t>>     Completions;  //!< Zero-copy completions received out of order
+#else
+      Operation                          ReadOp;       //!< Outstanding receive
+      Operation                          WriteOp;      //!< Outstanding send
+      bool                               Writing;      //!< Whether a send is outstanding
+      ::LPFN_TRANSMITFILE                TransmitFile; //!< Extension function
+#endif
+
+      // ------------------------------------ CONSTRUCTION ------------------------------------
+    public:
+      Connection(type& r, native_t s, uint64_t id, receive_t recv, close_t close) : Source(r, s, id),
+                                                                                   Pool(r.Pool),
+                                                                                   OnReceive(std::move(recv)),
+                                                                                   OnClose(std::move(close)),
+                                                                                   Input(nullptr),
+                                                                                   Queued(0)
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+                                                                                 , ZeroCopy(false),
+                                                                                   ZeroCopyNext(0),
+                                                                                   ZeroCopyDone(0)
+#else
+                                                                                 , Writing(false),
+                                                                                   TransmitFile(nullptr)
+#endif
+      {}
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::~Connection
+      //! Return buffers to the pool, close queued files and close the socket
+      /////////////////////////////////////////////////////////////////////////////////////////
+      ~Connection()
+      {
+        Pool->release(Input);
+        for (Transfer& t : Queue)
+          if (t.Block)
+            Pool->release(t.Block);
+          else
+            closeFile(t.File);
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+        for (auto& r : Retired)
+          Pool->release(r.second);
+#endif
+      }
+
+      // ----------------------------------- STATIC METHODS -----------------------------------
+    protected:
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::closeFile
+      //! Close a file handle
+      //!
+      //! \param[in] f - File
+      /////////////////////////////////////////////////////////////////////////////////////////
+      static void  closeFile(file_t f)
+      {
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+        ::close(f);
+#else
+        ::CloseHandle(f);
+#endif
+      }
+
+      // ---------------------------------- ACCESSOR METHODS ----------------------------------
+    public:
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::closed const
+      //! Query whether the connection has been closed
+      //!
+      //! \return bool - True once closed by either party
+      /////////////////////////////////////////////////////////////////////////////////////////
+      bool  closed() const
+      {
+        return this->Closed.load();
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::handle const
+      //! Get the native socket
+      //!
+      //! \return native_t - Socket  (Owned by the connection)
+      /////////////////////////////////////////////////////////////////////////////////////////
+      native_t  handle() const
+      {
+        return this->Handle;
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::pending
+      //! Get the amount of data waiting to be sent
+      //!
+      //! \return size_t - Number of queued bytes, including queued file regions
+      /////////////////////////////////////////////////////////////////////////////////////////
+      size_t  pending()
+      {
+        std::lock_guard<std::mutex> lock(WriteLock);
+        return Queued;
+      }
+
+      // ----------------------------------- MUTATOR METHODS ----------------------------------
+    public:
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::close
+      //! Close the connection  (The close handler receives zero)
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void  close()
+      {
+        shutdown(0);
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::send
+      //! Send data from any thread, queueing whatever cannot be sent immediately
+      //!
+      //! \param[in] const* data - Data
+      //! \param[in] length - Length of data, in bytes
+      //! \return bool - False if the connection is closed
+      /////////////////////////////////////////////////////////////////////////////////////////
+      bool  send(const void* data, size_t length)
+      {
+        BufferSegment seg = { static_cast<const byte*>(data), length };
+        return send(&seg, 1);
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::send
+      //! Send several buffers with a single vectored write, queueing whatever cannot be sent immediately
+      //!
+      //! \param[in] const* segments - Buffers
+      //! \param[in] count - Number of buffers
+      //! \return bool - False if the connection is closed
+      /////////////////////////////////////////////////////////////////////////////////////////
+      bool  send(const BufferSegment* segments, size_t count)
+      {
+        size_t  first = 0,      //!< First segment not entirely sent
+                skip = 0;       //!< Number of bytes of first segment already sent
+        int32_t error = 0;
+
+        if (closed())
+          return false;
+        {
+          std::lock_guard<std::mutex> lock(WriteLock);
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+          // [IDLE] Write directly from caller's buffers
+          while (Queue.empty() && first < count)
+          {
+            ::iovec iov[64];
+            size_t n = 0;
+            for (size_t k = first; k < count && n < 64; ++k, ++n)
+            {
+              iov[n].iov_base = const_cast<byte*>(segments[k].Data) + (k == first ? skip : 0);
+              iov[n].iov_len = segments[k].Length - (k == first ? skip : 0);
+            }
+
+            ::msghdr msg = {};
+            msg.msg_iov = iov;
+            msg.msg_iovlen = n;
+            ssize_t sent = ::sendmsg(this->Handle, &msg, int(MSG_NOSIGNAL));
+            if (sent < 0)
+            {
+              if (errno == EINTR)
+                continue;
+              if (errno != EAGAIN && errno != EWOULDBLOCK)
+                error = errno;
+              break;
+            }
+
+            // Advance past whatever was sent
+            for (size_t remaining = sent; ; ++first, skip = 0)
+            {
+              if (first == count || remaining < segments[first].Length - skip)
+              {
+                skip += remaining;
+                break;
+              }
+              remaining -= segments[first].Length - skip;
+            }
+          }
+#endif
+          // Queue remainder
+          if (!error)
+          {
+            for (; first < count; ++first, skip = 0)
+              enqueue(segments[first].Data + skip, segments[first].Length - skip);
+#ifndef WTL_SOCKET_REACTOR_EPOLL
+            error = transmit();
+#endif
+          }
+        }
+
+        if (error)
+          shutdown(error);
+        return !error;
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::send
+      //! Send the contents of a stream, transferring its blocks to the write queue without copying
+      //!
+      //! \param[in] &&stream - Stream  (Copied if its blocks belong to another pool)
+      //! \return bool - False if the connection is closed
+      /////////////////////////////////////////////////////////////////////////////////////////
+      bool  send(ChunkedStream&& stream)
+      {
+        int32_t error = 0;
+
+        // [FOREIGN] Copy
+        if (stream.pool() != Pool)
+        {
+          std::vector<BufferSegment> segments;
+          stream.segments([&segments] (const BufferSegment& s) { segments.push_back(s); });
+          bool const sent = send(segments.data(), segments.size());
+          stream.clear();
+          return sent;
+        }
+
+        if (closed())
+          return false;
+        {
+          std::lock_guard<std::mutex> lock(WriteLock);
+          for (block_t* b = stream.detach(), *next; b; b = next)
+          {
+            next = b->Next;
+            b->Next = nullptr;
+            if (b->End == b->Begin)
+              Pool->release(b);
+            else
+            {
+              Queue.push_back(Transfer{b, file_t(), 0, 0});
+              Queued += b->End - b->Begin;
+            }
+          }
+          error = transmit();
+        }
+
+        if (error)
+          shutdown(error);
+        return !error;
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::sendFile
+      //! Send a region of a file without copying it through user memory  (sendfile/TransmitFile)
+      //!
+      //! \param[in] file - File  (Ownership is transferred, it is closed once sent)
+      //! \param[in] offset - Offset of region
+      //! \param[in] length - Length of region, in bytes
+      //! \return bool - False if the connection is closed
+      /////////////////////////////////////////////////////////////////////////////////////////
+      bool  sendFile(file_t file, uint64_t offset, uint64_t length)
+      {
+        int32_t error = 0;
+
+        if (closed())
+        {
+          closeFile(file);
+          return false;
+        }
+        {
+          std::lock_guard<std::mutex> lock(WriteLock);
+          Queue.push_back(Transfer{nullptr, file, offset, length});
+          Queued += static_cast<size_t>(length);
+          error = transmit();
+        }
+
+        if (error)
+          shutdown(error);
+        return !error;
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::zeroCopy
+      //! Request that queued blocks are sent without copying them into the kernel  (Linux MSG_ZEROCOPY)
+      //!
+      //! \return bool - True if supported  (Only worthwhile for large transfers)
+      //!
+      //! \remarks Blocks are retained until the kernel reports their transmission. Data sent directly from the
+      //! \remarks caller's buffers is always copied.
+      /////////////////////////////////////////////////////////////////////////////////////////
+      bool  zeroCopy()
+      {
+#if defined(WTL_SOCKET_REACTOR_EPOLL) && defined(MSG_ZEROCOPY) && defined(SO_ZEROCOPY)
+        int one = 1;
+        std::lock_guard<std::mutex> lock(WriteLock);
+        return ZeroCopy = (::setsockopt(this->Handle, SOL_SOCKET, SO_ZEROCOPY, &one, sizeof(one)) == 0);
+#else
+        return false;
+#endif
+      }
+
+    protected:
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::deliver
+      //! Deliver received data from the input block
+      //!
+      //! \param[in] n - Number of bytes received
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void  deliver(uint32_t n)
+      {
+        // [I/O THREAD] Deliver in-place, then re-use block
+        if (!this->Reactor.Dispatch)
+        {
+          if (OnReceive)
+            OnReceive(*this, Input->data(), n);
+          return;
+        }
+
+        // [MARSHALLED] Transfer block to the handler
+        block_t* b = Input;
+        b->End = n;
+        Input = nullptr;
+
+        auto self = std::static_pointer_cast<Connection>(this->shared_from_this());
+        this->Reactor.Dispatch([self, b] {
+          if (self->OnReceive)
+            self->OnReceive(*self, b->data(), b->End);
+          self->Pool->release(b);
+        });
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::enqueue
+      //! Append a copy of data to the write queue  (WriteLock must be held)
+      //!
+      //! \param[in] const* data - Data
+      //! \param[in] length - Length of data, in bytes
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void  enqueue(const uint8_t* data, size_t length)
+      {
+        uint32_t const capacity = Pool->capacity();
+        Queued += length;
+
+        while (length)
+        {
+          if (Queue.empty() || !Queue.back().Block || Queue.back().Block->End == capacity)
+            Queue.push_back(Transfer{Pool->acquire(), file_t(), 0, 0});
+
+          block_t* tail = Queue.back().Block;
+          size_t n = std::min<size_t>(length, capacity - tail->End);
+          std::memcpy(tail->data() + tail->End, data, n);
+          tail->End += static_cast<uint32_t>(n);
+          data += n, length -= n;
+        }
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::consume
+      //! Remove sent data from the write queue  (WriteLock must be held)
+      //!
+      //! \param[in] n - Number of bytes sent
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void  consume(size_t n)
+      {
+        Queued -= n;
+        while (n)
+        {
+          Transfer& t = Queue.front();
+          size_t const avail = t.Block ? t.Block->End - t.Block->Begin : static_cast<size_t>(t.Length);
+          if (n < avail)
+          {
+            if (t.Block)
+              t.Block->Begin += static_cast<uint32_t>(n);
+            else
+              t.Offset += n, t.Length -= n;
+            return;
+          }
+          n -= avail;
+
+          // Release sent block or file
+          if (!t.Block)
+            closeFile(t.File);
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+          else if (ZeroCopyNext != ZeroCopyDone)
+            Retired.emplace_back(ZeroCopyNext - 1, t.Block);
+#endif
+          else
+            Pool->release(t.Block);
+          Queue.pop_front();
+        }
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::shutdown
+      //! Deregister from the reactor and notify the close handler  (Socket is closed upon destruction)
+      //!
+      //! \param[in] error - Socket error, or zero
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void  shutdown(int32_t error) override
+      {
+        if (this->Closed.exchange(true))
+          return;
+
+        auto self = std::static_pointer_cast<Connection>(this->shared_from_this());
+        this->Reactor.detach(*this);
+        this->Reactor.deliver([self, error] {
+          if (self->OnClose)
+            self->OnClose(*self, error);
+        });
+      }
+
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::ready
+      //! Service readiness edges
+      //!
+      //! \param[in] events - epoll events
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void  ready(uint32_t events) override
+      {
+        if (events & (uint32_t(EPOLLOUT) | uint32_t(EPOLLERR) | uint32_t(EPOLLHUP)))
+          flush();
+        if (events & (uint32_t(EPOLLIN) | uint32_t(EPOLLRDHUP) | uint32_t(EPOLLERR) | uint32_t(EPOLLHUP)))
+          receive();
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::flush
+      //! Reap zero-copy completions and send queued data until the socket would block
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void  flush()
+      {
+        int32_t error = 0;
+        {
+          std::lock_guard<std::mutex> lock(WriteLock);
+          if (ZeroCopyNext != ZeroCopyDone)
+            reap();
+          error = transmit();
+        }
+        if (error)
+          shutdown(error);
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::reap
+      //! Release blocks whose zero-copy sends have completed  (WriteLock must be held)
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void  reap()
+      {
+#if defined(MSG_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+        for (;;)
+        {
+          char control[128];
+          ::msghdr msg = {};
+          msg.msg_control = control;
+          msg.msg_controllen = sizeof(control);
+          if (::recvmsg(this->Handle, &msg, int(MSG_ERRQUEUE)) == -1)
+            break;
+
+          for (::cmsghdr* cm = CMSG_FIRSTHDR(&msg); cm; cm = CMSG_NXTHDR(&msg, cm))
+            if ((cm->cmsg_level == SOL_IP && cm->cmsg_type == IP_RECVERR) || (cm->cmsg_level == SOL_IPV6 && cm->cmsg_type == IPV6_RECVERR))
+            {
+              auto const* err = reinterpret_cast<const ::sock_extended_err*>(CMSG_DATA(cm));
+              if (err->ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+                continue;
+
+              // [COPIED] Kernel copied anyway, so stop paying for notifications
+              if (err->ee_code & SO_EE_CODE_ZEROCOPY_COPIED)
+                ZeroCopy = false;
+              Completions.emplace_back(err->ee_info, err->ee_data);
+            }
+        }
+
+        // Advance contiguous completion mark
+        for (bool merged = true; merged; )
+        {
+          merged = false;
+          for (auto c = Completions.begin(); c != Completions.end(); ++c)
+            if (c->first <= ZeroCopyDone)
+            {
+              ZeroCopyDone = std::max(ZeroCopyDone, c->second + 1);
+              Completions.erase(c);
+              merged = true;
+              break;
+            }
+        }
+
+        // Release blocks referenced only by completed sends
+        while (!Retired.empty() && Retired.front().first < ZeroCopyDone)
+        {
+          Pool->release(Retired.front().second);
+          Retired.pop_front();
+        }
+#endif
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::receive
+      //! Receive and deliver data until the socket would block  (Required by edge-triggering)
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void  receive()
+      {
+        std::lock_guard<std::mutex> lock(ReadLock);
+        while (!closed())
+        {
+          if (!Input)
+            Input = Pool->acquire();
+
+          ssize_t n = ::recv(this->Handle, Input->data(), Pool->capacity(), 0);
+          if (n > 0)
+            deliver(static_cast<uint32_t>(n));
+          else if (n == 0)
+            shutdown(0);
+          else if (errno == EAGAIN || errno == EWOULDBLOCK)
+            return;
+          else if (errno != EINTR)
+            shutdown(errno);
+        }
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::transmit
+      //! Send queued data until the socket would block  (WriteLock must be held)
+      //!
+      //! \return int32_t - Error code, or zero
+      /////////////////////////////////////////////////////////////////////////////////////////
+      int32_t  transmit()
+      {
+        while (!Queue.empty() && !closed())
+        {
+          Transfer& t = Queue.front();
+          ssize_t n;
+
+          // [FILE] Transfer within the kernel
+          if (!t.Block)
+          {
+            ::off_t offset = static_cast<::off_t>(t.Offset);
+            if ((n = ::sendfile(this->Handle, t.File, &offset, static_cast<size_t>(std::min<uint64_t>(t.Length, 1u << 30)))) == 0)
+              return EIO;
+          }
+          // [BLOCKS] Gather consecutive blocks into a single write
+          else
+          {
+            ::iovec iov[16];
+            size_t count = 0;
+            for (auto b = Queue.begin(); b != Queue.end() && b->Block && count < 16; ++b, ++count)
+            {
+              iov[count].iov_base = b->Block->data() + b->Block->Begin;
+              iov[count].iov_len = b->Block->End - b->Block->Begin;
+            }
+
+            ::msghdr msg = {};
+            msg.msg_iov = iov;
+            msg.msg_iovlen = count;
+#if defined(MSG_ZEROCOPY)
+            int const flags = int(MSG_NOSIGNAL) | (ZeroCopy ? int(MSG_ZEROCOPY) : 0);
+#else
+            int const flags = int(MSG_NOSIGNAL);
+#endif
+            // Kernel numbers each zero-copy send which transfers data
+            if ((n = ::sendmsg(this->Handle, &msg, flags)) > 0 && ZeroCopy)
+              ++ZeroCopyNext;
+          }
+
+          if (n >= 0)
+            consume(static_cast<size_t>(n));
+          else if (errno == EAGAIN || errno == EWOULDBLOCK)
+            return 0;
+          else if (errno == ENOBUFS && ZeroCopy)
+            ZeroCopy = false;
+          else if (errno != EINTR)
+            return errno;
+        }
+        return 0;
+      }
+#else
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::complete
+      //! Service completion of a receive or send
+      //!
+      //! \param[in] &op - Operation
+      //! \param[in] bytes - Number of bytes transferred
+      //! \param[in] error - Error code, or zero
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void  complete(Operation& op, uint32_t bytes, uint32_t error) override
+      {
+        // [RECEIVE] Deliver and re-issue
+        if (&op == &ReadOp)
+        {
+          if (error || bytes == 0)
+            shutdown(static_cast<int32_t>(error));
+          else if (!closed())
+          {
+            deliver(bytes);
+            read();
+          }
+          return;
+        }
+
+        // [SEND] Remove sent data and continue
+        if (!error)
+        {
+          std::lock_guard<std::mutex> lock(WriteLock);
+          consume(bytes);
+          Writing = false;
+          if (!closed())
+            error = transmit();
+        }
+        if (error)
+          shutdown(static_cast<int32_t>(error));
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::read
+      //! Issue an overlapped receive into the input block
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void  read()
+      {
+        if (!Input)
+          Input = Pool->acquire();
+
+        ::WSABUF buf = { Pool->capacity(), reinterpret_cast<char*>(Input->data()) };
+        ::DWORD flags = 0;
+        ReadOp.reset(this->shared_from_this());
+        ++this->Reactor.Outstanding;
+
+        if (::WSARecv(this->Handle, &buf, 1, nullptr, &flags, &ReadOp, nullptr) == SOCKET_ERROR && ::WSAGetLastError() != WSA_IO_PENDING)
+        {
+          int32_t error = ::WSAGetLastError();
+          --this->Reactor.Outstanding;
+          ReadOp.Pin.reset();
+          shutdown(error);
+        }
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::start
+      //! Issue the initial receive
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void  start() override
+      {
+        read();
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Connection::transmit
+      //! Issue an overlapped send of the queue head, unless one is outstanding  (WriteLock must be held)
+      //!
+      //! \return int32_t - Error code, or zero
+      /////////////////////////////////////////////////////////////////////////////////////////
+      int32_t  transmit()
+      {
+        if (Writing || Queue.empty())
+          return 0;
+
+        Transfer& t = Queue.front();
+        bool issued;
+
+        // [FILE] Transfer within the kernel
+        if (!t.Block)
+        {
+          ::GUID guid = WSAID_TRANSMITFILE;
+          ::DWORD bytes = 0;
+          if (!TransmitFile && ::WSAIoctl(this->Handle, SIO_GET_EXTENSION_FUNCTION_POINTER, &guid, sizeof(guid), &TransmitFile, sizeof(TransmitFile), &bytes, nullptr, nullptr) == SOCKET_ERROR)
+            return ::WSAGetLastError();
+
+          WriteOp.reset(this->shared_from_this());
+          WriteOp.Offset = static_cast<::DWORD>(t.Offset);
+          WriteOp.OffsetHigh = static_cast<::DWORD>(t.Offset >> 32);
+          ++this->Reactor.Outstanding;
+          issued = TransmitFile(this->Handle, t.File, static_cast<::DWORD>(std::min<uint64_t>(t.Length, 0x7FFFFFFE)), 0, &WriteOp, nullptr, 0)
+                || ::WSAGetLastError() == WSA_IO_PENDING;
+        }
+        // [BLOCKS] Gather consecutive blocks into a single send
+        else
+        {
+          ::WSABUF bufs[16];
+          ::DWORD count = 0;
+          for (auto b = Queue.begin(); b != Queue.end() && b->Block && count < 16; ++b, ++count)
+            bufs[count] = { b->Block->End - b->Block->Begin, reinterpret_cast<char*>(b->Block->data() + b->Block->Begin) };
+
+          WriteOp.reset(this->shared_from_this());
+          ++this->Reactor.Outstanding;
+          issued = ::WSASend(this->Handle, bufs, count, nullptr, 0, &WriteOp, nullptr) != SOCKET_ERROR
+                || ::WSAGetLastError() == WSA_IO_PENDING;
+        }
+
+        if (!issued)
+        {
+          int32_t error = ::WSAGetLastError();
+          --this->Reactor.Outstanding;
+          WriteOp.Pin.reset();
+          return error;
+        }
+        Writing = true;
+        return 0;
+      }
+#endif
+    };
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Listener - Listening socket
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Listener : Source
+    {
+      accept_t  OnAccept;      //!< Accept handler
+#ifndef WTL_SOCKET_REACTOR_EPOLL
+      Operation       AcceptOp;           //!< Outstanding accept
+      ::SOCKET        Accepted;           //!< Socket receiving the next connection
+      ::LPFN_ACCEPTEX AcceptEx;           //!< Extension function
+      uint8_t         Addresses[2 * (sizeof(::SOCKADDR_STORAGE) + 16)];     //!< Local and remote addresses
+#endif
+
+      Listener(type& r, native_t s, uint64_t id, accept_t accept) : Source(r, s, id),
+                                                                   OnAccept(std::move(accept))
+#ifndef WTL_SOCKET_REACTOR_EPOLL
+                                                                 , Accepted(INVALID_SOCKET),
+                                                                   AcceptEx(nullptr)
+#endif
+      {}
+
+#ifndef WTL_SOCKET_REACTOR_EPOLL
+      ~Listener()
+      {
+        if (Accepted != INVALID_SOCKET)
+          ::closesocket(Accepted);
+      }
+#endif
+
+      void  shutdown(int32_t) override
+      {
+        if (!this->Closed.exchange(true))
+          this->Reactor.detach(*this);
+      }
+
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Listener::ready
+      //! Accept connections until the socket would block
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void  ready(uint32_t) override
+      {
+        while (!this->Closed)
+        {
+          int s = ::accept4(this->Handle, nullptr, nullptr, int(SOCK_NONBLOCK) | int(SOCK_CLOEXEC));
+          if (s >= 0)
+          {
+            accept_t& fn = OnAccept;
+            this->Reactor.deliver([&fn, s, self = this->shared_from_this()] { fn(s); });
+          }
+          else if (errno != EINTR && errno != ECONNABORTED)
+            return;
+        }
+      }
+#else
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Listener::complete
+      //! Deliver an accepted connection and issue the next accept
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void  complete(Operation&, uint32_t, uint32_t error) override
+      {
+        if (this->Closed)
+          return;
+
+        if (!error)
+        {
+          ::SOCKET s = Accepted;
+          Accepted = INVALID_SOCKET;
+          ::setsockopt(s, SOL_SOCKET, SO_UPDATE_ACCEPT_CONTEXT, reinterpret_cast<const char*>(&this->Handle), sizeof(this->Handle));
+
+          accept_t& fn = OnAccept;
+          this->Reactor.deliver([&fn, s, self = this->shared_from_this()] { fn(s); });
+        }
+
+        try {
+          start();
+        }
+        catch (std::exception&) {
+          shutdown(0);
+        }
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Listener::start
+      //! Issue an overlapped accept
+      //!
+      //! \throw wtl::socket_error - Unable to create socket or issue accept
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void  start() override
+      {
+        ::SOCKADDR_STORAGE local = {};
+        int length = sizeof(local);
+        ::DWORD bytes = 0;
+
+        // Lookup AcceptEx and listener address family
+        if (!AcceptEx)
+        {
+          ::GUID guid = WSAID_ACCEPTEX;
+          if (::WSAIoctl(this->Handle, SIO_GET_EXTENSION_FUNCTION_POINTER, &guid, sizeof(guid), &AcceptEx, sizeof(AcceptEx), &bytes, nullptr, nullptr) == SOCKET_ERROR)
+            throw socket_error(HERE, "Unable to query AcceptEx");
+        }
+        if (::getsockname(this->Handle, reinterpret_cast<::SOCKADDR*>(&local), &length) == SOCKET_ERROR
+         || (Accepted = ::WSASocketW(local.ss_family, SOCK_STREAM, IPPROTO_TCP, nullptr, 0, WSA_FLAG_OVERLAPPED)) == INVALID_SOCKET)
+          throw socket_error(HERE, "Unable to create accept socket");
+
+        AcceptOp.reset(this->shared_from_this());
+        ++this->Reactor.Outstanding;
+        if (!AcceptEx(this->Handle, Accepted, Addresses, 0, sizeof(::SOCKADDR_STORAGE) + 16, sizeof(::SOCKADDR_STORAGE) + 16, &bytes, &AcceptOp)
+         && ::WSAGetLastError() != ERROR_IO_PENDING)
+        {
+          --this->Reactor.Outstanding;
+          AcceptOp.Pin.reset();
+          throw socket_error(HERE, "Unable to accept connections");
+        }
+      }
+#endif
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::shared_ptr<SocketBufferPool>                       Pool;           //!< Connection buffers
+    dispatch_t                                              Dispatch;       //!< Completion dispatcher, if any
+    std::mutex                                              Lock;           //!< Guards registrations
+    std::unordered_map<uint64_t, std::shared_ptr<Source>>   Sources;        //!< Registered sockets
+    uint64_t                                                NextId;         //!< Next registration key
+    std::atomic<bool>                                       Stopping;       //!< Whether shutdown has begun
+    std::vector<std::thread>                                Threads;        //!< I/O threads
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+    int                                                     Poll;           //!< epoll instance
+    int                                                     Wake;           //!< eventfd signalled upon shutdown
+#else
+    ::HANDLE                                                Port;           //!< I/O completion port
+    std::atomic<int32_t>                                    Outstanding;    //!< Number of overlapped operations in flight
+#endif
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::SocketReactor
+    //! Create reactor and start its I/O threads
+    //!
+    //! \param[in] threads - [optional] Number of I/O threads
+    //! \param[in] dispatcher - [optional] Marshals handlers to another thread  (Default executes upon I/O threads)
+    //! \param[in] blockSize - [optional] Capacity of each connection buffer, in bytes
+    //!
+    //! \throw wtl::invalid_argument - Zero threads or block size
+    //! \throw wtl::platform_error - Unable to create epoll instance or completion port
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit SocketReactor(uint32_t threads = 1, dispatch_t dispatcher = nullptr, uint32_t blockSize = 16384)
+      : Pool(std::make_shared<SocketBufferPool>(blockSize)),
+        Dispatch(std::move(dispatcher)),
+        NextId(1),
+        Stopping(false)
+#ifndef WTL_SOCKET_REACTOR_EPOLL
+      , Outstanding(0)
+#endif
+    {
+      if (!threads)
+        throw invalid_argument(HERE, "Reactor requires at least one I/O thread");
+
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+      if ((Poll = ::epoll_create1(EPOLL_CLOEXEC)) == -1)
+        throw platform_error(HERE, "Unable to create epoll instance");
+
+      // Level-triggered wake event releases every thread
+      ::epoll_event ev = {};
+      ev.events = EPOLLIN;
+      ev.data.u64 = 0;
+      if ((Wake = ::eventfd(0, int(EFD_CLOEXEC) | int(EFD_NONBLOCK))) == -1 || ::epoll_ctl(Poll, EPOLL_CTL_ADD, Wake, &ev) == -1)
+      {
+        ::close(Poll);
+        throw platform_error(HERE, "Unable to create reactor wake event");
+      }
+#else
+      if (!(Port = ::CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, threads)))
+        throw platform_error(HERE, "Unable to create I/O completion port");
+#endif
+
+      for (uint32_t i = 0; i < threads; ++i)
+        Threads.emplace_back([this] { run(); });
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(SocketReactor);      //!< Cannot be copied
+    DISABLE_MOVE(SocketReactor);      //!< Cannot be moved
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::~SocketReactor
+    //! Stop I/O threads and close every registered socket
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~SocketReactor()
+    {
+      stop();
+
+      // Close remaining sockets
+      std::vector<std::shared_ptr<Source>> remaining;
+      {
+        std::lock_guard<std::mutex> lock(Lock);
+        for (auto& s : Sources)
+          remaining.push_back(s.second);
+      }
+      for (auto& s : remaining)
+        s->shutdown(0);
+
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+      ::close(Wake);
+      ::close(Poll);
+#else
+      // Drain cancelled operations so their sources are released
+      while (Outstanding > 0)
+        if (!poll(100))
+          break;
+      ::CloseHandle(Port);
+#endif
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::buffers const
+    //! Get the connection buffer pool
+    //!
+    //! \return const SocketBufferPool& - Buffer pool
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const SocketBufferPool&  buffers() const
+    {
+      return *Pool;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::pool const
+    //! Get the connection buffer pool, eg. to create a ChunkedStream whose blocks can be sent without copying
+    //!
+    //! \return const std::shared_ptr<SocketBufferPool>& - Buffer pool
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const std::shared_ptr<SocketBufferPool>&  pool() const
+    {
+      return Pool;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::attach
+    //! Register a connected socket
+    //!
+    //! \param[in] s - Connected stream socket  (Ownership is transferred)
+    //! \param[in] recv - Receive handler
+    //! \param[in] close - [optional] Close handler
+    //! \return std::shared_ptr<Connection> - Connection
+    //!
+    //! \throw wtl::socket_error - Unable to register socket
+    /////////////////////////////////////////////////////////////////////////////////////////
+    std::shared_ptr<Connection>  attach(native_t s, receive_t recv, close_t close = nullptr)
+    {
+      auto conn = std::make_shared<Connection>(*this, s, nextId(), std::move(recv), std::move(close));
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+      if (::fcntl(s, F_SETFL, ::fcntl(s, F_GETFL) | O_NONBLOCK) == -1)
+        throw socket_error(HERE, "Unable to set non-blocking socket behaviour");
+#endif
+      attach(conn, ConnectionEvents);
+      return conn;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::listen
+    //! Register a listening socket
+    //!
+    //! \param[in] s - Bound, listening stream socket  (Ownership is transferred)
+    //! \param[in] accept - Accept handler  (Typically attaches the accepted socket)
+    //!
+    //! \throw wtl::socket_error - Unable to register socket
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  listen(native_t s, accept_t accept)
+    {
+      auto src = std::make_shared<Listener>(*this, s, nextId(), std::move(accept));
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+      if (::fcntl(s, F_SETFL, ::fcntl(s, F_GETFL) | O_NONBLOCK) == -1)
+        throw socket_error(HERE, "Unable to set non-blocking socket behaviour");
+#endif
+      attach(src, ListenEvents);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::stop
+    //! Stop and join the I/O threads  (Registered sockets remain open until destruction)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  stop()
+    {
+      if (Stopping.exchange(true))
+        return;
+
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+      uint64_t one = 1;
+      while (::write(Wake, &one, sizeof(one)) == -1 && errno == EINTR)
+        ;
+#else
+      for (size_t i = 0; i < Threads.size(); ++i)
+        ::PostQueuedCompletionStatus(Port, 0, 0, nullptr);
+#endif
+      for (auto& t : Threads)
+        if (t.joinable() && t.get_id() != std::this_thread::get_id())
+          t.join();
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::attach
+    //! Register a source and begin servicing it
+    //!
+    //! \param[in] src - Source
+    //! \param[in] events - epoll events  (Ignored by completion port)
+    //!
+    //! \throw wtl::socket_error - Unable to register socket
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  attach(std::shared_ptr<Source> src, uint32_t events)
+    {
+      if (Stopping)
+        throw logic_error(HERE, "Reactor has been stopped");
+      {
+        std::lock_guard<std::mutex> lock(Lock);
+        Sources.emplace(src->Id, src);
+      }
+
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+      ::epoll_event ev = {};
+      ev.events = events;
+      ev.data.u64 = src->Id;
+      if (::epoll_ctl(Poll, EPOLL_CTL_ADD, src->Handle, &ev) == -1)
+#else
+      if (::CreateIoCompletionPort(reinterpret_cast<::HANDLE>(src->Handle), Port, static_cast<::ULONG_PTR>(src->Id), 0) != Port)
+#endif
+      {
+        std::lock_guard<std::mutex> lock(Lock);
+        Sources.erase(src->Id);
+        throw socket_error(HERE, "Unable to register socket with reactor");
+      }
+
+#ifndef WTL_SOCKET_REACTOR_EPOLL
+      src->start();
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::deliver
+    //! Execute completion work upon the calling thread or via the dispatcher
+    //!
+    //! \param[in] fn - Work
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  deliver(work_t fn)
+    {
+      if (Dispatch)
+        Dispatch(std::move(fn));
+      else
+        fn();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::detach
+    //! Deregister a source, and cancel its outstanding operations
+    //!
+    //! \param[in] &src - Source
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  detach(Source& src)
+    {
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+      ::epoll_ctl(Poll, EPOLL_CTL_DEL, src.Handle, nullptr);
+      ::shutdown(src.Handle, SHUT_RDWR);
+#else
+      ::CancelIoEx(reinterpret_cast<::HANDLE>(src.Handle), nullptr);
+      ::shutdown(src.Handle, SD_BOTH);
+#endif
+      std::lock_guard<std::mutex> lock(Lock);
+      Sources.erase(src.Id);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::nextId
+    //! Generate a registration key
+    //!
+    //! \return uint64_t - Unique non-zero key
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t  nextId()
+    {
+      std::lock_guard<std::mutex> lock(Lock);
+      return NextId++;
+    }
+
+#ifdef WTL_SOCKET_REACTOR_EPOLL
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::run
+    //! Execute an I/O thread
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  run()
+    {
+      ::epoll_event events[64];
+
+      while (!Stopping)
+      {
+        int n = ::epoll_wait(Poll, events, 64, -1);
+
+        for (int i = 0; i < n && !Stopping; ++i)
+        {
+          // [WAKE] Stop
+          if (events[i].data.u64 == 0)
+            return;
+
+          // Retain source while servicing, it may be closed concurrently
+          std::shared_ptr<Source> src;
+          {
+            std::lock_guard<std::mutex> lock(Lock);
+            auto pos = Sources.find(events[i].data.u64);
+            if (pos != Sources.end())
+              src = pos->second;
+          }
+          if (src)
+            src->ready(events[i].events);
+        }
+      }
+    }
+#else
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::poll
+    //! Dequeue and service one completion
+    //!
+    //! \param[in] timeout - Timeout, in milliseconds
+    //! \return bool - False upon timeout or stop request
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  poll(::DWORD timeout)
+    {
+      ::DWORD bytes = 0;
+      ::ULONG_PTR key = 0;
+      ::OVERLAPPED* ov = nullptr;
+
+      ::BOOL ok = ::GetQueuedCompletionStatus(Port, &bytes, &key, &ov, timeout);
+      if (!ov)
+        return false;
+
+      // Release pin before servicing, the handler may re-issue the operation
+      Operation& op = static_cast<Operation&>(*ov);
+      std::shared_ptr<Source> src = std::move(op.Pin);
+      --Outstanding;
+      src->complete(op, bytes, ok ? 0 : ::GetLastError());
+      return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SocketReactor::run
+    //! Execute an I/O thread
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  run()
+    {
+      while (poll(INFINITE))
+        ;
+    }
+#endif
+  };
+
+} // namespace wtl
+
+#endif // WTL_SOCKET_REACTOR_HPP
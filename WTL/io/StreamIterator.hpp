@@ -56,7 +56,7 @@ namespace wtl
     //!
     //! \return StreamIterator& - Reference to self
     //////////////////////////////////////////////////////////////////////////////////////////
-	  StreamIterator& operator*() const
+	  StreamIterator& operator*()
 	  {
 		  return *this;
 	  }
@@ -67,7 +67,7 @@ namespace wtl
     //!
     //! \return StreamIterator& - Reference to self
     //////////////////////////////////////////////////////////////////////////////////////////
-	  StreamIterator& operator++() const
+	  StreamIterator& operator++()
 	  {
 		  return *this;
 	  }
@@ -79,7 +79,7 @@ namespace wtl
     //! \param[in] - Ignored
     //! \return StreamIterator& - Reference to self
     //////////////////////////////////////////////////////////////////////////////////////////
-	  StreamIterator& operator++(int) const
+	  StreamIterator& operator++(int)
 	  {
 		  return *this;
 	  }
@@ -0,0 +1,96 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\io\TextBuffer.hpp
+//! \brief Provides an unbounded output stream stored as a contiguous, null terminated character buffer
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_TEXT_BUFFER_HPP
+#define WTL_TEXT_BUFFER_HPP
+
+#include <wtl/WTL.hpp>
+#include <limits>                             //!< std::numeric_limits
+#include <string>                             //!< std::basic_string
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct TextBuffer - Output stream which appends characters to a contiguous buffer
+  //!
+  //! \tparam CHAR - Character type
+  //!
+  //! \remarks Satisfies the stream requirements of TextWriter. The contents are always null terminated.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename CHAR>
+  struct TextBuffer
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = TextBuffer<CHAR>;
+
+    //! \alias distance_t - Stream distance type
+    using distance_t = size_t;
+
+    //! \alias element_t - Stream element type
+    using element_t = CHAR;
+
+    //! \alias position_t - Stream position type
+    using position_t = size_t;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::basic_string<CHAR>  Buffer;      //!< Characters written
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TextBuffer::TextBuffer
+    //! Create empty stream
+    //!
+    //! \param[in] capacity - [optional] Initial capacity, in characters
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit TextBuffer(size_t capacity = 0)
+    {
+      Buffer.reserve(capacity);
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    ENABLE_COPY(TextBuffer);      //!< Can be deep copied
+    ENABLE_MOVE(TextBuffer);      //!< Can be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    //! Get the null terminated contents
+    const element_t*  begin() const      { return Buffer.c_str();                                 }
+
+    //! Get the number of elements which may be written  (Unbounded)
+    distance_t  remaining() const        { return std::numeric_limits<distance_t>::max();         }
+
+    //! Get the number of elements written
+    distance_t  used() const             { return Buffer.size();                                  }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    //! Discard the contents, retaining capacity
+    void  clear()                        { Buffer.clear();                                        }
+
+    //! Does nothing
+    void  flush()                        {}
+
+    //! Append a character
+    void  put(element_t ch)              { Buffer.push_back(ch);                                  }
+
+    //! Append a string
+    void  write(const element_t* str, size_t length)    { Buffer.append(str, length);             }
+
+    //! Append a string literal, excluding its null terminator
+    template <unsigned LENGTH>
+    void  write(const element_t (&str)[LENGTH])        { Buffer.append(str, LENGTH-1);           }
+  };
+
+} // namespace wtl
+
+#endif // WTL_TEXT_BUFFER_HPP
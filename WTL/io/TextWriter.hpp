@@ -10,6 +10,21 @@
 #define WTL_TEXT_WRITER_HPP
 
 #include <wtl/WTL.hpp>
+#include <wtl/utils/Exception.hpp>          //!< length_error
+#include <wtl/utils/Default.hpp>            //!< defvalue
+#include <wtl/utils/DynamicArray.hpp>       //!< Array
+#include <wtl/utils/FormatSpec.hpp>         //!< format_spec_t
+#include <wtl/utils/Range.hpp>              //!< delimited_range_t
+#include <wtl/utils/SFINAE.hpp>             //!< enable_if_enum_t
+#include <wtl/utils/chararray.hpp>          //!< CharArray
+#include <wtl/io/StreamIterator.hpp>        //!< StreamIterator
+#include <cstdarg>                          //!< va_list
+#include <cstdio>                           //!< std::vsnprintf
+#include <ostream>                          //!< std::basic_ostream
+#include <string>                           //!< std::char_traits
+#include <type_traits>                      //!< std::remove_reference_t
+#include <utility>                          //!< std::forward
+#include <vector>                           //!< std::vector
 
 //! \namespace wtl - Windows template library
 namespace wtl
@@ -18,7 +33,9 @@ namespace wtl
   //////////////////////////////////////////////////////////////////////////////////////////
 	//! \struct TextWriter - Writes formatted text to an output stream
   //! 
-  //! \tparam STREAM - Output stream type
+  //! \tparam STREAM - Output stream type  (eg. TextBuffer)
+  //!
+  //! \remarks The stream must provide 'put', 'write' and 'remaining', and additionally 'begin' for str() and 'used' for used()
   //////////////////////////////////////////////////////////////////////////////////////////
   template <typename STREAM>
   struct TextWriter 
@@ -100,24 +117,36 @@ namespace wtl
     //! Get the entire output as a null terminated string
     //! 
     //! \return const element_t* - Immutable pointer to start of stream
-    //! 
-    //! \throw wtl::logic_error - [Debug only] Stream has been closed
-    //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
     //////////////////////////////////////////////////////////////////////////////////////////
-    const element_t* str() 
+    const element_t* str() const
     {
-      CHECKED_LENGTH(1, remaining());
-
-      // Ensure null terminated
-      /*Stream.put(defvalue<element_t>());
-      Stream.seek(-1, FileSeek::Current);*/
-
-      // Return string
       return Stream.begin();
     }
+
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // TextWriter::stream const
+    //! Get the output stream
+    //! 
+    //! \return const stream_t& - Output stream
+    //////////////////////////////////////////////////////////////////////////////////////////
+    const stream_t& stream() const
+    {
+      return Stream;
+    }
     
     // ----------------------------------- MUTATOR METHODS ----------------------------------
   
+    //////////////////////////////////////////////////////////////////////////////////////////
+    // TextWriter::stream
+    //! Get the output stream
+    //! 
+    //! \return stream_t& - Output stream
+    //////////////////////////////////////////////////////////////////////////////////////////
+    stream_t& stream()
+    {
+      return Stream;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////
     // TextWriter::flush
     //! Flushes the output stream
@@ -140,14 +169,10 @@ namespace wtl
     //////////////////////////////////////////////////////////////////////////////////////////
     void write(element_t c)
     {
-      CHECKED_LENGTH(2, remaining());
+      CHECKED_LENGTH(1, remaining());
 
       // Write char 
       Stream.put(c);
-
-      // Null terminate
-      Stream.put(defvalue<element_t>());
-      Stream.seek(-1, FileSeek::Current);
     }
 
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -161,11 +186,11 @@ namespace wtl
     //////////////////////////////////////////////////////////////////////////////////////////
     void write(const element_t* str)
     {
-      CHECKED_LENGTH(strlen(str)+1, remaining());
+      const size_t length = std::char_traits<element_t>::length(str);
+      CHECKED_LENGTH(length, remaining());
 
-      // Write entire buffer to stream, then reverse over the null terminator
-      Stream.write(str, strlen(str)+1);
-      Stream.seek(-1, FileSeek::Current);
+      // Write string, excluding the null terminator
+      Stream.write(str, length);
     }
     
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -184,10 +209,6 @@ namespace wtl
 
       // Write to stream 
       Stream.write(str, length);
-      
-      // Null terminate then reverse over the null terminator
-      Stream.put(defvalue<element_t>());
-      Stream.seek(-1, FileSeek::Current);
     }
     
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -221,8 +242,7 @@ namespace wtl
     
     //////////////////////////////////////////////////////////////////////////////////////////
     // TextWriter::write
-    //! Optimized write for all elements of statically allocated array (eg. string literals)
-    //! If remaining stream capacity is exceeded, the results are undefined.
+    //! Optimized write for all elements of statically allocated array (eg. string literals), excluding the null terminator
     //! 
     //! \param[in] const (&)[] str - Statically allocated array of elements
     //! 
@@ -232,10 +252,10 @@ namespace wtl
     template <unsigned LENGTH>
     void write(const element_t (&str)[LENGTH])
     {
-      CHECKED_LENGTH(LENGTH, remaining());
+      CHECKED_LENGTH(LENGTH-1, remaining());
 
       // Write to stream
-      Stream.write(str);
+      Stream.write(str, LENGTH-1);
     }
     
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -256,7 +276,14 @@ namespace wtl
       va_start(args, format);
 
       // Format directly into stream
-      writevf(format, args);
+      try {
+        writevf(format, args);
+      }
+      catch (...) {
+        va_end(args);
+        throw;
+      }
+      va_end(args);
     }
     
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -271,18 +298,33 @@ namespace wtl
     //! \throw wtl::length_error - Formatted string would exceed buffer capacity
     //! \throw wtl::out_of_range - [Debug only] Initial stream position out of bounds
     //////////////////////////////////////////////////////////////////////////////////////////
-    void writevf(const element_t* format, va_list args)
+    void writevf(const char* format, va_list args)
     {
-      // Attempt to format directly into stream
-      int32_t capacity(Stream.remaining()),
-            written(vsnprintf(Stream.buffer(), capacity, format, args));
-
-      // Ensure successful
-      if (written < 0 || written >= capacity)
-        throw wtl::length_error(HERE, "Insufficient buffer space to format string");
+      char     buffer[128];     //!< Sufficient for any numeral
+      va_list  retry;
 
-      // Release stream
-      Stream.release(written);
+      // Format into local buffer
+      va_copy(retry, args);
+      int32_t written = std::vsnprintf(buffer, sizeof(buffer), format, args);
+      
+      // [ERROR] Throw
+      if (written < 0)
+      {
+        va_end(retry);
+        throw wtl::length_error(HERE, "Unable to format string");
+      }
+      
+      // [SUCCESS] Write to stream
+      if (written < static_cast<int32_t>(sizeof(buffer)))
+        write(buffer, written);
+      // [TRUNCATED] Format again into sufficient storage
+      else
+      {
+        std::vector<char> large(written + 1);
+        std::vsnprintf(large.data(), large.size(), format, retry);
+        write(large.data(), written);
+      }
+      va_end(retry);
     }
     
     /////////////////////////////////////////////////////////////////////////////////////////
@@ -314,10 +356,10 @@ namespace wtl
   //! 
   //! \param[in,out] &c - Debug console
   //! \param[in,out] &writer - Text writer
-  //! \return Console& - Reference to 'c'
+  //! \return std::basic_ostream<CHAR,TRAITS>& - Reference to 'c'
   //////////////////////////////////////////////////////////////////////////////////////////
-  template <typename STREAM>
-  Console& operator<< (Console& c, TextWriter<STREAM>& writer)
+  template <typename CHAR, typename TRAITS, typename STREAM>
+  std::basic_ostream<CHAR,TRAITS>& operator<< (std::basic_ostream<CHAR,TRAITS>& c, const TextWriter<STREAM>& writer)
   { 
     return c << writer.str();
   }
@@ -345,7 +387,7 @@ namespace wtl
   template <typename STREAM, typename ITERATOR>
   TextWriter<STREAM>& operator<< (TextWriter<STREAM>& w, const delimited_range_t<ITERATOR>& range) 
   {
-    delimit_range(w, range.First, range.Last, range.Delimiter);
+    delimit(StreamIterator<TextWriter<STREAM>>(w), range);
     return w;
   }
   
@@ -397,27 +439,6 @@ namespace wtl
 
   // --------------------------- COMMON --------------------------
 
-  //////////////////////////////////////////////////////////////////////////////////////////
-  // wtl::operator <<
-  //! Writes all elements of a statically allocated array to a stream as text
-  //! 
-  //! \tparam STREAM - Stream type
-  //! \tparam LENGTH - Array length
-  //!
-  //! \param[in,out] &w - Text writer
-  //! \param[in] const (&)[] str - String
-  //! \return TextWriter<STREAM>& - Reference to 'w'
-  //!
-  //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
-  //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
-  //////////////////////////////////////////////////////////////////////////////////////////
-  template <typename STREAM, unsigned LENGTH>
-  TextWriter<STREAM>& operator << (TextWriter<STREAM>& w, const typename STREAM::element_t (&str)[LENGTH])
-  {
-     w.write(str);
-     return w;
-  }
-  
   //////////////////////////////////////////////////////////////////////////////////////////
   // wtl::operator <<
   //! Writes a null terminated string to a stream as text
@@ -496,7 +517,7 @@ namespace wtl
   template <typename STREAM, typename U, typename = std::enable_if_t<std::is_integral<U>::value || std::is_floating_point<U>::value>>
   TextWriter<STREAM>& operator << (TextWriter<STREAM>& w, U val)
   {
-    w.writef(format_spec_t<U>::value, val);
+    w.writef(format_spec_t<char,U>::value, val);
     return w;
   }
   
@@ -514,7 +535,7 @@ namespace wtl
   //! \throw wtl::length_error - [Debug only] Insufficient stream buffer space
   //! \throw wtl::out_of_range - [Debug only] Stream position out of bounds
   //////////////////////////////////////////////////////////////////////////////////////////
-  template <typename STREAM, typename U, typename = enable_if_enum_t<U>>
+  template <typename STREAM, typename U, typename = enable_if_enum_t<U>, typename = void>
   TextWriter<STREAM>& operator << (TextWriter<STREAM>& w, U val)
   {
     // Write as a numeral accoring to underlying type
@@ -11,7 +11,13 @@
 
 #include <wtl/WTL.hpp>
 #include <wtl/utils/SFINAE.hpp>       //!< enable_if_floating_t
+#include <wtl/utils/Exception.hpp>    //!< domain_error
+#include <wtl/utils/chararray.hpp>    //!< CharArray
+#include <wtl/io/Console.hpp>         //!< cdebug, textcol
 #include "pugixml/pugixml.hpp"        //!< pugixml
+#include <cstdlib>                    //!< std::atof, std::atoi
+#include <sstream>                    //!< std::ostringstream
+#include <utility>                    //!< std::forward
 
 //! \namespace wtl - Windows template library
 namespace wtl
@@ -19,7 +25,9 @@ namespace wtl
   //////////////////////////////////////////////////////////////////////////////////////////
 	//! \struct XmlReader - Non-validating DOM XML reader. This class is now out of date and needs updating.
   //!
-  //! \tparam STREAM - Stream type
+  //! \tparam STREAM - Stream type providing mutable 'buffer' and 'remaining'  (eg. FrameView)
+  //!
+  //! \remarks The document is parsed in-place, so the stream contents are modified and must outlive the reader
   //////////////////////////////////////////////////////////////////////////////////////////
   template <typename STREAM>
   struct XmlReader 
@@ -61,7 +69,7 @@ namespace wtl
 
       // Query result
       if (!res)
-        throw wtl::domain_error(HERE, "Unable to parse xml: %s", res.description());
+        throw wtl::domain_error(HERE, "Unable to parse xml: ", res.description());
     }
     
     // -------------------------------- COPY, MOVE & DESTROY --------------------------------
@@ -153,7 +161,7 @@ namespace wtl
       //CHECKED_LENGTH(!n || (strlen(n.node().value()) < CharArray<LENGTH,char>::length));
 
       // Copy string into character array if node is valid
-      return sz.length() > 0 ? (str.assign(sz.c_str()), true) : false;
+      return sz.length() > 0 ? (str.assign(sz.c_str(), sz.c_str() + sz.length()), true) : false;
     }
 
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -178,9 +186,9 @@ namespace wtl
     //! \return bool - True if query succeeded, otherwise False
     //////////////////////////////////////////////////////////////////////////////////////////
     template <typename KEY>
-    bool getValue(KEY key, bool value) const
+    bool getValue(KEY key, bool& value) const
     {
-      CharArray<32> str;
+      CharArray<Encoding::UTF8,32> str;
       
       // Evaluate
       if (getString(key, str) && !str.empty())
@@ -218,10 +226,10 @@ namespace wtl
     template <typename KEY, typename T, typename = enable_if_floating_t<T>>
     bool getValue(KEY key, T& value) const
     {
-      CharArray<32> str;
+      CharArray<Encoding::UTF8,32> str;
       
       // Convert string, if present, to int and return true; otherwise return false
-      return getString(key, str) && !str.empty() ? (value = atof(str.c_str()), true) : false;
+      return getString(key, str) && !str.empty() ? (value = static_cast<T>(std::atof(str.c_str())), true) : false;
     }
 
     //////////////////////////////////////////////////////////////////////////////////////////
@@ -234,13 +242,13 @@ namespace wtl
     //! 
     //! \throw pugi::pugi_error - Query does not result in a string
     //////////////////////////////////////////////////////////////////////////////////////////
-    template <typename KEY, typename T, typename = enable_if_numeric_t<T>>
+    template <typename KEY, typename T, typename = enable_if_numeric_t<T>, typename = void>
     bool getValue(KEY key, T& value) const
     {
-      CharArray<32> str;
+      CharArray<Encoding::UTF8,32> str;
       
       // Convert string, if present, to int and return true; otherwise return false
-      return getString(key, str) && !str.empty() ? (value = atoi(str.c_str()), true) : false;
+      return getString(key, str) && !str.empty() ? (value = static_cast<T>(std::atoi(str.c_str())), true) : false;
     }
     
     
@@ -259,12 +267,12 @@ namespace wtl
 
           // Generate document with line breaks
           root.print(stream, " ");
-          cdebug_s << stream.str();
+          cdebug << stream.str();
         }
       }
       catch (std::exception& e) {
-        cdebug_s << Cons::Warning << "Unable to print invalid xml: "
-                 << Cons::Yellow << e.what();
+        cdebug << textcol::red << "Unable to print invalid xml: "
+               << textcol::yellow << e.what();
       }
     }
     
@@ -292,17 +300,21 @@ namespace wtl
   // wtl::operator <<
   //! Writes a formatted xml fragment to the debug console
   //! 
+  //! \tparam CHAR - Output stream character type
+  //! \tparam TRAITS - Output stream character traits
+  //! 
   //! \param[in,out] &c - Debug console
   //! \param[in,out] &reader - Xml reader
-  //! \return Console& - Reference to 'c'
+  //! \return std::basic_ostream<CHAR,TRAITS>& - Reference to 'c'
   //////////////////////////////////////////////////////////////////////////////////////////
-  inline Console& operator<< (Console& c, const pugi::xml_node& node)
+  template <typename CHAR, typename TRAITS>
+  std::basic_ostream<CHAR,TRAITS>& operator<< (std::basic_ostream<CHAR,TRAITS>& c, const pugi::xml_node& node)
   { 
-    static constexpr Cons colDelimiter = Cons::Grey,              //!< Delimiter colour
-                          colElement = Cons::Yellow,              //!< Element colour
-                          colAttribute = Cons::Yellow,            //!< Attribute name colour
-                          colComment = Cons::Grey,                //!< Comment colour
-                          colText = Cons::White;                  //!< Text and attribute value colour
+    const textcol::colour_t colDelimiter = textcol::grey,         //!< Delimiter colour
+                            colElement = textcol::yellow,         //!< Element colour
+                            colAttribute = textcol::yellow,       //!< Attribute name colour
+                            colComment = textcol::grey,           //!< Comment colour
+                            colText = textcol::white;             //!< Text and attribute value colour
 
     // Skip comments, text
     switch (node.type())
@@ -362,6 +374,10 @@ namespace wtl
           case pugi::node_cdata:
             c << n;
             break;
+
+          // [OTHER] Drop
+          default:
+            break;
           }
         
         // Indent closing tag
@@ -405,10 +421,10 @@ namespace wtl
   //! 
   //! \param[in,out] &c - Debug console
   //! \param[in,out] &reader - Xml reader
-  //! \return Console& - Reference to 'c'
+  //! \return std::basic_ostream<CHAR,TRAITS>& - Reference to 'c'
   //////////////////////////////////////////////////////////////////////////////////////////
-  template <typename STREAM>
-  Console& operator<< (Console& c, const XmlReader<STREAM>& reader)
+  template <typename CHAR, typename TRAITS, typename STREAM>
+  std::basic_ostream<CHAR,TRAITS>& operator<< (std::basic_ostream<CHAR,TRAITS>& c, const XmlReader<STREAM>& reader)
   { 
     // Print document from root
     return c << static_cast<const pugi::xml_node&>(reader.root()) << endl;
@@ -9,14 +9,19 @@
 #define WTL_MODULE_COLLECTION_HPP
 
 #include <wtl/WTL.hpp>
+#include <wtl/casts/EnumCast.hpp>           //!< enum_cast
 #include <wtl/utils/List.hpp>               //!< List
 #include <wtl/utils/Default.hpp>            //!< defvalue
 #include <wtl/traits/EncodingTraits.hpp>    //!< Encoding
 #include <wtl/resources/ResourceBlob.hpp>   //!< ResourceBlob
 #include <wtl/resources/ResourceId.hpp>     //!< ResourceId
+#include <wtl/resources/PeResourceIndex.hpp>  //!< PeResourceIndex
 #include <wtl/platform/SystemFlags.hpp>     //!< ResourceType
 #include <wtl/modules/Module.h>             //!< Module
+#include <algorithm>                        //!< std::find
+#include <atomic>                           //!< std::atomic
 #include <functional>                       //!< std::forward, std::reference_wrapper
+#include <string>                           //!< std::char_traits
 
 //! \namespace wtl - Windows template library
 namespace wtl
@@ -34,7 +39,10 @@ namespace wtl
   
     // ----------------------------------- REPRESENTATION -----------------------------------
   protected:
-    List<element_t>   Items;       //!< Module storage
+    List<element_t>        Items;        //!< Module storage
+    PeResourceIndex        Resources;    //!< Resources of every module, in order of precedence
+    bool                   Indexed;      //!< Whether the resources of every module are indexed
+    std::atomic<uint32_t>  Generation;   //!< Incremented whenever a module is added or removed
 
     // ------------------------------------ CONSTRUCTION ------------------------------------
   public:
@@ -42,9 +50,55 @@ namespace wtl
     // ModuleCollection::ModuleCollection
     //! Create empty collection
     /////////////////////////////////////////////////////////////////////////////////////////
-    ModuleCollection() = default;
+    ModuleCollection() : Indexed(true), Generation(0)
+    {}
 
     // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ModuleCollection::resourceName
+    //! Convert a resource identifier into a (case-insensitive) resource name
+    //! 
+    //! \tparam ENC - Resource name character encoding 
+    //!
+    //! \param[in] id - Resource identifier
+    //! \return ResourceName - Resource name
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <Encoding ENC>
+    static ResourceName  resourceName(ResourceId<ENC> id)
+    {
+      if (id.isOrdinal())
+        return ResourceName(id.toOrdinal());
+
+      return ResourceName(id.Value.Name, std::char_traits<encoding_char_t<ENC>>::length(id.Value.Name));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ModuleCollection::fallbackLanguages
+    //! Get the languages searched for resources of neutral language, in the order used by the resource loader
+    //! 
+    //! \param[out] &languages - Language ids
+    //! \return size_t - Number of distinct language ids
+    //!
+    //! \remarks Thread UI language, user UI language, system UI language, neutral, then English (United States)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static size_t  fallbackLanguages(uint16_t (&languages)[6])
+    {
+      uint16_t const preferred[6] = { ::GetThreadUILanguage(),
+                                      ::GetUserDefaultUILanguage(),
+                                      ::GetSystemDefaultUILanguage(),
+                                      MAKELANGID(LANG_NEUTRAL,SUBLANG_NEUTRAL),
+                                      MAKELANGID(LANG_NEUTRAL,SUBLANG_DEFAULT),
+                                      MAKELANGID(LANG_ENGLISH,SUBLANG_ENGLISH_US) };
+      size_t count = 0;
+
+      // Remove duplicates, preserving order
+      for (uint16_t lang : preferred)
+        if (std::find(languages, languages + count, lang) == languages + count)
+          languages[count++] = lang;
+
+      return count;
+    }
 
     // ---------------------------------- ACCESSOR METHODS ----------------------------------
   public:
@@ -52,6 +106,9 @@ namespace wtl
     // ModuleCollection::findResource
     //! Find a resource from any module in the collection
     //! 
+    //! \remarks Resources are looked up in the index of every module. Modules whose image could not be indexed,
+    //! \remarks and names of the form '#123', are searched using the resource API.
+    //! 
     //! \tparam ENC - Resource name character encoding 
     //!
     //! \param[in] type - Resource type
@@ -63,6 +120,23 @@ namespace wtl
     ResourceBlob  findResource(ResourceType type, ResourceId<ENC> name, LanguageId language = LanguageId::Neutral) const
     {
       ResourceBlob res;
+      const ResourceView* view;
+
+      // [INDEXED] Lookup resource view  (Neutral language follows the fallback order of the resource loader)
+      if (language == LanguageId::Neutral)
+      {
+        uint16_t languages[6];
+        view = Resources.find(ResourceName(static_cast<uint16_t>(enum_cast(type))), resourceName(name), languages, fallbackLanguages(languages));
+      }
+      else
+        view = Resources.find(ResourceName(static_cast<uint16_t>(enum_cast(type))), resourceName(name), language);
+
+      if (view)
+        return ResourceBlob(*view);
+      
+      // [NOT FOUND] Authoritative unless a module could not be indexed
+      if (Indexed && (name.isOrdinal() || name.Value.Name[0] != '#'))
+        return defvalue<ResourceBlob>();
 
       // Search all modules for resource
       for (const element_t& m : Items)
@@ -98,6 +172,19 @@ namespace wtl
       return findResource<ENC>(ResourceType::String, (id.Value.Numeral/16)+1, language);
     }
     
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ModuleCollection::generation const
+    //! Get the generation of the collection, which changes whenever a module is added or removed
+    //! 
+    //! \return uint32_t - Generation
+    //!
+    //! \remarks Caches of resources compare generations to detect resources that have become missing or unloaded
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  generation() const
+    {
+      return Generation.load(std::memory_order_acquire);
+    }
+    
     // ----------------------------------- MUTATOR METHODS ----------------------------------
     
     /////////////////////////////////////////////////////////////////////////////////////////
@@ -109,6 +196,8 @@ namespace wtl
     void  add(const Module& m)
     {
       Items.emplace_back(m);
+      Indexed &= index(m);
+      Generation.fetch_add(1, std::memory_order_release);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////
@@ -120,6 +209,32 @@ namespace wtl
     void  remove(const Module& m)
     {
       Items.remove_if( [&m] (const element_t& w) { return &w.get() == &m; } );
+
+      // Re-index remaining modules
+      Resources.clear();
+      Indexed = true;
+      for (const element_t& e : Items)
+        Indexed &= index(e.get());
+      Generation.fetch_add(1, std::memory_order_release);
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ModuleCollection::index
+    //! Index the resources of a module
+    //!
+    //! \param[in] const& m - Module
+    //! \return bool - True if indexed, false if image could not be parsed
+    //!
+    //! \remarks Modules loaded as data files (whose handles have low-order bits set) are laid out as on disk
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  index(const Module& m)
+    {
+      uintptr_t const handle = reinterpret_cast<uintptr_t>(m.handle().get());
+      const void* base = reinterpret_cast<const void*>(handle & ~uintptr_t(3));
+      auto const layout = (handle & 1) ? PeResourceIndex::Layout::File : PeResourceIndex::Layout::Image;
+
+      return base && Resources.add(base, PeResourceIndex::extent(base, layout), layout);
     }
   };
 
@@ -12,7 +12,7 @@
 #include <wtl/casts/EnumCast.hpp>               //!< EnumCast
 #include <wtl/utils/Handle.hpp>                 //!< Handle
 #include <wtl/traits/EncodingTraits.hpp>        //!< Encoding
-#include <wtl/traits/WindowTraits.hpp>          //!< HWnd
+#include <wtl/traits/windowtraits.hpp>          //!< HWnd
 #include <wtl/traits/MessageTraits.hpp>         //!< message_traits
 #include <wtl/platform/WindowMessage.hpp>       //!< WindowMessage
 #include <wtl/platform/MsgResult.hpp>           //!< MsgResult, MsgRoute
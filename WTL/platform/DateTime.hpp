@@ -13,7 +13,7 @@
 #include <wtl/platform/Locale.hpp>          //!< LocaleId
 #include <wtl/platform/SystemFlags.hpp>     //!< DateFlags
 #include <wtl/traits/EncodingTraits.hpp>    //!< Encoding
-#include <wtl/utils/CharArray.hpp>          //!< CharArray
+#include <wtl/utils/chararray.hpp>          //!< CharArray
 #include <wtl/utils/Zero.hpp>               //!< Zero
 
 //! \namespace wtl - Windows template library
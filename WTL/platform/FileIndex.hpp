@@ -0,0 +1,1105 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\platform\FileIndex.hpp
+//! \brief Provides a persistent file-tree index maintained from file system change notifications
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_FILE_INDEX_HPP
+#define WTL_FILE_INDEX_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/platform/FileTreeSearch.hpp>    //!< FileTreeSearch, FileEntry
+#include <wtl/utils/Exception.hpp>            //!< logic_error, domain_error, platform_error
+#include <algorithm>                          //!< std::copy, std::equal
+#include <istream>                            //!< std::istream
+#include <ostream>                            //!< std::ostream
+#include <string>                             //!< std::basic_string
+#include <unordered_map>                      //!< std::unordered_map, std::unordered_multimap
+#include <vector>                             //!< std::vector
+#ifdef WTL_FILE_TREE_GETDENTS
+  #include <poll.h>                           //!< ::poll
+  #include <sys/inotify.h>                    //!< ::inotify_init1
+#endif
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct FileIndex - Index of a file tree, kept up to date incrementally from change notifications
+  //!
+  //! \tparam ENC - Path character encoding  (Must be narrow on Linux)
+  //!
+  //! \remarks Entries are stored as nodes of a tree, linked to their parent and siblings, with names held in
+  //! \remarks a single arena. Paths are resolved through a hash of (parent, name). Files are also linked into
+  //! \remarks a list per extension, so prefix and extension queries never examine unrelated entries.
+  //!
+  //! \remarks Linux notifications use one inotify watch per folder. Windows notifications use a single
+  //! \remarks recursive ReadDirectoryChangesW request. If the notification queue overflows, the tree is rescanned.
+  //! \remarks Changes made while the initial scan is in progress may be missed until the next rescan.
+  //!
+  //! \remarks Not thread-safe. Snapshots use the native byte order and are only portable between builds with
+  //! \remarks the same encoding.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <Encoding ENC>
+  struct FileIndex
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var encoding - Encoding type
+    static constexpr Encoding encoding = ENC;
+
+    //! \alias type - Define own type
+    using type = FileIndex<encoding>;
+
+    //! \alias search_t - Enumerator type
+    using search_t = FileTreeSearch<encoding>;
+
+    //! \alias char_t - Encoding character type
+    using char_t = typename search_t::char_t;
+
+    //! \alias string_t - Path string type
+    using string_t = typename search_t::string_t;
+
+    //! \var separator - Path separator
+    static constexpr char_t separator = search_t::separator;
+
+    //! \var npos - Invalid node index
+    static constexpr uint32_t npos = ~0u;
+
+    //! \var SnapshotVersion - Snapshot format version
+    static constexpr uint32_t SnapshotVersion = 1;
+
+    //! \var MaxPath - Maximum length of a snapshot path or name, in characters
+    static constexpr uint32_t MaxPath = 32768;
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Node - Indexed entry
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Node
+    {
+      uint32_t  Parent;         //!< Parent folder, or npos for the root  (Free nodes link the free list via NextSibling)
+      uint32_t  FirstChild;     //!< First child, or npos
+      uint32_t  NextSibling;    //!< Next sibling, or npos
+      uint32_t  PrevSibling;    //!< Previous sibling, or npos
+      uint32_t  NextExt;        //!< Next file with the same extension, or npos
+      uint32_t  PrevExt;        //!< Previous file with the same extension, or npos
+      uint32_t  Name;           //!< Offset of name within arena
+      uint32_t  Length;         //!< Length of name, in characters
+      uint32_t  Attributes;     //!< Attributes  (FileEntry values)
+      uint64_t  Size;           //!< Size, in bytes
+      uint64_t  Modified;       //!< Last write time  (100-nanosecond intervals since 1601)
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Entry - Reference to an indexed entry
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Entry
+    {
+      const type*  Index;       //!< Index
+      uint32_t     Id;          //!< Node, or npos
+
+      explicit operator bool() const     { return Id != npos;                                                }
+      uint32_t  attributes() const       { return node().Attributes;                                         }
+      bool      isFolder() const         { return (node().Attributes & FileEntry::Directory) != 0;           }
+      uint64_t  modified() const         { return node().Modified;                                           }
+      string_t  name() const             { return string_t(Index->Names.data() + node().Name, node().Length); }
+      string_t  path() const             { return Index->path(Id);                                           }
+      uint64_t  size() const             { return node().Size;                                               }
+      const Node&  node() const          { return Index->Nodes[Id];                                          }
+    };
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Change - Notification translated to a relative path
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Change
+    {
+      bool      Removed;        //!< Whether the path was removed or renamed away, otherwise created or modified
+      string_t  Path;           //!< Path relative to root
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Record - Description of a single path
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Record
+    {
+      uint32_t  Attributes;     //!< Attributes
+      uint64_t  Size;           //!< Size, in bytes
+      uint64_t  Modified;       //!< Last write time
+    };
+
+#ifdef WTL_FILE_TREE_GETDENTS
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Monitor - Linux change notifications  (One inotify watch per folder)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Monitor
+    {
+      int                                 Handle = -1;    //!< inotify descriptor
+      std::unordered_map<int,uint32_t>    Watches;        //!< Folder node of each watch
+      std::unordered_map<uint32_t,int>    Folders;        //!< Watch of each folder node
+
+      ~Monitor()
+      {
+        close();
+      }
+
+      bool  active() const
+      {
+        return Handle != -1;
+      }
+
+      // Watch a folder
+      void  add(uint32_t node, const string_t& path)
+      {
+        uint32_t const mask = IN_CREATE|IN_DELETE|IN_MOVED_FROM|IN_MOVED_TO|IN_MODIFY|IN_ATTRIB|IN_CLOSE_WRITE|IN_ONLYDIR|IN_DONT_FOLLOW|IN_EXCL_UNLINK;
+        int const wd = ::inotify_add_watch(Handle, path.c_str(), mask);
+        if (wd != -1)
+        {
+          Watches[wd] = node;
+          Folders[node] = wd;
+        }
+      }
+
+      // Stop watching
+      void  close()
+      {
+        if (Handle != -1)
+          ::close(Handle);
+        Handle = -1;
+        Watches.clear();
+        Folders.clear();
+      }
+
+      // Stop watching a folder which has been removed from the index
+      void  forget(uint32_t node)
+      {
+        auto pos = Folders.find(node);
+        if (pos != Folders.end())
+        {
+          ::inotify_rm_watch(Handle, pos->second);
+          Watches.erase(pos->second);
+          Folders.erase(pos);
+        }
+      }
+
+      // Begin watching
+      bool  open()
+      {
+        close();
+        Handle = ::inotify_init1(static_cast<int>(IN_NONBLOCK) | static_cast<int>(IN_CLOEXEC));    // Enumerators, avoid wtl::operator|
+        return Handle != -1;
+      }
+
+      // Translate waiting notifications into changes, returns false if the queue overflowed
+      bool  read(const type& index, uint32_t timeout, std::vector<Change>& changes)
+      {
+        ::pollfd pfd = { Handle, POLLIN, 0 };
+        if (::poll(&pfd, 1, static_cast<int>(timeout)) <= 0)
+          return true;
+
+        alignas(::inotify_event) char buffer[65536];
+        for (ssize_t length; (length = ::read(Handle, buffer, sizeof(buffer))) > 0; )
+          for (ssize_t offset = 0; offset < length; )
+          {
+            auto const* ev = reinterpret_cast<const ::inotify_event*>(buffer + offset);
+            offset += sizeof(::inotify_event) + ev->len;
+
+            if (ev->mask & IN_Q_OVERFLOW)
+              return false;
+
+            // [IGNORED] Watch was removed by the kernel
+            if (ev->mask & IN_IGNORED)
+            {
+              auto pos = Watches.find(ev->wd);
+              if (pos != Watches.end())
+              {
+                Folders.erase(pos->second);
+                Watches.erase(pos);
+              }
+              continue;
+            }
+
+            auto pos = Watches.find(ev->wd);
+            if (pos == Watches.end() || ev->len == 0)
+              continue;
+
+            string_t path = index.path(pos->second);
+            if (!path.empty())
+              path += separator;
+            path += ev->name;
+            changes.push_back(Change{(ev->mask & (IN_DELETE|IN_MOVED_FROM)) != 0, std::move(path)});
+          }
+        return true;
+      }
+
+      // Get the waitable descriptor
+      int  handle() const
+      {
+        return Handle;
+      }
+    };
+#else
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Monitor - Win32 change notifications  (One recursive request upon the root)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Monitor
+    {
+      ::HANDLE      Folder = INVALID_HANDLE_VALUE;    //!< Root folder
+      ::OVERLAPPED  Overlapped = {};                  //!< Outstanding request
+      alignas(::DWORD) ::BYTE  Buffer[65536];         //!< Notification buffer
+
+      ~Monitor()
+      {
+        close();
+      }
+
+      bool  active() const
+      {
+        return Folder != INVALID_HANDLE_VALUE;
+      }
+
+      // Folders are watched recursively from the root
+      void  add(uint32_t, const string_t&)
+      {}
+
+      // Stop watching
+      void  close()
+      {
+        if (Folder != INVALID_HANDLE_VALUE)
+        {
+          ::CancelIo(Folder);
+          ::CloseHandle(Folder);
+          ::CloseHandle(Overlapped.hEvent);
+        }
+        Folder = INVALID_HANDLE_VALUE;
+      }
+
+      // Removed folders are no longer reported
+      void  forget(uint32_t)
+      {}
+
+      // Begin watching
+      bool  open(const string_t& root)
+      {
+        close();
+        Folder = WinAPI<encoding>::createFile(root.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ|FILE_SHARE_WRITE|FILE_SHARE_DELETE,
+                                              nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS|FILE_FLAG_OVERLAPPED, nullptr);
+        if (Folder == INVALID_HANDLE_VALUE)
+          return false;
+
+        Overlapped = ::OVERLAPPED {};
+        Overlapped.hEvent = ::CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        return request();
+      }
+
+      // Issue the next request
+      bool  request()
+      {
+        ::ResetEvent(Overlapped.hEvent);
+        return ::ReadDirectoryChangesW(Folder, Buffer, sizeof(Buffer), TRUE,
+                                       FILE_NOTIFY_CHANGE_FILE_NAME|FILE_NOTIFY_CHANGE_DIR_NAME|FILE_NOTIFY_CHANGE_ATTRIBUTES|FILE_NOTIFY_CHANGE_SIZE|FILE_NOTIFY_CHANGE_LAST_WRITE,
+                                       nullptr, &Overlapped, nullptr) != FALSE;
+      }
+
+      // Translate waiting notifications into changes, returns false if the buffer overflowed
+      bool  read(const type&, uint32_t timeout, std::vector<Change>& changes)
+      {
+        ::DWORD length = 0;
+        if (::WaitForSingleObject(Overlapped.hEvent, timeout) != WAIT_OBJECT_0)
+          return true;
+
+        // [OVERFLOW] Notifications were discarded
+        if (!::GetOverlappedResult(Folder, &Overlapped, &length, FALSE) || length == 0)
+        {
+          request();
+          return false;
+        }
+
+        for (auto const* info = reinterpret_cast<const ::FILE_NOTIFY_INFORMATION*>(Buffer); ;
+             info = reinterpret_cast<const ::FILE_NOTIFY_INFORMATION*>(reinterpret_cast<const ::BYTE*>(info) + info->NextEntryOffset))
+        {
+          bool const removed = info->Action == FILE_ACTION_REMOVED || info->Action == FILE_ACTION_RENAMED_OLD_NAME;
+          changes.push_back(Change{removed, convert(info->FileName, info->FileNameLength / sizeof(wchar_t))});
+          if (!info->NextEntryOffset)
+            break;
+        }
+        request();
+        return true;
+      }
+
+      // Convert a notification path to the index encoding
+      static string_t  convert(const wchar_t* str, size_t length)
+      {
+        if (std::is_same<char_t,wchar_t>::value)
+          return string_t(reinterpret_cast<const char_t*>(str), length);
+
+        string_t out(::WideCharToMultiByte(static_cast<::UINT>(encoding), 0, str, static_cast<int>(length), nullptr, 0, nullptr, nullptr), '\0');
+        ::WideCharToMultiByte(static_cast<::UINT>(encoding), 0, str, static_cast<int>(length), reinterpret_cast<char*>(&out[0]), static_cast<int>(out.size()), nullptr, nullptr);
+        return out;
+      }
+
+      // Get the waitable event
+      ::HANDLE  handle() const
+      {
+        return Overlapped.hEvent;
+      }
+    };
+#endif
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    string_t                                  Root;         //!< Absolute path of root, with trailing separator
+    std::vector<Node>                         Nodes;        //!< Nodes  (Node 0 is the root)
+    std::vector<char_t>                       Names;        //!< Name arena
+    std::unordered_multimap<uint64_t,uint32_t> Lookup;      //!< Nodes keyed by hash of (parent, name)
+    std::unordered_map<string_t,uint32_t>     Extensions;   //!< First file of each extension  (Folded on Windows)
+    uint32_t                                  Free;         //!< First free node, or npos
+    uint32_t                                  Count;        //!< Number of entries, excluding the root
+    size_t                                    Waste;        //!< Number of arena characters no longer referenced
+    Monitor                                   Changes;      //!< Change notifications
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::FileIndex
+    //! Create an empty index of a folder
+    //!
+    //! \param[in] root - Absolute path of folder
+    //!
+    //! \throw wtl::logic_error - Folder does not exist
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit FileIndex(string_t root) : Root(std::move(root))
+    {
+      Record r;
+      if (Root.empty() || Root.back() != separator)
+        Root += separator;
+
+      // Verify folder exists
+      if (!describe(Root, r) || !(r.Attributes & FileEntry::Directory))
+        throw logic_error(HERE, "Index folder does not exist");
+
+      reset();
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(FileIndex);      //!< Cannot be copied
+    DISABLE_MOVE(FileIndex);      //!< Cannot be moved  (Outstanding notification requests refer to the index)
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::describe
+    //! Query the attributes, size and time of a path
+    //!
+    //! \param[in] const& path - Absolute path
+    //! \param[in,out] &r - On return, description of path
+    //! \return bool - True if path exists
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static bool  describe(const string_t& path, Record& r)
+    {
+#ifdef WTL_FILE_TREE_GETDENTS
+      struct ::stat st;
+      if (::lstat(path.c_str(), &st) != 0)
+        return false;
+
+      r.Attributes = S_ISDIR(st.st_mode) ? FileEntry::Directory : S_ISLNK(st.st_mode) ? FileEntry::ReparsePoint : FileEntry::Normal;
+      if ((st.st_mode & 0222) == 0)
+        r.Attributes |= FileEntry::ReadOnly;
+
+      r.Size = S_ISDIR(st.st_mode) ? 0 : static_cast<uint64_t>(st.st_size);
+      r.Modified = (static_cast<uint64_t>(st.st_mtim.tv_sec) + 11644473600ULL) * 10000000ULL + st.st_mtim.tv_nsec / 100;
+#else
+      ::WIN32_FILE_ATTRIBUTE_DATA data;
+      string_t const target = (path.size() > 3 && path.back() == separator) ? path.substr(0, path.size()-1) : path;
+      if (!WinAPI<encoding>::getFileAttributesEx(target.c_str(), ::GetFileExInfoStandard, &data))
+        return false;
+
+      r.Attributes = data.dwFileAttributes;
+      r.Size = static_cast<uint64_t>(data.nFileSizeHigh) << 32 | data.nFileSizeLow;
+      r.Modified = static_cast<uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32 | data.ftLastWriteTime.dwLowDateTime;
+#endif
+      // Hidden names
+      size_t const name = path.find_last_of(separator, path.size() - 2);
+      if (path[name == string_t::npos ? 0 : name + 1] == '.')
+        r.Attributes |= FileEntry::Hidden;
+      return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::fold
+    //! Fold a character for comparison  (ASCII case is ignored on Windows)
+    //!
+    //! \param[in] c - Character
+    //! \return char_t - Folded character
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static char_t  fold(char_t c)
+    {
+#ifdef WTL_FILE_TREE_GETDENTS
+      return c;
+#else
+      return (c >= 'A' && c <= 'Z') ? static_cast<char_t>(c + ('a' - 'A')) : c;
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::key
+    //! Calculate the lookup key of a name within a folder
+    //!
+    //! \param[in] parent - Parent node
+    //! \param[in] const* name - Name
+    //! \param[in] length - Length of name
+    //! \return uint64_t - Key
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint64_t  key(uint32_t parent, const char_t* name, size_t length)
+    {
+      // FNV-1a
+      uint64_t hash = 0xCBF29CE484222325ULL ^ parent;
+      for (size_t i = 0; i < length; ++i)
+        hash = (hash ^ static_cast<uint64_t>(fold(name[i]))) * 0x100000001B3ULL;
+      return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::extensionOf
+    //! Get the folded extension of a name
+    //!
+    //! \param[in] const* name - Name
+    //! \param[in] length - Length of name
+    //! \return string_t - Extension without leading dot, or empty
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static string_t  extensionOf(const char_t* name, size_t length)
+    {
+      size_t dot = length;
+      while (dot != 0 && name[dot-1] != '.')
+        --dot;
+
+      string_t ext;
+      for (size_t i = dot; dot != 0 && i < length; ++i)
+        ext += fold(name[i]);
+      return ext;
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::extension const
+    //! Visit every file with an extension
+    //!
+    //! \tparam FN - Visitor type
+    //!
+    //! \param[in] const& ext - Extension without leading dot  (Case is ignored on Windows)
+    //! \param[in] fn - Visitor accepting an Entry
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename FN>
+    void  extension(const string_t& ext, FN fn) const
+    {
+      string_t const dotted = char_t('.') + ext;
+      auto const head = Extensions.find(extensionOf(dotted.c_str(), dotted.size()));
+      for (uint32_t id = (head != Extensions.end() ? head->second : npos); id != npos; id = Nodes[id].NextExt)
+        fn(Entry{this, id});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::find const
+    //! Find an entry
+    //!
+    //! \param[in] const& path - Path relative to root
+    //! \return Entry - Entry, which evaluates to false if not found
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Entry  find(const string_t& path) const
+    {
+      return Entry{this, resolve(path, path.size())};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::handle const
+    //! Get the waitable notification handle, to integrate with an event loop
+    //!
+    //! \return int/::HANDLE - inotify descriptor (Linux) or event (Windows), signalled when update() has work
+    /////////////////////////////////////////////////////////////////////////////////////////
+    auto  handle() const -> decltype(Changes.handle())
+    {
+      return Changes.handle();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::path const
+    //! Build the path of a node, relative to root
+    //!
+    //! \param[in] id - Node
+    //! \return string_t - Relative path  (Empty for the root)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    string_t  path(uint32_t id) const
+    {
+      // Measure then fill from the end
+      size_t length = 0;
+      for (uint32_t n = id; n != 0; n = Nodes[n].Parent)
+        length += Nodes[n].Length + 1;
+
+      string_t path(length ? length - 1 : 0, separator);
+      for (uint32_t n = id; n != 0; n = Nodes[n].Parent)
+      {
+        length -= Nodes[n].Length + 1;
+        std::copy(Names.begin() + Nodes[n].Name, Names.begin() + Nodes[n].Name + Nodes[n].Length, path.begin() + length);
+      }
+      return path;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::prefix const
+    //! Visit every entry whose relative path begins with a prefix
+    //!
+    //! \tparam FN - Visitor type
+    //!
+    //! \param[in] const& prefix - Relative path prefix  (eg. "src/ut" visits 'src/utils' and its descendants)
+    //! \param[in] fn - Visitor accepting an Entry
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename FN>
+    void  prefix(const string_t& prefix, FN fn) const
+    {
+      // Resolve folder containing the final partial name
+      size_t const split = prefix.find_last_of(separator);
+      uint32_t const folder = (split == string_t::npos ? 0 : resolve(prefix, split));
+      const char_t* partial = prefix.c_str() + (split == string_t::npos ? 0 : split + 1);
+      size_t const length = prefix.c_str() + prefix.size() - partial;
+
+      if (folder == npos)
+        return;
+
+      for (uint32_t child = Nodes[folder].FirstChild; child != npos; child = Nodes[child].NextSibling)
+      {
+        const Node& n = Nodes[child];
+        if (n.Length < length || !std::equal(partial, partial + length, Names.begin() + n.Name, [](char_t a, char_t b) { return fold(a) == fold(b); }))
+          continue;
+
+        // Visit child and its descendants
+        fn(Entry{this, child});
+        for (uint32_t id = n.FirstChild; id != npos && id != child; )
+        {
+          fn(Entry{this, id});
+
+          // Depth-first: descend, otherwise advance to next sibling of the nearest ancestor
+          if (Nodes[id].FirstChild != npos)
+            id = Nodes[id].FirstChild;
+          else
+          {
+            while (id != child && Nodes[id].NextSibling == npos)
+              id = Nodes[id].Parent;
+            id = (id == child ? child : Nodes[id].NextSibling);
+          }
+        }
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::root const
+    //! Get the absolute path of the indexed folder
+    //!
+    //! \return const string_t& - Absolute path, with trailing separator
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const string_t&  root() const
+    {
+      return Root;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::save const
+    //! Write a binary snapshot
+    //!
+    //! \param[in,out] &out - Binary output stream
+    //!
+    //! \throw wtl::platform_error - Stream failed
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  save(std::ostream& out) const
+    {
+      // Header: magic, version, character size, root
+      write<uint32_t>(out, 0x58444946);    // 'FIDX'
+      write<uint32_t>(out, SnapshotVersion);
+      write<uint32_t>(out, sizeof(char_t));
+      write<uint32_t>(out, static_cast<uint32_t>(Root.size()));
+      out.write(reinterpret_cast<const char*>(Root.data()), Root.size() * sizeof(char_t));
+      write<uint32_t>(out, Count);
+
+      // Entries in depth-first order, so parents precede children  (Parents are identified by ordinal)
+      std::vector<uint32_t> ordinal(Nodes.size(), uint32_t(npos));
+      uint32_t next = 0;
+      ordinal[0] = next++;
+      for (uint32_t id = Nodes[0].FirstChild; id != npos; )
+      {
+        const Node& n = Nodes[id];
+        ordinal[id] = next++;
+        write<uint32_t>(out, ordinal[n.Parent]);
+        write<uint32_t>(out, n.Attributes);
+        write<uint64_t>(out, n.Size);
+        write<uint64_t>(out, n.Modified);
+        write<uint32_t>(out, n.Length);
+        out.write(reinterpret_cast<const char*>(&Names[n.Name]), n.Length * sizeof(char_t));
+
+        if (n.FirstChild != npos)
+          id = n.FirstChild;
+        else
+        {
+          while (id != 0 && Nodes[id].NextSibling == npos)
+            id = Nodes[id].Parent;
+          id = (id == 0 ? npos : Nodes[id].NextSibling);
+        }
+      }
+
+      if (!out)
+        throw platform_error(HERE, "Unable to write file index snapshot");
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::size const
+    //! Get the number of entries
+    //!
+    //! \return uint32_t - Number of files and folders, excluding the root
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  size() const
+    {
+      return Count;
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::child const
+    //! Find a child by name
+    //!
+    //! \param[in] parent - Parent node
+    //! \param[in] const* name - Name
+    //! \param[in] length - Length of name
+    //! \return uint32_t - Child, or npos
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  child(uint32_t parent, const char_t* name, size_t length) const
+    {
+      auto range = Lookup.equal_range(key(parent, name, length));
+      for (auto pos = range.first; pos != range.second; ++pos)
+      {
+        const Node& n = Nodes[pos->second];
+        if (n.Parent == parent && n.Length == length
+         && std::equal(name, name + length, Names.begin() + n.Name, [](char_t a, char_t b) { return fold(a) == fold(b); }))
+          return pos->second;
+      }
+      return npos;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::resolve const
+    //! Resolve the leading characters of a relative path
+    //!
+    //! \param[in] const& path - Path relative to root
+    //! \param[in] length - Number of characters to resolve
+    //! \return uint32_t - Node, or npos if not found
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  resolve(const string_t& path, size_t length) const
+    {
+      uint32_t id = 0;
+      for (size_t start = 0; id != npos && start < length; )
+      {
+        size_t end = path.find(separator, start);
+        end = (end == string_t::npos || end > length ? length : end);
+        if (end != start)
+          id = child(id, path.c_str() + start, end - start);
+        start = end + 1;
+      }
+      return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::write
+    //! Write a value to a binary stream
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    static void  write(std::ostream& out, T value)
+    {
+      out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::load
+    //! Replace the contents with a binary snapshot
+    //!
+    //! \param[in,out] &in - Binary input stream
+    //!
+    //! \throw wtl::domain_error - Snapshot is malformed, from another version, or of another folder
+    //! \throw wtl::platform_error - Unable to resume watching the folder
+    //!
+    //! \remarks Changes made since the snapshot was saved are not reflected until the next rescan. An index which
+    //! \remarks was watching resumes watching, even if the snapshot is malformed (whereupon the index is left empty).
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  load(std::istream& in)
+    {
+      if (read<uint32_t>(in) != 0x58444946 || read<uint32_t>(in) != SnapshotVersion || read<uint32_t>(in) != sizeof(char_t))
+        throw domain_error(HERE, "Unrecognised file index snapshot");
+
+      uint32_t const rootLength = read<uint32_t>(in);
+      if (rootLength > MaxPath)
+        throw domain_error(HERE, "Truncated or corrupt file index snapshot");
+
+      string_t root(rootLength, '\0');
+      in.read(reinterpret_cast<char*>(&root[0]), root.size() * sizeof(char_t));
+      if (!in || root != Root)
+        throw domain_error(HERE, "File index snapshot describes another folder");
+
+      bool const watching = Changes.active();
+      reset();
+
+      // Entries in depth-first order  (Count is untrusted, so nodes grow as entries are read)
+      uint32_t const count = read<uint32_t>(in);
+      std::vector<uint32_t> nodes(1, 0);
+      std::vector<char_t> name;
+      bool valid = in && count < npos;
+
+      for (uint32_t i = 0; valid && i < count; ++i)
+      {
+        uint32_t const parent = read<uint32_t>(in);
+        Record r;
+        r.Attributes = read<uint32_t>(in);
+        r.Size = read<uint64_t>(in);
+        r.Modified = read<uint64_t>(in);
+        uint32_t const length = read<uint32_t>(in);
+
+        valid = in && length != 0 && length <= MaxPath && parent < nodes.size() && (Nodes[nodes[parent]].Attributes & FileEntry::Directory);
+        if (valid)
+        {
+          name.resize(length);
+          valid = !!in.read(reinterpret_cast<char*>(name.data()), name.size() * sizeof(char_t));
+        }
+        if (valid)
+          nodes.push_back(upsert(nodes[parent], name.data(), name.size(), r));
+      }
+
+      // [MALFORMED] Discard partial contents
+      if (!valid)
+        reset();
+
+      if (watching)
+        watch();
+
+      if (!valid)
+        throw domain_error(HERE, "Truncated or corrupt file index snapshot");
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::scan
+    //! Rebuild the index by enumerating the folder
+    //!
+    //! \param[in,out] &pool - [optional] Pool executing the enumeration  (Default is the shared pool)
+    //!
+    //! \throw wtl::logic_error - Folder no longer exists
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  scan(ThreadPool& pool = ThreadPool::shared())
+    {
+      bool const watching = Changes.active();
+      reset();
+      if (watching)
+        watch();
+      merge(0, pool);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::update
+    //! Apply pending change notifications
+    //!
+    //! \param[in] timeout - [optional] Maximum time to wait for a notification, in milliseconds
+    //! \param[in,out] &pool - [optional] Pool used to enumerate created folders  (Default is the shared pool)
+    //! \return uint32_t - Number of notifications applied
+    //!
+    //! \throw wtl::logic_error - Not watching
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  update(uint32_t timeout = 0, ThreadPool& pool = ThreadPool::shared())
+    {
+      std::vector<Change> changes;
+
+      if (!Changes.active())
+        throw logic_error(HERE, "File index is not watching for changes");
+
+      // [OVERFLOW] Rebuild
+      if (!Changes.read(*this, timeout, changes))
+      {
+        scan(pool);
+        return 1;
+      }
+
+      for (const Change& c : changes)
+      {
+        size_t const split = c.Path.find_last_of(separator);
+        uint32_t const parent = (split == string_t::npos ? 0 : resolve(c.Path, split));
+        const char_t* name = c.Path.c_str() + (split == string_t::npos ? 0 : split + 1);
+        size_t const length = c.Path.c_str() + c.Path.size() - name;
+        Record r;
+
+        // [UNKNOWN FOLDER] Ignore
+        if (parent == npos || length == 0)
+          continue;
+
+        // [REMOVED] Also removed if it no longer exists  (eg. when renamed twice before notification)
+        if (c.Removed || !describe(Root + c.Path, r))
+        {
+          uint32_t const id = child(parent, name, length);
+          if (id != npos)
+            remove(id);
+          continue;
+        }
+
+        // [CREATED/MODIFIED] Refresh, enumerate folders not previously known
+        bool const known = child(parent, name, length) != npos;
+        uint32_t const id = upsert(parent, name, length, r);
+        if (!known && (r.Attributes & FileEntry::Directory) && !(r.Attributes & FileEntry::ReparsePoint))
+          merge(id, pool);
+      }
+
+      // Reclaim arena once mostly unreferenced
+      if (Waste > Names.size() / 2)
+        compact();
+
+      return static_cast<uint32_t>(changes.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::watch
+    //! Begin receiving change notifications  (Call before scan() to minimise missed changes)
+    //!
+    //! \throw wtl::platform_error - Unable to watch folder
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  watch()
+    {
+#ifdef WTL_FILE_TREE_GETDENTS
+      if (!Changes.open())
+        throw platform_error(HERE, "Unable to create inotify instance");
+
+      // Watch all known folders
+      Changes.add(0, Root);
+      for (uint32_t id = 1; id < Nodes.size(); ++id)
+        if (Nodes[id].Parent != npos && (Nodes[id].Attributes & FileEntry::Directory) && !(Nodes[id].Attributes & FileEntry::ReparsePoint))
+          Changes.add(id, Root + path(id));
+#else
+      if (!Changes.open(Root))
+        throw platform_error(HERE, "Unable to watch folder for changes");
+#endif
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::compact
+    //! Rebuild the name arena without unreferenced names
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  compact()
+    {
+      std::vector<char_t> names;
+      names.reserve(Names.size() - Waste);
+      for (Node& n : Nodes)
+        if (n.Parent != npos)
+        {
+          names.insert(names.end(), Names.begin() + n.Name, Names.begin() + n.Name + n.Length);
+          n.Name = static_cast<uint32_t>(names.size() - n.Length);
+        }
+      Names.swap(names);
+      Waste = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::merge
+    //! Enumerate a folder and its descendants into the index
+    //!
+    //! \param[in] folder - Folder node
+    //! \param[in,out] &pool - Pool executing the enumeration
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  merge(uint32_t folder, ThreadPool& pool)
+    {
+      string_t const base = Root + path(folder);
+      typename search_t::batch_t batch;
+      search_t search(base, FileFilter<char_t>(), pool);
+
+      while (search.next(batch))
+      {
+        // Resolve folder, creating placeholders if the parent's batch has not arrived
+        uint32_t parent = folder;
+        for (size_t start = base.size() + (folder != 0), end; start < batch.Folder->size(); start = end + 1)
+        {
+          end = batch.Folder->find(separator, start);
+          uint32_t const id = child(parent, batch.Folder->c_str() + start, end - start);
+          parent = (id != npos ? id : upsert(parent, batch.Folder->c_str() + start, end - start, Record{FileEntry::Directory, 0, 0}));
+        }
+
+        for (const FileEntry& e : batch.Entries)
+          upsert(parent, batch.name(e), e.Length, Record{e.Attributes, e.Size, e.Modified});
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::read
+    //! Read a value from a binary stream
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    static T  read(std::istream& in)
+    {
+      T value = T();
+      in.read(reinterpret_cast<char*>(&value), sizeof(T));
+      return value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::remove
+    //! Remove an entry and its descendants
+    //!
+    //! \param[in] id - Node
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  remove(uint32_t id)
+    {
+      // Unlink from parent
+      Node& top = Nodes[id];
+      (top.PrevSibling != npos ? Nodes[top.PrevSibling].NextSibling : Nodes[top.Parent].FirstChild) = top.NextSibling;
+      if (top.NextSibling != npos)
+        Nodes[top.NextSibling].PrevSibling = top.PrevSibling;
+      top.NextSibling = npos;
+
+      // Release descendants depth-first
+      for (std::vector<uint32_t> stack(1, id); !stack.empty(); )
+      {
+        uint32_t const n = stack.back();
+        stack.pop_back();
+        for (uint32_t c = Nodes[n].FirstChild; c != npos; c = Nodes[c].NextSibling)
+          stack.push_back(c);
+        release(n);
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::release
+    //! Return an unlinked node to the free list
+    //!
+    //! \param[in] id - Node
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  release(uint32_t id)
+    {
+      Node& n = Nodes[id];
+      const char_t* name = &Names[n.Name];
+
+      // Remove from lookup
+      auto range = Lookup.equal_range(key(n.Parent, name, n.Length));
+      for (auto pos = range.first; pos != range.second; ++pos)
+        if (pos->second == id)
+        {
+          Lookup.erase(pos);
+          break;
+        }
+
+      // Remove from extension list
+      if (!(n.Attributes & FileEntry::Directory))
+      {
+        if (n.PrevExt != npos)
+          Nodes[n.PrevExt].NextExt = n.NextExt;
+        else
+        {
+          auto head = Extensions.find(extensionOf(name, n.Length));
+          if (n.NextExt != npos)
+            head->second = n.NextExt;
+          else
+            Extensions.erase(head);
+        }
+        if (n.NextExt != npos)
+          Nodes[n.NextExt].PrevExt = n.PrevExt;
+      }
+      else
+        Changes.forget(id);
+
+      Waste += n.Length;
+      --Count;
+      n.Parent = npos;
+      n.NextSibling = Free;
+      Free = id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::reset
+    //! Remove all entries and stop watching
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  reset()
+    {
+      Changes.close();
+      Nodes.assign(1, Node{npos, npos, npos, npos, npos, npos, 0, 0, FileEntry::Directory, 0, 0});
+      Names.clear();
+      Lookup.clear();
+      Extensions.clear();
+      Free = npos;
+      Count = 0;
+      Waste = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileIndex::upsert
+    //! Insert or update an entry
+    //!
+    //! \param[in] parent - Parent folder node
+    //! \param[in] const* name - Name
+    //! \param[in] length - Length of name
+    //! \param[in] const& r - Description
+    //! \return uint32_t - Node
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  upsert(uint32_t parent, const char_t* name, size_t length, const Record& r)
+    {
+      uint32_t id = child(parent, name, length);
+
+      // [EXISTING] Update description, replacing the entry if it changed between file and folder
+      if (id != npos)
+      {
+        Node& n = Nodes[id];
+        if (((n.Attributes ^ r.Attributes) & FileEntry::Directory) == 0)
+        {
+          n.Attributes = r.Attributes;
+          n.Size = r.Size;
+          n.Modified = r.Modified;
+          return id;
+        }
+        remove(id);
+      }
+
+      // Allocate node
+      uint32_t const offset = static_cast<uint32_t>(Names.size());
+      Names.insert(Names.end(), name, name + length);
+      if (Free != npos)
+      {
+        id = Free;
+        Free = Nodes[id].NextSibling;
+      }
+      else
+      {
+        id = static_cast<uint32_t>(Nodes.size());
+        Nodes.emplace_back();
+      }
+
+      // Link as first child
+      Node& n = Nodes[id];
+      n = Node{parent, npos, Nodes[parent].FirstChild, npos, npos, npos, offset, static_cast<uint32_t>(length), r.Attributes, r.Size, r.Modified};
+      if (n.NextSibling != npos)
+        Nodes[n.NextSibling].PrevSibling = id;
+      Nodes[parent].FirstChild = id;
+      Lookup.emplace(key(parent, &Names[offset], length), id);
+      ++Count;
+
+      // [FILE] Link as first of extension  [FOLDER] Watch
+      if (!(r.Attributes & FileEntry::Directory))
+      {
+        auto head = Extensions.emplace(extensionOf(&Names[offset], length), id);
+        if (!head.second)
+        {
+          Nodes[id].NextExt = head.first->second;
+          Nodes[head.first->second].PrevExt = id;
+          head.first->second = id;
+        }
+      }
+      else if (Changes.active() && !(r.Attributes & FileEntry::ReparsePoint))
+        Changes.add(id, Root + path(id));
+
+      return id;
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_FILE_INDEX_HPP
@@ -0,0 +1,871 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\platform\FileTreeSearch.hpp
+//! \brief Provides a parallel, recursive file system enumerator
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_FILE_TREE_SEARCH_HPP
+#define WTL_FILE_TREE_SEARCH_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/traits/EncodingTraits.hpp>      //!< Encoding, encoding_char_t
+#include <wtl/threads/ThreadPool.hpp>         //!< ThreadPool
+#include <wtl/utils/Exception.hpp>            //!< logic_error
+#include <atomic>                             //!< std::atomic
+#include <condition_variable>                 //!< std::condition_variable
+#include <cstring>                            //!< std::strlen
+#include <deque>                              //!< std::deque
+#include <iterator>                           //!< std::input_iterator_tag
+#include <memory>                             //!< std::shared_ptr
+#include <mutex>                              //!< std::mutex
+#include <string>                             //!< std::basic_string
+#include <vector>                             //!< std::vector
+#if defined(WTL_PORTABLE) && defined(__linux__)
+  #include <dirent.h>                         //!< DT_DIR, DT_LNK
+  #include <fcntl.h>                          //!< ::open
+  #include <sys/stat.h>                       //!< ::fstatat
+  #include <sys/syscall.h>                    //!< SYS_getdents64
+  #include <unistd.h>                         //!< ::syscall, ::close
+  #define WTL_FILE_TREE_GETDENTS
+#elif defined(WTL_PORTABLE)
+  #error FileTreeSearch requires the Win32 or Linux file system API
+#elif !defined(FIND_FIRST_EX_LARGE_FETCH)
+  #define FIND_FIRST_EX_LARGE_FETCH   0x00000002      //!< Windows 7 and above
+#endif
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct FileFilter - Selects the files reported by a file tree search
+  //!
+  //! \tparam CHR - Character type
+  //!
+  //! \remarks Files are reported if they match any glob pattern ('*' and '?') and any extension. An empty
+  //! \remarks set of patterns or extensions matches everything. Folders are always searched, but are only
+  //! \remarks reported when requested, regardless of the patterns.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename CHR>
+  struct FileFilter
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = FileFilter<CHR>;
+
+    //! \alias char_t - Character type
+    using char_t = CHR;
+
+    //! \alias string_t - String type
+    using string_t = std::basic_string<char_t>;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::vector<string_t>  Patterns;        //!< Glob patterns
+    std::vector<string_t>  Extensions;      //!< Extensions, without the leading dot
+    bool                   Folders;         //!< Whether to report folders
+    bool                   CaseSensitive;   //!< Whether matching is case sensitive
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileFilter::FileFilter
+    //! Create filter which reports all files and folders
+    /////////////////////////////////////////////////////////////////////////////////////////
+    FileFilter() : Folders(true),
+#ifdef WTL_FILE_TREE_GETDENTS
+                   CaseSensitive(true)
+#else
+                   CaseSensitive(false)
+#endif
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    ENABLE_COPY(FileFilter);      //!< Can be copied
+    ENABLE_MOVE(FileFilter);      //!< Can be moved
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileFilter::glob
+    //! Query whether a name matches a glob pattern
+    //!
+    //! \param[in] const* pattern - Null terminated pattern  ('*' matches any run of characters, '?' any one character)
+    //! \param[in] const* name - Name
+    //! \param[in] length - Length of name, in characters
+    //! \param[in] caseSensitive - Whether matching is case sensitive  (Otherwise ASCII letters are folded)
+    //! \return bool - True if matched
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static bool  glob(const char_t* pattern, const char_t* name, size_t length, bool caseSensitive)
+    {
+      const char_t *star = nullptr,          //!< Position beyond most recent '*'
+                   *retry = nullptr;         //!< Name position to resume from if the text after '*' fails
+      const char_t *pos = name,
+                   *end = name + length;
+
+      while (pos != end)
+      {
+        // [ANY] Remember position then match nothing
+        if (*pattern == '*')
+        {
+          star = ++pattern;
+          retry = pos;
+        }
+        // [ONE/LITERAL] Consume one character
+        else if (*pattern && (*pattern == '?' || equal(*pattern, *pos, caseSensitive)))
+        {
+          ++pattern;
+          ++pos;
+        }
+        // [MISMATCH] Extend the most recent '*' by one character
+        else if (star)
+        {
+          pattern = star;
+          pos = ++retry;
+        }
+        else
+          return false;
+      }
+
+      // Trailing '*' match the empty remainder
+      while (*pattern == '*')
+        ++pattern;
+      return *pattern == '\0';
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileFilter::equal
+    //! Compare two characters
+    //!
+    //! \param[in] a - First character
+    //! \param[in] b - Second character
+    //! \param[in] caseSensitive - Whether to fold ASCII letters
+    //! \return bool - True if equal
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static bool  equal(char_t a, char_t b, bool caseSensitive)
+    {
+      if (a == b)
+        return true;
+      if (caseSensitive)
+        return false;
+
+      // Fold ASCII letters to lowercase
+      auto fold = [](char_t c) { return (c >= 'A' && c <= 'Z') ? static_cast<char_t>(c + ('a' - 'A')) : c; };
+      return fold(a) == fold(b);
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileFilter::folders const
+    //! Query whether folders are reported
+    //!
+    //! \return bool - True if folders are reported
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  folders() const
+    {
+      return Folders;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileFilter::matches const
+    //! Query whether a file name is selected
+    //!
+    //! \param[in] const* name - Name
+    //! \param[in] length - Length of name, in characters
+    //! \return bool - True if selected
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  matches(const char_t* name, size_t length) const
+    {
+      // [EXTENSIONS] Compare text beyond the final dot
+      if (!Extensions.empty())
+      {
+        size_t dot = length;
+        while (dot != 0 && name[dot-1] != '.')
+          --dot;
+
+        bool found = false;
+        for (auto ext = Extensions.begin(); dot != 0 && !found && ext != Extensions.end(); ++ext)
+          found = ext->length() == length - dot && glob(ext->c_str(), name + dot, length - dot, CaseSensitive);
+
+        if (!found)
+          return false;
+      }
+
+      // [PATTERNS] Match any
+      if (Patterns.empty())
+        return true;
+
+      for (const auto& p : Patterns)
+        if (glob(p.c_str(), name, length, CaseSensitive))
+          return true;
+
+      return false;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileFilter::caseSensitive
+    //! Set whether matching is case sensitive  (Default is true on Linux, otherwise false)
+    //!
+    //! \param[in] enable - Whether matching is case sensitive
+    //! \return type& - Reference to self
+    /////////////////////////////////////////////////////////////////////////////////////////
+    type&  caseSensitive(bool enable)
+    {
+      CaseSensitive = enable;
+      return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileFilter::extension
+    //! Add an extension
+    //!
+    //! \param[in] const& ext - Extension without leading dot  (eg. "hpp")
+    //! \return type& - Reference to self
+    //!
+    //! \throw wtl::invalid_argument - Extension is empty or contains wildcards
+    /////////////////////////////////////////////////////////////////////////////////////////
+    type&  extension(const string_t& ext)
+    {
+      if (ext.empty() || ext.find_first_of(string_t{'*','?','.'}) != string_t::npos)
+        throw invalid_argument(HERE, "Extensions cannot be empty, or contain dots or wildcards");
+
+      Extensions.push_back(ext);
+      return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileFilter::folders
+    //! Set whether folders are reported
+    //!
+    //! \param[in] enable - Whether folders are reported
+    //! \return type& - Reference to self
+    /////////////////////////////////////////////////////////////////////////////////////////
+    type&  folders(bool enable)
+    {
+      Folders = enable;
+      return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileFilter::pattern
+    //! Add a glob pattern
+    //!
+    //! \param[in] const& glob - Pattern  (eg. "*.tmp", "report-??.txt")
+    //! \return type& - Reference to self
+    /////////////////////////////////////////////////////////////////////////////////////////
+    type&  pattern(const string_t& glob)
+    {
+      Patterns.push_back(glob);
+      return *this;
+    }
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct FileEntry - Compact description of a file system entry within a batch
+  //!
+  //! \remarks Attributes use the Win32 'FileAttribute' values on all platforms. Times are 100-nanosecond
+  //! \remarks intervals since 1 January 1601 (UTC) on all platforms.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct FileEntry
+  {
+    //! \var Directory/Hidden/Normal/ReadOnly/ReparsePoint - Attributes used by all platforms
+    static constexpr uint32_t ReadOnly = 0x0001,
+                              Hidden = 0x0002,
+                              Directory = 0x0010,
+                              Normal = 0x0080,
+                              ReparsePoint = 0x0400;
+
+    uint32_t  Name;         //!< Offset of name within batch name arena
+    uint32_t  Length;       //!< Length of name, in characters
+    uint32_t  Attributes;   //!< Attributes
+    uint64_t  Size;         //!< Size, in bytes  (Zero for folders)
+    uint64_t  Modified;     //!< Last write time
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct FileBatch - Entries enumerated from a single folder, with names stored contiguously
+  //!
+  //! \tparam CHR - Character type
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename CHR>
+  struct FileBatch
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = FileBatch<CHR>;
+
+    //! \alias char_t - Character type
+    using char_t = CHR;
+
+    //! \alias string_t - String type
+    using string_t = std::basic_string<char_t>;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    std::shared_ptr<const string_t>  Folder;      //!< Absolute path of folder  (With trailing separator, shared by all batches of the folder)
+    std::vector<char_t>              Names;       //!< Name arena  (Each name is null terminated)
+    std::vector<FileEntry>           Entries;     //!< Entries
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileBatch::fullPath const
+    //! Build the full path of an entry
+    //!
+    //! \param[in] const& e - Entry within this batch
+    //! \return string_t - Absolute path
+    /////////////////////////////////////////////////////////////////////////////////////////
+    string_t  fullPath(const FileEntry& e) const
+    {
+      string_t path;
+      path.reserve(Folder->length() + e.Length);
+      path.append(*Folder).append(name(e), e.Length);
+      return path;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileBatch::name const
+    //! Get the name of an entry
+    //!
+    //! \param[in] const& e - Entry within this batch
+    //! \return const char_t* - Null terminated name
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const char_t*  name(const FileEntry& e) const
+    {
+      return Names.data() + e.Name;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileBatch::append
+    //! Append an entry
+    //!
+    //! \param[in] const* name - Name
+    //! \param[in] length - Length of name, in characters
+    //! \param[in] attributes - Attributes
+    //! \param[in] size - Size, in bytes
+    //! \param[in] modified - Last write time
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  append(const char_t* name, size_t length, uint32_t attributes, uint64_t size, uint64_t modified)
+    {
+      Entries.push_back(FileEntry{static_cast<uint32_t>(Names.size()), static_cast<uint32_t>(length), attributes, size, modified});
+      Names.insert(Names.end(), name, name + length);
+      Names.push_back('\0');
+    }
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct FileTreeSearch - Enumerates a folder and all its descendants in parallel
+  //!
+  //! \tparam ENC - Path character encoding  (Must be narrow on Linux)
+  //!
+  //! \remarks Each folder is enumerated by a ThreadPool work item, which posts its subfolders as further work
+  //! \remarks items; these are pushed onto the worker's own deque and stolen by idle workers. Entries are
+  //! \remarks filtered as they are enumerated and published in batches which the caller consumes as a range.
+  //!
+  //! \remarks The Win32 backend uses FindFirstFileEx with large fetches and without short names (Windows 7 and above). The Linux
+  //! \remarks backend reads raw directory entries with getdents64 and only queries the size and time of
+  //! \remarks entries which are reported. Reparse points and symbolic links are reported but never followed.
+  //!
+  //! \remarks Folders which cannot be opened are skipped and counted by errors(). Destroying the search
+  //! \remarks abandons any folders still waiting to be enumerated.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <Encoding ENC>
+  struct FileTreeSearch
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var encoding - Encoding type
+    static constexpr Encoding encoding = ENC;
+
+    //! \alias type - Define own type
+    using type = FileTreeSearch<encoding>;
+
+    //! \alias char_t - Encoding character type
+    using char_t = encoding_char_t<encoding>;
+
+    //! \alias string_t - Path string type
+    using string_t = std::basic_string<char_t>;
+
+    //! \alias filter_t - Filter type
+    using filter_t = FileFilter<char_t>;
+
+    //! \alias batch_t - Batch type
+    using batch_t = FileBatch<char_t>;
+
+    //! \var separator - Path separator
+#ifdef WTL_FILE_TREE_GETDENTS
+    static constexpr char_t separator = '/';
+    static_assert(sizeof(char_t) == 1, "Linux paths must use a narrow character encoding");
+#else
+    static constexpr char_t separator = '\\';
+#endif
+
+    //! \var BatchSize - Maximum number of entries per batch
+    static constexpr uint32_t BatchSize = 1024;
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Result - Entry yielded by the range
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Result
+    {
+      const batch_t*    Batch;      //!< Batch containing entry
+      const FileEntry*  Entry;      //!< Entry
+
+      const string_t&  folder() const             { return *Batch->Folder;                                       }
+      string_t         fullPath() const           { return Batch->fullPath(*Entry);                              }
+      bool             isFolder() const           { return (Entry->Attributes & FileEntry::Directory) != 0;      }
+      uint64_t         modified() const           { return Entry->Modified;                                      }
+      const char_t*    name() const               { return Batch->name(*Entry);                                  }
+      uint64_t         size() const               { return Entry->Size;                                          }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct iterator - Input iterator which blocks until the next entry is available
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct iterator
+    {
+      using iterator_category = std::input_iterator_tag;
+      using value_type = Result;
+      using difference_type = ptrdiff_t;
+      using pointer = const Result*;
+      using reference = const Result&;
+
+      type*           Search;      //!< Search, or nullptr at end
+      batch_t         Current;     //!< Current batch
+      size_t          Index;       //!< Index of current entry
+      mutable Result  Value;       //!< Current entry  (Refreshed upon access, so copies never refer to another batch)
+
+      explicit iterator(type* search = nullptr) : Search(search), Index(0)
+      {
+        if (Search)
+          fetch();
+      }
+
+      reference  operator*() const                      { return Value = Result{&Current, &Current.Entries[Index]};   }
+      pointer    operator->() const                     { return &**this;                                             }
+      bool       operator==(const iterator& r) const    { return Search == r.Search;       }
+      bool       operator!=(const iterator& r) const    { return Search != r.Search;       }
+
+      iterator&  operator++()
+      {
+        if (++Index == Current.Entries.size())
+          fetch();
+        return *this;
+      }
+
+    private:
+      // Advance to first entry of next non-empty batch
+      void  fetch()
+      {
+        Index = 0;
+        do
+        {
+          if (!Search->next(Current))
+          {
+            Search = nullptr;
+            return;
+          }
+        }
+        while (Current.Entries.empty());
+      }
+    };
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct State - State shared by the search and its work items
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct State
+    {
+      ThreadPool*              Pool;          //!< Pool executing the work items
+      filter_t                 Filter;        //!< Filter
+      std::atomic<int64_t>     Pending;       //!< Number of folders not yet enumerated
+      std::atomic<uint64_t>    Errors;        //!< Number of folders which could not be opened
+      std::atomic<bool>        Cancelled;     //!< Whether the search was abandoned
+      std::mutex               Lock;          //!< Guards results
+      std::condition_variable  Ready;         //!< Signalled when a batch is published or the search completes
+      std::deque<batch_t>      Batches;       //!< Published batches
+
+      State(ThreadPool& pool, filter_t&& filter) : Pool(&pool), Filter(std::move(filter)), Pending(0), Errors(0), Cancelled(false)
+      {}
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Record - Raw directory entry produced by the platform backend
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Record
+    {
+      const char_t*  Name;          //!< Null terminated name
+      size_t         Length;        //!< Length of name
+      uint32_t       Attributes;    //!< Attributes
+      uint64_t       Size;          //!< Size, in bytes  (Valid once described)
+      uint64_t       Modified;      //!< Last write time  (Valid once described)
+    };
+
+#ifdef WTL_FILE_TREE_GETDENTS
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Reader - Linux directory reader
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Reader
+    {
+      //! \struct dirent64 - Layout of records returned by getdents64
+      struct dirent64
+      {
+        uint64_t        d_ino;
+        int64_t         d_off;
+        unsigned short  d_reclen;
+        unsigned char   d_type;
+        char            d_name[1];
+      };
+
+      int      Handle;          //!< Directory descriptor
+      long     Length,          //!< Number of bytes buffered
+               Offset;          //!< Offset of next record
+      alignas(8) char  Buffer[32768];
+
+      explicit Reader(const string_t& folder) : Length(0), Offset(0)
+      {
+        Handle = ::open(folder.c_str(), O_RDONLY|O_DIRECTORY|O_CLOEXEC);
+      }
+
+      ~Reader()
+      {
+        if (Handle != -1)
+          ::close(Handle);
+      }
+
+      bool  exists() const
+      {
+        return Handle != -1;
+      }
+
+      // Read the next record, refilling the buffer as necessary
+      bool  next(Record& r)
+      {
+        if (Offset >= Length)
+        {
+          Length = ::syscall(SYS_getdents64, Handle, Buffer, sizeof(Buffer));
+          Offset = 0;
+          if (Length <= 0)
+            return false;
+        }
+
+        auto const* d = reinterpret_cast<const dirent64*>(Buffer + Offset);
+        Offset += d->d_reclen;
+
+        r.Name = d->d_name;
+        r.Length = std::strlen(d->d_name);
+        r.Size = r.Modified = 0;
+        r.Attributes = (d->d_name[0] == '.' ? FileEntry::Hidden : 0);
+        switch (d->d_type)
+        {
+        case DT_DIR:      r.Attributes |= FileEntry::Directory;     break;
+        case DT_LNK:      r.Attributes |= FileEntry::ReparsePoint;  break;
+        case DT_UNKNOWN:
+          // [UNKNOWN] Some file systems require a stat
+          describe(r);
+          break;
+        default:          r.Attributes |= FileEntry::Normal;        break;
+        }
+        return true;
+      }
+
+      // Query the size, time and type of a record
+      void  describe(Record& r)
+      {
+        struct ::stat st;
+        if (::fstatat(Handle, r.Name, &st, AT_SYMLINK_NOFOLLOW) != 0)
+          return;
+
+        r.Attributes &= FileEntry::Hidden;
+        r.Attributes |= S_ISDIR(st.st_mode) ? FileEntry::Directory : S_ISLNK(st.st_mode) ? FileEntry::ReparsePoint : FileEntry::Normal;
+        if ((st.st_mode & 0222) == 0)
+          r.Attributes |= FileEntry::ReadOnly;
+
+        r.Size = S_ISDIR(st.st_mode) ? 0 : static_cast<uint64_t>(st.st_size);
+        r.Modified = (static_cast<uint64_t>(st.st_mtim.tv_sec) + 11644473600ULL) * 10000000ULL + st.st_mtim.tv_nsec / 100;
+      }
+    };
+#else
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Reader - Win32 directory reader
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Reader
+    {
+      //! \alias data_t - Result type
+      using data_t = choose_t<encoding,::WIN32_FIND_DATAA,::WIN32_FIND_DATAW>;
+
+      ::HANDLE  Handle;         //!< Search handle
+      data_t    Data;           //!< Current result
+      bool      First;          //!< Whether current result has not been read
+
+      explicit Reader(const string_t& folder) : First(true)
+      {
+        string_t const query = folder + char_t('*');
+        Handle = WinAPI<encoding>::findFirstFileEx(query.c_str(), ::FindExInfoBasic, &Data, ::FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
+      }
+
+      ~Reader()
+      {
+        if (Handle != INVALID_HANDLE_VALUE)
+          ::FindClose(Handle);
+      }
+
+      bool  exists() const
+      {
+        return Handle != INVALID_HANDLE_VALUE;
+      }
+
+      // Read the next result
+      bool  next(Record& r)
+      {
+        if (!First && !WinAPI<encoding>::findNextFile(Handle, &Data))
+          return false;
+        First = false;
+
+        r.Name = Data.cFileName;
+        r.Length = std::char_traits<char_t>::length(Data.cFileName);
+        r.Attributes = Data.dwFileAttributes;
+        r.Size = static_cast<uint64_t>(Data.nFileSizeHigh) << 32 | Data.nFileSizeLow;
+        r.Modified = static_cast<uint64_t>(Data.ftLastWriteTime.dwHighDateTime) << 32 | Data.ftLastWriteTime.dwLowDateTime;
+        return true;
+      }
+
+      // Results are already described
+      void  describe(Record&)
+      {}
+    };
+#endif
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::shared_ptr<State>  Shared;       //!< State shared with work items
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileTreeSearch::FileTreeSearch
+    //! Begin enumerating a folder and its descendants
+    //!
+    //! \param[in] const& folder - Target folder
+    //! \param[in] filter - [optional] Filter  (Default reports all files and folders)
+    //! \param[in,out] &pool - [optional] Pool executing the search  (Default is the shared pool)
+    //!
+    //! \throw wtl::logic_error - Folder does not exist
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit FileTreeSearch(string_t folder, filter_t filter = filter_t(), ThreadPool& pool = ThreadPool::shared())
+      : Shared(std::make_shared<State>(pool, std::move(filter)))
+    {
+      // Ensure trailing separator
+      if (folder.empty() || folder.back() != separator)
+        folder += separator;
+
+      // Verify folder exists
+      if (!Reader(folder).exists())
+        throw logic_error(HERE, "Search folder does not exist");
+
+      schedule(Shared, std::make_shared<const string_t>(std::move(folder)));
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(FileTreeSearch);      //!< Cannot be copied
+    ENABLE_MOVE(FileTreeSearch);       //!< Can be moved
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileTreeSearch::~FileTreeSearch
+    //! Abandons any folders not yet enumerated
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~FileTreeSearch()
+    {
+      if (Shared)
+        Shared->Cancelled.store(true);
+    }
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileTreeSearch::schedule
+    //! Post a work item which enumerates a folder
+    //!
+    //! \param[in] const& state - Shared state
+    //! \param[in] folder - Absolute path of folder, with trailing separator
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void  schedule(const std::shared_ptr<State>& state, std::shared_ptr<const string_t> folder)
+    {
+      state->Pending.fetch_add(1, std::memory_order_relaxed);
+      state->Pool->post([state, folder] { enumerate(state, folder); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileTreeSearch::enumerate
+    //! Enumerate the entries of one folder, scheduling its subfolders
+    //!
+    //! \param[in] const& shared - Shared state
+    //! \param[in] const& folder - Absolute path of folder, with trailing separator
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void  enumerate(const std::shared_ptr<State>& shared, const std::shared_ptr<const string_t>& folder)
+    {
+      State& state = *shared;
+
+      if (!state.Cancelled.load(std::memory_order_relaxed))
+      {
+        Reader reader(*folder);
+
+        // [ERROR] Skip folder
+        if (!reader.exists())
+          state.Errors.fetch_add(1, std::memory_order_relaxed);
+        else
+        {
+          batch_t batch;
+          batch.Folder = folder;
+
+          for (Record r; reader.next(r) && !state.Cancelled.load(std::memory_order_relaxed); )
+          {
+            // Skip relative paths
+            if (r.Name[0] == '.' && (r.Length == 1 || (r.Length == 2 && r.Name[1] == '.')))
+              continue;
+
+            // [FOLDER] Search, unless a link
+            if (r.Attributes & FileEntry::Directory)
+            {
+              if (!(r.Attributes & FileEntry::ReparsePoint))
+              {
+                string_t child;
+                child.reserve(folder->length() + r.Length + 1);
+                child.append(*folder).append(r.Name, r.Length) += separator;
+                schedule(shared, std::make_shared<const string_t>(std::move(child)));
+              }
+              if (!state.Filter.folders())
+                continue;
+            }
+            // [FILE] Filter
+            else if (!state.Filter.matches(r.Name, r.Length))
+              continue;
+
+            reader.describe(r);
+            batch.append(r.Name, r.Length, r.Attributes, r.Size, r.Modified);
+
+            // [FULL] Publish
+            if (batch.Entries.size() == BatchSize)
+            {
+              publish(state, std::move(batch));
+              batch = batch_t();
+              batch.Folder = folder;
+            }
+          }
+
+          if (!batch.Entries.empty())
+            publish(state, std::move(batch));
+        }
+      }
+
+      // [COMPLETE] Wake consumer
+      if (state.Pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      {
+        std::lock_guard<std::mutex> guard(state.Lock);
+        state.Ready.notify_all();
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileTreeSearch::publish
+    //! Publish a batch to the consumer
+    //!
+    //! \param[in,out] &state - Shared state
+    //! \param[in] &&batch - Batch
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void  publish(State& state, batch_t&& batch)
+    {
+      {
+        std::lock_guard<std::mutex> guard(state.Lock);
+        state.Batches.push_back(std::move(batch));
+      }
+      state.Ready.notify_one();
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileTreeSearch::errors const
+    //! Get the number of folders which could not be opened
+    //!
+    //! \return uint64_t - Number of folders skipped so far
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t  errors() const
+    {
+      return Shared->Errors.load(std::memory_order_relaxed);
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileTreeSearch::begin
+    //! Get an iterator to the first entry, blocking until available
+    //!
+    //! \return iterator - Input iterator
+    //!
+    //! \remarks Results are consumed as they are iterated, the range can only be traversed once
+    /////////////////////////////////////////////////////////////////////////////////////////
+    iterator  begin()
+    {
+      return iterator(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileTreeSearch::end
+    //! Get the sentinel iterator
+    //!
+    //! \return iterator - Sentinel
+    /////////////////////////////////////////////////////////////////////////////////////////
+    iterator  end()
+    {
+      return iterator();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FileTreeSearch::next
+    //! Retrieve the next batch, blocking until one is published or the search completes
+    //!
+    //! \param[in,out] &batch - On return, the next batch
+    //! \return bool - True if retrieved, false once the search has completed
+    //!
+    //! \remarks When called by a worker of the search pool, the caller executes pending work while it waits
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  next(batch_t& batch)
+    {
+      State& state = *Shared;
+
+      // [WORKER] Never block the pool
+      if (ThreadPool::current() == state.Pool)
+        state.Pool->wait([&state] {
+          std::lock_guard<std::mutex> guard(state.Lock);
+          return !state.Batches.empty() || state.Pending.load(std::memory_order_acquire) == 0;
+        });
+
+      std::unique_lock<std::mutex> lock(state.Lock);
+      state.Ready.wait(lock, [&state] { return !state.Batches.empty() || state.Pending.load(std::memory_order_acquire) == 0; });
+
+      if (state.Batches.empty())
+        return false;
+
+      batch = std::move(state.Batches.front());
+      state.Batches.pop_front();
+      return true;
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_FILE_TREE_SEARCH_HPP
@@ -10,7 +10,7 @@
 
 #include <wtl/WTL.hpp>
 #include <wtl/traits/EncodingTraits.hpp>      //!< Encoding
-#include <wtl/utils/CharArray.hpp>            //!< CharArray
+#include <wtl/utils/chararray.hpp>            //!< CharArray
 #include <wtl/utils/String.hpp>               //!< String
 #include <wtl/platform/SystemFlags.hpp>       //!< WindowVersion
 #include <utility>
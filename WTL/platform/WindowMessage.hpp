@@ -269,6 +269,7 @@ namespace wtl
     App = 0x8000,					            		      //!< [Windows 4.00] 
     MouseEnter,                                 //!< [Custom] Mouse entering window
     Socket,                                     //!< [Custom] Socket event
+    PostedWork,                                 //!< [Custom] Work posted to message pump thread
   };
   
   //! Define traits: Non-contiguous Attribute
@@ -9,291 +9,104 @@
 #define WTL_DIALOG_RESOURCES_HPP
 
 #include <wtl/WTL.hpp>
+#include <wtl/resources/DialogTemplateCache.hpp>   //!< DialogTemplateCache
+#include <wtl/resources/ResourceId.hpp>            //!< ResourceId
+#include <wtl/utils/Exception.hpp>                 //!< platform_error
 
 //! \namespace wtl - Windows template library
 namespace wtl
 {
-  //! \struct DLGTEMPLATEEX - Extended dialog template
-  struct DLGTEMPLATEEX
-  {
-    WORD           version;
-    WORD           signature;
-    DWORD          helpID;
-    WindowStyleEx  styleEx;
-    WindowStyle    style;
-    WORD           numItems;
-    short          x, y,
-                   cx, cy;
-    WCHAR*         menu;                    //!< Variable-length field
-    /*
-    WCHAR*         windowClass;             //!< Variable-length field
-    WCHAR          titleLen;
-    WCHAR          title[titleLen];         //!< Variable-length field
-    WORD           pointsize;
-    WORD           weight;
-    BYTE           italic;
-    BYTE           charset;
-    WCHAR          stringLen;
-    WCHAR          typeface[stringLen];     //!< Variable-length field
-    */
-  };
-    
-  //! \struct DLGITEMTEMPLATEEX - Extended Dialog Item Template
-  struct DLGITEMTEMPLATEEX
-  {
-    ulong32_t       helpId;     //!< Control help Id
-    WindowStyleEx styleEx;    //!< Extended style
-    WindowStyle   style;      //!< Style
-    int16_t         x,          //!< X co-ordinate in dialog units
-                  y,          //!< Y co-ordinate in dialog units
-                  cx,         //!< Width in dialog units
-                  cy;         //!< Height in dialog units
-    ulong32_t       ctrlId;     //!< Control Id
-  };
-
   /////////////////////////////////////////////////////////////////////////////////////////
-  //! \struct Resources - Provides access to application resources
-  //! 
-  //! \tparam ENC - Character encoding type
+  //! \struct DialogResource - Encapsulates loading a dialog template from the resource table
+  //!
+  //! \remarks Templates are parsed once, by the process-wide DialogTemplateCache
   /////////////////////////////////////////////////////////////////////////////////////////
-  template <Encoding ENC = Encoding::UTF16>
-  struct DialogResource : Resources<ENC>
-  {      
+  struct DialogResource
+  {
     // ---------------------------------- TYPES & CONSTANTS ---------------------------------
-  
-    //! \alias char_t - Defines character type
-    using char_t = encoding_char_t<ENC>;
 
-    //! \alias stream_t - Defines memory stream type
-    using stream_t = MemoryStream<uint8_t>;
+    //! \alias const_iterator - Item template iterator
+    using const_iterator = DialogTemplate::const_iterator;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    DialogTemplateCache::template_t  Template;      //!< Parsed template
 
     // ------------------------------------ CONSTRUCTION ------------------------------------
-    
+  public:
     /////////////////////////////////////////////////////////////////////////////////////////
-    //! \struct DialogItemTemplate - Variable length dialog item template
+    // DialogResource::DialogResource
+    //! Loads a dialog resource
+    //!
+    //! \tparam ENC - Character encoding type
+    //!
+    //! \param[in] id - Dialog identifier
+    //! \param[in] lang - [optional] Dialog language
+    //!
+    //! \throw wtl::domain_error - Malformed template
+    //! \throw wtl::platform_error - Missing dialog
     /////////////////////////////////////////////////////////////////////////////////////////
-    struct DialogItemTemplate 
+    template <Encoding ENC> explicit
+    DialogResource(ResourceId<ENC> id, LanguageId lang = LanguageId::Neutral) : Template(DialogTemplateCache::instance().find(id,lang))
     {
-      // ---------------------------------- TYPES & CONSTANTS ---------------------------------
-
-      //! \alias ByteVector - User data storage type
-      using ByteVector = std::vector<uint8_t>;
-
-      // ------------------------------------ CONSTRUCTION ------------------------------------
-
-      /////////////////////////////////////////////////////////////////////////////////////////
-      // DialogItemTemplate::DialogItemTemplate 
-      //! Create from extended item template (DLGITEMTEMPLATEEX)
-      //! 
-      //! \param[in] &stream - Binary reader containing extended item template
-      /////////////////////////////////////////////////////////////////////////////////////////
-      DialogItemTemplate(BinaryReader<stream_t>& stream) 
-      {
-        // Read item data
-        stream >> HelpId 
-               >> StyleEx 
-               >> Style;
-
-        int16_t x, y, cx, cy;   //!< Item position and size (in dialog units)
-
-        // Read position
-        stream >> x >> y >> cx >> cy;
-        Position.set(x,y,cx,cy);
-      
-        // Read control Id
-        in >> Ident;
-
-        // Read window class
-        ResourceId<ENC> idClass;
-        in >> ident;
-
-        // Copy/lookup window class
-        if (ident.isString())
-          WndClass = ident.toString();
-        else
-          WndClass = getWindowClass(static_cast<SystemClass>(ident.toOrdinal()));
-
-        // Read title
-        in >> DlgTitle;
-
-        // Read amount of creation data
-        int16_t numBytes;
-        in >> numBytes;
-
-        // Read creation data, if any
-        if (numBytes)
-          UserData.assign(in.position(), in.position()+numBytes);
-      }
-
-      // ----------------------------------- STATIC METHODS -----------------------------------
-
-      // ---------------------------------- ACCESSOR METHODS ----------------------------------			
-
-      // ----------------------------------- MUTATOR METHODS ----------------------------------
+      // [CHECK] Ensure dialog found
+      if (!Template)
+        throw platform_error(HERE, "Dialog resource does not exist");
+    }
 
-      // ----------------------------------- REPRESENTATION -----------------------------------
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    ENABLE_COPY(DialogResource);       //!< Can be shallow copied
+    ENABLE_MOVE(DialogResource);       //!< Can be moved
+    ENABLE_POLY(DialogResource);       //!< Can be polymorphic
 
-      WindowStyle    Style;          //!< Window style
-      WindowStyleEx  StyleEx;        //!< Extended window style
-      WindowId       Ident;          //!< Control id
-      long32_t         HelpId;         //!< Help id context
-      Rect<int16_t>    Position;       //!< Position
-      std::wstring   Text,           //!< Item text
-                     WndClass;       //!< Window class name
-      ByteVector     UserData;       //!< Creation data
-    };
-    
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
     /////////////////////////////////////////////////////////////////////////////////////////
-    //! \struct DialogTemplate - Variable length dialog item template
-    //! 
-    //! \tparam ENC - Character encoding
+    // DialogResource::begin const
+    //! Get position of first item template
+    //!
+    //! \return const_iterator - Position of first item
     /////////////////////////////////////////////////////////////////////////////////////////
-    struct DialogTemplate 
+    const_iterator  begin() const
     {
-      // ---------------------------------- TYPES & CONSTANTS ---------------------------------
-
-      //! \alias stream_t - Defines input stream type
-      using stream_t = MemoryStream<encoding_char_t<ENC>>;
-
-      using ItemCollection = std::vector<DialogItemTemplate>;
-
-      // ------------------------------------ CONSTRUCTION ------------------------------------
-
-      /////////////////////////////////////////////////////////////////////////////////////////
-      // DialogTemplate::DialogTemplate 
-      //! Create from an extended dialog template
-      //! 
-      //! \param[in] &stream - Binary reader containing extended dialog item template
-      /////////////////////////////////////////////////////////////////////////////////////////
-      DialogTemplate(BinaryReader<stream_t>& stream) 
-      {
-        int16_t  version,       //!< Version
-               signature;     //!< Signature
-        
-        // Read version 
-        stream >> version 
-               >> signature;
-
-        // Check version for extended dialog signature
-        if (version != 1 || signature != 0xFFFF)
-          throw;
-
-        int16_t numItems;
-
-        // Read dialog data
-        stream >> HelpId 
-               >> Style 
-               >> StyleEx
-               >> numItems;
-
-        int16_t x, y, cx, cy;   //!< Dialog position and size (in dialog units)
-
-        // Read position
-        stream >> x >> y >> cx >> cy;
-        Position.set(x,y,cx,cy);
-      
-        // Read menu
-        in >> MenuId;
-
-        // Read items
-        for (uint32_t idx = 0; idx < numItems; ++idx)
-          Items.emplace_back(stream);
-      }
-      
-      // ----------------------------------- STATIC METHODS -----------------------------------
-
-      // ---------------------------------- ACCESSOR METHODS ----------------------------------			
-
-      // ----------------------------------- MUTATOR METHODS ----------------------------------
-
-      // ----------------------------------- REPRESENTATION -----------------------------------
-    public:
-      WindowStyle    Style;          //!< Window style
-      WindowStyleEx  StyleEx;        //!< Extended window style
-      WindowId       Ident;          //!< Window id
-      Rect<int16_t>    Position;       //!< Position
-      std::wstring   DlgTitle,       //!< Dialog title
-                     WndClass,       //!< Window class name
-                     CreateData;     //!< Creation data
-      ItemCollection Items;          //!< Item templates
-    };
+      return Template->begin();
+    }
 
-  protected:
     /////////////////////////////////////////////////////////////////////////////////////////
-    // DialogItemTemplate::getWindowClass
-    //! Get a system window class name from its ordinal
-    //! 
-    //! \param[in] id - System window class identifier
-    //! 
-    //! \throw wtl::domain_error - Unrecognised window class
+    // DialogResource::end const
+    //! Get position beyond last item template
+    //!
+    //! \return const_iterator - Position beyond last item
     /////////////////////////////////////////////////////////////////////////////////////////
-    static std::wstring getWindowClass(SystemClass id)
+    const_iterator  end() const
     {
-      switch (id)
-      {
-      case SystemClass::Button:      return WC_BUTTONW; 
-      case SystemClass::Edit:        return WC_EDITW; 
-      case SystemClass::Static:      return WC_STATICW; 
-      case SystemClass::ListBox:     return WC_LISTBOXW;
-      case SystemClass::ScrollBar:   return WC_SCROLLBARW;
-      case SystemClass::ComboBox:    return WC_COMBOBOXW;
-      }
-
-      // Unrecognised window class ordinal
-      throw domain_error(HERE, "Unrecognised window class ordinal '", enum_cast(id), "'");
+      return Template->end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////
-    // Resources::load
-    //! Find the resource data block associated with a resource handle
-    //! 
-    //! \tparam DATA - Resource storage format
-    //! 
-    //! \param[in] module - Module containing resource
-    //! \param[in] res - Resource handle
-    //! \return DATA* - Resource data block
+    // DialogResource::get const
+    //! Get the dialog template
+    //!
+    //! \return const DialogTemplate& - Parsed template
     /////////////////////////////////////////////////////////////////////////////////////////
-    template <typename DATA = uint8_t>
-    static DATA* load(HMODULE module, const HResource& res)
+    const DialogTemplate&  get() const
     {
-      // Load resource
-      if (HGLOBAL block = ::LoadResource(module, res))
-      {
-        // Retrieve data
-        if (DATA* data = reinterpret_cast<DATA*>(::LockResource(block)))
-          return data;
-
-        // Failed
-        throw platform_error(HERE, "Unable to lock resource");
-      }
-      
-      // Not found
-      throw platform_error(HERE, "Missing resource");
+      return *Template;
     }
 
-  public:
     /////////////////////////////////////////////////////////////////////////////////////////
-    // Resources::loadDialog
-    //! Loads a string resource
-    //! 
-    //! \tparam ENC - Output character encoding 
-    //! \tparam LENGTH - Output buffer length
-    //! 
-    //! \param[in] module - Module containing string
-    //! \param[in] id - String identifier
-    //! \param[in,out] &str - Output buffer
-    //! \return bool - True iff was found 
-    //! 
-    //! \throw wtl::domain_error - Insufficient buffer capacity
+    // DialogResource::size const
+    //! Get the number of item templates
+    //!
+    //! \return uint16_t - Number of items
     /////////////////////////////////////////////////////////////////////////////////////////
-    template <Encoding ENC, unsigned LENGTH>
-    bool loadDialog(HMODULE module, ResourceId<ENC> id, DLGTEMPLATE) 
+    uint16_t  size() const
     {
+      return Template->size();
     }
-
   };
 
-  
 } //namespace wtl
-#endif // WTL_DIALOG_RESOURCES_HPP
 
+#endif // WTL_DIALOG_RESOURCES_HPP
@@ -0,0 +1,440 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\resources\DialogTemplate.hpp
+//! \brief Parses dialog templates in-place, without copying their strings or creation data
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_DIALOG_TEMPLATE_HPP
+#define WTL_DIALOG_TEMPLATE_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/casts/EnumCast.hpp>                 //!< enum_cast
+#include <wtl/platform/WindowFlags.hpp>           //!< WindowStyle, WindowStyleEx
+#include <wtl/utils/Exception.hpp>                //!< domain_error
+#include <wtl/utils/Rectangle.hpp>                //!< Rect
+#include <cstring>                                //!< std::memcpy
+#include <memory>                                 //!< std::unique_ptr
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct DialogString - View of a string, or ordinal, stored within a dialog template
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct DialogString
+  {
+    const char16_t* Text;         //!< Null-terminated UTF-16 text within template, or nullptr if ordinal/absent
+    uint16_t        Length;       //!< Length of text, in characters
+    uint16_t        Ordinal;      //!< Ordinal, or zero if text/absent
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DialogString::empty const
+    //! Query whether neither text nor ordinal is present
+    //!
+    //! \return bool - True iff absent
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  empty() const
+    {
+      return !Text && !Ordinal;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DialogString::isOrdinal const
+    //! Query whether an ordinal is present
+    //!
+    //! \return bool - True iff ordinal
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  isOrdinal() const
+    {
+      return !Text && Ordinal;
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct DialogItemTemplate - View of a dialog item template (DLGITEMTEMPLATE or DLGITEMTEMPLATEEX)
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct DialogItemTemplate
+  {
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    ulong32_t        HelpId;         //!< Help id context
+    WindowStyleEx    StyleEx;        //!< Extended window style
+    WindowStyle      Style;          //!< Window style
+    Rect<int16_t>    Position;       //!< Position  (in dialog units)
+    uint32_t         Ident;          //!< Control id
+    DialogString     WndClass;       //!< Window class name, or predefined class atom
+    DialogString     Text;           //!< Item text, or resource ordinal
+    const uint8_t*   CreateData;     //!< Creation data within template, or nullptr if none
+    uint16_t         CreateLength;   //!< Size of creation data, in bytes
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DialogItemTemplate::className const
+    //! Get the window class name, resolving predefined class atoms
+    //!
+    //! \return const char16_t* - Window class name
+    //!
+    //! \throw wtl::domain_error - Unrecognised window class
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const char16_t*  className() const
+    {
+      // [NAME] Return name within template
+      if (WndClass.Text)
+        return WndClass.Text;
+
+      // [ATOM] Lookup predefined class
+      switch (WndClass.Ordinal)
+      {
+      case 0x0080:   return u"Button";
+      case 0x0081:   return u"Edit";
+      case 0x0082:   return u"Static";
+      case 0x0083:   return u"ListBox";
+      case 0x0084:   return u"ScrollBar";
+      case 0x0085:   return u"ComboBox";
+      }
+
+      // Unrecognised window class ordinal
+      throw domain_error(HERE, "Unrecognised window class ordinal '", WndClass.Ordinal, "'");
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct DialogTemplate - View of a dialog template (DLGTEMPLATE or DLGTEMPLATEEX)
+  //!
+  //! \remarks Strings and creation data refer directly to the template, which must outlive this object. Item
+  //! \remarks templates are stored in a single allocation sized from the item count within the header.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct DialogTemplate
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = DialogTemplate;
+
+    //! \alias const_iterator - Item template iterator
+    using const_iterator = const DialogItemTemplate*;
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Reader - Bounds-checked reader of template fields
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Reader
+    {
+      const uint8_t* const  Start;      //!< First byte
+      const uint8_t* const  End;        //!< Beyond last byte
+      const uint8_t*        Position;   //!< Next byte
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Reader::read
+      //! Read a fixed-size field
+      //!
+      //! \tparam T - Field type
+      //! \return T - Field value
+      //!
+      //! \throw wtl::domain_error - Truncated template
+      /////////////////////////////////////////////////////////////////////////////////////////
+      template <typename T>
+      T  read()
+      {
+        T value;
+        ensure(sizeof(T));
+        std::memcpy(&value, Position, sizeof(T));
+        Position += sizeof(T);
+        return value;
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Reader::string
+      //! Read a null-terminated UTF-16 string
+      //!
+      //! \return DialogString - View of string
+      //!
+      //! \throw wtl::domain_error - Truncated template
+      /////////////////////////////////////////////////////////////////////////////////////////
+      DialogString  string()
+      {
+        DialogString str {reinterpret_cast<const char16_t*>(Position), 0, 0};
+
+        // Scan for terminator
+        for (uint16_t ch = read<uint16_t>(); ch != 0; ch = read<uint16_t>())
+          ++str.Length;
+
+        return str;
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Reader::stringOrOrdinal
+      //! Read a 'sz_Or_Ord' field
+      //!
+      //! \return DialogString - View of string, ordinal, or neither
+      //!
+      //! \throw wtl::domain_error - Truncated template
+      /////////////////////////////////////////////////////////////////////////////////////////
+      DialogString  stringOrOrdinal()
+      {
+        switch (read<uint16_t>())
+        {
+        // [ABSENT] Empty
+        case 0x0000:
+          return DialogString {nullptr, 0, 0};
+
+        // [ORDINAL] Read ordinal
+        case 0xFFFF:
+          return DialogString {nullptr, 0, read<uint16_t>()};
+
+        // [STRING] Re-read from first character
+        default:
+          Position -= sizeof(uint16_t);
+          return string();
+        }
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Reader::bytes
+      //! Read a block of bytes
+      //!
+      //! \param[in] length - Length, in bytes
+      //! \return const uint8_t* - Block, or nullptr if empty
+      //!
+      //! \throw wtl::domain_error - Truncated template
+      /////////////////////////////////////////////////////////////////////////////////////////
+      const uint8_t*  bytes(uint16_t length)
+      {
+        const uint8_t* block = length ? Position : nullptr;
+        ensure(length);
+        Position += length;
+        return block;
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Reader::align
+      //! Advance to the next DWORD boundary, relative to the start of the template
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void  align()
+      {
+        size_t const offset = (Position - Start + 3) & ~size_t(3);
+        Position = Start + (offset < size_t(End - Start) ? offset : size_t(End - Start));
+      }
+
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // Reader::ensure const
+      //! Verify a field lies within the template
+      //!
+      //! \param[in] length - Field length, in bytes
+      //!
+      //! \throw wtl::domain_error - Truncated template
+      /////////////////////////////////////////////////////////////////////////////////////////
+      void  ensure(size_t length) const
+      {
+        if (length > size_t(End - Position))
+          throw domain_error(HERE, "Dialog template truncated at offset ", Position - Start);
+      }
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    ulong32_t        HelpId;         //!< Help id context  (Zero unless extended)
+    WindowStyleEx    StyleEx;        //!< Extended window style
+    WindowStyle      Style;          //!< Window style
+    Rect<int16_t>    Position;       //!< Position  (in dialog units)
+    DialogString     Menu;           //!< Menu resource name/ordinal
+    DialogString     WndClass;       //!< Window class name/atom
+    DialogString     Title;          //!< Dialog title
+    uint16_t         PointSize;      //!< Font point size  (Zero unless DS_SETFONT)
+    uint16_t         Weight;         //!< Font weight  (Zero unless extended)
+    bool             Italic;         //!< Whether font is italic  (False unless extended)
+    uint8_t          CharSet;        //!< Font character set  (Zero unless extended)
+    DialogString     Typeface;       //!< Font typeface  (Empty unless DS_SETFONT)
+    bool             Extended;       //!< Whether template is extended (DLGTEMPLATEEX)
+
+  protected:
+    std::unique_ptr<DialogItemTemplate[]>  Items;      //!< Item templates
+    uint16_t                               Count;      //!< Number of item templates
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DialogTemplate::DialogTemplate
+    //! Parse a standard or extended dialog template
+    //!
+    //! \param[in] const* data - Dialog template
+    //! \param[in] length - Length of template, in bytes
+    //!
+    //! \throw wtl::domain_error - Malformed template
+    //! \throw wtl::invalid_argument - [Debug only] Missing template
+    /////////////////////////////////////////////////////////////////////////////////////////
+    DialogTemplate(const void* data, uint32_t length) : HelpId(0),
+                                                        PointSize(0),
+                                                        Weight(0),
+                                                        Italic(false),
+                                                        CharSet(0),
+                                                        Typeface {nullptr, 0, 0},
+                                                        Count(0)
+    {
+      REQUIRED_PARAM(data);
+
+      Reader in {static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + length, static_cast<const uint8_t*>(data)};
+
+      // [EXTENDED] Identify from version and signature
+      in.ensure(2 * sizeof(uint16_t));
+      Extended = (reinterpret_cast<const uint16_t*>(data)[0] == 1 && reinterpret_cast<const uint16_t*>(data)[1] == 0xFFFF);
+
+      // Read header
+      if (Extended)
+      {
+        in.Position += 2 * sizeof(uint16_t);
+        HelpId = in.read<uint32_t>();
+        StyleEx = in.read<WindowStyleEx>();
+        Style = in.read<WindowStyle>();
+      }
+      else
+      {
+        Style = in.read<WindowStyle>();
+        StyleEx = in.read<WindowStyleEx>();
+      }
+      Count = in.read<uint16_t>();
+      Position = position(in);
+
+      // Read menu, class and title
+      Menu = in.stringOrOrdinal();
+      WndClass = in.stringOrOrdinal();
+      Title = in.string();
+
+      // [FONT] Read font
+      if (enum_cast(Style) & DS_SETFONT)
+      {
+        PointSize = in.read<uint16_t>();
+        if (Extended)
+        {
+          Weight = in.read<uint16_t>();
+          Italic = in.read<uint8_t>() != 0;
+          CharSet = in.read<uint8_t>();
+        }
+        Typeface = in.string();
+      }
+
+      // Read items into a single allocation
+      Items.reset(new DialogItemTemplate[Count]);
+      for (uint16_t idx = 0; idx < Count; ++idx)
+        read(in, Items[idx]);
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(DialogTemplate);      //!< Cannot be copied
+    ENABLE_MOVE(DialogTemplate);       //!< Can be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DialogTemplate::begin const
+    //! Get position of first item template
+    //!
+    //! \return const_iterator - Position of first item
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const_iterator  begin() const
+    {
+      return Items.get();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DialogTemplate::end const
+    //! Get position beyond last item template
+    //!
+    //! \return const_iterator - Position beyond last item
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const_iterator  end() const
+    {
+      return Items.get() + Count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DialogTemplate::size const
+    //! Get the number of item templates
+    //!
+    //! \return uint16_t - Number of items
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint16_t  size() const
+    {
+      return Count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DialogTemplate::operator[] const
+    //! Access an item template
+    //!
+    //! \param[in] idx - Zero-based item index
+    //! \return const DialogItemTemplate& - Item template
+    //!
+    //! \throw wtl::logic_error - [Debug only] Index out of bounds
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const DialogItemTemplate&  operator [] (uint16_t idx) const
+    {
+      LOGIC_INVARIANT(idx < Count);
+      return Items[idx];
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DialogTemplate::position
+    //! Read a position and size, in dialog units
+    //!
+    //! \param[in,out] &in - Template reader
+    //! \return Rect<int16_t> - Position
+    //!
+    //! \throw wtl::domain_error - Truncated template
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static Rect<int16_t>  position(Reader& in)
+    {
+      int16_t const x = in.read<int16_t>(),
+                    y = in.read<int16_t>(),
+                    cx = in.read<int16_t>(),
+                    cy = in.read<int16_t>();
+      return Rect<int16_t>(x, y, x+cx, y+cy);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DialogTemplate::read const
+    //! Read an item template
+    //!
+    //! \param[in,out] &in - Template reader
+    //! \param[in,out] &item - Item template
+    //!
+    //! \throw wtl::domain_error - Truncated template
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  read(Reader& in, DialogItemTemplate& item) const
+    {
+      // Items are DWORD-aligned
+      in.align();
+
+      // Read styles
+      if (Extended)
+      {
+        item.HelpId = in.read<uint32_t>();
+        item.StyleEx = in.read<WindowStyleEx>();
+        item.Style = in.read<WindowStyle>();
+      }
+      else
+      {
+        item.HelpId = 0;
+        item.Style = in.read<WindowStyle>();
+        item.StyleEx = in.read<WindowStyleEx>();
+      }
+
+      // Read position and id
+      item.Position = position(in);
+      item.Ident = Extended ? in.read<uint32_t>() : in.read<uint16_t>();
+
+      // Read class, text and creation data
+      item.WndClass = in.stringOrOrdinal();
+      item.Text = in.stringOrOrdinal();
+      item.CreateLength = in.read<uint16_t>();
+      item.CreateData = in.bytes(item.CreateLength);
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_DIALOG_TEMPLATE_HPP
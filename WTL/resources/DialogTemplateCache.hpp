@@ -0,0 +1,186 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\resources\DialogTemplateCache.hpp
+//! \brief Provides a process-wide cache of parsed dialog templates
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_DIALOG_TEMPLATE_CACHE_HPP
+#define WTL_DIALOG_TEMPLATE_CACHE_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/resources/DialogTemplate.hpp>     //!< DialogTemplate
+#include <wtl/resources/PeResourceIndex.hpp>    //!< ResourceName
+#include <wtl/resources/ResourceBlob.hpp>       //!< ResourceBlob
+#include <wtl/resources/ResourceId.hpp>         //!< ResourceId
+#include <wtl/modules/ModuleCollection.h>       //!< LoadedModules
+#include <memory>                               //!< std::shared_ptr
+#include <mutex>                                //!< std::mutex
+#include <unordered_map>                        //!< std::unordered_map
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct DialogTemplateCache - Parses each dialog template once, keyed by resource name and language
+  //!
+  //! \remarks Templates are parsed in-place, so their strings refer to the resource data of the module which
+  //! \remarks contains them. The cache is emptied whenever a module is added to or removed from LoadedModules,
+  //! \remarks but templates already retrieved must not be used once their module has been unloaded.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct DialogTemplateCache
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = DialogTemplateCache;
+
+    //! \alias template_t - Shared template type
+    using template_t = std::shared_ptr<const DialogTemplate>;
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Key - Resource name and language
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Key
+    {
+      ResourceName  Name;         //!< Case-insensitive resource name
+      ::LANGID      Language;     //!< Resource language
+
+      bool operator == (const Key& r) const
+      {
+        return Language == r.Language && Name == r.Name;
+      }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct KeyHash - Hashes resource name and language
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct KeyHash
+    {
+      size_t operator () (const Key& k) const
+      {
+        // FNV-1a
+        size_t hash = (2166136261u ^ k.Language ^ (size_t(k.Name.Ordinal) << 16)) * 16777619u;
+        for (char16_t ch : k.Name.Text)
+          hash = (hash ^ static_cast<size_t>(ch)) * 16777619u;
+        return hash;
+      }
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    mutable std::mutex                               Lock;           //!< Protects 'Templates' and 'Generation'
+    std::unordered_map<Key,template_t,KeyHash>       Templates;      //!< Parsed templates
+    uint32_t                                         Generation;     //!< Generation of loaded modules when templates were parsed
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DialogTemplateCache::DialogTemplateCache
+    //! Create empty cache
+    /////////////////////////////////////////////////////////////////////////////////////////
+    DialogTemplateCache() : Generation(LoadedModules.generation())
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(DialogTemplateCache);      //!< Cannot be copied
+    DISABLE_MOVE(DialogTemplateCache);      //!< Cannot be moved
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DialogTemplateCache::instance
+    //! Get the process-wide cache
+    //!
+    //! \return DialogTemplateCache& - Shared cache
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static DialogTemplateCache&  instance()
+    {
+      static DialogTemplateCache  cache;
+      return cache;
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DialogTemplateCache::size const
+    //! Get the number of cached templates
+    //!
+    //! \return uint32_t - Number of templates
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  size() const
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      return static_cast<uint32_t>(Templates.size());
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DialogTemplateCache::clear
+    //! Discards all cached templates  (Templates already retrieved remain valid while their module is loaded)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clear()
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      Templates.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DialogTemplateCache::find
+    //! Find a dialog template, parsing it upon first use
+    //!
+    //! \tparam ENC - Resource id character encoding
+    //!
+    //! \param[in] id - Dialog identifier
+    //! \param[in] lang - [optional] Dialog language
+    //! \return template_t - Parsed template, or nullptr if the dialog does not exist
+    //!
+    //! \throw wtl::domain_error - Malformed template
+    //! \throw wtl::platform_error - Unable to load resource
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <Encoding ENC>
+    template_t  find(ResourceId<ENC> id, LanguageId lang = LanguageId::Neutral)
+    {
+      Key key {ModuleCollection::resourceName(id), lang};
+      uint32_t const generation = LoadedModules.generation();
+
+      // [CACHED] Return parsed template
+      {
+        std::lock_guard<std::mutex> guard(Lock);
+
+        // [MODULES CHANGED] Discard templates, which may refer to a module since unloaded
+        if (generation != Generation)
+        {
+          Templates.clear();
+          Generation = generation;
+        }
+
+        auto pos = Templates.find(key);
+        if (pos != Templates.end())
+          return pos->second;
+      }
+
+      // [MISSING] Lookup resource
+      ResourceBlob res = LoadedModules.findResource(ResourceType::Dialog, id, lang);
+      if (!res.exists())
+        return nullptr;
+
+      // Parse without holding lock  (If another thread parses the same template first, its copy is retained)
+      template_t parsed = std::make_shared<const DialogTemplate>(res.get<uint8_t>(), static_cast<uint32_t>(res.size()));
+
+      std::lock_guard<std::mutex> guard(Lock);
+
+      // [MODULES CHANGED] Return without caching, since the template may belong to a module being unloaded
+      if (generation != Generation || LoadedModules.generation() != generation)
+        return parsed;
+
+      return Templates.emplace(std::move(key), std::move(parsed)).first->second;
+    }
+  };
+
+} // namespace wtl
+
+#endif  // WTL_DIALOG_TEMPLATE_CACHE_HPP
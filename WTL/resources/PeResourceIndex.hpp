@@ -0,0 +1,642 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\resources\PeResourceIndex.hpp
+//! \brief Provides a self-contained, hash-indexed reader for the resource section of PE/COFF images
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_PE_RESOURCE_INDEX_HPP
+#define WTL_PE_RESOURCE_INDEX_HPP
+
+#include <wtl/WTL.hpp>
+#include <algorithm>                          //!< std::max
+#include <cstring>                            //!< std::memcpy
+#include <string>                             //!< std::u16string
+#include <type_traits>                        //!< std::make_unsigned_t
+#include <unordered_map>                      //!< std::unordered_map
+#include <unordered_set>                      //!< std::unordered_set
+
+#ifndef _WIN32
+  #include <fcntl.h>                          //!< open
+  #include <sys/mman.h>                       //!< mmap
+  #include <sys/stat.h>                       //!< fstat
+  #include <unistd.h>                         //!< close
+#endif
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct ResourceView - Location of resource data within an image  (Does not own the data)
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct ResourceView
+  {
+    const void*  Data;          //!< Resource data
+    uint32_t     Size;          //!< Size in bytes
+    uint32_t     CodePage;      //!< Code page of resource data
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct ResourceName - Resource type or name: either an ordinal or a (case-insensitive) string
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct ResourceName
+  {
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    uint16_t        Ordinal;      //!< Ordinal  (Zero if named)
+    std::u16string  Text;         //!< Upper-case name  (Empty if ordinal)
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ResourceName::ResourceName
+    //! Create from ordinal
+    //!
+    //! \param[in] ordinal - Ordinal
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ResourceName(uint16_t ordinal = 0) : Ordinal(ordinal)
+    {}
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ResourceName::ResourceName
+    //! Create from string
+    //!
+    //! \tparam CHAR - Character type  (Only characters within the ASCII range are case-folded)
+    //!
+    //! \param[in] *str - String
+    //! \param[in] length - Length in characters
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename CHAR>
+    ResourceName(const CHAR* str, size_t length) : Ordinal(0)
+    {
+      Text.reserve(length);
+      for (size_t idx = 0; idx < length; ++idx)
+      {
+        char16_t const ch = static_cast<char16_t>(static_cast<std::make_unsigned_t<CHAR>>(str[idx]));
+        Text.push_back(ch >= u'a' && ch <= u'z' ? static_cast<char16_t>(ch - (u'a' - u'A')) : ch);
+      }
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    bool operator == (const ResourceName& r) const
+    {
+      return Ordinal == r.Ordinal && Text == r.Text;
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct PeResourceIndex - Indexes the type/name/language directory tree of one or more PE images by hash,
+  //!  returning views of resource data without copying
+  //!
+  //! \remarks Images may be laid out as on disk (eg. a mapped file, or a module loaded as a data file) or as mapped
+  //! \remarks by the loader. When several images provide the same resource, the first image added takes precedence,
+  //! \remarks mirroring a linear search. Images must remain mapped while the index is in use.
+  //!
+  //! \remarks Parsing depends on no platform API, and malformed images are rejected rather than partially indexed.
+  //! \remarks Each directory may be visited once and the number of entries is capped, so the cost of indexing is
+  //! \remarks linear in the size of the resource section even when directories are shared or cyclic.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct PeResourceIndex
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = PeResourceIndex;
+
+    //! \enum Layout - Image layout
+    enum class Layout
+    {
+      File,       //!< Sections at their file offsets
+      Image,      //!< Sections at their relative virtual addresses
+    };
+
+    //! \var AnyLanguage - Language id matching the first language of a resource
+    static constexpr uint16_t  AnyLanguage = 0xFFFF;
+
+    //! \var MaxEntries - Maximum number of directory entries within an image
+    static constexpr uint32_t  MaxEntries = 1u << 18;
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Key - Resource type, name and language
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Key
+    {
+      ResourceName  Type;         //!< Resource type
+      ResourceName  Name;         //!< Resource name
+      uint16_t      Language;     //!< Language id
+
+      bool operator == (const Key& r) const
+      {
+        return Language == r.Language && Type == r.Type && Name == r.Name;
+      }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct KeyHash - Hashes resource keys
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct KeyHash
+    {
+      size_t operator () (const Key& k) const
+      {
+        std::hash<std::u16string> text;
+        size_t hash = static_cast<size_t>(uint64_t(k.Type.Ordinal) << 32 | uint64_t(k.Name.Ordinal) << 16 | k.Language);
+        if (!k.Type.Text.empty())
+          hash ^= text(k.Type.Text) + 0x9E3779B9 + (hash << 6) + (hash >> 2);
+        if (!k.Name.Text.empty())
+          hash ^= text(k.Name.Text) + 0x9E3779B9 + (hash << 6) + (hash >> 2);
+        return hash;
+      }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Image - Bounds-checked view of an image
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Image
+    {
+      const uint8_t*  Base;           //!< First byte
+      size_t          Size;           //!< Size in bytes
+      Layout          Format;         //!< Layout
+      size_t          Sections;       //!< Offset of section table
+      uint16_t        SectionCount;   //!< Number of sections
+
+      //! Copies a value, if within bounds
+      template <typename T>
+      bool read(size_t offset, T& value) const
+      {
+        if (offset > Size || Size - offset < sizeof(T))
+          return false;
+        std::memcpy(&value, Base + offset, sizeof(T));
+        return true;
+      }
+
+      //! Converts a relative virtual address of a range into its offset, if within bounds
+      bool locate(uint32_t rva, uint32_t length, size_t& offset) const
+      {
+        if (Format == Layout::Image)
+          offset = rva;
+        else
+        {
+          // Search section table
+          bool found = false;
+          for (uint16_t idx = 0; idx < SectionCount && !found; ++idx)
+          {
+            uint32_t va, raw, pointer;
+            size_t const section = Sections + idx * 40;
+            if (!read(section + 12, va) || !read(section + 16, raw) || !read(section + 20, pointer))
+              return false;
+
+            if (rva >= va && rva - va < raw)
+            {
+              offset = static_cast<size_t>(pointer) + (rva - va);
+              found = true;
+            }
+          }
+          if (!found)
+            return false;
+        }
+        return offset <= Size && Size - offset >= length;
+      }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Walk - State of a walk of the directory tree
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Walk
+    {
+      std::unordered_map<Key,ResourceView,KeyHash>  Found;        //!< Resources found
+      std::unordered_set<uint32_t>                  Visited;      //!< Offsets of directories visited
+      uint32_t                                      Entries = 0;  //!< Number of directory entries visited
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::unordered_map<Key,ResourceView,KeyHash>   Resources;     //!< Resources by type, name and language
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PeResourceIndex::PeResourceIndex
+    //! Create empty index
+    /////////////////////////////////////////////////////////////////////////////////////////
+    PeResourceIndex() = default;
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(PeResourceIndex);      //!< Cannot be copied
+    ENABLE_MOVE(PeResourceIndex);       //!< Can be moved
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PeResourceIndex::extent
+    //! Calculates the size of an image from its headers  (Used when the size of a loaded module is not known)
+    //!
+    //! \param[in] *base - First byte of image  (Headers must be readable)
+    //! \param[in] layout - Image layout
+    //! \return size_t - Size in bytes, or zero if headers are malformed
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static size_t  extent(const void* base, Layout layout)
+    {
+      Image image {static_cast<const uint8_t*>(base), 0x1000, layout, 0, 0};
+      size_t optional;
+      uint32_t size = 0;
+
+      if (!headers(image, optional))
+        return 0;
+
+      // [IMAGE] Query 'SizeOfImage'
+      if (layout == Layout::Image)
+        return image.read(optional + 56, size) ? size : 0;
+
+      // [FILE] Calculate end of furthest section
+      size_t end = image.Sections + image.SectionCount * 40;
+      for (uint16_t idx = 0; idx < image.SectionCount; ++idx)
+      {
+        uint32_t raw, pointer;
+        size_t const section = image.Sections + idx * 40;
+        if (!image.read(section + 16, raw) || !image.read(section + 20, pointer))
+          return 0;
+        end = std::max<size_t>(end, static_cast<size_t>(pointer) + raw);
+      }
+      return end;
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PeResourceIndex::headers
+    //! Validates the DOS and NT headers, locating the optional header and section table
+    //!
+    //! \param[in,out] &image - Image  (Section table is located upon success)
+    //! \param[out] &optional - Offset of optional header
+    //! \return bool - True iff headers are valid
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static bool  headers(Image& image, size_t& optional)
+    {
+      uint16_t magic, optionalSize;
+      uint32_t pe, signature;
+
+      // Validate 'MZ' then 'PE\0\0' signatures
+      if (!image.read(0, magic) || magic != 0x5A4D
+       || !image.read(0x3C, pe) || !image.read(pe, signature) || signature != 0x00004550)
+        return false;
+
+      // Locate optional header and section table (which follows the optional header)
+      size_t const file = static_cast<size_t>(pe) + 4;
+      if (!image.read(file + 2, image.SectionCount) || !image.read(file + 16, optionalSize))
+        return false;
+
+      optional = file + 20;
+      image.Sections = optional + optionalSize;
+      return image.read(optional, magic) && (magic == 0x10B || magic == 0x20B);
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PeResourceIndex::empty const
+    //! Query whether index is empty
+    //!
+    //! \return bool - True iff no resources are indexed
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  empty() const
+    {
+      return Resources.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PeResourceIndex::find const
+    //! Find a resource
+    //!
+    //! \param[in] const& type - Resource type
+    //! \param[in] const& name - Resource name
+    //! \param[in] language - Language id  (If neutral, and no neutral resource exists, the first language is used)
+    //! \return const ResourceView* - Resource view, or nullptr if not found
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const ResourceView*  find(const ResourceName& type, const ResourceName& name, uint16_t language = 0) const
+    {
+      auto pos = Resources.find(Key {type, name, language});
+      if (pos != Resources.end())
+        return &pos->second;
+
+      // [NEUTRAL] Fallback to first language
+      if (language == 0 && (pos = Resources.find(Key {type, name, AnyLanguage})) != Resources.end())
+        return &pos->second;
+
+      // [NOT FOUND]
+      return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PeResourceIndex::find const
+    //! Find a resource in the first of several languages
+    //!
+    //! \param[in] const& type - Resource type
+    //! \param[in] const& name - Resource name
+    //! \param[in] const* languages - Language ids in order of preference
+    //! \param[in] count - Number of language ids
+    //! \return const ResourceView* - Resource view, the first language if none are present, or nullptr if not found
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const ResourceView*  find(const ResourceName& type, const ResourceName& name, const uint16_t* languages, size_t count) const
+    {
+      Key key {type, name, 0};
+
+      // Search preferred languages, then fallback to first language
+      for (size_t idx = 0; idx <= count; ++idx)
+      {
+        key.Language = idx < count ? languages[idx] : AnyLanguage;
+
+        auto pos = Resources.find(key);
+        if (pos != Resources.end())
+          return &pos->second;
+      }
+
+      // [NOT FOUND]
+      return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PeResourceIndex::size const
+    //! Get the number of resources  (Excluding language fallbacks)
+    //!
+    //! \return size_t - Number of resources
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t  size() const
+    {
+      size_t count = 0;
+      for (auto& r : Resources)
+        if (r.first.Language != AnyLanguage)
+          ++count;
+      return count;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PeResourceIndex::add
+    //! Indexes the resources of an image  (Resources already indexed take precedence)
+    //!
+    //! \param[in] *base - First byte of image
+    //! \param[in] size - Size of image in bytes
+    //! \param[in] layout - Image layout
+    //! \return bool - True if indexed, false if image is malformed  (Nothing is indexed)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  add(const void* base, size_t size, Layout layout)
+    {
+      Image image {static_cast<const uint8_t*>(base), size, layout, 0, 0};
+      Walk state;
+      size_t optional, root;
+      uint16_t magic;
+      uint32_t count, rva, length;
+
+      if (!base || !headers(image, optional) || !image.read(optional, magic))
+        return false;
+
+      // Locate data directory  (Resource directory is third entry)
+      size_t const directory = optional + (magic == 0x20B ? 108 : 92);
+      if (!image.read(directory, count) || count < 3
+       || !image.read(directory + 4 + 2*8, rva) || !image.read(directory + 4 + 2*8 + 4, length))
+        return false;
+
+      // [NO RESOURCES] Valid but empty
+      if (!rva || !length)
+        return true;
+
+      if (!image.locate(rva, length, root))
+        return false;
+
+      // Walk type, name and language levels
+      Image section {image.Base + root, length, layout, 0, 0};
+      if (!walk(image, section, 0, 0, Key {}, state))
+        return false;
+
+      // Merge, preferring existing entries
+      for (auto& r : state.Found)
+        Resources.emplace(r.first, r.second);
+      return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PeResourceIndex::clear
+    //! Removes all resources
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clear()
+    {
+      Resources.clear();
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PeResourceIndex::walk
+    //! Indexes a resource directory, recursively
+    //!
+    //! \param[in] const& image - Entire image  (Data entries are relative virtual addresses)
+    //! \param[in] const& section - Resource section  (Directory offsets are relative to its start)
+    //! \param[in] offset - Offset of directory within section
+    //! \param[in] level - Directory level  (0=Type, 1=Name, 2=Language)
+    //! \param[in] key - Key identifying directory
+    //! \param[in,out] &state - Resources found, and directories visited
+    //! \return bool - True iff directory is valid
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static bool  walk(const Image& image, const Image& section, uint32_t offset, uint32_t level, Key key, Walk& state)
+    {
+      uint16_t named, numbered;
+
+      // [REVISITED] Reject directories referenced more than once  (Cyclic or shared)
+      if (!state.Visited.insert(offset).second)
+        return false;
+
+      // Read entry counts from IMAGE_RESOURCE_DIRECTORY
+      if (!section.read(offset + 12, named) || !section.read(offset + 14, numbered))
+        return false;
+
+      // [EXCESSIVE] Reject entries beyond the section or beyond the cap
+      uint32_t const entries = uint32_t(named) + numbered;
+      if (section.Size - offset < 16 + entries * size_t(8) || (state.Entries += entries) > MaxEntries)
+        return false;
+
+      for (uint32_t idx = 0; idx < entries; ++idx)
+      {
+        uint32_t ident, target;
+        size_t const entry = offset + 16 + idx * 8;
+
+        // Read IMAGE_RESOURCE_DIRECTORY_ENTRY
+        if (!section.read(entry, ident) || !section.read(entry + 4, target))
+          return false;
+
+        // Identify entry by name or ordinal
+        ResourceName name(static_cast<uint16_t>(ident));
+        if (ident & 0x80000000)
+        {
+          uint16_t chars;
+          size_t const str = ident & 0x7FFFFFFF;
+          if (!section.read(str, chars) || str + 2 + chars * 2u > section.Size)
+            return false;
+
+          // Copy name  (UTF-16, unaligned)
+          std::u16string text(chars, u'\0');
+          std::memcpy(&text[0], section.Base + str + 2, chars * 2u);
+          name = ResourceName(text.data(), text.size());
+        }
+
+        switch (level)
+        {
+        case 0: key.Type = name;                break;
+        case 1: key.Name = name;                break;
+        case 2: key.Language = name.Ordinal;    break;
+        }
+
+        // [DIRECTORY] Recurse  (Depth is limited to three levels)
+        if (target & 0x80000000)
+        {
+          if (level >= 2 || !walk(image, section, target & 0x7FFFFFFF, level + 1, key, state))
+            return false;
+        }
+        // [DATA] Read IMAGE_RESOURCE_DATA_ENTRY and locate data
+        else if (level == 2)
+        {
+          uint32_t rva, size, codepage;
+          size_t data;
+          if (!section.read(target, rva) || !section.read(target + 4, size) || !section.read(target + 8, codepage)
+           || !image.locate(rva, size, data))
+            return false;
+
+          ResourceView const view {image.Base + data, size, codepage};
+          state.Found.emplace(key, view);
+
+          // Index first language as fallback
+          Key any = key;
+          any.Language = AnyLanguage;
+          state.Found.emplace(std::move(any), view);
+        }
+        else
+          return false;
+      }
+      return true;
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct MappedImage - Maps an image file into memory read-only, and indexes its resources
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct MappedImage
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = MappedImage;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    const void*      Base;         //!< Mapped view, or nullptr
+    size_t           Size;         //!< Size of view in bytes
+    PeResourceIndex  Index;        //!< Resource index
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // MappedImage::MappedImage
+    //! Maps and indexes an image file
+    //!
+    //! \param[in] *path - Full path of file
+    //!
+    //! \remarks Check 'exists' to determine whether the file was mapped and is a valid image
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit MappedImage(const char* path) : Base(nullptr), Size(0)
+    {
+#ifdef _WIN32
+      ::HANDLE file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+      if (file != INVALID_HANDLE_VALUE)
+      {
+        ::LARGE_INTEGER length;
+        if (::GetFileSizeEx(file, &length) && length.QuadPart > 0)
+          if (::HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr))
+          {
+            Base = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            Size = Base ? static_cast<size_t>(length.QuadPart) : 0;
+            ::CloseHandle(mapping);
+          }
+        ::CloseHandle(file);
+      }
+#else
+      int fd = ::open(path, O_RDONLY);
+      if (fd != -1)
+      {
+        struct stat info;
+        if (::fstat(fd, &info) == 0 && info.st_size > 0)
+        {
+          void* view = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+          if (view != MAP_FAILED)
+            Base = view, Size = static_cast<size_t>(info.st_size);
+        }
+        ::close(fd);
+      }
+#endif
+      // [INVALID] Release view
+      if (Base && !Index.add(Base, Size, PeResourceIndex::Layout::File))
+        unmap();
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(MappedImage);      //!< Cannot be copied
+    DISABLE_MOVE(MappedImage);      //!< Cannot be moved
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // MappedImage::~MappedImage
+    //! Unmaps the image
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~MappedImage()
+    {
+      unmap();
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // MappedImage::exists const
+    //! Query whether the file was mapped and is a valid image
+    //!
+    //! \return bool - True iff mapped
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  exists() const
+    {
+      return Base != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // MappedImage::resources const
+    //! Get the resource index
+    //!
+    //! \return const PeResourceIndex& - Resource index
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const PeResourceIndex&  resources() const
+    {
+      return Index;
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // MappedImage::unmap
+    //! Releases the view, if any
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  unmap()
+    {
+      if (Base)
+      {
+        Index.clear();
+#ifdef _WIN32
+        ::UnmapViewOfFile(Base);
+#else
+        ::munmap(const_cast<void*>(Base), Size);
+#endif
+        Base = nullptr;
+        Size = 0;
+      }
+    }
+  };
+
+} // namespace wtl
+
+#endif  // WTL_PE_RESOURCE_INDEX_HPP
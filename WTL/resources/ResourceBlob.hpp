@@ -11,6 +11,7 @@
 #include <wtl/WTL.hpp>
 #include <wtl/traits/GlobalTraits.hpp>
 #include <wtl/traits/ResourceTraits.hpp>
+#include <wtl/resources/PeResourceIndex.hpp>     //!< ResourceView
 
 //! \namespace wtl - Windows template library
 namespace wtl
@@ -31,6 +32,7 @@ namespace wtl
   
   private:
     const void* Data;       //!< ResourceBlob data
+    uint32_t    Length;     //!< ResourceBlob size, in bytes
     
     // ------------------------------------ CONSTRUCTION ------------------------------------
   public:
@@ -41,7 +43,8 @@ namespace wtl
     ResourceBlob() : Module(defvalue<HModule>()),
                      Handle(defvalue<HResource>()),
                      Block(defvalue<HGlobal>()),
-                     Data(nullptr)
+                     Data(nullptr),
+                     Length(0)
     {
     }
     
@@ -57,12 +60,27 @@ namespace wtl
     ResourceBlob(const HModule& module, const HResource& resource) : Module(module),
                                                                      Handle(resource),
                                                                      Block(module,resource),
-                                                                     Data(::LockResource(Block))
+                                                                     Data(::LockResource(Block)),
+                                                                     Length(::SizeofResource(module, resource))
     {
       // Ensure data exists
       if (!Data)
         throw platform_error(HERE, "Unable to lock resource");
     }
+    
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ResourceBlob::ResourceBlob
+    //! Create from a view of resource data within an indexed image  (No handles are held)
+    //!
+    //! \param[in] const& view - Resource view
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit ResourceBlob(const ResourceView& view) : Module(defvalue<HModule>()),
+                                                      Handle(defvalue<HResource>()),
+                                                      Block(defvalue<HGlobal>()),
+                                                      Data(view.Data),
+                                                      Length(view.Size)
+    {
+    }
 
     // -------------------------------- COPY, MOVE & DESTROY --------------------------------
   public:
@@ -82,7 +100,7 @@ namespace wtl
     /////////////////////////////////////////////////////////////////////////////////////////
     bool exists() const
     {
-      return Handle.exists();
+      return Data != nullptr;
     }
     
     /////////////////////////////////////////////////////////////////////////////////////////
@@ -107,7 +125,7 @@ namespace wtl
     /////////////////////////////////////////////////////////////////////////////////////////
     long32_t size() const
     {
-      return ::SizeofResource(Module, Handle);
+      return Length;
     }
     
     /////////////////////////////////////////////////////////////////////////////////////////
@@ -122,7 +140,8 @@ namespace wtl
       return this->Handle == r.Handle
           && this->Module == r.Module
           && this->Block == r.Block
-          && this->Data == r.Data;
+          && this->Data == r.Data
+          && this->Length == r.Length;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////
@@ -9,8 +9,7 @@
 #define WTL_STRING_RESOURCES_HPP
 
 #include <wtl/WTL.hpp>
-#include <wtl/Resources/ResourceBlob.hpp>       //!< ResourceBlob
-#include <wtl/modules/ModuleCollection.h>       //!< LoadedModules
+#include <wtl/resources/StringTableCache.hpp>   //!< StringTableCache
 #include <wtl/utils/String.hpp>                 //!< String
 
 //! \namespace wtl - Windows template library
@@ -19,66 +18,16 @@ namespace wtl
   
   /////////////////////////////////////////////////////////////////////////////////////////
   //! \struct StringResource - Encapsulates loading a string from the resource table
+  //!
+  //! \remarks String tables are decoded once, by the process-wide StringTableCache
   /////////////////////////////////////////////////////////////////////////////////////////
   struct StringResource 
   {      
     // ---------------------------------- TYPES & CONSTANTS ---------------------------------
-  protected:
-#pragma pack (push, 1)
-    /////////////////////////////////////////////////////////////////////////////////////////
-    //! \struct StringTableEntry - Variable length string table entry
-    //!
-    //! \remarks String table is a block of 16 PASCAL-style strings (Prefixed with length as WORD)
-    //! \remarks Some of the 16 entries may be blank (Zero length, null string)
-    /////////////////////////////////////////////////////////////////////////////////////////
-    struct StringTableEntry
-    {
-      // ---------------------------------- TYPES & CONSTANTS ---------------------------------
-      
-      //! \var size - 
-      static constexpr int32_t  size = sizeof(wchar_t) + sizeof(uint16_t);
-      
-      // ----------------------------------- REPRESENTATION -----------------------------------
-
-      uint16_t       Length;        //!< Length of current entry, in characters
-      const wchar_t  Text[0xFFFF];  //!< String Text in UTF16
-
-      // ------------------------------------ CONSTRUCTION ------------------------------------
-	
-      DISABLE_CTOR(StringTableEntry);     //!< Cannot instantiate
-
-      // -------------------------------- COPY, MOVE & DESTROY --------------------------------
-
-      DISABLE_COPY(StringTableEntry);     //!< Cannot instantiate
-      DISABLE_MOVE(StringTableEntry);     //!< Cannot instantiate
-      DISABLE_DTOR(StringTableEntry);     //!< Cannot instantiate
-
-      // ---------------------------------- ACCESSOR METHODS ----------------------------------			
-
-      /////////////////////////////////////////////////////////////////////////////////////////
-      // StringTableEntry::next
-      //! Advance beyond this variable length entry to the next
-      //! 
-      //! \return const StringTableEntry* - Immutable pointer to next string in table
-      /////////////////////////////////////////////////////////////////////////////////////////
-      const StringTableEntry* next() const
-      {
-        // [EMPTY] Skip entry
-        if (!Length)
-          return reinterpret_cast<const StringTableEntry*>(Text);
-
-        // [NON-EMPTY] Skip entry text 
-        return reinterpret_cast<const StringTableEntry*>(Text + Length);
-      }
-      
-      // ----------------------------------- MUTATOR METHODS ----------------------------------
-    };
-#pragma pack (pop)
 
     // ----------------------------------- REPRESENTATION -----------------------------------
   protected:
-    ResourceBlob             Table;       //!< Table resource
-    const StringTableEntry*  Entry;       //!< Desired entry
+    StringTableCache::Entry  Entry;       //!< Interned string
     uint16_t                 Ident;       //!< String id
     
     // ------------------------------------ CONSTRUCTION ------------------------------------
@@ -96,20 +45,15 @@ namespace wtl
     //! \throw wtl::platform_error - Unable to load resource
     /////////////////////////////////////////////////////////////////////////////////////////
     template <Encoding ENC> explicit 
-    StringResource(ResourceId<ENC> id, LanguageId lang = LanguageId::Neutral) : Table(LoadedModules.findString(id,lang)), 
-                                                                                Entry(Table.get<StringTableEntry>()),
+    StringResource(ResourceId<ENC> id, LanguageId lang = LanguageId::Neutral) : Entry(StringTableCache::instance().find(id,lang)),
                                                                                 Ident(id.toOrdinal())
     {
       // [CHECK] Ensure table found
-      if (!Table.exists())
+      if (!Entry.Text)
         throw platform_error(HERE, "String resource ", Ident, " does not exist");
 
-      // Find desired string
-      for (int32_t i = 0, index = Ident % 16; Entry && i < index; i++)
-        Entry = Entry->next();
-
       // [NOT-FOUND] Return false & empty string 
-      if (!Entry || !Entry->Length)
+      if (!Entry.Length)
         throw logic_error(HERE, "String resource ", Ident, " does not exist");
     }
     
@@ -135,7 +79,7 @@ namespace wtl
     String<ENC> c_str() const
     {
       // Copy string as UTF16 (Convert on return if necessary)
-      return String<Encoding::UTF16>(Entry->Text, Entry->Text+Entry->Length);
+      return String<Encoding::UTF16>(Entry.Text, Entry.Text+Entry.Length);
     }
       
     // ----------------------------------- MUTATOR METHODS ----------------------------------
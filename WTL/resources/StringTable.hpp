@@ -0,0 +1,265 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\resources\StringTable.hpp
+//! \brief Decodes string table blocks, interning their text in a shared pool
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_STRING_TABLE_HPP
+#define WTL_STRING_TABLE_HPP
+
+#include <wtl/WTL.hpp>
+#include <algorithm>                            //!< std::copy, std::equal
+#include <array>                                //!< std::array
+#include <deque>                                //!< std::deque
+#include <memory>                               //!< std::unique_ptr
+#include <unordered_map>                        //!< std::unordered_map
+#include <unordered_set>                        //!< std::unordered_set
+#include <vector>                               //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct StringTable - Decoded blocks of 16 strings, by language, whose text is interned in a shared pool
+  //!
+  //! \remarks Each block of a string table resource holds 16 UTF-16 strings, each prefixed by its length in characters.
+  //! \remarks Identical strings (across blocks and languages) share storage. Text is null-terminated and remains valid
+  //! \remarks until the table is cleared.
+  //!
+  //! \remarks Blocks are associated with the generation of the modules from which they were decoded. A change of
+  //! \remarks generation discards every block (since resources may have been loaded or unloaded) but retains the text.
+  //!
+  //! \remarks Does not depend upon any Win32 API, and is not synchronised
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct StringTable
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = StringTable;
+
+    //! \var BlockCount - Number of 16-string blocks addressable by 16-bit string ids
+    static constexpr uint32_t  BlockCount = 0x10000 / 16;
+
+    //! \var ChunkSize - Minimum size of each pool allocation, in characters
+    static constexpr uint32_t  ChunkSize = 16 * 1024;
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Entry - Decoded string
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Entry
+    {
+      const char16_t*  Text;      //!< Interned text, or nullptr if the block does not exist
+      uint16_t         Length;    //!< Length in characters, or zero if the string does not exist
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Block - Decoded block of 16 strings
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Block
+    {
+      std::array<Entry,16>  Strings;      //!< Strings in order of id
+    };
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Language - Decoded blocks of a single language
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Language
+    {
+      std::vector<const Block*>  Index;       //!< Blocks by block number  (nullptr if not yet decoded)
+      std::deque<Block>          Blocks;      //!< Storage for decoded blocks
+
+      Language() : Index(BlockCount, nullptr)
+      {}
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct TextHash - Hashes interned text
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct TextHash
+    {
+      size_t operator () (const Entry& e) const
+      {
+        // FNV-1a
+        size_t hash = 2166136261u;
+        for (uint16_t idx = 0; idx < e.Length; ++idx)
+          hash = (hash ^ static_cast<size_t>(e.Text[idx])) * 16777619u;
+        return hash;
+      }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct TextEqual - Compares interned text
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct TextEqual
+    {
+      bool operator () (const Entry& l, const Entry& r) const
+      {
+        return l.Length == r.Length && std::equal(l.Text, l.Text + l.Length, r.Text);
+      }
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::unordered_map<uint16_t,Language>               Languages;      //!< Decoded blocks, by language id
+    std::unordered_set<Entry,TextHash,TextEqual>        Interned;       //!< Distinct strings
+    std::vector<std::unique_ptr<char16_t[]>>            Chunks;         //!< Pool storage
+    char16_t*                                           Cursor;         //!< Next free character in current chunk
+    uint32_t                                            Remaining;      //!< Free characters in current chunk
+    uint32_t                                            Generation;     //!< Generation of modules from which blocks were decoded
+    Block                                               Missing;        //!< Sentinel representing a block which does not exist
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StringTable::StringTable
+    //! Create empty table
+    //!
+    //! \param[in] generation - [optional] Current generation of modules
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit StringTable(uint32_t generation = 0) : Cursor(nullptr), Remaining(0), Generation(generation)
+    {
+      Missing.Strings.fill(Entry {nullptr, 0});
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(StringTable);      //!< Cannot be copied  (Blocks refer to pool and sentinel)
+    DISABLE_MOVE(StringTable);      //!< Cannot be moved  (Blocks refer to sentinel)
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StringTable::size const
+    //! Get the number of distinct strings
+    //!
+    //! \return uint32_t - Number of interned strings
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  size() const
+    {
+      return static_cast<uint32_t>(Interned.size());
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StringTable::cached
+    //! Get a decoded block, if any, first discarding every block if the generation has changed
+    //!
+    //! \param[in] block - Zero-based block number
+    //! \param[in] lang - Block language
+    //! \param[in] generation - Current generation of modules
+    //! \return const Block* - Decoded block, the 'Missing' sentinel, or nullptr if not yet decoded
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const Block*  cached(uint32_t block, uint16_t lang, uint32_t generation)
+    {
+      // [MODULES CHANGED] Discard blocks, which may since have been loaded or unloaded  (Interned text remains valid)
+      if (generation != Generation)
+      {
+        Languages.clear();
+        Generation = generation;
+      }
+
+      auto pos = Languages.find(lang);
+      return pos != Languages.end() ? pos->second.Index[block] : nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StringTable::clear
+    //! Discards all blocks and strings  (Invalidates the text of every entry)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clear()
+    {
+      Languages.clear();
+      Interned.clear();
+      Chunks.clear();
+      Cursor = nullptr;
+      Remaining = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StringTable::decode
+    //! Decodes a block of 16 length-prefixed strings, caching it if it was located in the current generation
+    //!
+    //! \param[in] block - Zero-based block number
+    //! \param[in] lang - Block language
+    //! \param[in] generation - Generation of modules in which the block was located
+    //! \param[in] const* text - Resource data, or nullptr if the block does not exist
+    //! \param[in] length - Length of resource data, in characters
+    //! \return Block - Decoded block, or the 'Missing' sentinel
+    //!
+    //! \remarks Strings extending beyond the data are treated as empty, as are any missing entirely. Callers should
+    //! \remarks first query cached(), which also observes any change of generation.
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Block  decode(uint32_t block, uint16_t lang, uint32_t generation, const char16_t* text, size_t length)
+    {
+      // [MISSING] Remember absence
+      if (!text)
+      {
+        if (generation == Generation)
+          Languages[lang].Index[block] = &Missing;
+        return Missing;
+      }
+
+      // Decode 16 PASCAL-style strings, each prefixed with its length  (Always UTF-16, irrespective of sizeof(wchar_t))
+      Block decoded;
+      const char16_t* const end = text + length;
+      for (Entry& str : decoded.Strings)
+      {
+        uint16_t const chars = text < end ? static_cast<uint16_t>(*text++) : 0;
+
+        // [TRUNCATED] Ignore malformed entries
+        str = (chars && chars <= end - text) ? intern(text, chars) : intern(text, 0);
+        text += std::min<ptrdiff_t>(chars, end - text);
+      }
+
+      // [CURRENT] Cache unless modules changed while locating the block
+      if (generation == Generation)
+      {
+        Language& language = Languages[lang];
+        language.Blocks.push_back(decoded);
+        language.Index[block] = &language.Blocks.back();
+      }
+      return decoded;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StringTable::intern
+    //! Finds or copies a string into the pool
+    //!
+    //! \param[in] *text - Text  (Need not be null-terminated)
+    //! \param[in] length - Length in characters
+    //! \return Entry - Interned string
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Entry  intern(const char16_t* text, uint16_t length)
+    {
+      // [DUPLICATE] Share existing text
+      auto pos = Interned.find(Entry {text, length});
+      if (pos != Interned.end())
+        return *pos;
+
+      // [FULL] Allocate chunk large enough for text and terminator
+      if (Remaining < length + 1u)
+      {
+        Remaining = (length + 1u > ChunkSize ? length + 1u : ChunkSize);
+        Chunks.emplace_back(new char16_t[Remaining]);
+        Cursor = Chunks.back().get();
+      }
+
+      // Copy text and null-terminate
+      Entry str {Cursor, length};
+      std::copy(text, text + length, Cursor);
+      Cursor[length] = u'\0';
+      Cursor += length + 1;
+      Remaining -= length + 1;
+
+      Interned.insert(str);
+      return str;
+    }
+  };
+
+} // namespace wtl
+
+#endif  // WTL_STRING_TABLE_HPP
@@ -0,0 +1,228 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\resources\StringTableCache.hpp
+//! \brief Provides a process-wide cache of decoded string table resources
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_STRING_TABLE_CACHE_HPP
+#define WTL_STRING_TABLE_CACHE_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/resources/ResourceBlob.hpp>       //!< ResourceBlob
+#include <wtl/resources/ResourceId.hpp>         //!< ResourceId
+#include <wtl/resources/StringTable.hpp>        //!< StringTable
+#include <wtl/modules/ModuleCollection.h>       //!< LoadedModules
+#include <wtl/threads/ThreadPool.hpp>           //!< ThreadPool, Task
+#include <wtl/utils/Exception.hpp>              //!< invalid_argument
+#include <mutex>                                //!< std::mutex
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct StringTableCache - Decodes each block of 16 strings in the string table of the loaded modules once,
+  //!  interning the text of every string in a shared pool  (See StringTable)
+  //!
+  //! \remarks Blocks are decoded upon first use, or in bulk by 'preload'. Each language is cached separately and
+  //! \remarks lookups index an array of blocks directly, so the cost of a lookup is independent of its position
+  //! \remarks within the block. Identical strings (across blocks and languages) share storage.
+  //!
+  //! \remarks Text is UTF-16, null-terminated, and remains valid until the cache is cleared. Decoded blocks (and the
+  //! \remarks absence of blocks) are discarded whenever a module is loaded or unloaded, and decoded again upon next
+  //! \remarks use; previously interned text remains valid.
+  //!
+  //! \remarks Resources are located without holding the cache lock, so lookups of cached strings are never delayed
+  //! \remarks by a search of the loaded modules.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct StringTableCache
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = StringTableCache;
+
+    //! \alias Entry - Cached string
+    using Entry = StringTable::Entry;
+
+  protected:
+    //! \alias Block - Decoded block of 16 strings
+    using Block = StringTable::Block;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    mutable std::mutex   Lock;        //!< Protects all state
+    StringTable          Table;       //!< Decoded blocks and interned text
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StringTableCache::StringTableCache
+    //! Create empty cache
+    /////////////////////////////////////////////////////////////////////////////////////////
+    StringTableCache() : Table(LoadedModules.generation())
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(StringTableCache);      //!< Cannot be copied
+    DISABLE_MOVE(StringTableCache);      //!< Cannot be moved
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StringTableCache::instance
+    //! Get the process-wide cache
+    //!
+    //! \return StringTableCache& - Shared cache
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static StringTableCache&  instance()
+    {
+      static StringTableCache  cache;
+      return cache;
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StringTableCache::size const
+    //! Get the number of distinct strings
+    //!
+    //! \return uint32_t - Number of interned strings
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  size() const
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      return Table.size();
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StringTableCache::clear
+    //! Discards all cached strings  (Invalidates the text of every entry)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clear()
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      Table.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StringTableCache::find
+    //! Find a string, decoding its block if necessary
+    //!
+    //! \tparam ENC - Resource id character encoding
+    //!
+    //! \param[in] id - String identifier
+    //! \param[in] lang - [optional] String language
+    //! \return Entry - String, possibly empty
+    //!
+    //! \throw wtl::invalid_argument - String ids must be numeric constants
+    //! \throw wtl::platform_error - Unable to load resource
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <Encoding ENC>
+    Entry  find(ResourceId<ENC> id, LanguageId lang = LanguageId::Neutral)
+    {
+      if (!id.isOrdinal())
+        throw invalid_argument(HERE, "String ids must be numeric constants");
+
+      uint16_t const ident = id.toOrdinal();
+      {
+        std::lock_guard<std::mutex> guard(Lock);
+
+        // [CACHED] Return decoded string
+        if (const Block* b = cached(ident / 16, lang))
+          return b->Strings[ident % 16];
+      }
+
+      return load(ident / 16, lang).Strings[ident % 16];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StringTableCache::preload
+    //! Decodes every block within a range of string ids
+    //!
+    //! \param[in] lang - [optional] String language
+    //! \param[in] first - [optional] First string id
+    //! \param[in] last - [optional] Last string id  (Inclusive)
+    //!
+    //! \throw wtl::platform_error - Unable to load resource
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  preload(LanguageId lang = LanguageId::Neutral, uint16_t first = 0, uint16_t last = 0xFFFF)
+    {
+      for (uint32_t block = first / 16; block <= last / 16u; ++block)
+      {
+        {
+          std::lock_guard<std::mutex> guard(Lock);
+          if (cached(block, lang))
+            continue;
+        }
+
+        load(block, lang);
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StringTableCache::preloadAsync
+    //! Decodes every block within a range of string ids upon the shared thread pool
+    //!
+    //! \param[in] lang - [optional] String language
+    //! \param[in] first - [optional] First string id
+    //! \param[in] last - [optional] Last string id  (Inclusive)
+    //! \return Task<void> - Completes once every block is decoded
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Task<void>  preloadAsync(LanguageId lang = LanguageId::Neutral, uint16_t first = 0, uint16_t last = 0xFFFF)
+    {
+      return ThreadPool::shared().async([this, lang, first, last] { preload(lang, first, last); });
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StringTableCache::cached
+    //! Get a decoded block, if any  (Caller must hold 'Lock')
+    //!
+    //! \param[in] block - Zero-based block number
+    //! \param[in] lang - Block language
+    //! \return const Block* - Decoded block, the sentinel of a missing block, or nullptr if not yet decoded
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const Block*  cached(uint32_t block, LanguageId lang)
+    {
+      return Table.cached(block, lang, LoadedModules.generation());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // StringTableCache::load
+    //! Locates and decodes a block  (Caller must not hold 'Lock')
+    //!
+    //! \param[in] block - Zero-based block number
+    //! \param[in] lang - Block language
+    //! \return Block - Decoded block, or the sentinel of a missing block
+    //!
+    //! \throw wtl::platform_error - Unable to load resource
+    //!
+    //! \remarks Blocks located while a module was loaded or unloaded are returned but not cached
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Block  load(uint32_t block, LanguageId lang)
+    {
+      uint32_t const generation = LoadedModules.generation();
+
+      // Lookup string table resource without lock  (Resource name is the one-based block number)
+      ResourceBlob table = LoadedModules.findString(ResourceId<Encoding::UTF16>(static_cast<uint16_t>(block * 16)), lang);
+
+      std::lock_guard<std::mutex> guard(Lock);
+
+      // [DECODED] Another thread decoded the block meanwhile
+      if (const Block* b = cached(block, lang))
+        return *b;
+
+      // Decode, or remember absence
+      if (!table.exists())
+        return Table.decode(block, lang, generation, nullptr, 0);
+      return Table.decode(block, lang, generation, table.get<char16_t>(), table.size() / sizeof(char16_t));
+    }
+  };
+
+} // namespace wtl
+
+#endif  // WTL_STRING_TABLE_CACHE_HPP
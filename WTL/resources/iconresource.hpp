@@ -9,7 +9,7 @@
 #define WTL_ICON_RESOURCES_HPP
 
 #include <wtl/WTL.hpp>
-#include <wtl/Resources/ResourceBlob.hpp>   //!< ResourceBlob
+#include <wtl/resources/ResourceBlob.hpp>   //!< ResourceBlob
 #include <wtl/traits/IconTraits.hpp>        //!< HIcon
 #include <wtl/platform/Locale.hpp>          //!< LanguageId
 #include <wtl/resources/ResourceId.hpp>      //!< ResourceId
@@ -0,0 +1,410 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\threads\EpochDomain.hpp
+//! \brief Provides epoch-based deferred reclamation for read-copy-update structures
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_EPOCH_DOMAIN_HPP
+#define WTL_EPOCH_DOMAIN_HPP
+
+#include <wtl/WTL.hpp>
+#include <algorithm>                          //!< std::remove_if
+#include <atomic>                             //!< std::atomic
+#include <mutex>                              //!< std::mutex, std::lock_guard
+#include <thread>                             //!< std::this_thread
+#include <vector>                             //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct EpochDomain - Tracks readers of published data so that superseded versions can be reclaimed
+  //!  once no reader can still observe them
+  //!
+  //! \remarks Readers announce themselves in one of two reader counters, selected by the parity of the global
+  //! \remarks epoch and striped across cache lines by thread. Entering and leaving a read section never blocks.
+  //!
+  //! \remarks Writers retire superseded objects tagged with the current epoch. The epoch only advances once every
+  //! \remarks reader of the preceding epoch has left, therefore an object retired at epoch 'n' is unreachable once
+  //! \remarks the epoch reaches 'n+2'. Reclamation is opportunistic upon retirement and upon leaving a read section,
+  //! \remarks unless a writer elects to wait for pre-existing readers with 'synchronize'.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct EpochDomain
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = EpochDomain;
+
+    //! \alias ticket_t - Define read-section ticket type
+    using ticket_t = uint32_t;
+
+    //! \var stripes - Number of reader counters per epoch parity
+    static constexpr uint32_t  stripes = 16;
+
+  protected:
+    //! \alias deleter_t - Define retired object deleter type
+    using deleter_t = void (*)(void*);
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct ReaderCount - Reader counter padded to occupy an entire cache line
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct alignas(64) ReaderCount
+    {
+      std::atomic<uint32_t>  Value;     //!< Number of readers within a read section
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct RetiredObject - Superseded object awaiting reclamation
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct RetiredObject
+    {
+      uint32_t   Epoch;       //!< Epoch at retirement
+      void*      Object;      //!< Retired object
+      deleter_t  Deleter;     //!< Deletes the object
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::atomic<uint32_t>       Epoch;                  //!< Global epoch
+    ReaderCount                 Readers[2][stripes];    //!< Reader counters indexed by epoch parity
+    mutable std::mutex          Lock;                   //!< Serializes retirement and reclamation
+    std::vector<RetiredObject>  Retired;                //!< Objects awaiting reclamation
+    std::atomic<uint32_t>       Backlog;                //!< Number of objects awaiting reclamation
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochDomain::EpochDomain
+    //! Create domain with no readers and nothing retired
+    /////////////////////////////////////////////////////////////////////////////////////////
+    EpochDomain() : Epoch(0), Backlog(0)
+    {
+      for (auto& parity : Readers)
+        for (auto& count : parity)
+          count.Value.store(0, std::memory_order_relaxed);
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(EpochDomain);      //!< Cannot be copied
+    DISABLE_MOVE(EpochDomain);      //!< Cannot be moved
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochDomain::~EpochDomain
+    //! Reclaims all retired objects
+    //!
+    //! \remarks No reader may be within a read section upon destruction
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~EpochDomain()
+    {
+      for (auto& r : Retired)
+        r.Deleter(r.Object);
+    }
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochDomain::shared
+    //! Access the process-wide domain shared by all read-copy-update structures by default
+    //!
+    //! \return EpochDomain& - Shared domain
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static EpochDomain&  shared()
+    {
+      static EpochDomain  domain;
+      return domain;
+    }
+
+  private:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochDomain::depth
+    //! Get the number of read sections (of any domain) the calling thread is within
+    //!
+    //! \return uint32_t& - Nesting depth
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t&  depth()
+    {
+      static thread_local uint32_t  sections = 0;
+      return sections;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochDomain::stripe
+    //! Get the reader counter stripe assigned to the calling thread
+    //!
+    //! \return uint32_t - Zero-based stripe index
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t  stripe()
+    {
+      static std::atomic<uint32_t>  next(0);
+      static thread_local uint32_t  index = next.fetch_add(1, std::memory_order_relaxed) % stripes;
+      return index;
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochDomain::pending const
+    //! Query the number of retired objects awaiting reclamation
+    //!
+    //! \return size_t - Number of retired objects
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t  pending() const
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      return Retired.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochDomain::backlog const
+    //! Query whether any retired objects await reclamation, without blocking
+    //!
+    //! \return bool - True iff objects await reclamation
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  backlog() const
+    {
+      return Backlog.load(std::memory_order_relaxed) != 0;
+    }
+
+  private:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochDomain::quiescent const
+    //! Query whether all readers of an epoch parity have left their read sections
+    //!
+    //! \param[in] parity - Epoch parity
+    //! \return bool - True iff no readers remain
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  quiescent(uint32_t parity) const
+    {
+      for (auto& count : Readers[parity & 1])
+        if (count.Value.load(std::memory_order_seq_cst) != 0)
+          return false;
+
+      return true;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochDomain::enter
+    //! Enters a read section. Any object loaded within the section remains valid until the section is left.
+    //!
+    //! \return ticket_t - Ticket identifying the read section
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ticket_t  enter()
+    {
+      uint32_t const s = stripe();
+
+      for (;;)
+      {
+        uint32_t const e = Epoch.load(std::memory_order_seq_cst);
+
+        // Announce reader then ensure the epoch did not advance meanwhile
+        Readers[e & 1][s].Value.fetch_add(1, std::memory_order_seq_cst);
+        if (Epoch.load(std::memory_order_seq_cst) == e)
+        {
+          ++depth();
+          return (e & 1) * stripes + s;
+        }
+
+        // [RETRY] Epoch advanced
+        Readers[e & 1][s].Value.fetch_sub(1, std::memory_order_release);
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochDomain::leave
+    //! Leaves a read section
+    //!
+    //! \param[in] ticket - Ticket returned by 'enter'
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  leave(ticket_t ticket)
+    {
+      --depth();
+      Readers[ticket / stripes][ticket % stripes].Value.fetch_sub(1, std::memory_order_release);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochDomain::retire
+    //! Retires an object that has been unpublished, and reclaims any objects no longer reachable by readers
+    //!
+    //! \tparam T - Object type
+    //!
+    //! \param[in] *obj - Object allocated with 'new' (Transfers ownership to the domain)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    void  retire(T* obj)
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+
+      // Tag with current epoch
+      if (obj)
+      {
+        Retired.push_back({ Epoch.load(std::memory_order_seq_cst), obj, [](void* p) { delete static_cast<T*>(p); } });
+        Backlog.store(static_cast<uint32_t>(Retired.size()), std::memory_order_relaxed);
+      }
+
+      reclaim();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochDomain::collect
+    //! Reclaims any retired objects no longer reachable by readers
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  collect()
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      reclaim();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochDomain::tryCollect
+    //! Reclaims any retired objects no longer reachable by readers, unless another thread is doing so
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  tryCollect()
+    {
+      std::unique_lock<std::mutex> guard(Lock, std::try_to_lock);
+      if (guard.owns_lock())
+        reclaim();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochDomain::synchronize
+    //! Waits until every read section entered before the call has been left, then reclaims every object
+    //! retired before the call
+    //!
+    //! \return bool - True if objects were reclaimed, false if the calling thread is within a read section
+    //!
+    //! \remarks Waiting from within a read section would never complete, therefore such callers are left to
+    //! \remarks opportunistic reclamation instead
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  synchronize()
+    {
+      // [READER] Cannot wait upon ourselves
+      if (depth() != 0)
+        return false;
+
+      uint32_t const target = Epoch.load(std::memory_order_seq_cst) + 2;
+
+      for (;;)
+      {
+        {
+          std::lock_guard<std::mutex> guard(Lock);
+
+          // Advance towards the target epoch while readers have left
+          while (static_cast<int32_t>(Epoch.load(std::memory_order_seq_cst) - target) < 0 && advance())
+          {}
+
+          // [REACHED] Delete everything retired before the call
+          if (static_cast<int32_t>(Epoch.load(std::memory_order_seq_cst) - target) >= 0)
+          {
+            release();
+            return true;
+          }
+        }
+        std::this_thread::yield();
+      }
+    }
+
+  private:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochDomain::advance
+    //! Advances the epoch iff all readers of the parity being reused have left
+    //!
+    //! \return bool - True iff advanced
+    //!
+    //! \remarks Caller must hold 'Lock'
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  advance()
+    {
+      uint32_t const e = Epoch.load(std::memory_order_seq_cst);
+      if (!quiescent(e + 1))
+        return false;
+
+      Epoch.store(e + 1, std::memory_order_seq_cst);
+      return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochDomain::reclaim
+    //! Advances the epoch (at most twice) where possible, then deletes objects retired two or more epochs ago
+    //!
+    //! \remarks Caller must hold 'Lock'
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  reclaim()
+    {
+      // Advance epoch while readers of the parity being reused have left
+      for (int32_t n = 0; n < 2 && !Retired.empty() && advance(); ++n)
+      {}
+
+      release();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochDomain::release
+    //! Deletes objects retired two or more epochs ago
+    //!
+    //! \remarks Caller must hold 'Lock'
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  release()
+    {
+      // Delete objects retired at least two epochs ago
+      uint32_t const now = Epoch.load(std::memory_order_seq_cst);
+      auto last = std::remove_if(Retired.begin(), Retired.end(), [now] (const RetiredObject& r)
+      {
+        if (now - r.Epoch < 2)
+          return false;
+
+        r.Deleter(r.Object);
+        return true;
+      });
+      Retired.erase(last, Retired.end());
+      Backlog.store(static_cast<uint32_t>(Retired.size()), std::memory_order_relaxed);
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct EpochGuard - Scoped read section within an epoch domain
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct EpochGuard
+  {
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    EpochDomain&           Domain;      //!< Domain
+    EpochDomain::ticket_t  Ticket;      //!< Read section ticket
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochGuard::EpochGuard
+    //! Enters a read section
+    //!
+    //! \param[in,out] &domain - Epoch domain
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit EpochGuard(EpochDomain& domain) : Domain(domain), Ticket(domain.enter())
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(EpochGuard);      //!< Cannot be copied
+    DISABLE_MOVE(EpochGuard);      //!< Cannot be moved
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // EpochGuard::~EpochGuard
+    //! Leaves the read section, reclaiming objects retired meanwhile where possible
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~EpochGuard()
+    {
+      Domain.leave(Ticket);
+
+      // Objects retired by (or during) this section may now be unreachable
+      if (Domain.backlog())
+        Domain.tryCollect();
+    }
+  };
+
+} // namespace wtl
+
+#endif  // WTL_EPOCH_DOMAIN_HPP
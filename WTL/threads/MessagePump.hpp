@@ -14,6 +14,13 @@
 #include <wtl/resources/ResourceId.hpp>             //!< ResourceId
 #include <wtl/platform/WindowFlags.hpp>             //!< ShowWindowFlags
 #include <wtl/windows/MessageBox.hpp>               //!< MessageBox
+#include <wtl/windows/MessageWindow.hpp>            //!< MessageWindow
+#include <wtl/threads/WorkQueue.hpp>                //!< WorkQueue
+#include <wtl/threads/PumpScheduler.hpp>            //!< PumpScheduler
+#include <wtl/casts/EnumCast.hpp>                   //!< enum_cast
+#include <algorithm>                                //!< std::min
+#include <atomic>                                   //!< std::atomic
+#include <chrono>                                   //!< std::chrono::milliseconds
 #include <stdexcept>                                //!< std::exception
 
 //! \namespace wtl - Windows template library
@@ -44,6 +51,9 @@ namespace wtl
     //! \alias window_t - Define window type
     using window_t = WINDOW;
 
+    //! \alias work_t - Define posted work item type
+    using work_t = WorkQueue::work_t;
+
     //! \enum PumpState - Define message pump states
     enum class PumpState
     {
@@ -54,12 +64,106 @@ namespace wtl
       //DialogModal,    //!< Pumping within modal dialog loop
       //MsgBoxModal,    //!< Pumping within modal msgbox loop
     };
+
+  private:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct MessageSource - Supplies messages from the thread message queue to the scheduler
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct MessageSource
+    {
+      //! \alias message_t - Define message type
+      using message_t = ::MSG;
+
+      type&  Pump;      //!< Message pump
+
+      explicit MessageSource(type& pump) : Pump(pump)
+      {}
+
+      bool peek(::MSG& msg)
+      {
+        return WinAPI<encoding>::peekMessage(&msg, nullptr, 0ul, 0ul, PM_REMOVE) != FALSE;
+      }
+
+      bool pending() const
+      {
+        return HIWORD(::GetQueueStatus(QS_ALLINPUT)) != 0;
+      }
+
+      bool quit(const ::MSG& msg) const
+      {
+        return msg.message == enum_cast(WindowMessage::Quit);
+      }
+
+      int32_t result(const ::MSG& msg) const
+      {
+        return static_cast<int32_t>(msg.wParam);
+      }
+
+      void dispatch(::MSG& msg)
+      {
+        Pump.dispatch(msg);
+      }
+
+      void wait(PumpScheduler::duration_t timeout)
+      {
+        using namespace std::chrono;
+
+        // Round up, otherwise timers would be polled repeatedly during their final millisecond
+        ::DWORD ms = INFINITE;
+        if (timeout != PumpScheduler::duration_t::max())
+          ms = static_cast<::DWORD>(std::min<int64_t>(duration_cast<milliseconds>(timeout + milliseconds(1) - nanoseconds(1)).count(), INFINITE-1));
+
+        ::MsgWaitForMultipleObjectsEx(0, nullptr, ms, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+      }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct WakeWindow - Message-only window notified when work is posted to the pump
+    //!
+    //! \remarks Modal menu, dialog and message box loops dispatch messages posted to windows but discard thread
+    //! \remarks messages, therefore posted work continues to execute while they are displayed
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct WakeWindow : MessageWindow<encoding>
+    {
+      type&  Pump;      //!< Message pump
+
+      explicit WakeWindow(type& pump) : Pump(pump)
+      {}
+
+    protected:
+      LResult route(WindowMessage message, ::WPARAM w, ::LPARAM l) override
+      {
+        // [POSTED-WORK] Execute a batch of work posted from other threads
+        if (message == WindowMessage::PostedWork)
+        {
+          try
+          {
+            Pump.Posted.drain(Pump.PostedBudget);
+          }
+          catch (std::exception& e)
+          {
+            cdebug << caught_exception("Unable to execute posted work", HERE, e);
+          }
+          return {MsgRoute::Handled, 0};
+        }
+
+        return MessageWindow<encoding>::route(message, w, l);
+      }
+    };
     
     // ----------------------------------- REPRESENTATION -----------------------------------
   private:
-    List<window_t*>   Dialogs;    //!< Currently active modeless dialogs
-    window_t          Window;     //!< Main thread window
-    PumpState         State;      //!< Current state
+    List<window_t*>       Dialogs;    //!< Currently active modeless dialogs
+    window_t              Window;     //!< Main thread window
+    PumpState             State;      //!< Current state
+    std::atomic<::DWORD>  ThreadId;   //!< Thread executing the pump
+    WorkQueue             Posted;     //!< Work posted from other threads
+    WakeWindow            Waker;      //!< Receives posted work notifications while the pump runs
+    std::atomic<::HWND>   WakeHandle; //!< Handle of 'Waker' while the pump runs, otherwise nullptr
+
+  public:
+    WorkQueue::duration_t  PostedBudget;   //!< Maximum time spent executing posted work per batch
+    PumpScheduler          Scheduler;      //!< Timers, idle tasks, dispatch budget and metrics  (Pump thread only)
     
     // ------------------------------------ CONSTRUCTION ------------------------------------
   public:
@@ -69,18 +173,41 @@ namespace wtl
     //! 
     //! \param[in] instance - Instance handle
     /////////////////////////////////////////////////////////////////////////////////////////
-    MessagePump(::HMODULE instance) : State(PumpState::Idle)
-    {}
+    MessagePump(::HMODULE instance) : State(PumpState::Idle), 
+                                      ThreadId(::GetCurrentThreadId()),
+                                      Posted([this] { return wake(); }),
+                                      Waker(*this),
+                                      WakeHandle(nullptr),
+                                      PostedBudget(std::chrono::milliseconds(8))
+    {
+      MessageWindow<encoding>::registerClass(instance);
+    }
     
     // -------------------------------- COPY, MOVE & DESTROY --------------------------------
   public:
     DISABLE_COPY(MessagePump);      //!< Cannot be copied
-    ENABLE_MOVE(MessagePump);       //!< Can be moved
+    DISABLE_MOVE(MessagePump);      //!< Cannot be moved
     ENABLE_POLY(MessagePump);       //!< Can be polymorphic
 
     // ----------------------------------- STATIC METHODS -----------------------------------
 
     // ---------------------------------- ACCESSOR METHODS ----------------------------------			
+  private:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // MessagePump::wake const
+    //! Notifies the pump thread that work has been posted  (Called from any thread)
+    //! 
+    //! \return bool - True iff notification was posted
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  wake() const
+    {
+      // [RUNNING] Notify the wake window, which modal loops continue to dispatch
+      if (::HWND wnd = WakeHandle.load())
+        return WinAPI<encoding>::postMessage(wnd, enum_cast(WindowMessage::PostedWork), 0, 0) != FALSE;
+
+      // [STOPPED] Notify the thread, executed once the pump is running
+      return WinAPI<encoding>::postThreadMessage(ThreadId.load(), enum_cast(WindowMessage::PostedWork), 0, 0) != FALSE;
+    }
 
     // ----------------------------------- MUTATOR METHODS ----------------------------------
   public:
@@ -96,6 +223,33 @@ namespace wtl
       return true;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // MessagePump::post
+    //! Posts work from any thread for execution upon the pump thread
+    //! 
+    //! \param[in] fn - Work item
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  post(work_t fn)
+    {
+      Posted.post(std::move(fn));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // MessagePump::post
+    //! Posts work from any thread for execution upon the pump thread, coalescing it with any waiting work for the same target
+    //! 
+    //! \tparam TARGET - Target type
+    //!
+    //! \param[in] const& target - Target object, eg. window (Identifies the work)
+    //! \param[in] fn - Work item  (Should read the latest state of the target rather than capture it)
+    //! \return bool - True if queued, false if coalesced with waiting work
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename TARGET>
+    bool  post(const TARGET& target, work_t fn)
+    {
+      return Posted.post(reinterpret_cast<WorkQueue::key_t>(&target), std::move(fn));
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////
     // MessagePump::removeDialog
     //! Informs the pump a dialog has been closed
@@ -132,6 +286,53 @@ namespace wtl
     }
 
   private:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // MessagePump::dispatch
+    //! Translates and dispatches a message, or executes posted work
+    //! 
+    //! \param[in,out] &msg - Message
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  dispatch(::MSG& msg)
+    {
+      // [POSTED-WORK] Execute a batch of work posted to the thread before the wake window existed
+      if (msg.hwnd == nullptr && msg.message == enum_cast(WindowMessage::PostedWork))
+      {
+        Posted.drain(PostedBudget);
+        return;
+      }
+
+      // [MODAL] Update state when entering/exiting modal loop
+      switch (static_cast<WindowMessage>(msg.message))
+      {
+      case WindowMessage::EnterMenuLoop: State = PumpState::ModalLoop;    break;
+      case WindowMessage::ExitMenuLoop:  State = PumpState::Running;      break;
+      }
+
+      // [EXISTS] 
+      //if (Window && Window->exists())
+      //{
+      //  // [ACCELERATOR] Pass all accelerators to main window
+      //  if (WinAPI<encoding>::translateAccelerator(*Window, activeAccelerators, &msg))
+      //    return;
+
+      //  // [DIALOG] Translate accelerators or dispatch to dialog
+      //  if (Dialogs.contains(msg.hwnd))
+      //    if (WinAPI<encoding>::translateAccelerator(msg.hwnd, activeAccelerators, &msg)
+      //     || WinAPI<encoding>::isDialogMessage(msg.hwnd, &msg))
+      //     return;
+
+      //  // TODO: Property sheets
+      //}
+
+      // Translate and dispatch to target
+      ::TranslateMessage(&msg);
+      WinAPI<encoding>::dispatchMessage(&msg);
+
+      // [POSTED-WORK] Recover notifications discarded by modal loops, which do not dispatch thread messages
+      if (Posted.signalled())
+        Posted.drain(PostedBudget);
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////
     // MessagePump::onExit
     //! Called once after message pump finishes
@@ -148,8 +349,6 @@ namespace wtl
     /////////////////////////////////////////////////////////////////////////////////////////
     virtual int32_t  onRun(ShowWindowFlags mode)
     {
-      MSG msg;      //!< Current message
-
       try
       {
         // [EVENT] Raise 'onStart'
@@ -161,56 +360,55 @@ namespace wtl
 
         // Update state
         State = PumpState::Running;
+        ThreadId = ::GetCurrentThreadId();
 
-        // Retrieve next message for any window
-        while (WinAPI<encoding>::getMessage(&msg, nullptr, 0ul, 0ul))
-        {
-          // [MODAL] Update state when entering/exiting modal loop
-          switch (static_cast<WindowMessage>(msg.message))
-          {
-          case WindowMessage::EnterMenuLoop: State = PumpState::ModalLoop;    break;
-          case WindowMessage::ExitMenuLoop:  State = PumpState::Running;      break;
-          }
+        // Receive posted work notifications upon this thread, then execute work posted beforehand
+        Waker.create();
+        WakeHandle = (::HWND)Waker.handle();
+        Posted.drain(PostedBudget);
 
-          // [EXISTS] 
-          //if (Window && Window->exists())
-          //{
-          //  // [ACCELERATOR] Pass all accelerators to main window
-          //  if (WinAPI<encoding>::translateAccelerator(*Window, activeAccelerators, &msg))
-          //    continue;
-
-          //  // [DIALOG] Translate accelerators or dispatch to dialog
-          //  if (Dialogs.contains(msg.hwnd))
-          //    if (WinAPI<encoding>::translateAccelerator(msg.hwnd, activeAccelerators, &msg)
-          //     || WinAPI<encoding>::isDialogMessage(msg.hwnd, &msg))
-          //     continue;
-
-          //  // TODO: Property sheets
-          //}
-
-          // Translate and dispatch to target
-          ::TranslateMessage(&msg);
-          WinAPI<encoding>::dispatchMessage(&msg);
-        }
+        // Dispatch messages, interleaved with timers and idle tasks, until WM_QUIT
+        MessageSource source(*this);
+        int32_t result = Scheduler.pump(source);
+        closeWaker();
       
         // [EVENT] Raise 'onExit'
         onExit();
         
         // Return WM_QUIT result
-        return msg.wParam;
+        return result;
       }
       catch (std::exception& e)
       {
+        closeWaker();
         errorBox<encoding>(Window, caught_exception("Unable to dispatch message", HERE, e));
         return -1;
       }
       catch (...)
       {
+        closeWaker();
         errorBox<encoding>(Window, caught_exception("An unrecognised terminal error has occurred, the program will now exit.", HERE));
         return -2;
       }
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // MessagePump::closeWaker
+    //! Destroys the wake window; work posted hereafter notifies the thread instead
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  closeWaker()
+    {
+      WakeHandle = nullptr;
+      try
+      {
+        Waker.destroy();
+      }
+      catch (std::exception& e)
+      {
+        cdebug << caught_exception("Unable to destroy wake window", HERE, e);
+      }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////
     // MessagePump::onStart
     //! Called once before message pump starts
@@ -0,0 +1,400 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\threads\PumpScheduler.hpp
+//! \brief Provides idle-time and deadline scheduling for a message loop, independent of the message source
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_PUMP_SCHEDULER_HPP
+#define WTL_PUMP_SCHEDULER_HPP
+
+#include <wtl/WTL.hpp>
+#include <algorithm>                          //!< std::push_heap, std::pop_heap, std::make_heap, std::remove_if
+#include <chrono>                             //!< std::chrono::steady_clock
+#include <deque>                              //!< std::deque
+#include <functional>                         //!< std::function
+#include <unordered_map>                      //!< std::unordered_map
+#include <vector>                             //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct DispatchMetrics - Statistics gathered by a message loop
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct DispatchMetrics
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias duration_t - Define duration type
+    using duration_t = std::chrono::steady_clock::duration;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    uint64_t    Iterations = 0;         //!< Number of loop iterations
+    uint64_t    Messages = 0;           //!< Number of messages dispatched
+    uint64_t    OverBudget = 0;         //!< Number of messages whose dispatch alone exceeded the iteration budget
+    uint64_t    IdleSlices = 0;         //!< Number of idle tasks executed
+    uint64_t    TimersFired = 0;        //!< Number of timers executed
+    uint64_t    Waits = 0;              //!< Number of times the loop blocked awaiting messages
+    duration_t  DispatchTime {};        //!< Total time spent dispatching messages
+    duration_t  LongestDispatch {};     //!< Longest single dispatch
+    duration_t  IdleTime {};            //!< Total time spent executing idle tasks
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DispatchMetrics::averageDispatch const
+    //! Get the mean dispatch time
+    //!
+    //! \return duration_t - Mean time spent dispatching each message, or zero if none dispatched
+    /////////////////////////////////////////////////////////////////////////////////////////
+    duration_t  averageDispatch() const
+    {
+      return Messages ? DispatchTime / static_cast<duration_t::rep>(Messages) : duration_t::zero();
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DispatchMetrics::clear
+    //! Resets all statistics
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clear()
+    {
+      *this = DispatchMetrics();
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct PumpScheduler - Cooperative scheduler which interleaves message dispatch with deadline-ordered timers
+  //!  and idle tasks, so that deferred work executes while the message queue is empty without starving input
+  //!
+  //! \remarks Each iteration of 'pump' dispatches messages until none remain or the iteration budget is spent, then
+  //! \remarks executes any expired timers, then executes idle tasks in short slices until a message arrives. When there
+  //! \remarks is nothing to do the loop blocks until a message arrives or the earliest timer expires.
+  //!
+  //! \remarks The scheduler knows nothing of Win32; messages are obtained from a 'SOURCE' which provides:
+  //! \remarks   message_t                       - Message type
+  //! \remarks   bool peek(message_t&)           - Removes the next message, if any
+  //! \remarks   bool pending()                  - Query whether any message is waiting
+  //! \remarks   bool quit(const message_t&)     - Query whether a message terminates the loop
+  //! \remarks   int32_t result(const message_t&)- Exit code of a terminating message
+  //! \remarks   void dispatch(message_t&)       - Dispatches a message
+  //! \remarks   void wait(duration_t)           - Blocks until a message arrives or the timeout elapses
+  //!
+  //! \remarks Cancelled timers are removed from the front of the deadline heap immediately, so the loop never wakes
+  //! \remarks early on their account, and the heap is compacted once cancelled entries outnumber active timers.
+  //!
+  //! \remarks Not thread-safe; timers and idle tasks must be added upon the pump thread.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct PumpScheduler
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = PumpScheduler;
+
+    //! \alias clock_t - Define clock type
+    using clock_t = std::chrono::steady_clock;
+
+    //! \alias duration_t - Define duration type
+    using duration_t = clock_t::duration;
+
+    //! \alias time_point_t - Define time-point type
+    using time_point_t = clock_t::time_point;
+
+    //! \alias work_t - Define timer work type
+    using work_t = std::function<void ()>;
+
+    //! \alias idle_t - Define idle task type  (Accepts the slice deadline, returns true if further work remains)
+    using idle_t = std::function<bool (time_point_t)>;
+
+    //! \alias timer_t - Define timer identifier type
+    using timer_t = uint32_t;
+
+    //! \var compaction - Number of cancelled heap entries tolerated beyond the number of active timers
+    static constexpr size_t  compaction = 64;
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Deadline - Heap entry identifying the expiry of a timer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Deadline
+    {
+      time_point_t  Due;        //!< Expiry time
+      timer_t       Id;         //!< Timer identifier
+
+      // Order earliest first, then by creation
+      bool operator > (const Deadline& r) const
+      {
+        return Due != r.Due ? Due > r.Due : Id > r.Id;
+      }
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    duration_t                             Budget;       //!< Maximum time spent dispatching messages per iteration
+    duration_t                             IdleSlice;    //!< Time allotted to each idle task
+    DispatchMetrics                        Metrics;      //!< Statistics
+
+  protected:
+    std::vector<Deadline>                  Heap;         //!< Min-heap of timer expiries (Front is always active)
+    std::unordered_map<timer_t,work_t>     Timers;       //!< Work of active timers
+    std::deque<idle_t>                     Idle;         //!< Idle tasks, executed round-robin
+    timer_t                                NextId;       //!< Next timer identifier
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PumpScheduler::PumpScheduler
+    //! Create scheduler with no timers or idle tasks
+    //!
+    //! \param[in] budget - [optional] Maximum time spent dispatching messages per iteration
+    //! \param[in] slice - [optional] Time allotted to each idle task
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit PumpScheduler(duration_t budget = std::chrono::milliseconds(16), duration_t slice = std::chrono::milliseconds(4))
+      : Budget(budget), IdleSlice(slice), NextId(1)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(PumpScheduler);      //!< Cannot be copied
+    ENABLE_MOVE(PumpScheduler);       //!< Can be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PumpScheduler::idle const
+    //! Query whether any idle tasks remain
+    //!
+    //! \return bool - True iff idle work remains
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  idle() const
+    {
+      return !Idle.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PumpScheduler::timeout const
+    //! Calculate how long the loop may block before the earliest timer expires
+    //!
+    //! \param[in] now - Current time
+    //! \return duration_t - Time until earliest expiry, zero if already expired, or duration_t::max() if no timers
+    /////////////////////////////////////////////////////////////////////////////////////////
+    duration_t  timeout(time_point_t now) const
+    {
+      if (Heap.empty())
+        return duration_t::max();
+
+      return Heap.front().Due > now ? Heap.front().Due - now : duration_t::zero();
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PumpScheduler::cancel
+    //! Cancels a timer
+    //!
+    //! \param[in] id - Timer identifier
+    //! \return bool - True if cancelled, false if already executed or cancelled
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  cancel(timer_t id)
+    {
+      if (Timers.erase(id) == 0)
+        return false;
+
+      // [COMPACT] Discard cancelled entries once they dominate the heap
+      if (Heap.size() > 2 * Timers.size() + compaction)
+      {
+        Heap.erase(std::remove_if(Heap.begin(), Heap.end(), [this] (const Deadline& d) { return Timers.count(d.Id) == 0; }), Heap.end());
+        std::make_heap(Heap.begin(), Heap.end(), std::greater<Deadline>());
+      }
+      // [EARLIEST] Ensure the earliest expiry is active
+      else
+        prune();
+
+      return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PumpScheduler::schedule
+    //! Adds a timer which executes once at, or soon after, a specified time
+    //!
+    //! \param[in] due - Expiry time
+    //! \param[in] fn - Work
+    //! \return timer_t - Timer identifier
+    /////////////////////////////////////////////////////////////////////////////////////////
+    timer_t  schedule(time_point_t due, work_t fn)
+    {
+      timer_t const id = NextId++;
+
+      Timers.emplace(id, std::move(fn));
+      Heap.push_back({due, id});
+      std::push_heap(Heap.begin(), Heap.end(), std::greater<Deadline>());
+      return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PumpScheduler::schedule
+    //! Adds a timer which executes once after a specified delay
+    //!
+    //! \param[in] delay - Delay
+    //! \param[in] fn - Work
+    //! \return timer_t - Timer identifier
+    /////////////////////////////////////////////////////////////////////////////////////////
+    timer_t  schedule(duration_t delay, work_t fn)
+    {
+      return schedule(clock_t::now() + delay, std::move(fn));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PumpScheduler::pump
+    //! Executes the message loop until the source yields a terminating message
+    //!
+    //! \tparam SOURCE - Message source type
+    //!
+    //! \param[in,out] &source - Message source
+    //! \return int32_t - Exit code of terminating message
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename SOURCE>
+    int32_t  pump(SOURCE& source)
+    {
+      typename SOURCE::message_t msg;
+
+      for (;;)
+      {
+        auto const deadline = clock_t::now() + Budget;
+        ++Metrics.Iterations;
+
+        // [MESSAGES] Dispatch until none remain or budget spent
+        while (source.peek(msg))
+        {
+          if (source.quit(msg))
+            return source.result(msg);
+
+          auto const start = clock_t::now();
+          source.dispatch(msg);
+          auto const end = clock_t::now();
+          record(end - start);
+
+          if (end >= deadline)
+            break;
+        }
+
+        // [TIMERS] Execute expired timers
+        expire(clock_t::now(), deadline);
+
+        // [IDLE] Execute idle tasks until a message arrives
+        if (!source.pending() && idle())
+          runIdle(source);
+
+        // [WAIT] Block until a message arrives or the earliest timer expires
+        else if (!source.pending())
+        {
+          ++Metrics.Waits;
+          source.wait(timeout(clock_t::now()));
+        }
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PumpScheduler::whenIdle
+    //! Adds an idle task, executed repeatedly while the message queue is empty until it reports completion
+    //!
+    //! \param[in] fn - Idle task
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  whenIdle(idle_t fn)
+    {
+      Idle.push_back(std::move(fn));
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PumpScheduler::expire
+    //! Executes timers which expired before the current time, while the budget permits
+    //!
+    //! \param[in] now - Current time  (Timers scheduled meanwhile execute next iteration)
+    //! \param[in] deadline - Iteration deadline  (At least one timer executes, if any expired)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  expire(time_point_t now, time_point_t deadline)
+    {
+      for (bool first = true; !Heap.empty() && Heap.front().Due <= now; first = false)
+      {
+        if (!first && clock_t::now() >= deadline)
+          break;
+
+        timer_t const id = Heap.front().Id;
+        std::pop_heap(Heap.begin(), Heap.end(), std::greater<Deadline>());
+        Heap.pop_back();
+
+        // Front is always active
+        auto pos = Timers.find(id);
+        work_t fn = std::move(pos->second);
+        Timers.erase(pos);
+        prune();
+
+        ++Metrics.TimersFired;
+        fn();
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PumpScheduler::prune
+    //! Removes cancelled timers from the front of the heap
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  prune()
+    {
+      while (!Heap.empty() && Timers.count(Heap.front().Id) == 0)
+      {
+        std::pop_heap(Heap.begin(), Heap.end(), std::greater<Deadline>());
+        Heap.pop_back();
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PumpScheduler::record
+    //! Records the duration of a dispatch
+    //!
+    //! \param[in] elapsed - Time spent dispatching
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  record(duration_t elapsed)
+    {
+      ++Metrics.Messages;
+      Metrics.DispatchTime += elapsed;
+      Metrics.LongestDispatch = std::max(Metrics.LongestDispatch, elapsed);
+      if (elapsed > Budget)
+        ++Metrics.OverBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PumpScheduler::runIdle
+    //! Executes idle tasks round-robin, one slice each, until a message arrives, a timer expires or none remain
+    //!
+    //! \tparam SOURCE - Message source type
+    //!
+    //! \param[in,out] &source - Message source
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename SOURCE>
+    void  runIdle(SOURCE& source)
+    {
+      auto const start = clock_t::now();
+
+      while (!Idle.empty() && !source.pending() && timeout(clock_t::now()) != duration_t::zero())
+      {
+        idle_t fn = std::move(Idle.front());
+        Idle.pop_front();
+        ++Metrics.IdleSlices;
+
+        // [REMAINING] Requeue behind other idle tasks
+        if (fn(clock_t::now() + IdleSlice))
+          Idle.push_back(std::move(fn));
+      }
+
+      Metrics.IdleTime += clock_t::now() - start;
+    }
+  };
+
+} // namespace wtl
+
+#endif  // WTL_PUMP_SCHEDULER_HPP
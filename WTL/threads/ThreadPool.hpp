@@ -0,0 +1,890 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\threads\ThreadPool.hpp
+//! \brief Provides a work-stealing thread pool and asynchronous tasks with continuations
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_THREAD_POOL_HPP
+#define WTL_THREAD_POOL_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/threads/WorkStealingDeque.hpp>  //!< WorkStealingDeque
+#include <algorithm>                          //!< std::min, std::max
+#include <atomic>                             //!< std::atomic
+#include <chrono>                             //!< std::chrono::milliseconds
+#include <condition_variable>                 //!< std::condition_variable
+#include <deque>                              //!< std::deque
+#include <exception>                          //!< std::exception_ptr
+#include <functional>                         //!< std::function
+#include <memory>                             //!< std::shared_ptr, std::unique_ptr
+#include <mutex>                              //!< std::mutex
+#include <thread>                             //!< std::thread
+#include <type_traits>                        //!< std::result_of, std::conditional
+#include <vector>                             //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //! Forward declarations
+  template <typename T> struct Task;
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct ThreadPool - Fixed set of worker threads which execute work items using work-stealing
+  //!
+  //! \remarks Each worker owns a Chase-Lev deque. Work posted by a worker is pushed onto its own deque and popped
+  //! \remarks in LIFO order for locality; idle workers steal the oldest items from their peers. Work posted from
+  //! \remarks other threads is placed in a shared injection queue.
+  //!
+  //! \remarks Workers sleep when no work is queued. Threads that wait upon a task or parallel loop while executing
+  //! \remarks upon a worker execute other queued work meanwhile, so nested parallelism cannot exhaust the pool.
+  //! \remarks Waiters with nothing to execute spin briefly then park until a work item completes.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct ThreadPool
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = ThreadPool;
+
+    //! \alias work_t - Define work item type
+    using work_t = std::function<void ()>;
+
+    //! \var spins - Number of times a waiter yields before parking
+    static constexpr uint32_t  spins = 64;
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Job - Queued work item
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Job
+    {
+      work_t  Work;       //!< Work item
+
+      explicit Job(work_t&& fn) : Work(std::move(fn))
+      {}
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Worker - Worker thread and its deque
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Worker
+    {
+      WorkStealingDeque<Job*>  Jobs;        //!< Work posted by this worker
+      std::thread              Thread;      //!< Worker thread
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Context - Identifies the pool and worker executing upon the calling thread
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Context
+    {
+      ThreadPool*  Pool = nullptr;      //!< Pool, if calling thread is a worker
+      uint32_t     Index = 0;           //!< Zero-based worker index
+      uint32_t     Seed = 0;            //!< Victim selection state
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::vector<std::unique_ptr<Worker>>  Workers;      //!< Workers
+    std::mutex                            InjectLock;   //!< Serializes injection queue
+    std::deque<Job*>                      Injected;     //!< Work posted by non-worker threads
+    std::atomic<int64_t>                  Queued;       //!< Number of items waiting
+    std::atomic<uint32_t>                 Sleepers;     //!< Number of sleeping workers
+    std::mutex                            SleepLock;    //!< Guards sleeping workers
+    std::condition_variable               Wakeup;       //!< Signalled when work is posted
+    std::atomic<uint32_t>                 Waiters;      //!< Number of parked waiters
+    std::mutex                            WaitLock;     //!< Guards parked waiters
+    std::condition_variable               Progress;     //!< Signalled when work completes (or is posted) while waiters are parked
+    std::atomic<bool>                     Stopping;     //!< Whether pool is being destroyed
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::ThreadPool
+    //! Create pool and start worker threads
+    //!
+    //! \param[in] threads - [optional] Number of workers  (Default is number of hardware threads)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit ThreadPool(uint32_t threads = std::max(1u, std::thread::hardware_concurrency()))
+      : Queued(0), Sleepers(0), Waiters(0), Stopping(false)
+    {
+      threads = std::max(1u, threads);
+
+      // Create all deques before any worker can attempt to steal
+      for (uint32_t i = 0; i < threads; ++i)
+        Workers.emplace_back(new Worker());
+
+      for (uint32_t i = 0; i < threads; ++i)
+        Workers[i]->Thread = std::thread(&ThreadPool::execute, this, i);
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(ThreadPool);      //!< Cannot be copied
+    DISABLE_MOVE(ThreadPool);      //!< Cannot be moved
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::~ThreadPool
+    //! Executes any waiting work then stops the worker threads
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~ThreadPool()
+    {
+      {
+        std::lock_guard<std::mutex> guard(SleepLock);
+        Stopping.store(true);
+      }
+      Wakeup.notify_all();
+
+      for (auto& w : Workers)
+        w->Thread.join();
+    }
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::current
+    //! Get the pool executing upon the calling thread
+    //!
+    //! \return ThreadPool* - Pool if calling thread is a worker, otherwise nullptr
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static ThreadPool*  current()
+    {
+      return context().Pool;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::shared
+    //! Access the process-wide pool
+    //!
+    //! \return ThreadPool& - Shared pool with one worker per hardware thread
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static ThreadPool&  shared()
+    {
+      static ThreadPool  pool;
+      return pool;
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::context
+    //! Get the worker context of the calling thread
+    //!
+    //! \return Context& - Thread-local context
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static Context&  context()
+    {
+      static thread_local Context  ctx;
+      return ctx;
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::size const
+    //! Get the number of workers
+    //!
+    //! \return uint32_t - Number of worker threads
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  size() const
+    {
+      return static_cast<uint32_t>(Workers.size());
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::async
+    //! Executes a function asynchronously
+    //!
+    //! \tparam FN - Function type
+    //!
+    //! \param[in] fn - Function accepting no arguments
+    //! \return Task<R> - Task providing the result, or exception, of the function
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename FN>
+    Task<std::result_of_t<FN& ()>>  async(FN fn);
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::parallel_for
+    //! Executes a function for each index within a range, dividing the range between the workers
+    //!
+    //! \tparam INDEX - Integral index type
+    //! \tparam FN - Function type
+    //!
+    //! \param[in] first - First index
+    //! \param[in] last - Index beyond the last
+    //! \param[in] const& fn - Function accepting an index
+    //! \param[in] grain - [optional] Number of consecutive indicies executed as a single work item
+    //!
+    //! \throw - Rethrows the first exception raised by the function, remaining chunks are abandoned
+    //!
+    //! \remarks The calling thread participates and blocks until the entire range has executed
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename INDEX, typename FN>
+    void  parallel_for(INDEX first, INDEX last, const FN& fn, INDEX grain = 1)
+    {
+      /////////////////////////////////////////////////////////////////////////////////////////
+      //! \struct Loop - State shared by the participants
+      /////////////////////////////////////////////////////////////////////////////////////////
+      struct Loop
+      {
+        std::atomic<uint64_t>  Next;          //!< Next chunk to claim
+        std::atomic<uint64_t>  Completed;     //!< Number of chunks completed or abandoned
+        std::atomic<bool>      Failed;        //!< Whether an exception was captured
+        std::exception_ptr     Error;         //!< First exception
+        const FN*              Body;          //!< Function  (Only dereferenced for claimed chunks)
+        INDEX                  First, Last, Grain;
+        uint64_t               Chunks;
+
+        // Claim chunks until none remain
+        void run()
+        {
+          for (uint64_t c; (c = Next.fetch_add(1)) < Chunks; Completed.fetch_add(1, std::memory_order_release))
+          {
+            if (Failed.load(std::memory_order_relaxed))
+              continue;
+
+            INDEX const from = static_cast<INDEX>(First + c * Grain),
+                        to = static_cast<INDEX>(std::min<uint64_t>(c * Grain + Grain, Last - First) + First);
+            try
+            {
+              for (INDEX i = from; i < to; ++i)
+                (*Body)(i);
+            }
+            catch (...)
+            {
+              if (!Failed.exchange(true))
+                Error = std::current_exception();
+            }
+          }
+        }
+      };
+
+      if (!(first < last))
+        return;
+
+      grain = std::max<INDEX>(grain, 1);
+      auto loop = std::make_shared<Loop>();
+      loop->Next = loop->Completed = 0;
+      loop->Failed = false;
+      loop->Body = &fn;
+      loop->First = first;
+      loop->Last = last;
+      loop->Grain = grain;
+      loop->Chunks = (static_cast<uint64_t>(last - first) + grain - 1) / grain;
+
+      // Recruit workers then participate  (Late helpers find nothing to claim and never touch 'fn')
+      uint64_t const helpers = std::min<uint64_t>(loop->Chunks - 1, size());
+      for (uint64_t i = 0; i < helpers; ++i)
+        post([loop] { loop->run(); });
+      loop->run();
+
+      // Wait for chunks claimed by helpers
+      wait([&loop] { return loop->Completed.load(std::memory_order_acquire) == loop->Chunks; });
+
+      if (loop->Failed.load())
+        std::rethrow_exception(loop->Error);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::post
+    //! Posts a work item from any thread
+    //!
+    //! \param[in] fn - Work item  (Should not throw, exceptions are discarded)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  post(work_t fn)
+    {
+      Context& ctx = context();
+      Job* job = new Job(std::move(fn));
+
+      // Count before publishing so the counter never underflows
+      Queued.fetch_add(1, std::memory_order_seq_cst);
+
+      // [WORKER] Push onto own deque
+      if (ctx.Pool == this)
+        Workers[ctx.Index]->Jobs.push(job);
+      // [EXTERNAL] Inject
+      else
+      {
+        std::lock_guard<std::mutex> guard(InjectLock);
+        Injected.push_back(job);
+      }
+
+      // Wake a sleeper  (Acquiring the lock ensures it is either waiting or will observe the item)
+      if (Sleepers.load(std::memory_order_seq_cst) != 0)
+      {
+        { std::lock_guard<std::mutex> guard(SleepLock); }
+        Wakeup.notify_one();
+      }
+
+      // Wake parked workers, which execute work while they wait
+      notifyWaiters();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::runPending
+    //! Executes one waiting work item upon the calling thread, if any
+    //!
+    //! \return bool - True if an item was executed
+    //!
+    //! \remarks Intended for threads which must wait for work executing within the pool
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  runPending()
+    {
+      Context& ctx = context();
+
+      if (Job* job = find(ctx.Pool == this ? ctx.Index : size()))
+      {
+        run(job);
+        return true;
+      }
+      return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::wait
+    //! Blocks until a condition is satisfied. Workers of this pool execute waiting work meanwhile.
+    //!
+    //! \tparam PREDICATE - Predicate type
+    //!
+    //! \param[in] const& ready - Condition
+    //!
+    //! \remarks Other threads (eg. a window thread) never execute pool work implicitly
+    //!
+    //! \remarks Having nothing to execute, the caller yields up to 'spins' times then parks. Parked waiters re-evaluate
+    //! \remarks the condition whenever a work item completes, and at least every millisecond in case the condition
+    //! \remarks is satisfied by a thread outside the pool.
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename PREDICATE>
+    void  wait(const PREDICATE& ready)
+    {
+      bool const worker = (current() == this);
+
+      for (uint32_t spin = 0; !ready(); )
+      {
+        // [WORKER] Execute waiting work meanwhile
+        if (worker && runPending())
+          spin = 0;
+
+        // [SPIN] Most waits are brief
+        else if (spin++ < spins)
+          std::this_thread::yield();
+
+        // [PARK] Sleep until work completes, or (for workers) is posted
+        else
+        {
+          Waiters.fetch_add(1, std::memory_order_seq_cst);
+          {
+            std::unique_lock<std::mutex> lock(WaitLock);
+            Progress.wait_for(lock, std::chrono::milliseconds(1), [&] {
+              return ready() || (worker && Queued.load(std::memory_order_seq_cst) > 0);
+            });
+          }
+          Waiters.fetch_sub(1, std::memory_order_seq_cst);
+          spin = 0;
+        }
+      }
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::execute
+    //! Worker thread procedure
+    //!
+    //! \param[in] index - Zero-based worker index
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  execute(uint32_t index)
+    {
+      Context& ctx = context();
+      ctx.Pool = this;
+      ctx.Index = index;
+      ctx.Seed = index * 0x9E3779B9u + 1;
+
+      for (;;)
+      {
+        if (Job* job = find(index))
+        {
+          run(job);
+          continue;
+        }
+
+        // Sleep until work is posted
+        std::unique_lock<std::mutex> lock(SleepLock);
+        Sleepers.fetch_add(1, std::memory_order_seq_cst);
+        Wakeup.wait(lock, [this] { return Queued.load(std::memory_order_seq_cst) > 0 || Stopping.load(); });
+        Sleepers.fetch_sub(1, std::memory_order_seq_cst);
+
+        // [STOP] Exit once all work has executed
+        if (Stopping.load() && Queued.load(std::memory_order_seq_cst) == 0)
+          break;
+      }
+
+      ctx.Pool = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::find
+    //! Claims a waiting work item from the worker's own deque, the injection queue, or a randomly chosen peer
+    //!
+    //! \param[in] index - Zero-based worker index, or size() if the caller is not a worker
+    //! \return Job* - Claimed item, or nullptr if none found
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Job*  find(uint32_t index)
+    {
+      Job* job = nullptr;
+
+      // [OWN] Newest item
+      if (index < size())
+        job = Workers[index]->Jobs.pop();
+
+      // [INJECTED] Oldest external item
+      if (!job)
+      {
+        std::lock_guard<std::mutex> guard(InjectLock);
+        if (!Injected.empty())
+        {
+          job = Injected.front();
+          Injected.pop_front();
+        }
+      }
+
+      // [STEAL] Oldest item of each peer, starting from a random victim
+      if (!job)
+      {
+        uint32_t& seed = context().Seed;
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+
+        for (uint32_t i = 0, start = seed % size(); i < size() && !job; ++i)
+        {
+          uint32_t const victim = (start + i) % size();
+          if (victim != index)
+            job = Workers[victim]->Jobs.steal();
+        }
+      }
+
+      if (job)
+        Queued.fetch_sub(1, std::memory_order_seq_cst);
+
+      return job;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::run
+    //! Executes and destroys a work item, then wakes any parked waiters
+    //!
+    //! \param[in] *job - Claimed item
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  run(Job* job)
+    {
+      {
+        std::unique_ptr<Job> item(job);
+
+        try {
+          item->Work();
+        }
+        catch (...) {
+          // Work posted directly must not throw, tasks capture their own exceptions
+        }
+      }
+
+      notifyWaiters();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::notifyWaiters
+    //! Wakes any parked waiters so they re-evaluate their condition
+    //!
+    //! \remarks Acquiring the lock ensures each waiter is either parked or will observe changes made beforehand
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  notifyWaiters()
+    {
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (Waiters.load(std::memory_order_seq_cst) != 0)
+      {
+        { std::lock_guard<std::mutex> guard(WaitLock); }
+        Progress.notify_all();
+      }
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct TaskStateBase - Completion state shared by a task and its continuations
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct TaskStateBase
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias continuation_t - Define continuation type
+    using continuation_t = std::function<void ()>;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    std::atomic<bool>            Complete;          //!< Whether result or exception is available
+    std::exception_ptr           Error;             //!< Exception, if any
+    std::mutex                   Lock;              //!< Guards continuations and waiters
+    std::condition_variable      Ready;             //!< Signalled upon completion
+    std::vector<continuation_t>  Continuations;     //!< Executed upon completion
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    TaskStateBase() : Complete(false)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(TaskStateBase);      //!< Cannot be copied
+    DISABLE_MOVE(TaskStateBase);      //!< Cannot be moved
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TaskStateBase::fail
+    //! Completes with an exception
+    //!
+    //! \param[in] error - Exception
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  fail(std::exception_ptr error)
+    {
+      Error = error;
+      finish();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TaskStateBase::finish
+    //! Publishes completion, wakes waiters and executes continuations
+    //!
+    //! \remarks Result or exception must be stored beforehand
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  finish()
+    {
+      std::vector<continuation_t> pending;
+      {
+        std::lock_guard<std::mutex> guard(Lock);
+        Complete.store(true, std::memory_order_release);
+        pending.swap(Continuations);
+      }
+      Ready.notify_all();
+
+      for (auto& fn : pending)
+        fn();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TaskStateBase::wait
+    //! Blocks until complete
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  wait()
+    {
+      std::unique_lock<std::mutex> lock(Lock);
+      Ready.wait(lock, [this] { return Complete.load(std::memory_order_acquire); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TaskStateBase::whenComplete
+    //! Registers a continuation, or executes it immediately if already complete
+    //!
+    //! \param[in] fn - Continuation
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  whenComplete(continuation_t fn)
+    {
+      {
+        std::lock_guard<std::mutex> guard(Lock);
+        if (!Complete.load(std::memory_order_relaxed))
+        {
+          Continuations.push_back(std::move(fn));
+          return;
+        }
+      }
+      fn();
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct TaskState - Completion state of a task producing a value
+  //!
+  //! \tparam T - Result type
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct TaskState : TaskStateBase
+  {
+    std::unique_ptr<T>  Value;        //!< Result, once complete
+
+    template <typename FN, typename... ARGS>
+    void  complete(FN& fn, ARGS&&... args)
+    {
+      try {
+        Value.reset(new T(fn(std::forward<ARGS>(args)...)));
+      }
+      catch (...) {
+        Error = std::current_exception();
+      }
+      finish();
+    }
+
+    const T&  get() const
+    {
+      if (Error)
+        std::rethrow_exception(Error);
+      return *Value;
+    }
+
+    T  take()
+    {
+      if (Error)
+        std::rethrow_exception(Error);
+      return std::move(*Value);
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct TaskState<void> - Completion state of a task producing no value
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <>
+  struct TaskState<void> : TaskStateBase
+  {
+    template <typename FN, typename... ARGS>
+    void  complete(FN& fn, ARGS&&... args)
+    {
+      try {
+        fn(std::forward<ARGS>(args)...);
+      }
+      catch (...) {
+        Error = std::current_exception();
+      }
+      finish();
+    }
+
+    void  get() const
+    {
+      if (Error)
+        std::rethrow_exception(Error);
+    }
+
+    void  take()
+    {
+      get();
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct continuation_result - Calculates the result of a continuation accepting the result of an antecedent
+  //!
+  //! \tparam FN - Continuation type
+  //! \tparam T - Antecedent result type
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename FN, typename T>
+  struct continuation_result : std::result_of<FN& (const T&)>
+  {};
+
+  template <typename FN>
+  struct continuation_result<FN,void> : std::result_of<FN& ()>
+  {};
+
+  //! \alias continuation_result_t - Continuation result type accessor
+  template <typename FN, typename T>
+  using continuation_result_t = typename continuation_result<FN,T>::type;
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct Task - Result of an asynchronous operation which may be awaited or continued
+  //!
+  //! \tparam T - Result type
+  //!
+  //! \remarks Continuations receive the result of their antecedent. If the antecedent fails the continuation is
+  //! \remarks skipped and its task fails with the same exception. Continuations may be executed by any object
+  //! \remarks providing 'post(std::function<void()>)', such as a MessagePump, to deliver results to its thread.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct Task
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = Task<T>;
+
+    //! \alias result_t - Define result type
+    using result_t = T;
+
+    //! \alias reference_t - Define result reference type  (void if result_t is void)
+    using reference_t = std::conditional_t<std::is_void<T>::value, void, std::add_lvalue_reference_t<const T>>;
+
+    //! \alias state_t - Define completion state type
+    using state_t = TaskState<T>;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::shared_ptr<state_t>  State;      //!< Completion state
+    ThreadPool*               Pool;       //!< Executes continuations by default
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Task::Task
+    //! Create from completion state
+    //!
+    //! \param[in] state - Completion state
+    //! \param[in] &pool - Pool which executes continuations by default
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Task(std::shared_ptr<state_t> state, ThreadPool& pool) : State(std::move(state)), Pool(&pool)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    ENABLE_COPY(Task);      //!< Can be shallow copied
+    ENABLE_MOVE(Task);      //!< Can be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Task::get const
+    //! Blocks until complete and retrieves the result
+    //!
+    //! \return reference_t - Reference to result, valid while any copy of the task exists
+    //!
+    //! \throw - Rethrows the exception raised by the operation, if any
+    /////////////////////////////////////////////////////////////////////////////////////////
+    reference_t  get() const
+    {
+      wait();
+      return State->get();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Task::ready const
+    //! Query whether the result is available
+    //!
+    //! \return bool - True iff complete
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  ready() const
+    {
+      return State->Complete.load(std::memory_order_acquire);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Task::wait const
+    //! Blocks until complete
+    //!
+    //! \remarks When called from a worker of the owning pool, waiting work is executed meanwhile
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  wait() const
+    {
+      if (ThreadPool::current() == Pool)
+        Pool->wait([this] { return ready(); });
+      else
+        State->wait();
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Task::take
+    //! Blocks until complete and moves the result out of the task, eg. for move-only results
+    //!
+    //! \return result_t - Result
+    //!
+    //! \throw - Rethrows the exception raised by the operation, if any
+    //!
+    //! \remarks The result is left in a moved-from state; neither this task nor its copies should retrieve it again,
+    //! \remarks and continuations must already have executed
+    /////////////////////////////////////////////////////////////////////////////////////////
+    result_t  take()
+    {
+      wait();
+      return State->take();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Task::then
+    //! Schedules a continuation upon the owning pool
+    //!
+    //! \tparam FN - Continuation type
+    //!
+    //! \param[in] fn - Continuation accepting the result  (or nothing, if result_t is void)
+    //! \return Task<R> - Task providing the result of the continuation
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename FN>
+    Task<continuation_result_t<FN,T>>  then(FN fn) const
+    {
+      return then(*Pool, std::move(fn));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Task::then
+    //! Schedules a continuation upon an executor, such as a MessagePump or another pool
+    //!
+    //! \tparam EXECUTOR - Executor type providing 'post(std::function<void()>)'
+    //! \tparam FN - Continuation type
+    //!
+    //! \param[in,out] &exec - Executor  (Must outlive the antecedent)
+    //! \param[in] fn - Continuation accepting the result  (or nothing, if result_t is void)
+    //! \return Task<R> - Task providing the result of the continuation
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename EXECUTOR, typename FN>
+    Task<continuation_result_t<FN,T>>  then(EXECUTOR& exec, FN fn) const
+    {
+      using next_t = TaskState<continuation_result_t<FN,T>>;
+
+      auto prev = State;
+      auto next = std::make_shared<next_t>();
+
+      // Post continuation once antecedent completes
+      prev->whenComplete([&exec, prev, next, fn] () mutable
+      {
+        exec.post([prev, next, fn] () mutable
+        {
+          if (prev->Error)
+            next->fail(prev->Error);
+          else
+            continueWith(*prev, *next, fn);
+        });
+      });
+
+      return Task<continuation_result_t<FN,T>>(next, *Pool);
+    }
+
+  private:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Task::continueWith
+    //! Executes a continuation with the result of a successful antecedent
+    //!
+    //! \param[in] &prev - Antecedent state
+    //! \param[in,out] &next - Continuation state
+    //! \param[in] &fn - Continuation
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename U, typename R, typename FN>
+    static void  continueWith(TaskState<U>& prev, TaskState<R>& next, FN& fn)
+    {
+      next.complete(fn, *prev.Value);
+    }
+
+    template <typename R, typename FN>
+    static void  continueWith(TaskState<void>& prev, TaskState<R>& next, FN& fn)
+    {
+      next.complete(fn);
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  // ThreadPool::async
+  //! Executes a function asynchronously
+  //!
+  //! \tparam FN - Function type
+  //!
+  //! \param[in] fn - Function accepting no arguments
+  //! \return Task<R> - Task providing the result, or exception, of the function
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename FN>
+  Task<std::result_of_t<FN& ()>>  ThreadPool::async(FN fn)
+  {
+    auto state = std::make_shared<TaskState<std::result_of_t<FN& ()>>>();
+
+    post([state, fn] () mutable { state->complete(fn); });
+
+    return Task<std::result_of_t<FN& ()>>(state, *this);
+  }
+
+} // namespace wtl
+
+#endif  // WTL_THREAD_POOL_HPP
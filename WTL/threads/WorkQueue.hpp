@@ -0,0 +1,324 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\threads\WorkQueue.hpp
+//! \brief Provides a multiple-producer, single-consumer queue of work items with per-key coalescing
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_WORK_QUEUE_HPP
+#define WTL_WORK_QUEUE_HPP
+
+#include <wtl/WTL.hpp>
+#include <atomic>                             //!< std::atomic
+#include <chrono>                             //!< std::chrono::steady_clock
+#include <functional>                         //!< std::function
+#include <memory>                             //!< std::unique_ptr
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct WorkQueue - Lock-free queue of work items posted from any thread and executed by a single consumer
+  //!
+  //! \remarks The consumer is notified by a single call to the 'wake' function when the queue transitions from
+  //! \remarks idle to signalled; further posts do not notify again until the consumer has begun draining. Should
+  //! \remarks the notification fail, the queue reverts to idle so that the next post notifies again.
+  //!
+  //! \remarks Work posted with a key is coalesced: while an item for that key is waiting, further posts with the
+  //! \remarks same key are discarded. The waiting item therefore executes once and should read the latest state
+  //! \remarks rather than capture it. Keys are released immediately before execution, so posts made while the
+  //! \remarks item executes are queued again.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct WorkQueue
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = WorkQueue;
+
+    //! \alias work_t - Define work item type
+    using work_t = std::function<void ()>;
+
+    //! \alias wake_t - Define consumer notification type  (Returns true iff the consumer was notified)
+    using wake_t = std::function<bool ()>;
+
+    //! \alias key_t - Define coalescing key type
+    using key_t = uintptr_t;
+
+    //! \alias duration_t - Define time budget type
+    using duration_t = std::chrono::steady_clock::duration;
+
+    //! \var slots - Number of coalescing key slots
+    static constexpr uint32_t  slots = 1024;
+
+    //! \var probes - Maximum number of slots probed when coalescing a key
+    static constexpr uint32_t  probes = 8;
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Node - Queued work item
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Node
+    {
+      std::atomic<Node*>  Next;       //!< Next item
+      work_t              Work;       //!< Work item
+      int32_t             Slot;       //!< Coalescing key slot, if any, otherwise -1
+
+      Node() : Next(nullptr), Slot(-1)
+      {}
+
+      Node(work_t&& fn, int32_t slot) : Next(nullptr), Work(std::move(fn)), Slot(slot)
+      {}
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::atomic<Node*>     Head;               //!< Most recently posted item  (Producers)
+    Node*                  Tail;               //!< Next item to execute  (Consumer)
+    Node                   Stub;               //!< Sentinel item
+    std::atomic<key_t>     Keys[slots];        //!< Keys of waiting coalesced items
+    std::atomic<bool>      Signalled;          //!< Whether consumer has been notified
+    wake_t                 Wake;               //!< Notifies the consumer
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // WorkQueue::WorkQueue
+    //! Create an empty queue
+    //!
+    //! \param[in] wake - Function which notifies the consumer that work is available (Called from producer threads)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit WorkQueue(wake_t wake) : Head(&Stub), Tail(&Stub), Signalled(false), Wake(std::move(wake))
+    {
+      for (auto& k : Keys)
+        k.store(0, std::memory_order_relaxed);
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(WorkQueue);      //!< Cannot be copied
+    DISABLE_MOVE(WorkQueue);      //!< Cannot be moved
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // WorkQueue::~WorkQueue
+    //! Destroys any items that were not executed
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~WorkQueue()
+    {
+      bool busy;
+      while (Node* n = pop(busy))
+        delete n;
+    }
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  private:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // WorkQueue::hash
+    //! Calculates the home slot of a key
+    //!
+    //! \param[in] key - Coalescing key
+    //! \return uint32_t - Zero-based slot index
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t  hash(key_t key)
+    {
+      uint64_t h = static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull;
+      return static_cast<uint32_t>(h >> 32) % slots;
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // WorkQueue::signalled const
+    //! Query whether the consumer has been notified but has not yet begun draining
+    //!
+    //! \return bool - True iff work may be waiting
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  signalled() const
+    {
+      return Signalled.load(std::memory_order_acquire);
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // WorkQueue::drain
+    //! Executes waiting items upon the consumer thread until the queue is empty or the time budget is spent
+    //!
+    //! \param[in] budget - Time budget (At least one item is executed, if any are waiting)
+    //! \return uint32_t - Number of items executed
+    //!
+    //! \remarks If items remain the consumer is notified again, allowing other messages to be processed between batches
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  drain(duration_t budget)
+    {
+      auto const deadline = std::chrono::steady_clock::now() + budget;
+      uint32_t   executed = 0;
+      bool       busy = false;
+
+      // Accept notifications from subsequent posts
+      Signalled.store(false, std::memory_order_seq_cst);
+
+      try
+      {
+        while (Node* n = pop(busy))
+        {
+          std::unique_ptr<Node> item(n);
+
+          // Release key before executing, posts made hereafter must execute again
+          if (item->Slot != -1)
+            Keys[item->Slot].exchange(0, std::memory_order_acq_rel);
+
+          item->Work();
+          ++executed;
+
+          // [BUDGET] Yield to the message queue
+          if (std::chrono::steady_clock::now() >= deadline)
+          {
+            busy = true;
+            break;
+          }
+        }
+      }
+      catch (...)
+      {
+        notify();
+        throw;
+      }
+
+      // [REMAINING] Request another batch
+      if (busy)
+        notify();
+
+      return executed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // WorkQueue::post
+    //! Posts a work item from any thread
+    //!
+    //! \param[in] fn - Work item
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  post(work_t fn)
+    {
+      push(new Node(std::move(fn), -1));
+      notify();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // WorkQueue::post
+    //! Posts a coalesced work item from any thread
+    //!
+    //! \param[in] key - Coalescing key, typically the address of the target  (Must be non-zero)
+    //! \param[in] fn - Work item
+    //! \return bool - True if queued, false if coalesced with a waiting item of the same key
+    //!
+    //! \remarks If every slot within the probe sequence is occupied by other keys the item is queued uncoalesced
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  post(key_t key, work_t fn)
+    {
+      uint32_t const home = hash(key);
+
+      // [COALESCE] Search for a waiting item with the same key  (Read-modify-write publishes our prior writes to the consumer)
+      for (uint32_t i = 0; i < probes; ++i)
+      {
+        key_t expected = key;
+        if (Keys[(home + i) % slots].compare_exchange_strong(expected, key, std::memory_order_acq_rel))
+          return false;
+      }
+
+      // [CLAIM] Reserve an empty slot for the key
+      int32_t slot = -1;
+      for (uint32_t i = 0; i < probes && slot == -1; ++i)
+      {
+        key_t expected = 0;
+        if (Keys[(home + i) % slots].compare_exchange_strong(expected, key, std::memory_order_acq_rel))
+          slot = static_cast<int32_t>((home + i) % slots);
+        else if (expected == key)
+          return false;
+      }
+
+      push(new Node(std::move(fn), slot));
+      notify();
+      return true;
+    }
+
+  private:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // WorkQueue::notify
+    //! Notifies the consumer unless already notified
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  notify()
+    {
+      // [FAILED] Revert to idle, allowing the next post to notify again
+      if (!Signalled.exchange(true, std::memory_order_seq_cst) && Wake && !Wake())
+        Signalled.store(false, std::memory_order_seq_cst);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // WorkQueue::pop
+    //! Removes the oldest item  (Consumer only)
+    //!
+    //! \param[out] &busy - Set when an item is being posted but is not yet linked
+    //! \return Node* - Oldest item, or nullptr if empty or busy
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Node*  pop(bool& busy)
+    {
+      Node* tail = Tail;
+      Node* next = tail->Next.load(std::memory_order_acquire);
+
+      busy = false;
+
+      // Skip the sentinel
+      if (tail == &Stub)
+      {
+        if (next == nullptr)
+          return nullptr;
+
+        Tail = tail = next;
+        next = next->Next.load(std::memory_order_acquire);
+      }
+
+      // [ITEM] Successor exists
+      if (next)
+      {
+        Tail = next;
+        return tail;
+      }
+
+      // [BUSY] Producer has swapped the head but not linked its predecessor
+      if (tail != Head.load(std::memory_order_acquire))
+      {
+        busy = true;
+        return nullptr;
+      }
+
+      // [LAST] Re-insert sentinel behind the final item
+      push(&Stub);
+      next = tail->Next.load(std::memory_order_acquire);
+      if (next)
+      {
+        Tail = next;
+        return tail;
+      }
+
+      busy = true;
+      return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // WorkQueue::push
+    //! Appends an item  (Any thread)
+    //!
+    //! \param[in] *n - Item
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  push(Node* n)
+    {
+      n->Next.store(nullptr, std::memory_order_relaxed);
+      Node* prev = Head.exchange(n, std::memory_order_acq_rel);
+      prev->Next.store(n, std::memory_order_release);
+    }
+  };
+
+} // namespace wtl
+
+#endif  // WTL_WORK_QUEUE_HPP
@@ -0,0 +1,216 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\threads\WorkStealingDeque.hpp
+//! \brief Provides a Chase-Lev work-stealing deque
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_WORK_STEALING_DEQUE_HPP
+#define WTL_WORK_STEALING_DEQUE_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/utils/Exception.hpp>            //!< logic_error
+#include <atomic>                             //!< std::atomic, std::atomic_thread_fence
+#include <memory>                             //!< std::unique_ptr
+#include <type_traits>                        //!< std::is_pointer
+#include <vector>                             //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct WorkStealingDeque - Dynamically sized Chase-Lev deque. The owning thread pushes and pops at the bottom,
+  //!  any other thread may steal from the top.
+  //!
+  //! \tparam T - Element pointer type  (nullptr is returned when empty)
+  //!
+  //! \remarks Implements the weak memory model formulation by Le, Pop, Cohen & Zappa Nardelli (PPoPP 2013).
+  //! \remarks Superseded buffers are retained until destruction because thieves may still be reading them.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct WorkStealingDeque
+  {
+    static_assert(std::is_pointer<T>::value, "Deque elements must be pointers");
+
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = WorkStealingDeque<T>;
+
+    //! \alias value_type - Define element type
+    using value_type = T;
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Buffer - Circular buffer with power-of-two capacity
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Buffer
+    {
+      int64_t                               Capacity;     //!< Number of elements
+      std::unique_ptr<std::atomic<T>[]>     Items;        //!< Elements
+
+      explicit Buffer(int64_t capacity) : Capacity(capacity), Items(new std::atomic<T>[static_cast<size_t>(capacity)])
+      {}
+
+      T get(int64_t idx) const
+      {
+        return Items[idx & (Capacity-1)].load(std::memory_order_relaxed);
+      }
+
+      void put(int64_t idx, T value)
+      {
+        Items[idx & (Capacity-1)].store(value, std::memory_order_relaxed);
+      }
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::atomic<int64_t>                  Top;          //!< Index of oldest element  (Thieves)
+    std::atomic<int64_t>                  Bottom;       //!< Index beyond newest element  (Owner)
+    std::atomic<Buffer*>                  Current;      //!< Current buffer
+    std::vector<std::unique_ptr<Buffer>>  Buffers;      //!< Current and superseded buffers  (Owner)
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // WorkStealingDeque::WorkStealingDeque
+    //! Create empty deque
+    //!
+    //! \param[in] capacity - [optional] Initial capacity  (Must be a power of two)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit WorkStealingDeque(int64_t capacity = 256) : Top(0), Bottom(0)
+    {
+      LOGIC_INVARIANT(capacity > 0 && (capacity & (capacity-1)) == 0);
+
+      Buffers.emplace_back(new Buffer(capacity));
+      Current.store(Buffers.back().get(), std::memory_order_relaxed);
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(WorkStealingDeque);      //!< Cannot be copied
+    DISABLE_MOVE(WorkStealingDeque);      //!< Cannot be moved
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // WorkStealingDeque::empty const
+    //! Query whether deque is empty  (Approximate unless called by the owner while no thief is active)
+    //!
+    //! \return bool - True iff empty
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  empty() const
+    {
+      return Bottom.load(std::memory_order_relaxed) <= Top.load(std::memory_order_relaxed);
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // WorkStealingDeque::pop
+    //! Removes the newest element  (Owner only)
+    //!
+    //! \return T - Newest element, or nullptr if empty
+    /////////////////////////////////////////////////////////////////////////////////////////
+    T  pop()
+    {
+      int64_t b = Bottom.load(std::memory_order_relaxed) - 1;
+      Buffer* a = Current.load(std::memory_order_relaxed);
+      Bottom.store(b, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      int64_t t = Top.load(std::memory_order_relaxed);
+
+      // [EMPTY] Restore bottom
+      if (t > b)
+      {
+        Bottom.store(b+1, std::memory_order_relaxed);
+        return nullptr;
+      }
+
+      T value = a->get(b);
+
+      // [LAST] Race thieves for the final element
+      if (t == b)
+      {
+        if (!Top.compare_exchange_strong(t, t+1, std::memory_order_seq_cst, std::memory_order_relaxed))
+          value = nullptr;
+        Bottom.store(b+1, std::memory_order_relaxed);
+      }
+      return value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // WorkStealingDeque::push
+    //! Appends an element  (Owner only)
+    //!
+    //! \param[in] value - Element  (Must not be nullptr)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  push(T value)
+    {
+      int64_t b = Bottom.load(std::memory_order_relaxed);
+      int64_t t = Top.load(std::memory_order_acquire);
+      Buffer* a = Current.load(std::memory_order_relaxed);
+
+      // [FULL] Double capacity
+      if (b - t > a->Capacity - 1)
+        a = grow(a, t, b);
+
+      a->put(b, value);
+      std::atomic_thread_fence(std::memory_order_release);
+      Bottom.store(b+1, std::memory_order_relaxed);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // WorkStealingDeque::steal
+    //! Removes the oldest element  (Any thread)
+    //!
+    //! \return T - Oldest element, or nullptr if empty or lost a race with another thread
+    /////////////////////////////////////////////////////////////////////////////////////////
+    T  steal()
+    {
+      int64_t t = Top.load(std::memory_order_acquire);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      int64_t b = Bottom.load(std::memory_order_acquire);
+
+      // [EMPTY]
+      if (t >= b)
+        return nullptr;
+
+      Buffer* a = Current.load(std::memory_order_acquire);
+      T value = a->get(t);
+
+      // [RACE] Another thread claimed the element
+      if (!Top.compare_exchange_strong(t, t+1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return nullptr;
+
+      return value;
+    }
+
+  private:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // WorkStealingDeque::grow
+    //! Publishes a buffer of twice the capacity containing the current elements  (Owner only)
+    //!
+    //! \param[in] *a - Current buffer
+    //! \param[in] t - Top index
+    //! \param[in] b - Bottom index
+    //! \return Buffer* - New buffer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Buffer*  grow(Buffer* a, int64_t t, int64_t b)
+    {
+      Buffers.emplace_back(new Buffer(a->Capacity * 2));
+      Buffer* next = Buffers.back().get();
+
+      for (int64_t i = t; i < b; ++i)
+        next->put(i, a->get(i));
+
+      Current.store(next, std::memory_order_release);
+      return next;
+    }
+  };
+
+} // namespace wtl
+
+#endif  // WTL_WORK_STEALING_DEQUE_HPP
@@ -1,6 +1,6 @@
 //////////////////////////////////////////////////////////////////////////////////////////
 //! \file wtl\threads\WorkerThread.hpp
-//! \brief Background thread. Eventually this will be expanded to the background worker idiom
+//! \brief Background threads. Short-lived work should be executed by the thread pool instead
 //! \date 6 March 2015
 //! \author Nick Crowley
 //! \copyright Nick Crowley. All rights reserved.
@@ -9,12 +9,13 @@
 #define WTL_WORKER_THREAD_HPP
 
 #include <wtl/WTL.hpp>
-#include <thread>
+#include <wtl/threads/ThreadPool.hpp>         //!< ThreadPool, Task
+#include <thread>                             //!< std::thread
 
 //! \namespace wtl - Windows template library
 namespace wtl
 {
-  //! \alias WorkerThread - Uses std::thread
+  //! \alias WorkerThread - Dedicated thread for long-running work  (Use ThreadPool::async for background tasks)
   using WorkerThread = std::thread;
 
 }
@@ -10,6 +10,8 @@
 
 #include <wtl/WTL.hpp>
 #include <wtl/utils/Handle.hpp>               //!< Handle
+#include <wtl/utils/HandlePool.hpp>           //!< HandlePool
+#include <wtl/utils/UniqueHandle.hpp>         //!< UniqueHandle
 #include <wtl/platform/Colours.hpp>           //!< Colour
 #include <wtl/platform/DrawingFlags.hpp>      //!< StockObject,HatchStyle
 #include <wtl/platform/SystemFlags.hpp>       //!< SystemColour
@@ -23,6 +25,16 @@ namespace wtl
   /////////////////////////////////////////////////////////////////////////////////////////
   using HBrush = Handle<::HBRUSH>;
 
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \alias HUniqueBrush - Unique brush handle
+  /////////////////////////////////////////////////////////////////////////////////////////
+  using HUniqueBrush = UniqueHandle<::HBRUSH>;
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \alias HBrushPool - Recycles solid brushes by colour
+  /////////////////////////////////////////////////////////////////////////////////////////
+  using HBrushPool = HandlePool<::HBRUSH,Colour>;
+
 
   /////////////////////////////////////////////////////////////////////////////////////////
   //! \struct handle_alloc<::HBRUSH> - Encapsulates brush handle allocation
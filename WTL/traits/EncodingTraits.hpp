@@ -143,13 +143,13 @@ namespace wtl
   //! \return auto - 'narrow' if sizeof(CHR) == 1, otherwise 'wide'
   /////////////////////////////////////////////////////////////////////////////////////////
   template <Encoding ENC, typename NARROW, typename WIDE> constexpr
-  auto choose(NARROW narrow, WIDE wide) noexcept -> enable_if_narrow_t<ENC, NARROW>
+  auto choose(NARROW narrow, WIDE) noexcept -> enable_if_narrow_t<ENC, NARROW>
   {
     return narrow;
   }
   
   template <Encoding ENC, typename NARROW, typename WIDE> constexpr
-  auto choose(NARROW narrow, WIDE wide) noexcept -> enable_if_wide_t<ENC, WIDE>
+  auto choose(NARROW, WIDE wide) noexcept -> enable_if_wide_t<ENC, WIDE>
   {
     return wide;
   }
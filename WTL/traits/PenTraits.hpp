@@ -10,10 +10,13 @@
 
 #include <wtl/WTL.hpp>
 #include <wtl/utils/Handle.hpp>               //!< Handle
+#include <wtl/utils/HandlePool.hpp>           //!< HandlePool
+#include <wtl/utils/UniqueHandle.hpp>         //!< UniqueHandle
 #include <wtl/platform/Colours.hpp>           //!< Colour
 #include <wtl/platform/DrawingFlags.hpp>      //!< StockObject, PenStyle
 #include <wtl/platform/SystemFlags.hpp>       //!< SystemColour
 #include <wtl/casts/EnumCast.hpp>             //!< EnumCast
+#include <tuple>                              //!< std::tuple
 
 //! \namespace wtl - Windows template library
 namespace wtl
@@ -23,6 +26,16 @@ namespace wtl
   /////////////////////////////////////////////////////////////////////////////////////////
   using HPen = Handle<::HPEN>;
 
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \alias HUniquePen - Unique pen handle
+  /////////////////////////////////////////////////////////////////////////////////////////
+  using HUniquePen = UniqueHandle<::HPEN>;
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \alias HPenPool - Recycles pens by style, width and colour
+  /////////////////////////////////////////////////////////////////////////////////////////
+  using HPenPool = HandlePool<::HPEN,std::tuple<PenStyle,int32_t,Colour>>;
+
   
   /////////////////////////////////////////////////////////////////////////////////////////
   //! \struct handle_alloc<::HPEN> - Encapsulates creating device context pens
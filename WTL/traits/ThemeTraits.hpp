@@ -11,7 +11,7 @@
 #include <wtl/WTL.hpp>
 #include <wtl/utils/Handle.hpp>               //!< Handle
 #include <wtl/utils/String.hpp>               //!< String
-#include <wtl/traits/WindowTraits.hpp>        //!< HWnd
+#include <wtl/traits/windowtraits.hpp>        //!< HWnd
 #include <Uxtheme.h>                          //!< Visual styles
 
 //! \namespace wtl - Windows template library
@@ -10,7 +10,7 @@
 
 #include <wtl/WTL.hpp>
 #include <wtl/utils/Handle.hpp>           //!< Handle
-#include <wtl/utils/CharArray.hpp>        //!< CharArray
+#include <wtl/utils/chararray.hpp>        //!< CharArray
 #include <wtl/utils/String.hpp>           //!< String
 #include <wtl/traits/EnumTraits.hpp>      //!< is_attribute
 #include <wtl/traits/EncodingTraits.hpp>  //!< Encoding
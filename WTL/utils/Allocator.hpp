@@ -10,6 +10,7 @@
 
 #include <wtl/WTL.hpp>
 #include <wtl/utils/SFINAE.hpp>             //!< wtl::enable_if_class_t
+#include <wtl/utils/Default.hpp>            //!< wtl::defvalue
 #include <utility>                          //!< std::forward
 
 //! \namespace wtl - Windows template library
@@ -10,6 +10,7 @@
 
 #include <wtl/WTL.hpp>
 #include <wtl/utils/Default.hpp>            //!< Default
+#include <wtl/utils/PowerOf.hpp>            //!< power_of
 #include <wtl/utils/DynamicArray.hpp>       //!< Array
 #include <wtl/utils/Range.hpp>              //!< delimited_range
 #include <wtl/utils/DebugInfo.hpp>          //!< DebugInfo
@@ -46,8 +47,9 @@ namespace wtl
     //! \struct loop - Unfurls the high bits of the mask into a variable length array
     //!
     //! \tparam IDX - Zero-based iteration index
+    //! \tparam END - Whether iteration is complete
     //////////////////////////////////////////////////////////////////////////////////////////
-    template <uint32_t IDX>
+    template <uint32_t IDX, bool END = (IDX == bits)>
     struct loop
     {
       static_assert((IDX >= 0) && (IDX < bits), "Invalid loop index");
@@ -71,12 +73,12 @@ namespace wtl
     };
 
     //////////////////////////////////////////////////////////////////////////////////////////
-    //! \struct loop<bits> - Base case 
+    //! \struct loop<bits> - Base case  (Partially specialized as explicit specialization is not permitted at class scope)
     //////////////////////////////////////////////////////////////////////////////////////////
-    template <>
-    struct loop<bits>
+    template <uint32_t IDX>
+    struct loop<IDX,true>
     {
-      static void flatten(const mask_t& mask, BitArray& out)
+      static void flatten(const mask_t&, BitArray&)
       { /*no-op*/ }
     };
     
@@ -313,17 +315,20 @@ namespace wtl
   //!
   //! \tparam DATA - Bitset data type
   //! 
+  //! \tparam CHAR - Output stream character type
+  //! \tparam TRAITS - Output stream character traits
+  //! 
   //! \param[in,out] &c - Debugging console
   //! \param[in] const& b - Bitset 
-  //! \return Console& - Reference to input console
+  //! \return std::basic_ostream<CHAR,TRAITS>& - Reference to input console
   //////////////////////////////////////////////////////////////////////////////////////////
-  template <typename DATA>
-  Console& operator << (Console& c, const Bitset<DATA>& b)
+  template <typename CHAR, typename TRAITS, typename DATA>
+  std::basic_ostream<CHAR,TRAITS>& operator << (std::basic_ostream<CHAR,TRAITS>& c, const Bitset<DATA>& b)
   {
     // Print comma separated zero-based indicies of high-bits
-    return c << Cons::Grey  << '{' 
-             << Cons::White << delimited_range(b.flatten(), ',')
-             << Cons::Grey  << '}';
+    return c << textcol::grey  << '{' 
+             << textcol::white << delimited_range(b.flatten(), ',')
+             << textcol::grey  << '}';
   };
 
 
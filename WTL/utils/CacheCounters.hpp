@@ -0,0 +1,38 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\utils\CacheCounters.hpp
+//! \brief Provides hit and miss counters for caches
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_CACHE_COUNTERS_HPP
+#define WTL_CACHE_COUNTERS_HPP
+
+#include <wtl/WTL.hpp>
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct CacheCounters - Hit and miss counters
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct CacheCounters
+  {
+    uint64_t  Hits,       //!< Number of lookups answered by the cache
+              Misses;     //!< Number of lookups forwarded to the source
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CacheCounters::ratio const
+    //! Query the hit rate
+    //!
+    //! \return double - Proportion of lookups which hit, or zero if none
+    /////////////////////////////////////////////////////////////////////////////////////////
+    double  ratio() const
+    {
+      return Hits + Misses ? static_cast<double>(Hits) / (Hits + Misses) : 0.0;
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_CACHE_COUNTERS_HPP
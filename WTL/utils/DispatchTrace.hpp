@@ -0,0 +1,677 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\utils\DispatchTrace.hpp
+//! \brief Provides latency tracing of message dispatch, routing and event handlers  (See DISPATCH_TRACING)
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_DISPATCH_TRACE_HPP
+#define WTL_DISPATCH_TRACE_HPP
+
+#include <wtl/WTL.hpp>
+#include <algorithm>                          //!< std::min, std::max, std::sort
+#include <atomic>                             //!< std::atomic
+#include <chrono>                             //!< std::chrono::steady_clock
+#include <iomanip>                            //!< std::setw
+#include <mutex>                              //!< std::mutex
+#include <ostream>                            //!< std::ostream
+#include <unordered_map>                      //!< std::unordered_map
+#include <vector>                             //!< std::vector
+#ifdef _MSC_VER
+  #include <intrin.h>                         //!< _BitScanReverse64
+#endif
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \enum TraceCategory - Define the stages of message dispatch that are traced
+  /////////////////////////////////////////////////////////////////////////////////////////
+  enum class TraceCategory : uint8_t
+  {
+    WndProc,        //!< Class window procedure  (Identified by message)
+    Lookup,         //!< Window object lookup  (Identified by message)
+    Route,          //!< Instance window procedure  (Identified by message)
+    Event,          //!< Raising an event  (Identified by event address)
+    Handler,        //!< Executing an event handler  (Identified by delegate address)
+  };
+
+  //! \var TraceCategories - Number of trace categories
+  constexpr uint32_t  TraceCategories = 5;
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct LatencyHistogram - Log-linear histogram of latencies in nanoseconds, in the style of HdrHistogram
+  //!
+  //! \remarks Values below 8ns are recorded exactly. Each subsequent power-of-two range is divided into 8 equal
+  //! \remarks buckets, bounding the relative error of any reported percentile to 12.5%.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct LatencyHistogram
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var subBuckets - Number of buckets per power-of-two range
+    static constexpr uint32_t  subBuckets = 8;
+
+    //! \var buckets - Total number of buckets  (Covers the full 64-bit range)
+    static constexpr uint32_t  buckets = (64 - 2) * subBuckets;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    uint64_t  Counts[buckets];      //!< Number of values recorded in each bucket
+    uint64_t  Count;                //!< Number of values
+    uint64_t  Sum;                  //!< Sum of values
+    uint64_t  Min;                  //!< Minimum value
+    uint64_t  Max;                  //!< Maximum value
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    LatencyHistogram()
+    {
+      clear();
+    }
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LatencyHistogram::bucket
+    //! Get the bucket containing a value
+    //!
+    //! \param[in] ns - Value
+    //! \return uint32_t - Zero-based bucket index
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t  bucket(uint64_t ns)
+    {
+      if (ns < subBuckets)
+        return static_cast<uint32_t>(ns);
+
+      uint32_t const magnitude = log2(ns);
+      return (magnitude - 2) * subBuckets + static_cast<uint32_t>((ns >> (magnitude - 3)) - subBuckets);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LatencyHistogram::upperBound
+    //! Get the largest value within a bucket
+    //!
+    //! \param[in] idx - Zero-based bucket index
+    //! \return uint64_t - Inclusive upper bound
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint64_t  upperBound(uint32_t idx)
+    {
+      if (idx < subBuckets)
+        return idx;
+
+      uint32_t const shift = idx / subBuckets - 1;
+      return ((static_cast<uint64_t>(subBuckets + idx % subBuckets) + 1) << shift) - 1;
+    }
+
+  private:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LatencyHistogram::log2
+    //! Get the index of the most significant set bit
+    //!
+    //! \param[in] value - Non-zero value
+    //! \return uint32_t - Zero-based bit index
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t  log2(uint64_t value)
+    {
+#if defined(_MSC_VER) && defined(_WIN64)
+      unsigned long idx;
+      _BitScanReverse64(&idx, value);
+      return idx;
+#elif defined(__GNUC__)
+      return 63 - __builtin_clzll(value);
+#else
+      uint32_t idx = 0;
+      while (value >>= 1)
+        ++idx;
+      return idx;
+#endif
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LatencyHistogram::mean const
+    //! Get the mean value
+    //!
+    //! \return uint64_t - Mean, or zero if empty
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t  mean() const
+    {
+      return Count ? Sum / Count : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LatencyHistogram::percentile const
+    //! Get the value below which a proportion of values fall
+    //!
+    //! \param[in] p - Percentile  (0.0 to 100.0)
+    //! \return uint64_t - Upper bound of the bucket containing the percentile  (Never exceeds the maximum)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t  percentile(double p) const
+    {
+      if (!Count)
+        return 0;
+
+      uint64_t const rank = std::max<uint64_t>(1, static_cast<uint64_t>(p / 100.0 * Count + 0.5));
+      uint64_t seen = 0;
+
+      for (uint32_t idx = 0; idx < buckets; ++idx)
+        if ((seen += Counts[idx]) >= rank)
+          return std::min(upperBound(idx), Max);
+
+      return Max;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LatencyHistogram::clear
+    //! Removes all values
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clear()
+    {
+      std::fill(std::begin(Counts), std::end(Counts), 0);
+      Count = Sum = Max = 0;
+      Min = UINT64_MAX;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LatencyHistogram::merge
+    //! Adds the values of another histogram
+    //!
+    //! \param[in] const& r - Another histogram
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  merge(const LatencyHistogram& r)
+    {
+      for (uint32_t idx = 0; idx < buckets; ++idx)
+        Counts[idx] += r.Counts[idx];
+
+      Count += r.Count;
+      Sum += r.Sum;
+      Min = std::min(Min, r.Min);
+      Max = std::max(Max, r.Max);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // LatencyHistogram::record
+    //! Records a value
+    //!
+    //! \param[in] ns - Value
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  record(uint64_t ns)
+    {
+      ++Counts[bucket(ns)];
+      ++Count;
+      Sum += ns;
+      Min = std::min(Min, ns);
+      Max = std::max(Max, ns);
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct HandlerStatistics - Time spent within an event handler
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct HandlerStatistics
+  {
+    const char*  Name = nullptr;      //!< Handler type name
+    uint64_t     Calls = 0;           //!< Number of invocations
+    uint64_t     Total = 0;           //!< Total time, in nanoseconds
+    uint64_t     Longest = 0;         //!< Longest invocation, in nanoseconds
+
+    void  merge(const HandlerStatistics& r)
+    {
+      Name = r.Name;
+      Calls += r.Calls;
+      Total += r.Total;
+      Longest = std::max(Longest, r.Longest);
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct TraceEvent - Timeline entry describing a single traced span
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct TraceEvent
+  {
+    uint64_t       Start;         //!< Start time, in nanoseconds since the trace epoch
+    uint64_t       Duration;      //!< Duration, in nanoseconds
+    uintptr_t      Id;            //!< Message identifier, or address of event/delegate
+    const char*    Name;          //!< Handler type name, if any
+    uint32_t       Thread;        //!< Sequential thread number
+    TraceCategory  Category;      //!< Dispatch stage
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct TraceStatistics - Statistics of traced spans, by message and by handler
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct TraceStatistics
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias message_map_t - Define latency by message type
+    using message_map_t = std::unordered_map<uint32_t,LatencyHistogram>;
+
+    //! \alias handler_map_t - Define time by handler
+    using handler_map_t = std::unordered_map<uintptr_t,HandlerStatistics>;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    LatencyHistogram         Categories[TraceCategories];     //!< Latency of each dispatch stage
+    message_map_t            Messages;                        //!< Latency of window procedure by message
+    handler_map_t            Handlers;                        //!< Time within each event handler
+    std::vector<TraceEvent>  Events;                          //!< Timeline, if captured
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TraceStatistics::clear
+    //! Removes all statistics and timeline entries
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clear()
+    {
+      for (auto& c : Categories)
+        c.clear();
+      Messages.clear();
+      Handlers.clear();
+      Events.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TraceStatistics::record
+    //! Records a traced span
+    //!
+    //! \param[in] const& e - Span
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  record(const TraceEvent& e)
+    {
+      Categories[static_cast<uint32_t>(e.Category)].record(e.Duration);
+
+      switch (e.Category)
+      {
+      case TraceCategory::WndProc:
+        Messages[static_cast<uint32_t>(e.Id)].record(e.Duration);
+        break;
+
+      case TraceCategory::Handler:
+        {
+          auto& h = Handlers[e.Id];
+          h.Name = e.Name;
+          ++h.Calls;
+          h.Total += e.Duration;
+          h.Longest = std::max(h.Longest, e.Duration);
+        }
+        break;
+
+      default:
+        break;
+      }
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct DispatchTrace - Aggregates spans recorded into thread-local buffers, and exports them as a
+  //!  plain text report or in the Chrome trace event format (chrome://tracing, Perfetto)
+  //!
+  //! \remarks Each thread accumulates statistics and timeline entries without synchronization. Buffers are merged
+  //! \remarks into the shared trace when full, at most every 'FlushInterval', upon 'flush' and at thread exit.
+  //! \remarks Exports therefore reflect other threads as of their most recent merge.
+  //!
+  //! \remarks Tracing code is only compiled when DISPATCH_TRACING is non-zero; see the TRACE_SCOPE macros.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct DispatchTrace
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = DispatchTrace;
+
+    //! \alias clock_t - Define clock type
+    using clock_t = std::chrono::steady_clock;
+
+    //! \var bufferCapacity - Number of timeline entries buffered per thread before merging
+    static constexpr uint32_t  bufferCapacity = 4096;
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Buffer - Per-thread recording buffer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Buffer
+    {
+      TraceStatistics  Stats;         //!< Statistics and timeline since last merge
+      uint32_t         Thread;        //!< Sequential thread number
+      uint64_t         LastFlush;     //!< Time of last merge
+
+      Buffer() : Thread(next()), LastFlush(now())
+      {
+        Stats.Events.reserve(bufferCapacity);
+      }
+
+      ~Buffer()
+      {
+        instance().merge(Stats);
+      }
+
+      static uint32_t next()
+      {
+        static std::atomic<uint32_t>  count(0);
+        return ++count;
+      }
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    std::atomic<bool>      Timeline;          //!< Whether timeline entries are captured, in addition to statistics
+    std::atomic<uint64_t>  FlushInterval;     //!< Maximum interval between merges of each thread, in nanoseconds
+    size_t                 MaxEvents;         //!< Maximum number of timeline entries retained  (Further entries are dropped)
+
+  protected:
+    clock_t::time_point    Epoch;             //!< Trace epoch
+    mutable std::mutex     Lock;              //!< Guards merged statistics
+    TraceStatistics        Merged;            //!< Merged statistics
+    uint64_t               Dropped;           //!< Number of timeline entries dropped
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DispatchTrace::DispatchTrace
+    //! Create empty trace with timeline capture enabled
+    /////////////////////////////////////////////////////////////////////////////////////////
+    DispatchTrace() : Timeline(true),
+                      FlushInterval(100000000ull),
+                      MaxEvents(1u << 20),
+                      Epoch(clock_t::now()),
+                      Dropped(0)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(DispatchTrace);      //!< Cannot be copied
+    DISABLE_MOVE(DispatchTrace);      //!< Cannot be moved
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DispatchTrace::instance
+    //! Access the process-wide trace
+    //!
+    //! \return DispatchTrace& - Trace
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static DispatchTrace&  instance()
+    {
+      static DispatchTrace  trace;
+      return trace;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DispatchTrace::now
+    //! Get the current time
+    //!
+    //! \return uint64_t - Nanoseconds since the trace epoch
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint64_t  now()
+    {
+      using namespace std::chrono;
+      return static_cast<uint64_t>(duration_cast<nanoseconds>(clock_t::now() - instance().Epoch).count());
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DispatchTrace::local
+    //! Access the buffer of the calling thread
+    //!
+    //! \return Buffer& - Thread-local buffer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static Buffer&  local()
+    {
+      static thread_local Buffer  buffer;
+      return buffer;
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DispatchTrace::writeChromeTrace const
+    //! Writes the merged timeline in the Chrome trace event JSON format
+    //!
+    //! \param[in,out] &out - Output stream
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  writeChromeTrace(std::ostream& out) const
+    {
+      static const char* const categories[TraceCategories] = { "WndProc", "Lookup", "Route", "Event", "Handler" };
+
+      std::lock_guard<std::mutex> guard(Lock);
+      std::ios::fmtflags flags(out.flags());
+      bool first = true;
+
+      out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+      for (auto& e : Merged.Events)
+      {
+        out << (first ? "\n" : ",\n") << "{\"ph\":\"X\",\"pid\":1,\"tid\":" << std::dec << e.Thread
+            << ",\"cat\":\"" << categories[static_cast<uint32_t>(e.Category)] << "\",\"name\":\"";
+
+        // Name handlers by type, messages by identifier, events by address
+        if (e.Category == TraceCategory::Handler && e.Name)
+          writeEscaped(out, e.Name);
+        else
+          out << categories[static_cast<uint32_t>(e.Category)] << " 0x" << std::hex << e.Id << std::dec;
+
+        out << "\",\"ts\":" << e.Start / 1000 << '.' << std::setw(3) << std::setfill('0') << e.Start % 1000
+            << ",\"dur\":" << e.Duration / 1000 << '.' << std::setw(3) << std::setfill('0') << e.Duration % 1000 << '}';
+        first = false;
+      }
+      out << "\n]}\n";
+      out.flags(flags);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DispatchTrace::writeReport const
+    //! Writes the merged statistics as a plain text report
+    //!
+    //! \param[in,out] &out - Output stream
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  writeReport(std::ostream& out) const
+    {
+      static const char* const categories[TraceCategories] = { "WndProc", "Lookup", "Route", "Event", "Handler" };
+
+      std::lock_guard<std::mutex> guard(Lock);
+      std::ios::fmtflags flags(out.flags());
+
+      auto row = [&out] (const LatencyHistogram& h)
+      {
+        out << std::dec << std::setfill(' ')
+            << std::setw(10) << h.Count << std::setw(10) << h.mean() << std::setw(10) << h.percentile(50)
+            << std::setw(10) << h.percentile(99) << std::setw(12) << h.Max << '\n';
+      };
+
+      // Stages
+      out << "Stage         Count   Mean ns    P50 ns    P99 ns      Max ns\n";
+      for (uint32_t c = 0; c < TraceCategories; ++c)
+      {
+        out << std::left << std::setw(8) << categories[c] << std::right;
+        row(Merged.Categories[c]);
+      }
+
+      // Messages, most expensive first
+      std::vector<std::pair<uint32_t,const LatencyHistogram*>> messages;
+      for (auto& m : Merged.Messages)
+        messages.emplace_back(m.first, &m.second);
+      std::sort(messages.begin(), messages.end(), [] (const auto& a, const auto& b) { return a.second->Sum > b.second->Sum; });
+
+      out << "\nMessage       Count   Mean ns    P50 ns    P99 ns      Max ns\n";
+      for (auto& m : messages)
+      {
+        out << "0x" << std::hex << std::setw(4) << std::setfill('0') << m.first << "  ";
+        row(*m.second);
+      }
+
+      // Handlers, most expensive first
+      std::vector<const HandlerStatistics*> handlers;
+      for (auto& h : Merged.Handlers)
+        handlers.push_back(&h.second);
+      std::sort(handlers.begin(), handlers.end(), [] (auto a, auto b) { return a->Total > b->Total; });
+
+      out << "\n     Calls  Total ns   Mean ns    Max ns  Handler\n";
+      for (auto h : handlers)
+        out << std::dec << std::setfill(' ') << std::setw(10) << h->Calls << std::setw(10) << h->Total
+            << std::setw(10) << h->Total / std::max<uint64_t>(1, h->Calls) << std::setw(10) << h->Longest
+            << "  " << (h->Name ? h->Name : "?") << '\n';
+
+      if (Dropped)
+        out << "\n" << std::dec << Dropped << " timeline entries dropped\n";
+      out.flags(flags);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DispatchTrace::statistics const
+    //! Get a copy of the merged statistics
+    //!
+    //! \return TraceStatistics - Statistics and timeline
+    /////////////////////////////////////////////////////////////////////////////////////////
+    TraceStatistics  statistics() const
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      return Merged;
+    }
+
+  private:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DispatchTrace::writeEscaped
+    //! Writes a JSON string body
+    //!
+    //! \param[in,out] &out - Output stream
+    //! \param[in] const* str - String
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void  writeEscaped(std::ostream& out, const char* str)
+    {
+      for (; *str; ++str)
+        if (*str == '"' || *str == '\\')
+          out << '\\' << *str;
+        else if (static_cast<unsigned char>(*str) >= 0x20)
+          out << *str;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DispatchTrace::clear
+    //! Discards the merged statistics and timeline
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clear()
+    {
+      std::lock_guard<std::mutex> guard(Lock);
+      Merged.clear();
+      Dropped = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DispatchTrace::flush
+    //! Merges the buffer of the calling thread
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  flush()
+    {
+      Buffer& b = local();
+      merge(b.Stats);
+      b.LastFlush = now();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DispatchTrace::record
+    //! Records a span into the buffer of the calling thread
+    //!
+    //! \param[in] category - Dispatch stage
+    //! \param[in] id - Message identifier, or address of event/delegate
+    //! \param[in] const* name - Handler type name, if any
+    //! \param[in] start - Start time
+    //! \param[in] end - End time
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  record(TraceCategory category, uintptr_t id, const char* name, uint64_t start, uint64_t end)
+    {
+      Buffer& b = local();
+      TraceEvent const e { start, end - start, id, name, b.Thread, category };
+
+      b.Stats.record(e);
+      if (Timeline.load(std::memory_order_relaxed))
+        b.Stats.Events.push_back(e);
+
+      // [PERIODIC] Merge when full or stale
+      if (b.Stats.Events.size() >= bufferCapacity || end - b.LastFlush >= FlushInterval.load(std::memory_order_relaxed))
+      {
+        merge(b.Stats);
+        b.LastFlush = end;
+      }
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DispatchTrace::merge
+    //! Merges and clears a thread buffer
+    //!
+    //! \param[in,out] &stats - Statistics of a thread buffer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  merge(TraceStatistics& stats)
+    {
+      {
+        std::lock_guard<std::mutex> guard(Lock);
+
+        for (uint32_t c = 0; c < TraceCategories; ++c)
+          Merged.Categories[c].merge(stats.Categories[c]);
+        for (auto& m : stats.Messages)
+          Merged.Messages[m.first].merge(m.second);
+        for (auto& h : stats.Handlers)
+          Merged.Handlers[h.first].merge(h.second);
+
+        // Retain timeline up to capacity
+        size_t const accepted = std::min(stats.Events.size(), MaxEvents - std::min(MaxEvents, Merged.Events.size()));
+        Merged.Events.insert(Merged.Events.end(), stats.Events.begin(), stats.Events.begin() + accepted);
+        Dropped += stats.Events.size() - accepted;
+      }
+      stats.clear();
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct TraceScope - Records the duration of the enclosing scope as a span
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct TraceScope
+  {
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    uint64_t       Start;         //!< Start time
+    uintptr_t      Id;            //!< Message identifier, or address of event/delegate
+    const char*    Name;          //!< Handler type name, if any
+    TraceCategory  Category;      //!< Dispatch stage
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TraceScope::TraceScope
+    //! Begins a span
+    //!
+    //! \param[in] category - Dispatch stage
+    //! \param[in] id - Message identifier, or address of event/delegate
+    //! \param[in] const* name - [optional] Handler type name
+    /////////////////////////////////////////////////////////////////////////////////////////
+    TraceScope(TraceCategory category, uintptr_t id, const char* name = nullptr) : Start(DispatchTrace::now()),
+                                                                                   Id(id),
+                                                                                   Name(name),
+                                                                                   Category(category)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(TraceScope);      //!< Cannot be copied
+    DISABLE_MOVE(TraceScope);      //!< Cannot be moved
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // TraceScope::~TraceScope
+    //! Ends the span
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~TraceScope()
+    {
+      DispatchTrace::instance().record(Category, Id, Name, Start, DispatchTrace::now());
+    }
+  };
+
+} // namespace wtl
+
+#endif  // WTL_DISPATCH_TRACE_HPP
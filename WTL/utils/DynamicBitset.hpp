@@ -0,0 +1,797 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\utils\DynamicBitset.hpp
+//! \brief Bitset of any width with word-parallel iteration, vectorized set operations and rank/select
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_DYNAMIC_BITSET_HPP
+#define WTL_DYNAMIC_BITSET_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/utils/Exception.hpp>            //!< out_of_range
+#include <algorithm>                          //!< std::min, std::max, std::copy, std::fill
+#include <vector>                             //!< std::vector
+#ifdef _MSC_VER
+  #include <intrin.h>                         //!< _BitScanForward64, __popcnt64
+#endif
+#if defined(__AVX2__)
+  #include <immintrin.h>                      //!< AVX2
+  #define WTL_BITSET_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>                      //!< SSE2
+  #define WTL_BITSET_SSE2
+#endif
+#if defined(__BMI2__)
+  #include <immintrin.h>                      //!< _pdep_u64
+#endif
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct DynamicBitset - Bitset of any width, resizable at runtime
+  //!
+  //! \remarks Up to 256 bits are stored inline; wider sets are stored in a heap block. Set bits are enumerated a word
+  //! \remarks at a time with count-trailing-zeros, and set operations process 128 or 256 bits per instruction where
+  //! \remarks SSE2 or AVX2 is available. Bits beyond size() are always clear.
+  //!
+  //! \remarks Does not depend upon any Win32 API
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct DynamicBitset
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = DynamicBitset;
+
+    //! \alias word_t - Storage word type
+    using word_t = uint64_t;
+
+    //! \var WordBits - Number of bits per word
+    static constexpr uint32_t WordBits = 64;
+
+    //! \var InlineWords - Number of words stored inline
+    static constexpr uint32_t InlineWords = 4;
+
+    //! \var npos - Sentinel returned when no bit is found
+    static constexpr uint32_t npos = ~0u;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    word_t*   Data;                     //!< Words  (Inline or heap)
+    uint32_t  Bits;                     //!< Number of bits
+    uint32_t  Capacity;                 //!< Number of words allocated
+    word_t    Inline[InlineWords];      //!< Inline words
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::DynamicBitset
+    //! Create a bitset with every bit clear
+    //!
+    //! \param[in] bits - [optional] Number of bits
+    //!
+    //! \throw std::bad_alloc - Insufficient memory
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit DynamicBitset(uint32_t bits = 0) : Data(Inline), Bits(0), Capacity(InlineWords), Inline()
+    {
+      resize(bits);
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::DynamicBitset
+    //! Deep copy
+    /////////////////////////////////////////////////////////////////////////////////////////
+    DynamicBitset(const DynamicBitset& r) : DynamicBitset()
+    {
+      *this = r;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::DynamicBitset
+    //! Move-construct, transferring any heap block and leaving the source empty
+    /////////////////////////////////////////////////////////////////////////////////////////
+    DynamicBitset(DynamicBitset&& r) noexcept : DynamicBitset()
+    {
+      *this = std::move(r);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::operator=
+    //! Deep copy
+    //!
+    //! \throw std::bad_alloc - Insufficient memory
+    /////////////////////////////////////////////////////////////////////////////////////////
+    DynamicBitset& operator=(const DynamicBitset& r)
+    {
+      if (this != &r)
+      {
+        uint32_t const used = words();
+
+        // Copy words, clearing any surplus
+        reserve(r.Bits);
+        std::copy(r.Data, r.Data + r.words(), Data);
+        if (used > r.words())
+          std::fill(Data + r.words(), Data + used, word_t(0));
+        Bits = r.Bits;
+      }
+      return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::operator=
+    //! Move-assign, transferring any heap block and leaving the source empty
+    /////////////////////////////////////////////////////////////////////////////////////////
+    DynamicBitset& operator=(DynamicBitset&& r) noexcept
+    {
+      if (this != &r)
+      {
+        release();
+
+        // [HEAP] Transfer block
+        if (r.Data != r.Inline)
+        {
+          Data = r.Data;
+          Capacity = r.Capacity;
+          r.Data = r.Inline;
+          r.Capacity = InlineWords;
+        }
+        // [INLINE] Copy words
+        else
+          std::copy(r.Inline, r.Inline + InlineWords, Inline);
+
+        Bits = r.Bits;
+        r.Bits = 0;
+        std::fill(r.Inline, r.Inline + InlineWords, word_t(0));
+      }
+      return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::~DynamicBitset
+    //! Release any heap block
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~DynamicBitset()
+    {
+      release();
+    }
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::popcount
+    //! Count the set bits of a word
+    //!
+    //! \param[in] w - Word
+    //! \return uint32_t - Number of set bits
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t  popcount(word_t w)
+    {
+#if defined(_MSC_VER) && defined(_WIN64)
+      return static_cast<uint32_t>(__popcnt64(w));
+#elif defined(__GNUC__)
+      return static_cast<uint32_t>(__builtin_popcountll(w));
+#else
+      w = w - ((w >> 1) & 0x5555555555555555ull);
+      w = (w & 0x3333333333333333ull) + ((w >> 2) & 0x3333333333333333ull);
+      w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+      return static_cast<uint32_t>((w * 0x0101010101010101ull) >> 56);
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::tzcnt
+    //! Get the index of the least significant set bit of a word
+    //!
+    //! \param[in] w - Non-zero word
+    //! \return uint32_t - Zero-based bit index
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t  tzcnt(word_t w)
+    {
+#if defined(_MSC_VER) && defined(_WIN64)
+      unsigned long idx;
+      _BitScanForward64(&idx, w);
+      return idx;
+#elif defined(__GNUC__)
+      return static_cast<uint32_t>(__builtin_ctzll(w));
+#else
+      uint32_t idx = 0;
+      for (; !(w & 1); w >>= 1)
+        ++idx;
+      return idx;
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::selectWord
+    //! Get the index of the n-th set bit of a word
+    //!
+    //! \param[in] w - Word
+    //! \param[in] n - Zero-based ordinal  (Must be less than popcount(w))
+    //! \return uint32_t - Zero-based bit index
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t  selectWord(word_t w, uint32_t n)
+    {
+#if defined(__BMI2__)
+      return tzcnt(_pdep_u64(word_t(1) << n, w));
+#else
+      for (; n; --n)
+        w &= w - 1;
+      return tzcnt(w);
+#endif
+    }
+
+  protected:
+    //! Get the number of words required to store a number of bits
+    static uint32_t  wordsFor(uint32_t bits)    { return (bits + WordBits - 1) / WordBits;  }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::apply
+    //! Combine words of another bitset into this, vectorized where available
+    //!
+    //! \tparam OP - Operation type providing scalar and vector overloads
+    //!
+    //! \param[in,out] *dst - Destination words
+    //! \param[in] const* src - Source words
+    //! \param[in] n - Number of words
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename OP>
+    static void  apply(word_t* dst, const word_t* src, uint32_t n)
+    {
+      uint32_t i = 0;
+#if defined(WTL_BITSET_AVX2)
+      for (; i + 4 <= n; i += 4)
+      {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i)),
+                b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), OP::vector(a, b));
+      }
+#elif defined(WTL_BITSET_SSE2)
+      for (; i + 2 <= n; i += 2)
+      {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i)),
+                b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), OP::vector(a, b));
+      }
+#endif
+      for (; i < n; ++i)
+        dst[i] = OP::scalar(dst[i], src[i]);
+    }
+
+    //! \struct AndOp - Bitwise AND
+    struct AndOp
+    {
+      static word_t  scalar(word_t a, word_t b)     { return a & b;                   }
+#if defined(WTL_BITSET_AVX2)
+      static __m256i vector(__m256i a, __m256i b)   { return _mm256_and_si256(a, b);  }
+#elif defined(WTL_BITSET_SSE2)
+      static __m128i vector(__m128i a, __m128i b)   { return _mm_and_si128(a, b);     }
+#endif
+    };
+
+    //! \struct AndNotOp - Bitwise AND with complement of source
+    struct AndNotOp
+    {
+      static word_t  scalar(word_t a, word_t b)     { return a & ~b;                     }
+#if defined(WTL_BITSET_AVX2)
+      static __m256i vector(__m256i a, __m256i b)   { return _mm256_andnot_si256(b, a);  }
+#elif defined(WTL_BITSET_SSE2)
+      static __m128i vector(__m128i a, __m128i b)   { return _mm_andnot_si128(b, a);     }
+#endif
+    };
+
+    //! \struct OrOp - Bitwise OR
+    struct OrOp
+    {
+      static word_t  scalar(word_t a, word_t b)     { return a | b;                  }
+#if defined(WTL_BITSET_AVX2)
+      static __m256i vector(__m256i a, __m256i b)   { return _mm256_or_si256(a, b);  }
+#elif defined(WTL_BITSET_SSE2)
+      static __m128i vector(__m128i a, __m128i b)   { return _mm_or_si128(a, b);     }
+#endif
+    };
+
+    //! \struct XorOp - Bitwise exclusive-OR
+    struct XorOp
+    {
+      static word_t  scalar(word_t a, word_t b)     { return a ^ b;                   }
+#if defined(WTL_BITSET_AVX2)
+      static __m256i vector(__m256i a, __m256i b)   { return _mm256_xor_si256(a, b);  }
+#elif defined(WTL_BITSET_SSE2)
+      static __m128i vector(__m128i a, __m128i b)   { return _mm_xor_si128(a, b);     }
+#endif
+    };
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::all const
+    //! Query whether every bit is set
+    //!
+    //! \return bool - True iff every bit is set (or the bitset has no bits)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  all() const
+    {
+      return count() == Bits;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::any const
+    //! Query whether any bit is set
+    //!
+    //! \return bool - True iff at least one bit is set
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  any() const
+    {
+      for (uint32_t w = 0, n = words(); w < n; ++w)
+        if (Data[w])
+          return true;
+      return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::count const
+    //! Count the set bits
+    //!
+    //! \return uint32_t - Number of set bits
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  count() const
+    {
+      uint32_t total = 0;
+      for (uint32_t w = 0, n = words(); w < n; ++w)
+        total += popcount(Data[w]);
+      return total;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::data const
+    //! Get the storage words
+    //!
+    //! \return const word_t* - Words, least significant first
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const word_t*  data() const
+    {
+      return Data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::empty const
+    //! Query whether no bit is set
+    //!
+    //! \return bool - True if empty, otherwise False
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  empty() const
+    {
+      return !any();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::flatten const
+    //! Generates an array containing the zero-based indicies of any high bits
+    //!
+    //! \return std::vector<uint32_t> - Indicies of high bits, in ascending order
+    /////////////////////////////////////////////////////////////////////////////////////////
+    std::vector<uint32_t>  flatten() const
+    {
+      std::vector<uint32_t> bits;
+      bits.reserve(count());
+      forEach([&bits] (uint32_t idx) { bits.push_back(idx); });
+      return bits;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::forEach const
+    //! Enumerate the indicies of the set bits, in ascending order
+    //!
+    //! \tparam FUNC - Callable accepting a uint32_t
+    //!
+    //! \param[in] fn - Function object
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename FUNC>
+    void  forEach(FUNC&& fn) const
+    {
+      for (uint32_t w = 0, n = words(); w < n; ++w)
+        for (word_t bits = Data[w]; bits; bits &= bits - 1)
+          fn(w * WordBits + tzcnt(bits));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::get const
+    //! Query the state of a bit
+    //!
+    //! \param[in] index - Zero-based index of bit to query
+    //! \return bool - State of desired bit
+    //!
+    //! \throw wtl::out_of_range - [Debug only] Index out of range
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  get(uint32_t index) const
+    {
+      CHECKED_INDEX(index, 0, Bits);
+
+      return (Data[index / WordBits] >> (index % WordBits) & 1) != 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::next const
+    //! Find the first set bit at or after an index
+    //!
+    //! \param[in] from - [optional] Zero-based index at which to begin
+    //! \return uint32_t - Zero-based index of set bit, or npos if none
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  next(uint32_t from = 0) const
+    {
+      if (from >= Bits)
+        return npos;
+
+      uint32_t w = from / WordBits;
+      word_t bits = Data[w] & (~word_t(0) << (from % WordBits));
+      for (uint32_t n = words(); !bits; bits = Data[w])
+        if (++w == n)
+          return npos;
+
+      return w * WordBits + tzcnt(bits);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::rank const
+    //! Count the set bits preceding an index
+    //!
+    //! \param[in] index - Zero-based index  (May equal size())
+    //! \return uint32_t - Number of set bits below index
+    //!
+    //! \throw wtl::out_of_range - [Debug only] Index out of range
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  rank(uint32_t index) const
+    {
+      CHECKED_INDEX(index, 0, Bits+1);
+
+      uint32_t total = 0,
+               w = 0;
+      for (; w < index / WordBits; ++w)
+        total += popcount(Data[w]);
+
+      if (index % WordBits)
+        total += popcount(Data[w] & (~word_t(0) >> (WordBits - index % WordBits)));
+      return total;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::select const
+    //! Find the n-th set bit
+    //!
+    //! \param[in] n - Zero-based ordinal
+    //! \return uint32_t - Zero-based index of set bit, or npos if fewer bits are set
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  select(uint32_t n) const
+    {
+      for (uint32_t w = 0, count = words(); w < count; ++w)
+      {
+        uint32_t const bits = popcount(Data[w]);
+        if (n < bits)
+          return w * WordBits + selectWord(Data[w], n);
+        n -= bits;
+      }
+      return npos;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::size const
+    //! Get the number of bits
+    //!
+    //! \return uint32_t - Number of bits
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  size() const
+    {
+      return Bits;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::words const
+    //! Get the number of words in use
+    //!
+    //! \return uint32_t - Number of words
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  words() const
+    {
+      return wordsFor(Bits);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::operator == const
+    //! Equality operator
+    //!
+    //! \param[in] const& r - Another bitset
+    //! \return bool - True iff both have the same width and bits
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  operator == (const type& r) const
+    {
+      return Bits == r.Bits && std::equal(Data, Data + words(), r.Data);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::operator != const
+    //! Inequality operator
+    //!
+    //! \param[in] const& r - Another bitset
+    //! \return bool - True iff width or bits differ
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  operator != (const type& r) const
+    {
+      return !(*this == r);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::operator []
+    //! Query the state of a bit
+    //!
+    //! \param[in] index - zero-based index of bit to query
+    //! \return bool - State of desired bit
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  operator[](uint32_t index) const
+    {
+      return get(index);
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::andNot
+    //! Clear every bit which is set in another bitset
+    //!
+    //! \param[in] const& r - Another bitset  (Bits beyond its width are unaffected)
+    //! \return type& - Reference to self
+    /////////////////////////////////////////////////////////////////////////////////////////
+    type&  andNot(const type& r)
+    {
+      apply<AndNotOp>(Data, r.Data, std::min(words(), r.words()));
+      return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::clear
+    //! Clears every bit
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clear()
+    {
+      std::fill(Data, Data + words(), word_t(0));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::clear
+    //! Clears the state of a bit
+    //!
+    //! \param[in] index - Zero-based bit index
+    //!
+    //! \throw wtl::out_of_range - [Debug only] Index out of range
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clear(uint32_t index)
+    {
+      CHECKED_INDEX(index, 0, Bits);
+
+      Data[index / WordBits] &= ~(word_t(1) << (index % WordBits));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::data
+    //! Get the storage words, eg. for deserialization
+    //!
+    //! \return word_t* - Words, least significant first  (Call resize() afterwards to clear bits beyond size())
+    /////////////////////////////////////////////////////////////////////////////////////////
+    word_t*  data()
+    {
+      return Data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::flip
+    //! Toggles the state of a bit
+    //!
+    //! \param[in] index - Zero-based bit index
+    //!
+    //! \throw wtl::out_of_range - [Debug only] Index out of range
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  flip(uint32_t index)
+    {
+      CHECKED_INDEX(index, 0, Bits);
+
+      Data[index / WordBits] ^= word_t(1) << (index % WordBits);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::reserve
+    //! Ensure storage for a number of bits, without changing the size
+    //!
+    //! \param[in] bits - Number of bits
+    //!
+    //! \throw std::bad_alloc - Insufficient memory
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  reserve(uint32_t bits)
+    {
+      uint32_t const required = wordsFor(bits);
+      if (required <= Capacity)
+        return;
+
+      // Grow geometrically into a zeroed heap block
+      uint32_t const capacity = std::max(required, Capacity * 2);
+      word_t* block = new word_t[capacity]();
+      std::copy(Data, Data + words(), block);
+
+      release();
+      Data = block;
+      Capacity = capacity;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::resize
+    //! Change the number of bits; new bits are clear
+    //!
+    //! \param[in] bits - Number of bits
+    //!
+    //! \throw std::bad_alloc - Insufficient memory
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  resize(uint32_t bits)
+    {
+      reserve(bits);
+
+      // Clear bits beyond new size
+      uint32_t const n = wordsFor(bits);
+      std::fill(Data + n, Data + std::max(n, words()), word_t(0));
+      if (bits % WordBits)
+        Data[n-1] &= ~word_t(0) >> (WordBits - bits % WordBits);
+
+      Bits = bits;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::set
+    //! Sets every bit
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  set()
+    {
+      std::fill(Data, Data + words(), ~word_t(0));
+      resize(Bits);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::set
+    //! Sets the state of a bit
+    //!
+    //! \param[in] index - Zero-based bit index
+    //!
+    //! \throw wtl::out_of_range - [Debug only] Index out of range
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  set(uint32_t index)
+    {
+      CHECKED_INDEX(index, 0, Bits);
+
+      Data[index / WordBits] |= word_t(1) << (index % WordBits);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::set
+    //! Sets or clears a bit
+    //!
+    //! \param[in] index - Zero-based bit index
+    //! \param[in] state - New state
+    //!
+    //! \throw wtl::out_of_range - [Debug only] Index out of range
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  set(uint32_t index, bool state)
+    {
+      if (state)
+        set(index);
+      else
+        clear(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::operator &=
+    //! Bitwise AND with another bitset
+    //!
+    //! \param[in] const& r - Another bitset  (Missing bits are considered clear)
+    //! \return type& - Reference to self
+    /////////////////////////////////////////////////////////////////////////////////////////
+    type&  operator &= (const type& r)
+    {
+      uint32_t const n = std::min(words(), r.words());
+      apply<AndOp>(Data, r.Data, n);
+      std::fill(Data + n, Data + words(), word_t(0));
+      return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::operator |=
+    //! Bitwise OR with another bitset, widening this if necessary
+    //!
+    //! \param[in] const& r - Another bitset
+    //! \return type& - Reference to self
+    //!
+    //! \throw std::bad_alloc - Insufficient memory
+    /////////////////////////////////////////////////////////////////////////////////////////
+    type&  operator |= (const type& r)
+    {
+      if (r.Bits > Bits)
+        resize(r.Bits);
+
+      apply<OrOp>(Data, r.Data, r.words());
+      return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::operator ^=
+    //! Bitwise exclusive-OR with another bitset, widening this if necessary
+    //!
+    //! \param[in] const& r - Another bitset
+    //! \return type& - Reference to self
+    //!
+    //! \throw std::bad_alloc - Insufficient memory
+    /////////////////////////////////////////////////////////////////////////////////////////
+    type&  operator ^= (const type& r)
+    {
+      if (r.Bits > Bits)
+        resize(r.Bits);
+
+      apply<XorOp>(Data, r.Data, r.words());
+      return *this;
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // DynamicBitset::release
+    //! Release any heap block, reverting to inline storage
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  release()
+    {
+      if (Data != Inline)
+        delete[] Data;
+
+      Data = Inline;
+      Capacity = InlineWords;
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::operator &
+  //! Bitwise AND of two bitsets
+  //!
+  //! \param[in] l - Left operand
+  //! \param[in] const& r - Right operand
+  //! \return DynamicBitset - Result, with the width of the left operand
+  /////////////////////////////////////////////////////////////////////////////////////////
+  inline DynamicBitset operator & (DynamicBitset l, const DynamicBitset& r)
+  {
+    return std::move(l &= r);
+  }
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::operator |
+  //! Bitwise OR of two bitsets
+  //!
+  //! \param[in] l - Left operand
+  //! \param[in] const& r - Right operand
+  //! \return DynamicBitset - Result, with the greater width
+  /////////////////////////////////////////////////////////////////////////////////////////
+  inline DynamicBitset operator | (DynamicBitset l, const DynamicBitset& r)
+  {
+    return std::move(l |= r);
+  }
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::operator ^
+  //! Bitwise exclusive-OR of two bitsets
+  //!
+  //! \param[in] l - Left operand
+  //! \param[in] const& r - Right operand
+  //! \return DynamicBitset - Result, with the greater width
+  /////////////////////////////////////////////////////////////////////////////////////////
+  inline DynamicBitset operator ^ (DynamicBitset l, const DynamicBitset& r)
+  {
+    return std::move(l ^= r);
+  }
+
+} //namespace wtl
+
+#endif // WTL_DYNAMIC_BITSET_HPP
@@ -10,6 +10,9 @@
 
 #include <wtl/WTL.hpp>
 #include <wtl/traits/EncodingTraits.hpp>
+#include <wtl/casts/EnumCast.hpp>           //!< enum_cast
+#include <wtl/platform/WindowFlags.hpp>     //!< MultiByteFlags, WideCharFlags
+#include <wtl/utils/Exception.hpp>          //!< platform_error
 
 //! \namespace wtl - Windows template library
 namespace wtl
@@ -20,7 +20,9 @@
 #include <string>                           //!< std::string
 #include <cstdio>                           //!< std::snprintf
 #include <sstream>                          //!< std::ostringstream
-#include <winsock2.h>                       //!< WSAGetLastError
+#ifndef WTL_PORTABLE
+  #include <winsock2.h>                     //!< WSAGetLastError
+#endif
 
 //! \namespace wtl - Windows template library
 namespace wtl
@@ -0,0 +1,419 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\utils\FlatRegistry.hpp
+//! \brief Provides an open-addressing association between handles (or identifiers) and objects
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_FLAT_REGISTRY_HPP
+#define WTL_FLAT_REGISTRY_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/threads/EpochDomain.hpp>        //!< EpochDomain, EpochGuard
+#include <atomic>                             //!< std::atomic
+#include <memory>                             //!< std::unique_ptr
+#include <mutex>                              //!< std::mutex
+#include <thread>                             //!< std::this_thread
+#include <type_traits>                        //!< std::is_pointer, std::is_enum
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct FlatRegistry - Associates handles or identifiers with objects using a linear-probing hash table
+  //!
+  //! \tparam KEY - Key type  (Pointer, handle, integral or enumeration)
+  //! \tparam VALUE - Object type  (Objects are referenced, not owned)
+  //!
+  //! \remarks Slots are stored contiguously, so a lookup typically touches a single cache line. The slot of the most
+  //! \remarks recent successful lookup is remembered and checked first, since consecutive messages usually target
+  //! \remarks the same window.
+  //!
+  //! \remarks Lookups may be performed from any thread without locking: modifications are serialized and published
+  //! \remarks through a sequence counter, and readers retry if the table changed during their lookup. Lookups are
+  //! \remarks performed within a read section of an epoch domain, which reclaims superseded tables once no reader
+  //! \remarks can still observe them.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename KEY, typename VALUE>
+  struct FlatRegistry
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = FlatRegistry<KEY,VALUE>;
+
+    //! \alias key_t - Define key type
+    using key_t = KEY;
+
+    //! \alias value_t - Define object type
+    using value_t = VALUE;
+
+    //! \var initialCapacity - Number of slots allocated initially
+    static constexpr uint32_t  initialCapacity = 16;
+
+  protected:
+    //! \alias code_t - Define encoded key type  (Zero represents an empty slot)
+    using code_t = uintptr_t;
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Slot - Key and object
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Slot
+    {
+      std::atomic<code_t>   Key;        //!< Encoded key, or zero if empty
+      std::atomic<VALUE*>   Value;      //!< Object
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Table - Power-of-two array of slots
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Table
+    {
+      uint32_t                 Mask;       //!< Capacity - 1
+      std::unique_ptr<Slot[]>  Slots;      //!< Slots
+
+      explicit Table(uint32_t capacity) : Mask(capacity - 1), Slots(new Slot[capacity])
+      {
+        for (uint32_t idx = 0; idx <= Mask; ++idx)
+        {
+          Slots[idx].Key.store(0, std::memory_order_relaxed);
+          Slots[idx].Value.store(nullptr, std::memory_order_relaxed);
+        }
+      }
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::atomic<Table*>            Current;      //!< Current table
+    std::atomic<uint32_t>          Sequence;     //!< Odd while a modification is in progress
+    mutable std::atomic<uint32_t>  LastHit;      //!< Slot of most recent successful lookup
+    uint32_t                       Count;        //!< Number of entries  (Writers)
+    mutable std::mutex             WriteLock;    //!< Serializes modifications
+    EpochDomain&                   Domain;       //!< Reclaims superseded tables
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FlatRegistry::FlatRegistry
+    //! Create empty registry
+    //!
+    //! \param[in,out] &domain - [optional] Epoch domain used to reclaim superseded tables (Default is shared domain)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit FlatRegistry(EpochDomain& domain = EpochDomain::shared()) : Current(new Table(initialCapacity)),
+                                                                         Sequence(0),
+                                                                         LastHit(0),
+                                                                         Count(0),
+                                                                         Domain(domain)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(FlatRegistry);      //!< Cannot be copied
+    DISABLE_MOVE(FlatRegistry);      //!< Cannot be moved
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FlatRegistry::~FlatRegistry
+    //! Destroys the current table
+    //!
+    //! \remarks No reader may be within a lookup upon destruction
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~FlatRegistry()
+    {
+      delete Current.load(std::memory_order_relaxed);
+    }
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FlatRegistry::encode
+    //! Encodes a key as a non-zero integer
+    //!
+    //! \param[in] key - Key
+    //! \return code_t - Key value plus one
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename K = KEY>
+    static std::enable_if_t<std::is_pointer<K>::value,code_t>  encode(K key)
+    {
+      return reinterpret_cast<code_t>(key) + 1;
+    }
+
+    template <typename K = KEY>
+    static std::enable_if_t<!std::is_pointer<K>::value,code_t>  encode(K key)
+    {
+      return static_cast<code_t>(key) + 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FlatRegistry::home
+    //! Calculates the preferred slot of a key
+    //!
+    //! \param[in] code - Encoded key
+    //! \param[in] mask - Table capacity - 1
+    //! \return uint32_t - Zero-based slot index
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t  home(code_t code, uint32_t mask)
+    {
+      // Fibonacci hashing: handles share low-order bits, so use the high-order bits of the product
+      return static_cast<uint32_t>((static_cast<uint64_t>(code) * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FlatRegistry::contains const
+    //! Query whether a key is present  (Any thread)
+    //!
+    //! \param[in] key - Key
+    //! \return bool - True iff present
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  contains(KEY key) const
+    {
+      return find(key) != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FlatRegistry::empty const
+    //! Query whether registry is empty
+    //!
+    //! \return bool - True iff empty
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  empty() const
+    {
+      return size() == 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FlatRegistry::find const
+    //! Lookup the object associated with a key  (Any thread)
+    //!
+    //! \param[in] key - Key
+    //! \return VALUE* - Associated object, or nullptr if not present
+    /////////////////////////////////////////////////////////////////////////////////////////
+    VALUE*  find(KEY key) const
+    {
+      EpochGuard section(Domain);
+      code_t const code = encode(key);
+
+      for (;;)
+      {
+        uint32_t const seq = Sequence.load(std::memory_order_acquire);
+
+        // [MODIFYING] Wait for writer
+        if (seq & 1)
+        {
+          std::this_thread::yield();
+          continue;
+        }
+
+        Table* const table = Current.load(std::memory_order_acquire);
+        VALUE* value = nullptr;
+        uint32_t idx = LastHit.load(std::memory_order_relaxed) & table->Mask;
+
+        // [CACHED] Check slot of previous hit, otherwise probe from home slot
+        if (table->Slots[idx].Key.load(std::memory_order_relaxed) == code)
+          value = table->Slots[idx].Value.load(std::memory_order_relaxed);
+        else
+          for (idx = home(code, table->Mask); ; idx = (idx + 1) & table->Mask)
+          {
+            code_t const k = table->Slots[idx].Key.load(std::memory_order_relaxed);
+            if (k == code)
+            {
+              value = table->Slots[idx].Value.load(std::memory_order_relaxed);
+              break;
+            }
+            if (k == 0)
+              break;
+          }
+
+        // Ensure nothing changed meanwhile
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (Sequence.load(std::memory_order_relaxed) != seq)
+          continue;
+
+        if (value)
+          LastHit.store(idx, std::memory_order_relaxed);
+        return value;
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FlatRegistry::forEach const
+    //! Visits every entry  (Must not be called concurrently with modifications)
+    //!
+    //! \tparam FN - Visitor type
+    //!
+    //! \param[in] fn - Visitor accepting the object
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename FN>
+    void  forEach(FN fn) const
+    {
+      Table* const table = Current.load(std::memory_order_acquire);
+
+      for (uint32_t idx = 0; idx <= table->Mask; ++idx)
+        if (table->Slots[idx].Key.load(std::memory_order_relaxed) != 0)
+          fn(table->Slots[idx].Value.load(std::memory_order_relaxed));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FlatRegistry::size const
+    //! Get the number of entries
+    //!
+    //! \return uint32_t - Number of entries
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  size() const
+    {
+      std::lock_guard<std::mutex> guard(WriteLock);
+      return Count;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FlatRegistry::clear
+    //! Removes all entries
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clear()
+    {
+      std::lock_guard<std::mutex> guard(WriteLock);
+      Table* const table = Current.load(std::memory_order_relaxed);
+
+      beginWrite();
+      for (uint32_t idx = 0; idx <= table->Mask; ++idx)
+        table->Slots[idx].Key.store(0, std::memory_order_relaxed);
+      Count = 0;
+      endWrite();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FlatRegistry::erase
+    //! Removes an entry
+    //!
+    //! \param[in] key - Key
+    //! \return bool - True if removed, false if not present
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  erase(KEY key)
+    {
+      std::lock_guard<std::mutex> guard(WriteLock);
+      code_t const code = encode(key);
+      Table* const table = Current.load(std::memory_order_relaxed);
+      Slot* const slots = table->Slots.get();
+
+      // Locate entry
+      uint32_t i = home(code, table->Mask);
+      for (code_t k; (k = slots[i].Key.load(std::memory_order_relaxed)) != code; i = (i + 1) & table->Mask)
+        if (k == 0)
+          return false;
+
+      beginWrite();
+
+      // Shift back successors displaced beyond the vacated slot, avoiding tombstones
+      for (uint32_t j = i; ; )
+      {
+        j = (j + 1) & table->Mask;
+        code_t const k = slots[j].Key.load(std::memory_order_relaxed);
+        if (k == 0)
+          break;
+
+        // [IN-PLACE] Home lies cyclically within (i, j]
+        uint32_t const h = home(k, table->Mask);
+        if (i <= j ? (i < h && h <= j) : (i < h || h <= j))
+          continue;
+
+        slots[i].Value.store(slots[j].Value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        slots[i].Key.store(k, std::memory_order_relaxed);
+        i = j;
+      }
+      slots[i].Key.store(0, std::memory_order_relaxed);
+      --Count;
+
+      endWrite();
+      return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FlatRegistry::insert
+    //! Associates an object with a key, replacing any existing association
+    //!
+    //! \param[in] key - Key
+    //! \param[in] *value - Object  (Must not be nullptr)
+    //! \return bool - True if inserted, false if replaced
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  insert(KEY key, VALUE* value)
+    {
+      std::lock_guard<std::mutex> guard(WriteLock);
+      code_t const code = encode(key);
+
+      beginWrite();
+
+      // [FULL] Double capacity beyond 70% load
+      Table* table = Current.load(std::memory_order_relaxed);
+      if ((Count + 1) * 10 > (table->Mask + 1) * 7)
+        table = grow(table);
+
+      // Probe for key or empty slot
+      uint32_t idx = home(code, table->Mask);
+      code_t k;
+      while ((k = table->Slots[idx].Key.load(std::memory_order_relaxed)) != code && k != 0)
+        idx = (idx + 1) & table->Mask;
+
+      table->Slots[idx].Value.store(value, std::memory_order_relaxed);
+      table->Slots[idx].Key.store(code, std::memory_order_relaxed);
+      if (k == 0)
+        ++Count;
+
+      endWrite();
+      return k == 0;
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FlatRegistry::beginWrite
+    //! Marks the table as being modified  (Caller must hold 'WriteLock')
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  beginWrite()
+    {
+      Sequence.store(Sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FlatRegistry::endWrite
+    //! Publishes modifications  (Caller must hold 'WriteLock')
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  endWrite()
+    {
+      Sequence.store(Sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // FlatRegistry::grow
+    //! Publishes a table of twice the capacity containing the current entries  (Caller must be writing)
+    //!
+    //! \param[in] *table - Current table  (Retired once superseded)
+    //! \return Table* - New table
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Table*  grow(Table* table)
+    {
+      Table* const next = new Table((table->Mask + 1) * 2);
+
+      for (uint32_t idx = 0; idx <= table->Mask; ++idx)
+        if (code_t k = table->Slots[idx].Key.load(std::memory_order_relaxed))
+        {
+          uint32_t pos = home(k, next->Mask);
+          while (next->Slots[pos].Key.load(std::memory_order_relaxed) != 0)
+            pos = (pos + 1) & next->Mask;
+
+          next->Slots[pos].Value.store(table->Slots[idx].Value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+          next->Slots[pos].Key.store(k, std::memory_order_relaxed);
+        }
+
+      // Readers observing the superseded table retry once the modification is published
+      Current.store(next, std::memory_order_release);
+      Domain.retire(table);
+      return next;
+    }
+  };
+
+} // namespace wtl
+
+#endif  // WTL_FLAT_REGISTRY_HPP
@@ -44,7 +44,7 @@ namespace wtl
   //! Stop after final element
   //////////////////////////////////////////////////////////////////////////////////////////
   template <unsigned IDX = 0, typename FUNC, typename... ELEMS>
-  auto for_each_t(const std::tuple<ELEMS...>& t, FUNC fn) -> std::enable_if_t<IDX == sizeof...(ELEMS), FUNC>
+  auto for_each_t(const std::tuple<ELEMS...>&, FUNC fn) -> std::enable_if_t<IDX == sizeof...(ELEMS), FUNC>
   {
     // Return target in final state
     return fn;
@@ -30,12 +30,17 @@ namespace wtl
   //! \struct format_spec<...> - Define specializations for each type
   template <typename CHR> struct format_spec<CHR,ulong64_t>        { static constexpr const CHR* value = choose<default_encoding<CHR>::value>("%llu", L"%llu");  };
   template <typename CHR> struct format_spec<CHR,long64_t>         { static constexpr const CHR* value = choose<default_encoding<CHR>::value>("%lld", L"%lld");  };
-  template <typename CHR> struct format_spec<CHR,float64_t>        { static constexpr const CHR* value = choose<default_encoding<CHR>::value>("%llf", L"%llf");  };
+  template <typename CHR> struct format_spec<CHR,float64_t>        { static constexpr const CHR* value = choose<default_encoding<CHR>::value>("%lf", L"%lf");    };
   template <typename CHR> struct format_spec<CHR,float32_t>        { static constexpr const CHR* value = choose<default_encoding<CHR>::value>("%lf", L"%lf");    };
+#if LONG_MAX == INT32_MAX
   template <typename CHR> struct format_spec<CHR,ulong32_t>        { static constexpr const CHR* value = choose<default_encoding<CHR>::value>("%lu", L"%lu");    };
   template <typename CHR> struct format_spec<CHR,long32_t>         { static constexpr const CHR* value = choose<default_encoding<CHR>::value>("%ld", L"%ld");    };
   template <typename CHR> struct format_spec<CHR,uint32_t>         { static constexpr const CHR* value = choose<default_encoding<CHR>::value>("%lu", L"%lu");    };
   template <typename CHR> struct format_spec<CHR,int32_t>          { static constexpr const CHR* value = choose<default_encoding<CHR>::value>("%ld", L"%ld");    };
+#else
+  template <typename CHR> struct format_spec<CHR,uint32_t>         { static constexpr const CHR* value = choose<default_encoding<CHR>::value>("%u", L"%u");      };
+  template <typename CHR> struct format_spec<CHR,int32_t>          { static constexpr const CHR* value = choose<default_encoding<CHR>::value>("%d", L"%d");      };
+#endif
   template <typename CHR> struct format_spec<CHR,uint16_t>         { static constexpr const CHR* value = choose<default_encoding<CHR>::value>("%hu", L"%hu");    };
   template <typename CHR> struct format_spec<CHR,int16_t>          { static constexpr const CHR* value = choose<default_encoding<CHR>::value>("%hd", L"%hd");    };
   template <typename CHR> struct format_spec<CHR,CHR>              { static constexpr const CHR* value = choose<default_encoding<CHR>::value>("%c", L"%c");      };
@@ -0,0 +1,268 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\utils\HandlePool.hpp
+//! \brief Recycles frequently created and destroyed handles, eg. GDI brushes and pens
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_HANDLE_POOL_HPP
+#define WTL_HANDLE_POOL_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/utils/Handle.hpp>               //!< NativeHandle, handle_alloc, AllocType
+#include <wtl/utils/Exception.hpp>            //!< platform_error
+#include <mutex>                              //!< std::mutex
+#include <utility>                            //!< std::forward, std::pair
+#include <vector>                             //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct HandlePool - Retains released handles for re-use by later requests with identical creation arguments
+  //!
+  //! \tparam NATIVE - Native handle type
+  //! \tparam KEY - Type constructible from the creation arguments, compared for equality  (eg. Colour, std::tuple)
+  //! \tparam ALLOCATOR - [optional] Handle allocator type that models the ConstructibleHandle, DestroyableHandle concepts
+  //!
+  //! \remarks Only handles which were created are retained; accquired handles and weak references pass straight
+  //! \remarks through. Idle handles are searched most-recently-released first and the number retained is bounded,
+  //! \remarks beyond which released handles are destroyed. The pool must outlive its leases.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename NATIVE, typename KEY, typename ALLOCATOR = handle_alloc<NATIVE>>
+  struct HandlePool
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = HandlePool<NATIVE,KEY,ALLOCATOR>;
+
+    //! \alias native_t - Native handle type
+    using native_t = NATIVE;
+
+    //! \alias key_t - Creation key type
+    using key_t = KEY;
+
+    //! \var npos - Invalid handle sentinel value
+    static constexpr native_t npos = ALLOCATOR::npos;
+
+  protected:
+    //! \alias alloc_t - Define handle allocator type
+    using alloc_t = ALLOCATOR;
+
+    //! \alias value_t - Define allocation handle type
+    using value_t = NativeHandle<native_t>;
+
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Lease - Move-only handle which is returned to the pool upon destruction
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Lease
+    {
+      // ----------------------------------- REPRESENTATION -----------------------------------
+    protected:
+      type*    Pool;       //!< Owning pool
+      key_t    Key;        //!< Creation key
+      value_t  Value;      //!< Handle value and method of allocation
+
+      // ------------------------------------ CONSTRUCTION ------------------------------------
+    public:
+      Lease(type& pool, key_t key, value_t h) : Pool(&pool), Key(std::move(key)), Value(h)
+      {}
+
+      // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+    public:
+      DISABLE_COPY(Lease);      //!< Ownership is exclusive
+
+      Lease(Lease&& r) noexcept : Pool(r.Pool), Key(std::move(r.Key)), Value(r.Value)
+      {
+        r.Value = value_t(npos, AllocType::WeakRef);
+      }
+
+      Lease& operator=(Lease&& r) noexcept
+      {
+        if (this != &r)
+        {
+          Pool->recycle(std::move(Key), Value);
+          Pool = r.Pool;
+          Key = std::move(r.Key);
+          Value = r.Value;
+          r.Value = value_t(npos, AllocType::WeakRef);
+        }
+        return *this;
+      }
+
+      ~Lease()
+      {
+        Pool->recycle(std::move(Key), Value);
+      }
+
+      // ---------------------------------- ACCESSOR METHODS ----------------------------------
+    public:
+      //! Query whether handle is valid
+      bool  exists() const                { return Value.Handle != npos;  }
+
+      //! Get the handle value
+      native_t  get() const               { return Value.Handle;          }
+
+      //! Get the creation key
+      const key_t&  key() const           { return Key;                   }
+
+      //! Query whether handle is valid
+      operator bool() const               { return exists();              }
+
+      //! Implicit user conversion to underlying handle
+      operator native_t() const           { return get();                 }
+
+      // ----------------------------------- MUTATOR METHODS ----------------------------------
+    public:
+      /////////////////////////////////////////////////////////////////////////////////////////
+      // HandlePool::Lease::detach
+      //! Remove the handle from the pool's management, eg. to store in a Handle or UniqueHandle
+      //!
+      //! \return NativeHandle<native_t> - Handle and allocation method
+      /////////////////////////////////////////////////////////////////////////////////////////
+      value_t  detach() noexcept
+      {
+        value_t h = Value;
+        Value = value_t(npos, AllocType::WeakRef);
+        return h;
+      }
+    };
+
+    //! \alias lease_t - Leased handle type
+    using lease_t = Lease;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    mutable std::mutex                      Lock;         //!< Guards idle handles and statistics
+    std::vector<std::pair<key_t,value_t>>   Idle;         //!< Released handles, most recent last
+    uint32_t                                Capacity;     //!< Maximum number of idle handles
+    uint64_t                                Hits;         //!< Number of requests satisfied by re-use
+    uint64_t                                Misses;       //!< Number of requests which created a handle
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // HandlePool::HandlePool
+    //! Create empty pool
+    //!
+    //! \param[in] capacity - [optional] Maximum number of idle handles retained
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit HandlePool(uint32_t capacity = 32) : Capacity(capacity), Hits(0), Misses(0)
+    {
+      Idle.reserve(capacity);
+    }
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(HandlePool);      //!< Leases refer to their pool
+    DISABLE_MOVE(HandlePool);      //!< Leases refer to their pool
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // HandlePool::~HandlePool
+    //! Destroy idle handles
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~HandlePool()
+    {
+      clear();
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    //! Get the number of requests satisfied by re-use
+    uint64_t  hits() const               { std::lock_guard<std::mutex> lock(Lock);  return Hits;        }
+
+    //! Get the number of idle handles
+    size_t  idle() const                 { std::lock_guard<std::mutex> lock(Lock);  return Idle.size(); }
+
+    //! Get the number of requests which created a handle
+    uint64_t  misses() const             { std::lock_guard<std::mutex> lock(Lock);  return Misses;      }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // HandlePool::acquire
+    //! Lease an idle handle created with identical arguments, otherwise create one
+    //!
+    //! \param[in] &&... args - Arguments to allocator 'create' function, from which the key is constructed
+    //! \return lease_t - Leased handle
+    //!
+    //! \throw wtl::platform_error - Unable to create handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS>
+    lease_t  acquire(ARGS&&... args)
+    {
+      key_t key(args...);
+
+      // [REUSE] Search most recently released first
+      {
+        std::lock_guard<std::mutex> lock(Lock);
+        for (size_t idx = Idle.size(); idx-- > 0; )
+          if (Idle[idx].first == key)
+          {
+            value_t h = Idle[idx].second;
+            Idle[idx] = std::move(Idle.back());
+            Idle.pop_back();
+            ++Hits;
+            return lease_t(*this, std::move(key), h);
+          }
+        ++Misses;
+      }
+
+      // [CREATE] Allocate outside the lock
+      value_t h = alloc_t::create(std::forward<ARGS>(args)...);
+      if (h.Handle == npos)
+        throw platform_error(HERE, "Unable to create handle");
+
+      return lease_t(*this, std::move(key), h);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // HandlePool::clear
+    //! Destroy all idle handles
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clear()
+    {
+      std::vector<std::pair<key_t,value_t>> idle;
+      {
+        std::lock_guard<std::mutex> lock(Lock);
+        idle.swap(Idle);
+        Idle.reserve(Capacity);    // Ensure recycling never allocates
+      }
+      for (auto& entry : idle)
+        alloc_t::destroy(entry.second);
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // HandlePool::recycle
+    //! Retain a released handle, or destroy it if the pool is full
+    //!
+    //! \param[in] && key - Creation key
+    //! \param[in] h - Handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  recycle(key_t&& key, value_t h) noexcept
+    {
+      if (h.Handle == npos)
+        return;
+
+      // [CREATED] Retain while capacity remains
+      if (h.Method == AllocType::Create)
+      {
+        std::lock_guard<std::mutex> lock(Lock);
+        if (Idle.size() < Capacity)
+        {
+          Idle.emplace_back(std::move(key), h);
+          return;
+        }
+      }
+
+      // [FULL/UNOWNED] Release
+      alloc_t::destroy(h);
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_HANDLE_POOL_HPP
@@ -0,0 +1,429 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\utils\ItemModel.hpp
+//! \brief Virtual item store for list-style controls, with sorting and filtering
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_ITEM_MODEL_HPP
+#define WTL_ITEM_MODEL_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/utils/Exception.hpp>                //!< out_of_range
+#include <algorithm>                              //!< std::stable_sort
+#include <functional>                             //!< std::function
+#include <iterator>                               //!< std::distance
+#include <string>                                 //!< std::basic_string
+#include <vector>                                 //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct ItemModel - Stores the items displayed by a list-style control on the user side
+  //!
+  //! \tparam CHR - Character type
+  //! \tparam DATA - [optional] Item data type
+  //!
+  //! \remarks Item text is stored contiguously and items are addressed through an index, so controls only
+  //! \remarks need to know the number of rows and can draw each one on demand. Items are identified by their
+  //! \remarks insertion index, rows by their position within the current sorted and filtered view.
+  //!
+  //! \remarks Does not depend upon any Win32 API
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename CHR, typename DATA = uintptr_t>
+  struct ItemModel
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = ItemModel<CHR,DATA>;
+
+    //! \alias char_t - Define character type
+    using char_t = CHR;
+
+    //! \alias data_t - Define item data type
+    using data_t = DATA;
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct ItemView - Immutable view of an item
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct ItemView
+    {
+      const char_t*  Text;       //!< Item text  (Null terminated)
+      uint32_t       Length;     //!< Length of text, in characters
+      data_t         Data;       //!< Item data
+      uint32_t       Index;      //!< Zero-based item index
+    };
+
+    //! \alias filter_t - Define filter predicate type
+    using filter_t = std::function<bool (const ItemView&)>;
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Item - Item record
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Item
+    {
+      uint32_t  Offset;     //!< Offset of text within character store
+      uint32_t  Length;     //!< Length of text, in characters
+      data_t    Data;       //!< Item data
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::vector<char_t>    Text;         //!< Text of all items, each null terminated
+    std::vector<Item>      Items;        //!< Items, in order of insertion
+    std::vector<uint32_t>  Order;        //!< Indicies of all items, in sorted order
+    std::vector<uint32_t>  Rows;         //!< Indicies of items passing the filter, in sorted order
+    filter_t               Filter;       //!< [optional] Current filter
+    uint32_t               Revision;     //!< Incremented whenever the rows change
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::ItemModel
+    //! Create empty model
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ItemModel() : Revision(0)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    ENABLE_COPY(ItemModel);      //!< Can be deep copied
+    ENABLE_MOVE(ItemModel);      //!< Can be moved
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::length
+    //! Get the length of a null terminated string
+    //!
+    //! \param[in] const* txt - String
+    //! \return uint32_t - Length, in characters
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t  length(const char_t* txt)
+    {
+      return static_cast<uint32_t>(std::char_traits<char_t>::length(txt));
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::at const
+    //! Get a row with bounds checking
+    //!
+    //! \param[in] row - Zero-based row
+    //! \return ItemView - Item displayed at row
+    //!
+    //! \throw wtl::out_of_range - Row out of range
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ItemView  at(uint32_t row) const
+    {
+      if (row >= size())
+        throw out_of_range(HERE, "Row ", row, " is out of range");
+
+      return operator[](row);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::empty const
+    //! Query whether there are no rows
+    //!
+    //! \return bool - True iff no items pass the filter
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  empty() const
+    {
+      return Rows.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::filtered const
+    //! Query whether a filter is applied
+    //!
+    //! \return bool - True iff filtered
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  filtered() const
+    {
+      return static_cast<bool>(Filter);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::find const
+    //! Find the first row whose text begins with a prefix  (Used for keyboard search)
+    //!
+    //! \param[in] const* prefix - Prefix
+    //! \param[in] start - [optional] Zero-based row at which to begin, searching wraps at the end
+    //! \return int32_t - Zero-based row if found, otherwise -1
+    /////////////////////////////////////////////////////////////////////////////////////////
+    int32_t  find(const char_t* prefix, uint32_t start = 0) const
+    {
+      uint32_t const len = length(prefix),
+                     count = size();
+
+      // Search from start, wrapping at the end
+      for (uint32_t n = 0; n < count; ++n)
+      {
+        uint32_t const row = (start + n) % count;
+        const Item& item = Items[Rows[row]];
+        if (item.Length >= len && std::char_traits<char_t>::compare(&Text[item.Offset], prefix, len) == 0)
+          return static_cast<int32_t>(row);
+      }
+      return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::item const
+    //! Get an item by index, regardless of sorting and filtering
+    //!
+    //! \param[in] idx - Zero-based item index
+    //! \return ItemView - Item
+    //!
+    //! \throw wtl::out_of_range - Index out of range
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ItemView  item(uint32_t idx) const
+    {
+      if (idx >= total())
+        throw out_of_range(HERE, "Item ", idx, " is out of range");
+
+      return view(idx);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::revision const
+    //! Get the revision number, which changes whenever the rows change
+    //!
+    //! \return uint32_t - Revision
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  revision() const
+    {
+      return Revision;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::size const
+    //! Query the number of rows
+    //!
+    //! \return uint32_t - Number of items passing the filter
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  size() const
+    {
+      return static_cast<uint32_t>(Rows.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::total const
+    //! Query the number of items
+    //!
+    //! \return uint32_t - Number of items, including those excluded by the filter
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  total() const
+    {
+      return static_cast<uint32_t>(Items.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::operator[] const
+    //! Get a row without bounds checking
+    //!
+    //! \param[in] row - Zero-based row
+    //! \return ItemView - Item displayed at row
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ItemView  operator[](uint32_t row) const
+    {
+      return view(Rows[row]);
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::view const
+    //! Get an item by index without bounds checking
+    //!
+    //! \param[in] idx - Zero-based item index
+    //! \return ItemView - Item
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ItemView  view(uint32_t idx) const
+    {
+      const Item& item = Items[idx];
+      return ItemView {&Text[item.Offset], item.Length, item.Data, idx};
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::append
+    //! Append an item  (After all rows, regardless of sort order)
+    //!
+    //! \param[in] const* txt - Item text
+    //! \param[in] len - Length of text, in characters
+    //! \param[in] data - Item data
+    //! \return uint32_t - Zero-based item index
+    //!
+    //! \throw wtl::invalid_argument - Missing text
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  append(const char_t* txt, uint32_t len, data_t data)
+    {
+      REQUIRED_PARAM(txt);
+
+      // Append text and index it
+      uint32_t const idx = total();
+      Items.push_back(Item {static_cast<uint32_t>(Text.size()), len, data});
+      Text.insert(Text.end(), txt, txt + len);
+      Text.push_back(char_t());
+      Order.push_back(idx);
+
+      // Display iff not filtered
+      if (!Filter || Filter(view(idx)))
+      {
+        Rows.push_back(idx);
+        ++Revision;
+      }
+      return idx;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::append
+    //! Append an item  (After all rows, regardless of sort order)
+    //!
+    //! \param[in] const* txt - Item text  (Null terminated)
+    //! \param[in] data - [optional] Item data
+    //! \return uint32_t - Zero-based item index
+    //!
+    //! \throw wtl::invalid_argument - Missing text
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  append(const char_t* txt, data_t data = data_t())
+    {
+      REQUIRED_PARAM(txt);
+      return append(txt, length(txt), data);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::append
+    //! Append an item  (After all rows, regardless of sort order)
+    //!
+    //! \param[in] const& txt - Item text
+    //! \param[in] data - [optional] Item data
+    //! \return uint32_t - Zero-based item index
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  append(const std::basic_string<char_t>& txt, data_t data = data_t())
+    {
+      return append(txt.c_str(), static_cast<uint32_t>(txt.size()), data);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::append
+    //! Append a range of items in one operation  (After all rows, regardless of sort order)
+    //!
+    //! \tparam ITERATOR - Iterator of strings or null terminated strings
+    //!
+    //! \param[in] first - First item text
+    //! \param[in] last - Position beyond last item text
+    //!
+    //! \throw wtl::invalid_argument - Missing text
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename ITERATOR>
+    void  append(ITERATOR first, ITERATOR last)
+    {
+      // Reserve space for indicies  (Text is grown geometrically)
+      size_t const count = Items.size() + std::distance(first, last);
+      Items.reserve(count);
+      Order.reserve(count);
+      Rows.reserve(Filter ? Rows.size() : count);
+
+      for (; first != last; ++first)
+        append(*first);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::clear
+    //! Remove all items  (Retains the filter)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clear()
+    {
+      Text.clear();
+      Items.clear();
+      Order.clear();
+      Rows.clear();
+      ++Revision;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::filter
+    //! Display only the items matching a predicate  (Retains the sort order)
+    //!
+    //! \param[in] pred - Filter predicate, or empty to display all items
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  filter(filter_t pred)
+    {
+      Filter = std::move(pred);
+      refresh();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::reserve
+    //! Reserve storage before adding many items
+    //!
+    //! \param[in] count - Number of items
+    //! \param[in] chars - [optional] Total length of their text, in characters
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  reserve(uint32_t count, uint32_t chars = 0)
+    {
+      Items.reserve(count);
+      Order.reserve(count);
+      Rows.reserve(count);
+      Text.reserve(chars + count);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::sort
+    //! Sort all items by text, using a stable ordinal comparison
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  sort()
+    {
+      sort([](const ItemView& a, const ItemView& b) {
+        return std::lexicographical_compare(a.Text, a.Text + a.Length, b.Text, b.Text + b.Length);
+      });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::sort
+    //! Sort all items using a stable sort  (Including those excluded by the filter)
+    //!
+    //! \tparam COMPARE - Binary predicate type
+    //!
+    //! \param[in] cmp - Strict weak ordering of 'ItemView' objects
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename COMPARE>
+    void  sort(COMPARE cmp)
+    {
+      std::stable_sort(Order.begin(), Order.end(), [&](uint32_t a, uint32_t b) {
+        return cmp(view(a), view(b));
+      });
+      refresh();
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ItemModel::refresh
+    //! Rebuild the rows from the sort order and filter
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  refresh()
+    {
+      // [UNFILTERED] Display all items
+      if (!Filter)
+        Rows = Order;
+      // [FILTERED] Display matching items
+      else
+      {
+        Rows.clear();
+        for (uint32_t idx : Order)
+          if (Filter(view(idx)))
+            Rows.push_back(idx);
+      }
+      ++Revision;
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_ITEM_MODEL_HPP
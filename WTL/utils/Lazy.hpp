@@ -9,49 +9,137 @@
 #define WTL_LAZY_HPP
 
 #include <wtl/WTL.hpp>
-#include <wtl/utils/DynamicArray.hpp>
+#include <wtl/utils/Exception.hpp>            //!< logic_error
+#include <atomic>                             //!< std::atomic
+#include <condition_variable>                 //!< std::condition_variable
+#include <mutex>                              //!< std::mutex
+#include <new>                                //!< placement new
+#include <thread>                             //!< std::this_thread
+#include <utility>                            //!< std::forward
 
 //! \namespace wtl - Windows template library
 namespace wtl
 {
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct LazyParking - Process-wide lock and condition upon which threads wait for any Lazy under construction
+  /////////////////////////////////////////////////////////////////////////////////////////
+  struct LazyParking
+  {
+    std::mutex               Lock;       //!< Guards waiting
+    std::condition_variable  Woken;      //!< Signalled when a contended object is created (or creation fails)
+
+    //! Get the process-wide instance
+    static LazyParking&  instance()
+    {
+      static LazyParking parking;
+      return parking;
+    }
+  };
 
   /////////////////////////////////////////////////////////////////////////////////////////
   //! \struct Lazy - Provides lazy initialization for any type
   //!
   //! \tparam DATA - Any type
+  //!
+  //! \remarks The object is stored inline with a single atomic state byte. Once created, get_or_create() costs a single
+  //! \remarks acquire load. Concurrent callers wait for whichever thread wins the right to create the object; if its
+  //! \remarks factory throws, another caller may retry. destroy() and copying are not synchronised with readers.
   /////////////////////////////////////////////////////////////////////////////////////////
   template <typename DATA>
-  struct Lazy : protected DynamicArray<DATA,1>
+  struct Lazy
   {
     // ---------------------------------- TYPES & CONSTANTS ---------------------------------
-    
-    //! \alias base - Base class alias
-    using base = DynamicArray<DATA,1>;
-    
+
+    //! \alias type - Define own type
+    using type = Lazy<DATA>;
+
     //! \alias object_t - Object type
     using object_t = DATA;
-    
+
+  protected:
+    //! \enum State - Object state  (Waiting may be combined with Creating)
+    enum State : uint8_t
+    {
+      Empty    = 0,     //!< Not created
+      Creating = 1,     //!< Being created by one thread
+      Ready    = 2,     //!< Created
+      Waiting  = 4,     //!< Other threads are parked awaiting creation
+    };
+
+    //! \var SpinLimit - Number of times to yield before parking
+    static constexpr uint32_t SpinLimit = 64;
+
     // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    alignas(DATA) unsigned char   Storage[sizeof(DATA)];    //!< Object storage
+    std::atomic<uint8_t>          Status;                   //!< Object state
 
     // ------------------------------------ CONSTRUCTION ------------------------------------
-    
+  public:
     /////////////////////////////////////////////////////////////////////////////////////////
     // Lazy::Lazy
     //! Does nothing
     /////////////////////////////////////////////////////////////////////////////////////////
-    Lazy()
+    Lazy() : Status(Empty)
     {}
-    
+
     // -------------------------------- COPY, MOVE & DESTROY --------------------------------
   public:
-    ENABLE_COPY(Lazy);     //!< Move semantics inherited from enclosed type
-    ENABLE_MOVE(Lazy);     //!< Move semantics inherited from enclosed type
-    
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Lazy::Lazy
+    //! Copy-construct, copying the object if it exists
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Lazy(const Lazy& r) : Status(Empty)
+    {
+      if (r.exists())
+        create(*r);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Lazy::Lazy
+    //! Move-construct, moving the object if it exists
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Lazy(Lazy&& r) : Status(Empty)
+    {
+      if (r.exists())
+        create(std::move(*r));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Lazy::operator=
+    //! Copy-assign, replacing the object
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Lazy& operator=(const Lazy& r)
+    {
+      if (this != &r)
+      {
+        destroy();
+        if (r.exists())
+          create(*r);
+      }
+      return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Lazy::operator=
+    //! Move-assign, replacing the object
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Lazy& operator=(Lazy&& r)
+    {
+      if (this != &r)
+      {
+        destroy();
+        if (r.exists())
+          create(std::move(*r));
+      }
+      return *this;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////
     // Lazy::~Lazy
     //! Ensures the object is destroyed
     /////////////////////////////////////////////////////////////////////////////////////////
-    virtual ~Lazy()
+    ~Lazy()
     {
       destroy();
     }
@@ -59,7 +147,7 @@ namespace wtl
 	  // ----------------------------------- STATIC METHODS -----------------------------------
 
     // ---------------------------------- ACCESSOR METHODS ----------------------------------
-    
+  public:
     /////////////////////////////////////////////////////////////////////////////////////////
     // Lazy::exists const
     //! Query whether object exists
@@ -68,39 +156,39 @@ namespace wtl
     /////////////////////////////////////////////////////////////////////////////////////////
     bool exists() const
     {
-      return !this->empty();
+      return Status.load(std::memory_order_acquire) == Ready;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////
     // Lazy::operator * const
     //! Access the object
     //!
-    //! \return const_reference - Immutable reference to object 
-    //! 
+    //! \return const object_t& - Immutable reference to object
+    //!
     //! \throw wtl::logic_error - [Debug only] Object does not exist
     /////////////////////////////////////////////////////////////////////////////////////////
-    typename base::const_reference operator*() const
+    const object_t& operator*() const
     {
-      LOGIC_INVARIANT(this->empty() == false);
+      LOGIC_INVARIANT(exists());
 
-      return this->Data[0];
+      return *object();
     }
-    
+
     /////////////////////////////////////////////////////////////////////////////////////////
     // Lazy::operator -> const
     //! Access the object
     //!
-    //! \return const_pointer - Immutable pointer to object 
+    //! \return const object_t* - Immutable pointer to object
     //!
     //! \throw wtl::logic_error - [Debug only] Object does not exist
     /////////////////////////////////////////////////////////////////////////////////////////
-    typename base::const_pointer operator->() const
+    const object_t* operator->() const
     {
-      LOGIC_INVARIANT(this->empty() == false);
+      LOGIC_INVARIANT(exists());
 
-      return this->Data;
+      return object();
     }
-    
+
     /////////////////////////////////////////////////////////////////////////////////////////
     // Lazy::operator bool const
     //! Query whether object exists
@@ -123,25 +211,34 @@ namespace wtl
       return !exists();
     }
 
+  protected:
+    //! Get the object storage
+    const object_t*  object() const   { return reinterpret_cast<const object_t*>(Storage);  }
+
+    //! Get the object storage
+    object_t*  object()               { return reinterpret_cast<object_t*>(Storage);        }
+
     // ----------------------------------- MUTATOR METHODS ----------------------------------
-    
+  public:
     /////////////////////////////////////////////////////////////////////////////////////////
     // Lazy::create
     //! Creates the object
-    //! 
+    //!
     //! \tparam ...PARAMS - [optional] Constructor argument types
     //!
     //! \param[in,out] && args - [optional] Constructor arguments
     //!
-    //! \throw wtl::logic_error - [Debug only] Object already exists
+    //! \throw wtl::logic_error - Object already exists, or was created by another thread while waiting
+    //!
+    //! \remarks Unlike get_or_create(), the arguments are never silently discarded: a caller that loses the race
+    //! \remarks to construct the object is told so, rather than returning as though its arguments were used.
     /////////////////////////////////////////////////////////////////////////////////////////
     template <typename... PARAMS>
     void create(PARAMS&&... args)
     {
-      LOGIC_INVARIANT(this->empty() == true);
-
       // variadic construct in place
-      this->emplace_back(std::forward<PARAMS>(args)...);
+      if (!initialize([&] (void* at) { new (at) object_t(std::forward<PARAMS>(args)...); }))
+        throw logic_error(HERE, "Object already exists");
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////
@@ -150,45 +247,131 @@ namespace wtl
     /////////////////////////////////////////////////////////////////////////////////////////
     void destroy()
     {
-      this->clear();
+      if (exists())
+      {
+        object()->~object_t();
+        Status.store(Empty, std::memory_order_release);
+      }
     }
-    
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Lazy::get_or_create
+    //! Access the object, creating it exactly once if it does not exist
+    //!
+    //! \tparam FACTORY - Callable returning an object (or value from which it is constructible)
+    //!
+    //! \param[in] && factory - Factory invoked by at most one thread at a time
+    //! \return object_t& - Mutable reference to object
+    //!
+    //! \throw ... - Any exception thrown by the factory  (The object remains empty)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename FACTORY>
+    object_t&  get_or_create(FACTORY&& factory)
+    {
+      // [READY] Single acquire load
+      if (Status.load(std::memory_order_acquire) == Ready)
+        return *object();
+
+      initialize([&factory] (void* at) { new (at) object_t(factory()); });
+      return *object();
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////
     // Lazy::operator *
     //! Access the object
     //!
-    //! \return reference - Mutable reference to object 
+    //! \return object_t& - Mutable reference to object
     //!
     //! \throw wtl::logic_error - [Debug only] Object does not exist
     /////////////////////////////////////////////////////////////////////////////////////////
-    typename base::reference operator*()
+    object_t& operator*()
     {
       LOGIC_INVARIANT(exists());
 
-      return this->Data[0];
+      return *object();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////
     // Lazy::operator ->
     //! Access the object
     //!
+    //! \return object_t* - Mutable pointer to object
+    //!
     //! \throw wtl::logic_error - [Debug only] Object does not exist
     /////////////////////////////////////////////////////////////////////////////////////////
-    typename base::pointer operator->()
+    object_t* operator->()
     {
       LOGIC_INVARIANT(exists());
 
-      return this->Data;
+      return object();
     }
-  };
-  
 
-  
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Lazy::initialize
+    //! Construct the object once, or wait while another thread constructs it
+    //!
+    //! \tparam CONSTRUCT - Callable which constructs the object at an address
+    //!
+    //! \param[in] construct - Constructs object
+    //! \return bool - True iff object was constructed by this call, False if it was created by another
+    //!
+    //! \throw ... - Any exception thrown during construction
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename CONSTRUCT>
+    bool  initialize(CONSTRUCT&& construct)
+    {
+      for (uint32_t spin = 0; ; ++spin)
+      {
+        uint8_t state = Empty;
 
-} // WTL namespace
+        // [EMPTY] Claim creation
+        if (Status.compare_exchange_strong(state, Creating, std::memory_order_acquire))
+        {
+          try {
+            construct(static_cast<void*>(Storage));
+          }
+          catch (...) {
+            publish(Empty);
+            throw;
+          }
+          publish(Ready);
+          return true;
+        }
 
+        // [READY] Created by another thread
+        if (state == Ready)
+          return false;
 
+        // [CREATING] Yield briefly, then register as a waiter and park until published
+        if (spin < SpinLimit)
+          std::this_thread::yield();
+        else if (state & Waiting || Status.compare_exchange_weak(state, uint8_t(state | Waiting), std::memory_order_relaxed))
+        {
+          LazyParking& parking = LazyParking::instance();
+          std::unique_lock<std::mutex> lock(parking.Lock);
+          parking.Woken.wait(lock, [this] { return !(Status.load(std::memory_order_acquire) & Creating); });
+        }
+      }
+    }
 
-#endif // WTL_LAZY_HPP
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Lazy::publish
+    //! Publish the outcome of creation, waking any parked threads
+    //!
+    //! \param[in] state - Empty or Ready
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  publish(State state)
+    {
+      if (Status.exchange(state, std::memory_order_acq_rel) & Waiting)
+      {
+        LazyParking& parking = LazyParking::instance();
+        std::lock_guard<std::mutex> lock(parking.Lock);
+        parking.Woken.notify_all();
+      }
+    }
+  };
 
+} // WTL namespace
 
+#endif // WTL_LAZY_HPP
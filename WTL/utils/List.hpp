@@ -14,7 +14,7 @@
 #include <list>                             //!< std::list
 #include <algorithm>                        //!< std::find_if
 #include <functional>                       //!< std::function
-#include <wtl/utils/exception.hpp>          //!< out_of_range
+#include <wtl/utils/Exception.hpp>          //!< out_of_range
 
 //! \namespace wtl - Windows template library
 namespace wtl
@@ -11,7 +11,7 @@
 #include <wtl/WTL.hpp>
 #include <wtl/traits/EnumTraits.hpp>              //!< is_attribute, is_contiguous
 #include <wtl/traits/EncodingTraits.hpp>          //!< Encoding
-#include <wtl/utils/CharArray.hpp>                //!< CharArray
+#include <wtl/utils/chararray.hpp>                //!< CharArray
 #include <wtl/utils/Default.hpp>                  //!< default_t
 #include <string>
 
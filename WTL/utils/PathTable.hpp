@@ -0,0 +1,844 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\utils\PathTable.hpp
+//! \brief Provides compact storage for large numbers of paths by interning their components
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_PATH_TABLE_HPP
+#define WTL_PATH_TABLE_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/traits/EncodingTraits.hpp>      //!< Encoding, encoding_char_t
+#include <wtl/utils/Exception.hpp>            //!< length_error
+#include <iterator>                           //!< std::forward_iterator_tag
+#include <string>                             //!< std::basic_string, std::char_traits
+#include <vector>                             //!< std::vector
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  //! Forward declarations
+  template <Encoding ENC> struct InternedPath;
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct PathView - Non-owning view of a path component or substring
+  //!
+  //! \tparam CHR - Character type
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename CHR>
+  struct PathView
+  {
+    const CHR*  Text;       //!< First character  (Not null terminated)
+    uint32_t    Length;     //!< Number of characters
+
+    const CHR*  begin() const                         { return Text;                                }
+    bool        empty() const                         { return Length == 0;                         }
+    const CHR*  end() const                           { return Text + Length;                       }
+    uint32_t    size() const                          { return Length;                              }
+    std::basic_string<CHR>  str() const               { return std::basic_string<CHR>(Text, Length); }
+
+    bool  operator==(const PathView& r) const         { return Length == r.Length && std::char_traits<CHR>::compare(Text, r.Text, Length) == 0; }
+    bool  operator!=(const PathView& r) const         { return !(*this == r);                        }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct PathTable - Stores paths as chains of interned components, sharing common parent folders
+  //!
+  //! \tparam ENC - Path character encoding
+  //!
+  //! \remarks Each distinct path occupies one 16-byte node, which refers to its parent folder's node and to the text
+  //! \remarks of its final component. Component text is stored once, however many folders contain it. Paths are
+  //! \remarks identified by a 32-bit index, so a million paths sharing a typical folder structure occupy a few tens
+  //! \remarks of megabytes rather than the 260 characters per path of wtl::Path.
+  //!
+  //! \remarks Both '\\' and '/' are accepted as separators, the native separator is used when paths are rebuilt.
+  //! \remarks Leading separators form a root component (eg. UNC and POSIX roots), repeated and trailing separators
+  //! \remarks are discarded, and '.' and '..' components are resolved lexically. Components are case sensitive.
+  //!
+  //! \remarks Paths are never removed. Not thread-safe.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <Encoding ENC = Encoding::ANSI>
+  struct PathTable
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var encoding - Character encoding
+    static constexpr Encoding encoding = ENC;
+
+    //! \alias type - Define own type
+    using type = PathTable<encoding>;
+
+    //! \alias char_t - Encoding character type
+    using char_t = encoding_char_t<encoding>;
+
+    //! \alias string_t - String type
+    using string_t = std::basic_string<char_t>;
+
+    //! \alias view_t - View type
+    using view_t = PathView<char_t>;
+
+    //! \alias id_t - Path identifier
+    using id_t = uint32_t;
+
+    //! \var empty - Identifier of the empty path
+    static constexpr id_t empty = 0;
+
+    //! \var npos - Identifier returned when a path is not present
+    static constexpr id_t npos = ~0u;
+
+    //! \var separator - Native path separator
+#if defined(WTL_PORTABLE) && !defined(_WIN32)
+    static constexpr char_t separator = '/';
+#else
+    static constexpr char_t separator = '\\';
+#endif
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct ComponentIterator - Iterates the components of a path from the root, without copying
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct ComponentIterator
+    {
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = view_t;
+      using difference_type = ptrdiff_t;
+      using pointer = const view_t*;
+      using reference = view_t;
+
+      const type*  Table;       //!< Table
+      id_t         Leaf;        //!< Path being iterated
+      uint32_t     Depth;       //!< Depth of current component  (One-based)
+
+      view_t  operator*() const                                  { return Table->name(Table->ancestor(Leaf, Depth)); }
+      ComponentIterator&  operator++()                           { ++Depth; return *this;                            }
+      bool  operator==(const ComponentIterator& r) const         { return Depth == r.Depth && Leaf == r.Leaf;        }
+      bool  operator!=(const ComponentIterator& r) const         { return !(*this == r);                             }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct ComponentRange - Range of the components of a path
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct ComponentRange
+    {
+      ComponentIterator  First,     //!< First component
+                         Last;      //!< Position beyond last component
+
+      ComponentIterator  begin() const      { return First;     }
+      ComponentIterator  end() const        { return Last;      }
+    };
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Node - Interned path
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Node
+    {
+      id_t      Parent;         //!< Parent folder  (Empty path has itself as parent)
+      uint32_t  Name;           //!< Offset of final component within arena
+      uint16_t  NameLength;     //!< Length of final component
+      uint16_t  Depth;          //!< Number of components
+      uint32_t  Length;         //!< Length of entire path
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Component - Interned component text
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Component
+    {
+      uint32_t  Offset;         //!< Offset within arena
+      uint32_t  Length;         //!< Length, or npos if slot is empty
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::vector<Node>       Nodes;          //!< Paths  (Node zero is the empty path)
+    std::vector<char_t>     Names;          //!< Component text arena
+    std::vector<id_t>       PathSlots;      //!< Open-addressing table of nodes keyed by (parent, component), zero if empty
+    std::vector<Component>  NameSlots;      //!< Open-addressing table of component text
+    uint32_t                Components;     //!< Number of distinct components
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::PathTable
+    //! Create table containing only the empty path
+    /////////////////////////////////////////////////////////////////////////////////////////
+    PathTable() : Nodes(1, Node{empty, 0, 0, 0, 0}),
+                  PathSlots(64, empty),
+                  NameSlots(64, Component{0, npos}),
+                  Components(0)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    ENABLE_COPY(PathTable);      //!< Can be deep copied
+    ENABLE_MOVE(PathTable);      //!< Can be moved
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::hash
+    //! Hash characters  (FNV-1a)
+    //!
+    //! \param[in] const* text - Characters
+    //! \param[in] length - Number of characters
+    //! \return uint32_t - Hash
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t  hash(const char_t* text, size_t length)
+    {
+      uint32_t h = 0x811C9DC5u;
+      for (size_t i = 0; i < length; ++i)
+        h = (h ^ static_cast<uint32_t>(text[i])) * 0x01000193u;
+      return h;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::hash
+    //! Hash a (parent, component) pair
+    //!
+    //! \param[in] parent - Parent folder
+    //! \param[in] name - Component offset
+    //! \return uint32_t - Hash
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t  hash(id_t parent, uint32_t name)
+    {
+      uint64_t h = (static_cast<uint64_t>(parent) << 32 | name) * 0x9E3779B97F4A7C15ULL;
+      return static_cast<uint32_t>(h >> 32);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::isSeparator
+    //! Query whether a character separates components
+    //!
+    //! \param[in] c - Character
+    //! \return bool - True for '\\' and '/'
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static bool  isSeparator(char_t c)
+    {
+      return c == '\\' || c == '/';
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::delimited const
+    //! Query whether a separator follows a folder when its children are rebuilt
+    //!
+    //! \param[in] folder - Folder
+    //! \return bool - False for the empty path and root components, otherwise true
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  delimited(id_t folder) const
+    {
+      const Node& n = Nodes[folder];
+      return n.Depth != 0 && !isSeparator(Names[n.Name + n.NameLength - 1]);
+    }
+
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::ancestor const
+    //! Get an ancestor of a path
+    //!
+    //! \param[in] id - Path
+    //! \param[in] depth - Number of leading components to retain
+    //! \return id_t - Ancestor, or 'id' if 'depth' is not less than its depth
+    /////////////////////////////////////////////////////////////////////////////////////////
+    id_t  ancestor(id_t id, uint32_t depth) const
+    {
+      while (Nodes[id].Depth > depth)
+        id = Nodes[id].Parent;
+      return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::components const
+    //! Get the components of a path, from the root
+    //!
+    //! \param[in] id - Path
+    //! \return ComponentRange - Range of views
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ComponentRange  components(id_t id) const
+    {
+      return ComponentRange{ComponentIterator{this, id, 1u}, ComponentIterator{this, id, Nodes[id].Depth + 1u}};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::copy const
+    //! Write a path into a buffer, without allocating
+    //!
+    //! \param[in] id - Path
+    //! \param[in,out] *buffer - Output buffer
+    //! \param[in] capacity - Capacity of output buffer, in characters
+    //! \return uint32_t - Length of path, excluding the null terminator
+    //!
+    //! \throw wtl::length_error - Insufficient buffer
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  copy(id_t id, char_t* buffer, size_t capacity) const
+    {
+      uint32_t const length = Nodes[id].Length;
+      if (capacity <= length)
+        throw length_error(HERE, "Insufficient buffer to copy path");
+
+      // Fill from the end
+      buffer[length] = '\0';
+      for (id_t n = id; n != empty; n = Nodes[n].Parent)
+      {
+        const Node& node = Nodes[n];
+        char_t* pos = buffer + node.Length - node.NameLength;
+        std::char_traits<char_t>::copy(pos, &Names[node.Name], node.NameLength);
+        if (delimited(node.Parent))
+          pos[-1] = separator;
+      }
+      return length;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::depth const
+    //! Get the number of components of a path
+    //!
+    //! \param[in] id - Path
+    //! \return uint32_t - Number of components
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  depth(id_t id) const
+    {
+      return Nodes[id].Depth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::extension const
+    //! Get the extension of a path
+    //!
+    //! \param[in] id - Path
+    //! \return view_t - Extension including leading dot, or empty
+    /////////////////////////////////////////////////////////////////////////////////////////
+    view_t  extension(id_t id) const
+    {
+      view_t const n = name(id);
+      for (uint32_t dot = n.Length; dot-- > 0; )
+        if (n.Text[dot] == '.')
+          return view_t{n.Text + dot, n.Length - dot};
+      return view_t{n.Text + n.Length, 0};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::find const
+    //! Find a path without interning it
+    //!
+    //! \param[in] const* path - Path
+    //! \param[in] length - Length of path, in characters
+    //! \return id_t - Path, or npos if not present
+    /////////////////////////////////////////////////////////////////////////////////////////
+    id_t  find(const char_t* path, size_t length) const
+    {
+      return const_cast<type*>(this)->walk(empty, path, length, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::isAncestor const
+    //! Query whether a path contains another
+    //!
+    //! \param[in] folder - Possible ancestor
+    //! \param[in] id - Path
+    //! \return bool - True if 'folder' is a proper ancestor of 'id'
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  isAncestor(id_t folder, id_t id) const
+    {
+      return Nodes[folder].Depth < Nodes[id].Depth && ancestor(id, Nodes[folder].Depth) == folder;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::length const
+    //! Get the length of a path
+    //!
+    //! \param[in] id - Path
+    //! \return uint32_t - Number of characters
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  length(id_t id) const
+    {
+      return Nodes[id].Length;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::memory const
+    //! Get the memory occupied by the table
+    //!
+    //! \return size_t - Number of bytes allocated
+    /////////////////////////////////////////////////////////////////////////////////////////
+    size_t  memory() const
+    {
+      return Nodes.capacity() * sizeof(Node) + Names.capacity() * sizeof(char_t)
+           + PathSlots.capacity() * sizeof(id_t) + NameSlots.capacity() * sizeof(Component);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::name const
+    //! Get the final component of a path
+    //!
+    //! \param[in] id - Path
+    //! \return view_t - File or folder name, or empty
+    /////////////////////////////////////////////////////////////////////////////////////////
+    view_t  name(id_t id) const
+    {
+      return view_t{Names.data() + Nodes[id].Name, Nodes[id].NameLength};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::parent const
+    //! Get the folder containing a path
+    //!
+    //! \param[in] id - Path
+    //! \return id_t - Parent folder  (The empty path is its own parent)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    id_t  parent(id_t id) const
+    {
+      return Nodes[id].Parent;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::size const
+    //! Get the number of paths
+    //!
+    //! \return uint32_t - Number of paths, including every interned folder and the empty path
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  size() const
+    {
+      return static_cast<uint32_t>(Nodes.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::str const
+    //! Rebuild a path
+    //!
+    //! \param[in] id - Path
+    //! \return string_t - Path using native separators
+    /////////////////////////////////////////////////////////////////////////////////////////
+    string_t  str(id_t id) const
+    {
+      string_t s(Nodes[id].Length + 1, '\0');
+      s.resize(copy(id, &s[0], s.size()));
+      return s;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::combine
+    //! Intern a path relative to a folder
+    //!
+    //! \param[in] folder - Folder
+    //! \param[in] const* relative - Relative path  (An absolute path replaces the folder)
+    //! \param[in] length - Length of relative path, in characters
+    //! \return id_t - Combined path
+    //!
+    //! \throw wtl::length_error - Component or path is too long
+    /////////////////////////////////////////////////////////////////////////////////////////
+    id_t  combine(id_t folder, const char_t* relative, size_t length)
+    {
+      // [ABSOLUTE] Drive or root
+      bool const absolute = (length && isSeparator(relative[0])) || (length > 1 && relative[1] == ':');
+      return walk(absolute ? empty : folder, relative, length, true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::intern
+    //! Intern a path
+    //!
+    //! \param[in] const* path - Path
+    //! \param[in] length - Length of path, in characters
+    //! \return id_t - Path
+    //!
+    //! \throw wtl::length_error - Component or path is too long
+    /////////////////////////////////////////////////////////////////////////////////////////
+    id_t  intern(const char_t* path, size_t length)
+    {
+      return walk(empty, path, length, true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::intern
+    //! Intern a null-terminated path
+    //!
+    //! \param[in] const* path - Null-terminated path
+    //! \return id_t - Path
+    //!
+    //! \throw wtl::length_error - Component or path is too long
+    /////////////////////////////////////////////////////////////////////////////////////////
+    id_t  intern(const char_t* path)
+    {
+      return walk(empty, path, std::char_traits<char_t>::length(path), true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::reserve
+    //! Reserve capacity
+    //!
+    //! \param[in] paths - Number of distinct paths and folders
+    //! \param[in] characters - Number of characters of distinct components
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  reserve(uint32_t paths, uint32_t characters)
+    {
+      Nodes.reserve(paths + 1);
+      Names.reserve(characters);
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::child
+    //! Find or insert a path within a folder
+    //!
+    //! \param[in] parent - Folder
+    //! \param[in] const* name - Component
+    //! \param[in] length - Length of component
+    //! \param[in] insert - Whether to insert if not present
+    //! \return id_t - Path, or npos if not present and not inserted
+    //!
+    //! \throw wtl::length_error - Component or path is too long
+    /////////////////////////////////////////////////////////////////////////////////////////
+    id_t  child(id_t parent, const char_t* name, size_t length, bool insert)
+    {
+      // Intern component
+      uint32_t const offset = component(name, length, insert);
+      if (offset == npos)
+        return npos;
+
+      // Probe for (parent, component)
+      uint32_t const mask = static_cast<uint32_t>(PathSlots.size() - 1);
+      uint32_t idx = hash(parent, offset) & mask;
+      for (; PathSlots[idx] != empty; idx = (idx + 1) & mask)
+      {
+        const Node& n = Nodes[PathSlots[idx]];
+        if (n.Parent == parent && n.Name == offset && n.NameLength == length)
+          return PathSlots[idx];
+      }
+
+      if (!insert)
+        return npos;
+
+      // [NEW] Append node
+      const Node& p = Nodes[parent];
+      uint64_t const total = p.Length + (delimited(parent) ? 1 : 0) + length;
+      if (total >= 0xFFFFFFFFu || p.Depth == 0xFFFF)
+        throw length_error(HERE, "Path is too long to be interned");
+
+      id_t const id = static_cast<id_t>(Nodes.size());
+      Nodes.push_back(Node{parent, offset, static_cast<uint16_t>(length), static_cast<uint16_t>(p.Depth + 1), static_cast<uint32_t>(total)});
+      PathSlots[idx] = id;
+
+      // Grow beyond 50% load
+      if (Nodes.size() * 2 > PathSlots.size())
+        rehashPaths();
+      return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::component
+    //! Find or insert component text
+    //!
+    //! \param[in] const* name - Component
+    //! \param[in] length - Length of component
+    //! \param[in] insert - Whether to insert if not present
+    //! \return uint32_t - Offset within arena, or npos if not present and not inserted
+    //!
+    //! \throw wtl::length_error - Component is too long
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  component(const char_t* name, size_t length, bool insert)
+    {
+      if (length > 0xFFFF)
+        throw length_error(HERE, "Path component is too long to be interned");
+
+      uint32_t const mask = static_cast<uint32_t>(NameSlots.size() - 1);
+      uint32_t idx = hash(name, length) & mask;
+      for (; NameSlots[idx].Length != npos; idx = (idx + 1) & mask)
+        if (NameSlots[idx].Length == length && std::char_traits<char_t>::compare(&Names[NameSlots[idx].Offset], name, length) == 0)
+          return NameSlots[idx].Offset;
+
+      if (!insert)
+        return npos;
+
+      // [NEW] Append text
+      if (Names.size() + length >= npos)
+        throw length_error(HERE, "Path arena is exhausted");
+
+      uint32_t const offset = static_cast<uint32_t>(Names.size());
+      Names.insert(Names.end(), name, name + length);
+      NameSlots[idx] = Component{offset, static_cast<uint32_t>(length)};
+
+      // Grow beyond 50% load
+      if (++Components * 2 > NameSlots.size())
+        rehashNames();
+      return offset;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::rehashNames
+    //! Double the capacity of the component table
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  rehashNames()
+    {
+      std::vector<Component> slots(NameSlots.size() * 2, Component{0, npos});
+      uint32_t const mask = static_cast<uint32_t>(slots.size() - 1);
+
+      for (const Component& c : NameSlots)
+        if (c.Length != npos)
+        {
+          uint32_t idx = hash(&Names[c.Offset], c.Length) & mask;
+          while (slots[idx].Length != npos)
+            idx = (idx + 1) & mask;
+          slots[idx] = c;
+        }
+      NameSlots.swap(slots);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::rehashPaths
+    //! Double the capacity of the path table
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  rehashPaths()
+    {
+      std::vector<id_t> slots(PathSlots.size() * 2, empty);
+      uint32_t const mask = static_cast<uint32_t>(slots.size() - 1);
+
+      for (id_t id = 1; id < Nodes.size(); ++id)
+      {
+        uint32_t idx = hash(Nodes[id].Parent, Nodes[id].Name) & mask;
+        while (slots[idx] != empty)
+          idx = (idx + 1) & mask;
+        slots[idx] = id;
+      }
+      PathSlots.swap(slots);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // PathTable::walk
+    //! Resolve, and optionally intern, each component of a path
+    //!
+    //! \param[in] id - Initial folder
+    //! \param[in] const* path - Path
+    //! \param[in] length - Length of path, in characters
+    //! \param[in] insert - Whether to insert components which are not present
+    //! \return id_t - Path, or npos if not present and not inserted
+    /////////////////////////////////////////////////////////////////////////////////////////
+    id_t  walk(id_t id, const char_t* path, size_t length, bool insert)
+    {
+      const char_t *pos = path,
+                   *end = path + length;
+
+      // Retain leading separators as a single root component  (eg. POSIX root, UNC prefix)
+      if (pos != end && isSeparator(*pos))
+      {
+        static const char_t roots[2] = {separator, separator};
+        size_t n = 0;
+        for (; pos != end && isSeparator(*pos); ++pos)
+          ++n;
+        id = child(empty, roots, n > 1 ? 2 : 1, insert);
+      }
+
+      while (id != npos && pos != end)
+      {
+        const char_t* next = pos;
+        while (next != end && !isSeparator(*next))
+          ++next;
+
+        size_t const n = next - pos;
+        // [CURRENT] Ignore
+        if (n == 0 || (n == 1 && pos[0] == '.'))
+          ;
+        // [PARENT] Remove last component, unless there is none
+        else if (n == 2 && pos[0] == '.' && pos[1] == '.' && delimited(id) && name(id) != view_t{pos, 2})
+          id = Nodes[id].Parent;
+        else
+          id = child(id, pos, n, insert);
+
+        pos = (next == end ? end : next + 1);
+      }
+      return id;
+    }
+  };
+
+  //! Definitions of static members  (Required by C++14 when odr-used)
+  template <Encoding ENC> constexpr typename PathTable<ENC>::id_t   PathTable<ENC>::empty;
+  template <Encoding ENC> constexpr typename PathTable<ENC>::id_t   PathTable<ENC>::npos;
+  template <Encoding ENC> constexpr typename PathTable<ENC>::char_t PathTable<ENC>::separator;
+
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct InternedPath - Compact reference to a path stored in a PathTable
+  //!
+  //! \tparam ENC - Path character encoding
+  //!
+  //! \remarks Occupies two words; folder, name and extension queries neither copy nor allocate.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <Encoding ENC = Encoding::ANSI>
+  struct InternedPath
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = InternedPath<ENC>;
+
+    //! \alias table_t - Table type
+    using table_t = PathTable<ENC>;
+
+    //! \alias char_t - Encoding character type
+    using char_t = typename table_t::char_t;
+
+    //! \alias id_t - Path identifier type
+    using id_t = typename table_t::id_t;
+
+    //! \alias view_t - View type
+    using view_t = typename table_t::view_t;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    table_t*  Table;        //!< Table containing path
+    id_t      Id;           //!< Path
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // InternedPath::InternedPath
+    //! Create reference to an interned path
+    //!
+    //! \param[in] &table - Table containing path
+    //! \param[in] id - Path
+    /////////////////////////////////////////////////////////////////////////////////////////
+    InternedPath(table_t& table, id_t id) : Table(&table), Id(id)
+    {}
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // InternedPath::InternedPath
+    //! Intern a null-terminated path
+    //!
+    //! \param[in] &table - Table to store path
+    //! \param[in] const* path - Null-terminated path
+    //!
+    //! \throw wtl::length_error - Component or path is too long
+    /////////////////////////////////////////////////////////////////////////////////////////
+    InternedPath(table_t& table, const char_t* path) : Table(&table), Id(table.intern(path))
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    ENABLE_COPY(InternedPath);      //!< Can be copied
+    ENABLE_MOVE(InternedPath);      //!< Can be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // InternedPath::components const
+    //! Get the components of the path, from the root
+    //!
+    //! \return ComponentRange - Range of views
+    /////////////////////////////////////////////////////////////////////////////////////////
+    typename table_t::ComponentRange  components() const
+    {
+      return Table->components(Id);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // InternedPath::extension const
+    //! Get the file extension, if any
+    //!
+    //! \return view_t - Extension including leading dot, or empty
+    /////////////////////////////////////////////////////////////////////////////////////////
+    view_t  extension() const
+    {
+      return Table->extension(Id);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // InternedPath::fileName const
+    //! Get the final component
+    //!
+    //! \return view_t - File or folder name
+    /////////////////////////////////////////////////////////////////////////////////////////
+    view_t  fileName() const
+    {
+      return Table->name(Id);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // InternedPath::folder const
+    //! Get the folder containing the path
+    //!
+    //! \return InternedPath - Parent folder
+    /////////////////////////////////////////////////////////////////////////////////////////
+    type  folder() const
+    {
+      return type(*Table, Table->parent(Id));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // InternedPath::id const
+    //! Get the path identifier
+    //!
+    //! \return id_t - Identifier within table
+    /////////////////////////////////////////////////////////////////////////////////////////
+    id_t  id() const
+    {
+      return Id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // InternedPath::length const
+    //! Get the length of the path
+    //!
+    //! \return uint32_t - Number of characters
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  length() const
+    {
+      return Table->length(Id);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // InternedPath::str const
+    //! Rebuild the path
+    //!
+    //! \return std::basic_string<char_t> - Path using native separators
+    /////////////////////////////////////////////////////////////////////////////////////////
+    std::basic_string<char_t>  str() const
+    {
+      return Table->str(Id);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // InternedPath::operator== const
+    //! Equality operator  (Paths from the same table are equal iff their identifiers are equal)
+    //!
+    //! \param[in] const& r - Another path
+    //! \return bool - True if equal
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  operator==(const type& r) const
+    {
+      return Table == r.Table ? Id == r.Id : str() == r.str();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // InternedPath::operator!= const
+    //! Inequality operator
+    //!
+    //! \param[in] const& r - Another path
+    //! \return bool - True if not equal
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  operator!=(const type& r) const
+    {
+      return !(*this == r);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // InternedPath::operator+ const
+    //! Combine with a relative path, interning the result
+    //!
+    //! \param[in] const* relative - Null-terminated relative path
+    //! \return InternedPath - Combined path
+    //!
+    //! \throw wtl::length_error - Component or path is too long
+    /////////////////////////////////////////////////////////////////////////////////////////
+    type  operator+(const char_t* relative) const
+    {
+      return type(*Table, Table->combine(Id, relative, std::char_traits<char_t>::length(relative)));
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_PATH_TABLE_HPP
@@ -13,6 +13,7 @@
 #include <wtl/utils/Requires.hpp>      //!< requires
 #include <wtl/utils/Concepts.hpp>      //!< Signed16BitFields, Signed32BitFields
 #include <type_traits>                 //!< std::enable_if
+#include <ostream>                     //!< std::basic_ostream
 
 //! \namespace wtl - Windows template library
 namespace wtl
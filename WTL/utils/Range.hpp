@@ -9,7 +9,7 @@
 #define WTL_RANGE_HPP
 
 #include <wtl/WTL.hpp>
-#include <wtl/io/Console.hpp>           //!< Console
+#include <wtl/io/Console.hpp>           //!< console_stream
 #include <wtl/io/StreamIterator.hpp>    //!< StreamIterator
 
 //! \namespace wtl - Windows template library
@@ -74,9 +74,9 @@ namespace wtl
     //! \param[in] const &last - Position immediately beyond input range
     //! \param[in] delimiter - Delimiter character
     //////////////////////////////////////////////////////////////////////////////////////////
-    delimited_range_t(const iterator_t& first, const iterator_t& last, char delimeter) : First(first), 
-                                                                                         Last(last), 
-                                                                                         Delimiter(delimeter)
+    delimited_range_t(const iterator_t& first, const iterator_t& last, char delimeter) : Delimiter(delimeter),
+                                                                                         First(first), 
+                                                                                         Last(last)
     {}
     
     /*delimited_range(char delimeter, std::intializer_list<typename ITERATOR::value_type>&& elements) 
@@ -178,12 +178,13 @@ namespace wtl
   //! Write a delimited range to an output stream
   //!
   //! \tparam OUTPUT - Output iterator type
+  //! \tparam INPUT - Input iterator type
   //!
   //! \param[in,out] output - First position in output range
   //! \param[in] const& range - Delimited range
   //! \return OUTPUT - Position immediately beyond the last element written
   //////////////////////////////////////////////////////////////////////////////////////////
-  template <typename OUTPUT>
+  template <typename OUTPUT, typename INPUT>
   OUTPUT  delimit(OUTPUT output, const delimited_range_t<INPUT>& range)
   {
     return delimit(range.First, range.Last, output, range.Delimiter);
@@ -192,18 +193,20 @@ namespace wtl
 
   //////////////////////////////////////////////////////////////////////////////////////////
   // wtl::operator << 
-  //! Writes a delimited range to the console
+  //! Writes a delimited range to an output stream
   //!
+  //! \tparam CHAR - Output stream character type
+  //! \tparam TRAITS - Output stream character traits
   //! \tparam ITERATOR - Iterator type
   //!
-  //! \param[in,out] &c - Debug console
+  //! \param[in,out] &c - Output stream
   //! \param[in] const& range - Delimited input range
-  //! \return Console& : Reference to console 'c'
+  //! \return std::basic_ostream<CHAR,TRAITS>& : Reference to 'c'
   //////////////////////////////////////////////////////////////////////////////////////////
-  template <typename ITERATOR>
-  Console& operator << (Console& c, const delimited_range_t<ITERATOR>& range)
+  template <typename CHAR, typename TRAITS, typename ITERATOR>
+  std::basic_ostream<CHAR,TRAITS>& operator << (std::basic_ostream<CHAR,TRAITS>& c, const delimited_range_t<ITERATOR>& range)
   {
-    delimit(StreamIterator<Console>(c), range);
+    delimit(StreamIterator<std::basic_ostream<CHAR,TRAITS>>(c), range);
     return c;
   }
 
@@ -0,0 +1,390 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\utils\SharedHandle.hpp
+//! \brief Encapsulate any handle type with shared ownership, counted only once actually shared
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_SHARED_HANDLE_HPP
+#define WTL_SHARED_HANDLE_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/utils/UniqueHandle.hpp>         //!< UniqueHandle
+#include <wtl/utils/Handle.hpp>               //!< NativeHandle, handle_alloc, AllocType
+#include <wtl/utils/Exception.hpp>            //!< platform_error
+#include <atomic>                             //!< std::atomic
+#include <mutex>                              //!< std::mutex
+#include <type_traits>                        //!< std::enable_if_t
+#include <unordered_map>                      //!< std::unordered_map
+#include <utility>                            //!< std::forward
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct HandleShareTable - Side table of reference counts for handles of one type which have been shared
+  //!
+  //! \tparam NATIVE - Native handle type
+  //!
+  //! \remarks Handles owned by a single SharedHandle have no entry. Counts are sharded by handle value so that
+  //! \remarks unrelated handles rarely contend for the same lock.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename NATIVE>
+  struct HandleShareTable
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias native_t - Native handle type
+    using native_t = NATIVE;
+
+    //! \var Shards - Number of independently locked shards
+    static constexpr uint32_t Shards = 16;
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Shard - Lock and reference counts
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Shard
+    {
+      std::mutex                               Lock;       //!< Guards counts
+      std::unordered_map<uintptr_t,uint32_t>   Counts;     //!< Number of owners, by handle value
+    };
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    DISABLE_CTOR(HandleShareTable);     //!< Cannot instantiate
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // HandleShareTable::share
+    //! Add an owner to a handle, creating its count if previously unshared
+    //!
+    //! \param[in] h - Native handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static void  share(native_t h)
+    {
+      Shard& s = shard(encode(h));
+      std::lock_guard<std::mutex> lock(s.Lock);
+
+      auto pos = s.Counts.find(encode(h));
+      if (pos == s.Counts.end())
+        s.Counts.emplace(encode(h), 2u);
+      else
+        ++pos->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // HandleShareTable::unshare
+    //! Remove an owner from a handle
+    //!
+    //! \param[in] h - Native handle
+    //! \return bool - True iff the caller was the last owner
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static bool  unshare(native_t h) noexcept
+    {
+      Shard& s = shard(encode(h));
+      std::lock_guard<std::mutex> lock(s.Lock);
+
+      auto pos = s.Counts.find(encode(h));
+      if (pos == s.Counts.end() || --pos->second == 0)
+      {
+        if (pos != s.Counts.end())
+          s.Counts.erase(pos);
+        return true;
+      }
+      return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // HandleShareTable::owners
+    //! Get the number of owners of a handle
+    //!
+    //! \param[in] h - Native handle
+    //! \return uint32_t - Number of owners, or one if unshared
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t  owners(native_t h)
+    {
+      Shard& s = shard(encode(h));
+      std::lock_guard<std::mutex> lock(s.Lock);
+
+      auto pos = s.Counts.find(encode(h));
+      return pos == s.Counts.end() ? 1u : pos->second;
+    }
+
+  protected:
+    //! Encode a pointer or integral handle as an integer
+    static uintptr_t  encode(native_t h)
+    {
+      return reinterpret_cast<uintptr_t>(converter<native_t>::toPointer(h));
+    }
+
+    //! Get the shard responsible for a handle
+    static Shard&  shard(uintptr_t code)
+    {
+      static Shard table[Shards];
+      return table[(code ^ code >> 4 ^ code >> 12) % Shards];
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct SharedHandle - Provides a copyable smart-pointer type for any handle type, without a control block
+  //!
+  //! \tparam NATIVE - Native handle type which models the StoreableHandle concept
+  //! \tparam ALLOCATOR - [optional] Handle allocator type that models the ConstructibleHandle, DestroyableHandle concepts
+  //!
+  //! \remarks A handle is stored inline exactly as UniqueHandle until it is first copied, whereupon its reference count
+  //! \remarks is created in a side table. Handles which were accquired or are weak references are never destroyed, so
+  //! \remarks copying them never touches the table.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename NATIVE, typename ALLOCATOR = handle_alloc<NATIVE>>
+  struct SharedHandle
+  {
+    concept_check(NATIVE,StoreableHandle);
+
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = SharedHandle<NATIVE,ALLOCATOR>;
+
+    //! \alias native_t - Defines handle type
+    using native_t = NATIVE;
+
+    //! \var npos - Invalid handle sentinel value
+    static constexpr native_t npos = ALLOCATOR::npos;
+
+  protected:
+    //! \alias alloc_t - Define handle allocator type
+    using alloc_t = ALLOCATOR;
+
+    //! \alias table_t - Define reference count table type
+    using table_t = HandleShareTable<native_t>;
+
+    //! \alias value_t - Define allocation handle type
+    using value_t = NativeHandle<native_t>;
+
+    // ----------------------------------- REPRESENTATION ------------------------------------
+  protected:
+    value_t                    Value;      //!< Handle value and method of allocation
+    mutable std::atomic<bool>  Shared;     //!< Whether the handle has a reference count  (Set by copying)
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SharedHandle::SharedHandle
+    //! Create an empty handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    SharedHandle() : Value(npos, AllocType::WeakRef), Shared(false)
+    {}
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SharedHandle::SharedHandle
+    //! Create handle using appropriate allocator
+    //!
+    //! \param[in] && arg - First argument to allocator 'create' function
+    //! \param[in] &&... args - [optional] Remaining arguments
+    //!
+    //! \throw wtl::platform_error - Unable to create handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename ARG, typename... ARGS, typename = std::enable_if_t<!std::is_same<std::decay_t<ARG>,SharedHandle>::value>> explicit
+    SharedHandle(ARG&& arg, ARGS&&... args) : SharedHandle( UniqueHandle<native_t,alloc_t>(std::forward<ARG>(arg), std::forward<ARGS>(args)...) )
+    {}
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SharedHandle::SharedHandle
+    //! Assume ownership of a pre-existing native handle
+    //!
+    //! \param[in] h - Native handle
+    //! \param[in] t - Allocation type
+    /////////////////////////////////////////////////////////////////////////////////////////
+    SharedHandle(native_t h, AllocType t) : Value(h, t), Shared(false)
+    {}
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SharedHandle::SharedHandle
+    //! Assume ownership of a unique handle
+    //!
+    //! \param[in] && h - Unique handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    SharedHandle(UniqueHandle<native_t,alloc_t>&& h) : Value(h.detach()), Shared(false)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SharedHandle::SharedHandle
+    //! Copy-construct, adding an owner
+    /////////////////////////////////////////////////////////////////////////////////////////
+    SharedHandle(const SharedHandle& r) : Value(r.Value), Shared(r.share())
+    {}
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SharedHandle::SharedHandle
+    //! Move-construct, leaving the source empty
+    /////////////////////////////////////////////////////////////////////////////////////////
+    SharedHandle(SharedHandle&& r) noexcept : Value(r.Value), Shared(r.Shared.load(std::memory_order_relaxed))
+    {
+      r.Value = value_t(npos, AllocType::WeakRef);
+      r.Shared.store(false, std::memory_order_relaxed);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SharedHandle::operator=
+    //! Copy/move-assign, removing an owner from the existing handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    SharedHandle& operator=(SharedHandle r) noexcept
+    {
+      bool const shared = Shared.load(std::memory_order_relaxed);
+
+      std::swap(Value, r.Value);
+      Shared.store(r.Shared.load(std::memory_order_relaxed), std::memory_order_relaxed);
+      r.Shared.store(shared, std::memory_order_relaxed);
+      return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SharedHandle::~SharedHandle
+    //! Remove an owner, destroying the handle if this was the last
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~SharedHandle()
+    {
+      unshare();
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SharedHandle::exists const
+    //! Query whether handle is valid
+    //!
+    //! \return bool - True iff handle is valid
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool exists() const
+    {
+      return Value.Handle != npos;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SharedHandle::get const
+    //! Get the handle value
+    //!
+    //! \return native_t - Handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    native_t get() const
+    {
+      return Value.Handle;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SharedHandle::owners const
+    //! Get the number of owners
+    //!
+    //! \return uint32_t - Number of owners  (Zero if empty)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t owners() const
+    {
+      return !exists() ? 0u : Shared.load(std::memory_order_relaxed) ? table_t::owners(Value.Handle) : 1u;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SharedHandle::operator bool const
+    //! Query whether handle is valid
+    //!
+    //! \return bool - True iff handle is valid
+    /////////////////////////////////////////////////////////////////////////////////////////
+    operator bool() const
+    {
+      return exists();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SharedHandle::operator native_t const
+    //! Implicit user conversion to underlying handle
+    //!
+    //! \return native_t - Handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    operator native_t() const
+    {
+      return get();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SharedHandle::operator == const
+    //! Shared handle equality operator
+    //!
+    //! \param[in] const &r - Another handle
+    //! \return bool - True iff handle & method are equal
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool operator == (const type& r) const
+    {
+      return Value.Handle == r.Value.Handle
+          && Value.Method == r.Value.Method;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SharedHandle::operator != const
+    //! Shared handle inequality operator
+    //!
+    //! \param[in] const &r - Another handle
+    //! \return bool - True iff handle or method are different
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool operator != (const type& r) const
+    {
+      return !(*this == r);
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SharedHandle::share const
+    //! Add an owner for a copy of this handle
+    //!
+    //! \return bool - True iff the handle is now reference counted
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool share() const
+    {
+      // [UNOWNED] Accquired handles and weak references are never destroyed
+      if (!exists() || Value.Method != AllocType::Create)
+        return false;
+
+      // [SHARED] Create count upon first copy
+      table_t::share(Value.Handle);
+      Shared.store(true, std::memory_order_relaxed);
+      return true;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SharedHandle::release
+    //! Remove this owner, destroying the handle if this was the last, and leave this empty
+    //!
+    //! \throw wtl::platform_error - Unable to release handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void release()
+    {
+      // [FAILED] Throw platform_error
+      if (!unshare())
+        throw platform_error(HERE, "Unable to release handle");
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // SharedHandle::unshare
+    //! Remove this owner, destroying the handle if this was the last, and leave this empty
+    //!
+    //! \return bool - True if handle was destroyed, still shared or already invalid, false if failed to destroy
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool unshare() noexcept
+    {
+      value_t h = Value;
+      bool last = !Shared.load(std::memory_order_relaxed) || table_t::unshare(h.Handle);
+
+      Value = value_t(npos, AllocType::WeakRef);
+      Shared.store(false, std::memory_order_relaxed);
+      return h.Handle == npos || !last || alloc_t::destroy(h);
+    }
+  };
+
+} // WTL namespace
+
+#endif // WTL_SHARED_HANDLE_HPP
@@ -13,9 +13,11 @@
 #include <wtl/utils/DebugInfo.hpp>          //!< DebugInfo
 #include <wtl/utils/SFINAE.hpp>             //!< enable_if_sizeof_t
 #include <wtl/utils/Point.hpp>              //!< Point
-#include <wtl/platform/SystemFlags.hpp>     //!< SystemMetric
 #include <type_traits>                      //!< std::enable_if
 #include <algorithm>                        //!< std::min, std::max
+#ifndef WTL_PORTABLE
+  #include <wtl/platform/SystemFlags.hpp>   //!< SystemMetric
+#endif
 
 //! \namespace wtl - Windows template library
 namespace wtl
@@ -28,6 +30,8 @@ namespace wtl
   //!
   //! \remarks In order to use the implicit conversion operators to Win32 types requires that
   //! \remarks type T model the appropriate Signed16BitFields or Signed32BitFields concepts
+  //! \remarks
+  //! \remarks Construction from system metrics requires Win32 and is omitted from the portable core
   /////////////////////////////////////////////////////////////////////////////////////////
   template <typename T>
   struct Size
@@ -82,6 +86,7 @@ namespace wtl
                                  Height(static_cast<T>(h))
     {}
     
+#ifndef WTL_PORTABLE
     /////////////////////////////////////////////////////////////////////////////////////////
     // Size::Size constexpr 
     //! Create from a dimension and system metric
@@ -113,6 +118,7 @@ namespace wtl
     /////////////////////////////////////////////////////////////////////////////////////////
     Size(SystemMetric w, SystemMetric h) : Size(::GetSystemMetrics(enum_cast(w)), ::GetSystemMetrics(enum_cast(h)))
     {}
+#endif // WTL_PORTABLE
 
     // -------------------------------- COPY, MOVE & DESTROY --------------------------------
 
@@ -0,0 +1,317 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\utils\UniqueHandle.hpp
+//! \brief Encapsulate any handle type with exclusive ownership
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_UNIQUE_HANDLE_HPP
+#define WTL_UNIQUE_HANDLE_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/utils/Handle.hpp>               //!< NativeHandle, handle_alloc, AllocType
+#include <wtl/utils/Exception.hpp>            //!< platform_error
+#include <utility>                            //!< std::forward
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct UniqueHandle - Provides a move-only smart-pointer type for any handle type
+  //!
+  //! \tparam NATIVE - Native handle type which models the StoreableHandle concept
+  //! \tparam ALLOCATOR - [optional] Handle allocator type that models the ConstructibleHandle, DestroyableHandle concepts
+  //!
+  //! \remarks The handle and allocation method are stored inline and released by the allocator, so unlike Handle
+  //! \remarks there is no heap-allocated control block and no reference counting.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename NATIVE, typename ALLOCATOR = handle_alloc<NATIVE>>
+  struct UniqueHandle
+  {
+    concept_check(NATIVE,StoreableHandle);
+
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = UniqueHandle<NATIVE,ALLOCATOR>;
+
+    //! \alias native_t - Defines handle type
+    using native_t = NATIVE;
+
+    //! \var npos - Invalid handle sentinel value
+    static constexpr native_t npos = ALLOCATOR::npos;
+
+  protected:
+    //! \alias alloc_t - Define handle allocator type
+    using alloc_t = ALLOCATOR;
+
+    //! \alias value_t - Define allocation handle type
+    using value_t = NativeHandle<native_t>;
+
+    // ----------------------------------- REPRESENTATION ------------------------------------
+  protected:
+    value_t    Value;      //!< Handle value and method of allocation
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::UniqueHandle
+    //! Create an empty handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    UniqueHandle() : Value(npos, AllocType::WeakRef)
+    {}
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::UniqueHandle
+    //! Create handle using appropriate allocator
+    //!
+    //! \param[in] && arg - First argument to allocator 'create' function
+    //! \param[in] &&... args - [optional] Remaining arguments
+    //!
+    //! \throw wtl::platform_error - Unable to create handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename ARG, typename... ARGS> explicit
+    UniqueHandle(ARG&& arg, ARGS&&... args) : Value( allocate(std::forward<ARG>(arg), std::forward<ARGS>(args)...) )
+    {
+      // Ensure created successfully
+      if (!exists())
+        throw platform_error(HERE, "Unable to create handle");
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::UniqueHandle
+    //! Assume ownership of a pre-existing native handle
+    //!
+    //! \param[in] h - Native handle
+    //! \param[in] t - Allocation type
+    /////////////////////////////////////////////////////////////////////////////////////////
+    UniqueHandle(native_t h, AllocType t) : Value(h, t)
+    {}
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::UniqueHandle
+    //! Assume ownership of a pre-existing native handle
+    //!
+    //! \param[in] h - Native handle and allocation type
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit UniqueHandle(value_t h) : Value(h)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(UniqueHandle);      //!< Ownership is exclusive
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::UniqueHandle
+    //! Move-construct, leaving the source empty
+    /////////////////////////////////////////////////////////////////////////////////////////
+    UniqueHandle(UniqueHandle&& r) noexcept : Value(r.detach())
+    {}
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::operator=
+    //! Move-assign, destroying the existing handle and leaving the source empty
+    /////////////////////////////////////////////////////////////////////////////////////////
+    UniqueHandle& operator=(UniqueHandle&& r) noexcept
+    {
+      if (this != &r)
+      {
+        destroy(Value);
+        Value = r.detach();
+      }
+      return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::~UniqueHandle
+    //! Destroy the handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    ~UniqueHandle()
+    {
+      destroy(Value);
+    }
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  private:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::allocate
+    //! Allocates the handle using appropriate allocator. Also ensures handle models 'ConstructibleHandle' concept.
+    //!
+    //! \param[in] &&... args - Arguments to allocator 'create' function
+    //! \return value_t - Newly allocated handle
+    //!
+    //! \throw wtl::platform_error - Unable to create handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS>
+    static value_t allocate(ARGS&&... args)
+    {
+      static_assert(requires<alloc_t,concepts::ConstructibleHandle<native_t,ARGS...>>::value, "Incorrect handle constructor arguments");
+
+      return alloc_t::create(std::forward<ARGS>(args)...);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::destroy
+    //! Destroys a handle, if valid
+    //!
+    //! \param[in] h - Handle
+    //! \return bool - True if handle was destroyed or already invalid, false if valid but failed to destroy
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static bool destroy(value_t h) noexcept
+    {
+      return h.Handle == npos || alloc_t::destroy(h);
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::exists const
+    //! Query whether handle is valid
+    //!
+    //! \return bool - True iff handle is valid
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool exists() const
+    {
+      return Value.Handle != npos;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::get const
+    //! Get the handle value
+    //!
+    //! \return native_t - Handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    native_t get() const
+    {
+      return Value.Handle;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::method const
+    //! Get the allocation method
+    //!
+    //! \return AllocType - Allocation method
+    /////////////////////////////////////////////////////////////////////////////////////////
+    AllocType method() const
+    {
+      return Value.Method;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::operator bool const
+    //! Query whether handle is valid
+    //!
+    //! \return bool - True iff handle is valid
+    /////////////////////////////////////////////////////////////////////////////////////////
+    operator bool() const
+    {
+      return exists();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::operator native_t const
+    //! Implicit user conversion to underlying handle
+    //!
+    //! \return native_t - Handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    operator native_t() const
+    {
+      return get();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::operator == const
+    //! Native handle equality operator
+    //!
+    //! \param[in] h - Native handle
+    //! \return bool - True iff handles are equal
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool operator == (const native_t h) const
+    {
+      return Value.Handle == h;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::operator != const
+    //! Native handle inequality operator
+    //!
+    //! \param[in] h - Native handle
+    //! \return bool - True iff handles are different
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool operator != (const native_t h) const
+    {
+      return Value.Handle != h;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::detach
+    //! Relinquish ownership of the handle without destroying it, leaving this empty
+    //!
+    //! \return NativeHandle<native_t> - Handle and allocation method
+    /////////////////////////////////////////////////////////////////////////////////////////
+    value_t detach() noexcept
+    {
+      value_t h = Value;
+      Value = value_t(npos, AllocType::WeakRef);
+      return h;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::release
+    //! Destroys the handle, leaving this empty
+    //!
+    //! \throw wtl::platform_error - Unable to release handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void release()
+    {
+      // [FAILED] Throw platform_error
+      if (!destroy(detach()))
+        throw platform_error(HERE, "Unable to release handle");
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // UniqueHandle::reset
+    //! Destroy the existing handle and assume ownership of another
+    //!
+    //! \param[in] h - Native handle and allocation type
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void reset(value_t h) noexcept
+    {
+      destroy(Value);
+      Value = h;
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::operator ==
+  //! Non-member native handle equality operator
+  //!
+  //! \param[in] nh - Native handle
+  //! \param[in] const& uh - Unique handle
+  //! \return bool - True iff handles are equal
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename NATIVE, typename ALLOCATOR>
+  bool operator == (NATIVE nh, const UniqueHandle<NATIVE,ALLOCATOR>& uh)
+  {
+    return uh == nh;    // Delegate to member operator
+  }
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  // wtl::operator !=
+  //! Non-member native handle inequality operator
+  //!
+  //! \param[in] nh - Native handle
+  //! \param[in] const& uh - Unique handle
+  //! \return bool - True iff handles are unequal
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename NATIVE, typename ALLOCATOR>
+  bool operator != (NATIVE nh, const UniqueHandle<NATIVE,ALLOCATOR>& uh)
+  {
+    return uh != nh;    // Delegate to member operator
+  }
+
+} // WTL namespace
+
+#endif // WTL_UNIQUE_HANDLE_HPP
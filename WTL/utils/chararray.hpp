@@ -712,7 +712,7 @@ namespace wtl
       }
       
       // Failed: Insufficient length
-      if (n >= this->length) {
+      if (static_cast<uint32_t>(n) >= this->length) {
         clear();
         throw length_error(HERE, "Insufficient space to format string");
       }
@@ -929,6 +929,7 @@ namespace wtl
     return c << str.template translate<default_encoding<CHAR>::value>();
   }
 
+#ifndef WTL_PORTABLE
   /////////////////////////////////////////////////////////////////////////////////////////
   //! \struct LastErrorString - Encapsulates the string representation of ::GetLastError()
   //!
@@ -974,6 +975,7 @@ namespace wtl
 
     // ----------------------------------- MUTATOR METHODS ----------------------------------
   };
+#endif // WTL_PORTABLE
 
 } // WTL namespace
 
@@ -10,10 +10,11 @@
 
 #include <wtl/WTL.hpp>
 #include <wtl/traits/EncodingTraits.hpp>                          //!< Encoding
-#include <wtl/traits/WindowTraits.hpp>                            //!< HWnd
+#include <wtl/traits/windowtraits.hpp>                            //!< HWnd
 #include <wtl/utils/Exception.hpp>                                //!< exception
 #include <wtl/utils/Handle.hpp>                                   //!< Handle
 #include <wtl/windows/WindowId.hpp>                               //!< WindowId
+#include <vector>                                                 //!< std::vector
 
 //! \namespace wtl - Windows template library
 namespace wtl 
@@ -75,7 +76,7 @@ namespace wtl
     bool contains(IDENT id) const
     {
       // Lookup child window
-      return this->Collection.find(static_cast<ident_t>(id)) != this->Collection.end();
+      return this->Collection.contains(static_cast<ident_t>(id));
     }
     
     /////////////////////////////////////////////////////////////////////////////////////////
@@ -95,11 +96,10 @@ namespace wtl
     CTRL& find(IDENT id) const
     {
       // Lookup child window
-      auto pos = this->Collection.find(static_cast<ident_t>(id));
-      if (pos != this->Collection.end())
+      if (window_t* wnd = this->Collection.find(static_cast<ident_t>(id)))
       {
         // [FOUND] Convert & return
-        if (CTRL* ctrl = dynamic_cast<CTRL*>(pos->second))
+        if (CTRL* ctrl = dynamic_cast<CTRL*>(wnd))
           return *ctrl;
 
         // [ERROR] Incorrect window type
@@ -125,9 +125,8 @@ namespace wtl
     window_t* operator[](IDENT id) const
     {
       // Lookup child window
-      auto pos = this->Collection.find(static_cast<ident_t>(id));
-      if (pos != this->Collection.end())
-        return pos->second;
+      if (window_t* wnd = this->Collection.find(static_cast<ident_t>(id)))
+        return wnd;
 
       // [ERROR] Unable to find child window
       throw logic_error(HERE, "Child window not found");
@@ -158,7 +157,7 @@ namespace wtl
       child.Handle = HWnd(child.wndclass(), &child, Owner.handle(), child.Ident, child.Style, child.StyleEx, child.Text(), child.Position, child.Size);
 
       // Insert into collection iff successful
-      this->Collection[child.Ident] = &child;
+      this->Collection.insert(child.Ident(), &child);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////
@@ -169,17 +168,17 @@ namespace wtl
     /////////////////////////////////////////////////////////////////////////////////////////
     void clear()
     {
-      // Lookup first/last
-      typename collection_t::iterator pos = this->Collection.begin(), 
-                                      last = this->Collection.end();
+      std::vector<window_t*> children;
+
+      // Enumerate child windows
+      children.reserve(this->Collection.size());
+      this->Collection.forEach([&children] (window_t* wnd) { children.push_back(wnd); });
 
       // Remove and destroy each child window individually
-      while (pos != last)
+      for (window_t* wnd : children)
       {
-        window_t* wnd = pos->second;
-
         // Remove from collection before destroying
-        this->Collection.erase(pos++);
+        this->Collection.erase(wnd->Ident());
         wnd->destroy();
       }
     }
@@ -195,7 +194,7 @@ namespace wtl
     void remove(window_t& child)
     {
       // Remove from collection and then destroy
-      if (this->Collection.erase(child.Ident) > 0)
+      if (this->Collection.erase(child.Ident()))
         child.destroy();
       else
         // [ERROR] Unable to find child window
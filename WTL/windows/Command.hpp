@@ -10,11 +10,11 @@
 
 #include <wtl/WTL.hpp>
 #include <wtl/traits/EncodingTraits.hpp>          //!< Encoding
-#include <wtl/utils/CharArray.hpp>                //!< CharArray
+#include <wtl/utils/chararray.hpp>                //!< CharArray
 #include <wtl/windows/CommandId.hpp>             //!< CommandId
 #include <wtl/resources/ResourceId.hpp>            //!< ResourceId
 #include <wtl/resources/StringResource.hpp>       //!< StringResource
-#include <wtl/resources/IconResource.hpp>         //!< IconResource
+#include <wtl/resources/iconresource.hpp>         //!< IconResource
 #include <memory>                                 //!< std::shared_ptr
 #include <functional>                             //!< std::function
 
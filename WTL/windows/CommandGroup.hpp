@@ -10,12 +10,17 @@
 
 #include <wtl/WTL.hpp>
 #include <wtl/windows/Command.hpp>          //!< Command
+#include <wtl/windows/CommandIndex.hpp>     //!< CommandIndex
 #include <map>                             //!< std::map
 #include <memory>                          //!< std::shared_ptr
 
 //! \namespace wtl - Windows template library
 namespace wtl 
 {
+  // Forward declaration
+  template <Encoding ENC>
+  struct CommandGroupCollection;
+
   /////////////////////////////////////////////////////////////////////////////////////////
   //! \struct CommandGroup - Provides a collection of Gui Commands, indexed by Command Id
   //! 
@@ -45,15 +50,22 @@ namespace wtl
     //! \var encoding - Define window character encoding
     static constexpr Encoding encoding = ENC;
   
+    //! \alias index_t - Define command index type
+    using index_t = CommandIndex<ENC,type>;
+
   protected:
     //! \using decoder_t - Name/description string decoder type
     using decoder_t = typename Command<encoding>::NameDecoder;
 
+    //! Grant access to command index
+    friend struct CommandGroupCollection<ENC>;
+
     // ----------------------------------- REPRESENTATION -----------------------------------
   protected:
     CommandGroupId  Ident;        //!< Command Id
     decoder_t       Decoder;      //!< Name + Description
     icon_t          Icon;         //!< Command Icon
+    index_t*        Index;        //!< Index of owning collection, if any  (Maintained as commands are added/removed)
     
     // ------------------------------------ CONSTRUCTION ------------------------------------
   public:
@@ -65,7 +77,8 @@ namespace wtl
     /////////////////////////////////////////////////////////////////////////////////////////
     CommandGroup(CommandGroupId id) : Ident(id),
                                       Decoder(resource_id(id)),
-                                      Icon(resource_id(id))
+                                      Icon(resource_id(id)),
+                                      Index(nullptr)
     {}
 
     /////////////////////////////////////////////////////////////////////////////////////////
@@ -84,9 +97,22 @@ namespace wtl
     
 	  // -------------------------------- COPY, MOVE & DESTROY --------------------------------
   public:
-    ENABLE_COPY(CommandGroup);      //!< Can be shallow copied
-    ENABLE_MOVE(CommandGroup);      //!< Can be moved
-    ENABLE_POLY(CommandGroup);      //!< Can be polymorphic
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CommandGroup::CommandGroup
+    //! Create shallow copy of a group, which does not belong to any collection
+    //! 
+    //! \param[in] const& r - Another group
+    /////////////////////////////////////////////////////////////////////////////////////////
+    CommandGroup(const CommandGroup& r) : base(r),
+                                          Ident(r.Ident),
+                                          Decoder(r.Decoder),
+                                          Icon(r.Icon),
+                                          Index(nullptr)
+    {}
+
+    DISABLE_COPY_ASSIGN(CommandGroup);    //!< Cannot be copy-assigned  (Would invalidate index of owning collection)
+    DISABLE_MOVE(CommandGroup);           //!< Cannot be moved  (Would invalidate index of owning collection)
+    ENABLE_POLY(CommandGroup);            //!< Can be polymorphic
 
     // ----------------------------------- STATIC METHODS -----------------------------------
 
@@ -157,15 +183,37 @@ namespace wtl
 
     /////////////////////////////////////////////////////////////////////////////////////////
     // CommandGroup::operator +=
-    //! Add an command to the group
+    //! Add a command to the group, replacing any command with the same identifier
     //!
     //! \param[in] *cmd - Command
     //! \return CommandGroup& - Reference to self
     /////////////////////////////////////////////////////////////////////////////////////////
     CommandGroup& operator += (command_t* cmd)
     {
-      // Insert/overwrite
-      this->emplace(cmd->ident(), CommandPtr<encoding>(cmd));
+      auto& existing = (*this)[cmd->ident()];
+
+      // Insert/overwrite  (Unless already present)
+      if (existing.get() != cmd)
+        existing.reset(cmd);
+
+      // [INDEXED] Update index of owning collection
+      if (Index)
+        Index->insert(existing, this);
+      return *this;
+    }
+    
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CommandGroup::operator -=
+    //! Remove a command from the group
+    //!
+    //! \param[in] id - Command id
+    //! \return CommandGroup& - Reference to self
+    /////////////////////////////////////////////////////////////////////////////////////////
+    CommandGroup& operator -= (CommandId id)
+    {
+      // [INDEXED] Update index of owning collection
+      if (base::erase(id) && Index)
+        Index->erase(id, this);
       return *this;
     }
   };
@@ -201,31 +249,61 @@ namespace wtl
     //! \var encoding - Define window character encoding
     static constexpr Encoding encoding = ENC;
 
-    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+    //! \alias group_t - Define command group type
+    using group_t = CommandGroup<ENC>;
+
+  protected:
+    //! \alias index_t - Define command index type
+    using index_t = typename group_t::index_t;
+    
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    index_t   Index;        //!< Commands of every group, indexed by Command Id  (Groups must be added/removed via '+=' and '-=')
 
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CommandGroupCollection::CommandGroupCollection
+    //! Create empty collection
+    /////////////////////////////////////////////////////////////////////////////////////////
+    CommandGroupCollection() = default;
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(CommandGroupCollection);     //!< Cannot be copied  (Groups reference the index of their collection)
+    DISABLE_MOVE(CommandGroupCollection);     //!< Cannot be moved  (Groups reference the index of their collection)
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
     /////////////////////////////////////////////////////////////////////////////////////////
     // CommandGroupCollection::find const
-    //! Recursively searches each group for a command
+    //! Searches every group for a command
     //! 
     //! \param[in] id - Command identifier
     //! \return CommandPtr<ENC> - Shared Command pointer, possibly empty
     /////////////////////////////////////////////////////////////////////////////////////////
     CommandPtr<encoding>  find(CommandId id) const 
     {
-      // Lookup command
-      for (const auto& group : *this)
-        if (auto cmd = group.second->find(id))
-          return cmd;
-
-      // [NOT FOUND] Return empty pointer
-      return CommandPtr<encoding>(nullptr);
+      return Index.find(id);
+    }
+    
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CommandGroupCollection::group const
+    //! Find the group containing a command
+    //! 
+    //! \param[in] id - Command identifier
+    //! \return const group_t* - Command group, or nullptr if not found
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const group_t*  group(CommandId id) const 
+    {
+      return Index.owner(id);
     }
 
     // ----------------------------------- MUTATOR METHODS ----------------------------------
-      
+  public:
     /////////////////////////////////////////////////////////////////////////////////////////
     // CommandGroupCollection::operator +=
-    //! Add a group to the collection
+    //! Add a group to the collection, replacing any group with the same identifier
     //!
     //! \param[in] *group - Command group
     //! \return CommandGroupCollection& - Reference to self
@@ -236,10 +314,55 @@ namespace wtl
     {
       REQUIRED_PARAM(group);
 
-      // Insert/overwrite
-      this->emplace(group->ident(), CommandGroupPtr<encoding>(group));
+      auto& existing = (*this)[group->ident()];
+
+      // [OVERWRITE] Remove commands of replaced group from index
+      if (existing && existing.get() != group)
+        unindex(*existing);
+
+      // Insert/overwrite  (Unless already present)
+      if (existing.get() != group)
+        existing.reset(group);
+      
+      // Index commands, and any subsequently added to the group
+      existing->Index = &Index;
+      for (const auto& cmd : *existing)
+        Index.insert(cmd.second, existing.get());
       return *this;
     }
+      
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CommandGroupCollection::operator -=
+    //! Remove a group from the collection
+    //!
+    //! \param[in] id - Group identifier
+    //! \return CommandGroupCollection& - Reference to self
+    /////////////////////////////////////////////////////////////////////////////////////////
+    CommandGroupCollection& operator -= (CommandGroupId id)
+    {
+      auto pos = base::find(id);
+      if (pos != base::end())
+      {
+        // Remove commands from index
+        unindex(*pos->second);
+        base::erase(pos);
+      }
+      return *this;
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CommandGroupCollection::unindex
+    //! Removes the commands of a group from the index, and detaches the group from the collection
+    //!
+    //! \param[in,out] &group - Command group
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  unindex(group_t& group)
+    {
+      for (const auto& cmd : group)
+        Index.erase(cmd.first, &group);
+      group.Index = nullptr;
+    }
   };
 } // namespace wtl
 
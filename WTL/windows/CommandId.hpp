@@ -11,6 +11,7 @@
 #include <wtl/WTL.hpp>
 #include <wtl/traits/EnumTraits.hpp>
 #include <wtl/casts/EnumCast.hpp>
+#include <wtl/utils/Default.hpp>
 #include <wtl/Resource.h>
 #include <type_traits>
 
@@ -0,0 +1,218 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\windows\CommandIndex.hpp
+//! \brief Provides constant-time lookup of Gui Commands, and their owners, by Command Id
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_COMMAND_INDEX_HPP
+#define WTL_COMMAND_INDEX_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/casts/EnumCast.hpp>                   //!< enum_cast
+#include <wtl/utils/Exception.hpp>                  //!< invalid_argument
+#include <wtl/traits/EncodingTraits.hpp>            //!< Encoding
+#include <wtl/windows/CommandId.hpp>                //!< CommandId
+#include <array>                                    //!< std::array
+#include <memory>                                   //!< std::unique_ptr
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  // Forward declaration
+  template <Encoding ENC>
+  struct Command;
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct CommandIndex - Maps every Command Id to a command and the object which owns it (eg. its group or popup menu)
+  //!
+  //! \tparam ENC - Command character encoding
+  //! \tparam OWNER - Owner type
+  //! \tparam COMMAND - [optional] Command type  (Any type providing ident())
+  //!
+  //! \remarks Entries are stored in 256 pages of 256 entries, indexed by the high and low bytes of the Command Id.
+  //! \remarks Pages are allocated upon first use, so that the conventional 0xE100-based Ids do not require a full-size table.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <Encoding ENC, typename OWNER, typename COMMAND = Command<ENC>>
+  struct CommandIndex
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = CommandIndex<ENC,OWNER,COMMAND>;
+
+    //! \alias command_ptr - Define shared command pointer type
+    using command_ptr = std::shared_ptr<COMMAND>;
+
+    //! \alias owner_t - Define owner type
+    using owner_t = OWNER;
+
+    //! \var encoding - Define command character encoding
+    static constexpr Encoding encoding = ENC;
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \struct Entry - Command and owner
+    /////////////////////////////////////////////////////////////////////////////////////////
+    struct Entry
+    {
+      command_ptr      Command;      //!< Shared command, possibly empty
+      const OWNER*     Owner;        //!< Owner, possibly nullptr
+    };
+
+    //! \alias page_t - Define page type
+    using page_t = std::array<Entry,256>;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::array<std::unique_ptr<page_t>,256>  Pages;     //!< Pages indexed by high byte of Command Id
+    uint32_t                                 Count;     //!< Number of commands
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CommandIndex::CommandIndex
+    //! Create empty index
+    /////////////////////////////////////////////////////////////////////////////////////////
+    CommandIndex() : Count(0)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(CommandIndex);      //!< Cannot be copied
+    ENABLE_MOVE(CommandIndex);       //!< Can be moved
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CommandIndex::find const
+    //! Find a command
+    //!
+    //! \param[in] id - Command Id
+    //! \return command_ptr - Shared command pointer, possibly empty
+    /////////////////////////////////////////////////////////////////////////////////////////
+    command_ptr  find(CommandId id) const
+    {
+      if (const Entry* e = entry(id))
+        return e->Command;
+
+      // [NOT FOUND] Return empty pointer
+      return command_ptr(nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CommandIndex::owner const
+    //! Find the owner of a command
+    //!
+    //! \param[in] id - Command Id
+    //! \return const owner_t* - Owner, or nullptr if not found
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const owner_t*  owner(CommandId id) const
+    {
+      if (const Entry* e = entry(id))
+        return e->Owner;
+
+      // [NOT FOUND] Return nullptr
+      return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CommandIndex::size const
+    //! Get the number of commands
+    //!
+    //! \return uint32_t - Number of commands
+    /////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t  size() const
+    {
+      return Count;
+    }
+
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CommandIndex::entry const
+    //! Lookup the entry of a command
+    //!
+    //! \param[in] id - Command Id
+    //! \return const Entry* - Entry, or nullptr if not present
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const Entry*  entry(CommandId id) const
+    {
+      uint16_t const value = enum_cast(id);
+
+      // Lookup page, then entry
+      if (const page_t* page = Pages[value >> 8].get())
+        if ((*page)[value & 0xff].Command)
+          return &(*page)[value & 0xff];
+
+      return nullptr;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CommandIndex::clear
+    //! Removes all commands
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  clear()
+    {
+      for (auto& page : Pages)
+        page.reset();
+      Count = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CommandIndex::erase
+    //! Removes a command, provided it belongs to a specified owner
+    //!
+    //! \param[in] id - Command Id
+    //! \param[in] const* owner - Owner of command  (Commands indexed by another owner are unaffected)
+    //! \return bool - True if removed
+    /////////////////////////////////////////////////////////////////////////////////////////
+    bool  erase(CommandId id, const owner_t* owner)
+    {
+      Entry* e = const_cast<Entry*>(entry(id));
+
+      // [OWNED] Remove command
+      if (e && e->Owner == owner)
+      {
+        e->Command.reset();
+        e->Owner = nullptr;
+        --Count;
+        return true;
+      }
+
+      return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // CommandIndex::insert
+    //! Inserts or overwrites a command
+    //!
+    //! \param[in] const& cmd - Shared command
+    //! \param[in] const* owner - Owner of command
+    //!
+    //! \throw wtl::invalid_argument - [Debug only] Missing command
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  insert(const command_ptr& cmd, const owner_t* owner)
+    {
+      REQUIRED_PARAM(cmd);
+
+      uint16_t const value = enum_cast(cmd->ident());
+
+      // [NEW PAGE] Allocate upon first use
+      auto& page = Pages[value >> 8];
+      if (!page)
+        page.reset(new page_t());
+
+      // Insert/overwrite
+      Entry& e = (*page)[value & 0xff];
+      if (!e.Command)
+        ++Count;
+      e.Command = cmd;
+      e.Owner = owner;
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_COMMAND_INDEX_HPP
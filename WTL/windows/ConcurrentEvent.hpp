@@ -0,0 +1,292 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//! \file wtl\windows\ConcurrentEvent.hpp
+//! \brief Provides an observeable event that may be raised and subscribed from any thread
+//! \date 16 October 2026
+//! \author Nick Crowley
+//! \copyright Nick Crowley. All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_CONCURRENT_EVENT_HPP
+#define WTL_CONCURRENT_EVENT_HPP
+
+#include <wtl/WTL.hpp>
+#include <wtl/casts/OpaqueCast.hpp>           //!< OpaqueCast
+#include <wtl/threads/EpochDomain.hpp>        //!< EpochDomain, EpochGuard
+#include <wtl/windows/Delegate.hpp>           //!< Delegate
+#include <wtl/windows/event.hpp>              //!< handler_t
+#include <algorithm>                          //!< std::none_of, std::remove_copy_if
+#include <iterator>                           //!< std::back_inserter
+#include <tuple>                              //!< std::tuple
+#include <utility>                            //!< std::tuple_element
+#include <memory>                             //!< std::shared_ptr
+#include <vector>                             //!< std::vector
+#include <atomic>                             //!< std::atomic
+#include <mutex>                              //!< std::mutex
+#include <type_traits>                        //!< std::is_void
+
+//! \namespace wtl - Windows template library
+namespace wtl
+{
+  /////////////////////////////////////////////////////////////////////////////////////////
+  //! \struct ConcurrentEvent - Provides an observeable event with multiple subscribers which can be raised,
+  //!  subscribed and unsubscribed concurrently from any number of threads
+  //!
+  //! \tparam RET - [optional] Handler function return type (If unspecified, no return)
+  //! \tparam ARGS... - [optional] Handler function signature (If unspecified, no arguments)
+  //!
+  //! \remarks Subscribers are stored in an immutable array published through an atomic pointer. Subscribing and
+  //! \remarks unsubscribing publish a modified copy; raising reads the current array without taking any lock,
+  //! \remarks and superseded arrays are reclaimed through an epoch domain once no raiser can still observe them.
+  //!
+  //! \remarks Unsubscribing waits for concurrent raisers to finish with the delegate, then destroys it. Handlers
+  //! \remarks execute upon the raising thread and may safely unsubscribe themselves; such delegates are destroyed
+  //! \remarks once the read sections observing them have ended.
+  /////////////////////////////////////////////////////////////////////////////////////////
+  template <typename RET = void, typename... ARGS>
+  struct ConcurrentEvent
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    //! \alias argument_t - Delegate argument type accessor
+    //!
+    //! \tparam IDX - Zero-based argument index
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <unsigned IDX>
+    using argument_t = typename std::tuple_element<IDX, std::tuple<ARGS...>>::type;
+
+    //! \alias delegate_t - Define delegate type
+    using delegate_t = Delegate<RET,ARGS...>;
+
+    //! \alias result_t - Define delegate return type
+    using result_t = RET;
+
+    //! \alias signature_t - Define delegate signature
+    using signature_t = result_t (ARGS...);
+
+    //! \var arguments - Number of arguments
+    static constexpr uint32_t  arguments = sizeof...(ARGS);
+
+  protected:
+    //! \alias storage_t - Define delegate storage type
+    using storage_t = std::shared_ptr<delegate_t>;
+
+    //! \alias snapshot_t - Define immutable subscriber array type
+    using snapshot_t = std::vector<storage_t>;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  protected:
+    std::atomic<const snapshot_t*>  Subscribers;      //!< Current subscribers (delegates to handler functions), if any
+    std::mutex                      WriteLock;        //!< Serializes subscribers
+    EpochDomain&                    Domain;           //!< Reclaims superseded subscriber arrays
+
+    // ------------------------------------ CONSTRUCTION ------------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConcurrentEvent::ConcurrentEvent
+    //! Create event with no subscribers
+    //!
+    //! \param[in,out] &domain - [optional] Epoch domain used to reclaim subscriber arrays (Default is shared domain)
+    /////////////////////////////////////////////////////////////////////////////////////////
+    explicit ConcurrentEvent(EpochDomain& domain = EpochDomain::shared()) : Subscribers(nullptr), Domain(domain)
+    {}
+
+    // -------------------------------- COPY, MOVE & DESTROY --------------------------------
+  public:
+    DISABLE_COPY(ConcurrentEvent);      //!< Cannot be copied
+    DISABLE_MOVE(ConcurrentEvent);      //!< Cannot be moved
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConcurrentEvent::~ConcurrentEvent
+    //! Retires the subscriber array and destroys the delegates
+    /////////////////////////////////////////////////////////////////////////////////////////
+    virtual ~ConcurrentEvent()
+    {
+      Domain.retire(const_cast<snapshot_t*>(Subscribers.exchange(nullptr)));
+      Domain.synchronize();
+    }
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConcurrentEvent::empty() const
+    //! Query whether event has any subscribers
+    //!
+    //! \return bool - True iff event has no subscribers
+    //////////////////////////////////////////////////////////////////////////////////////////
+    bool empty() const
+    {
+      return Subscribers.load(std::memory_order_acquire) == nullptr;
+    }
+
+  private:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConcurrentEvent::invoke() const
+    //! Raises the event, notifying each subscriber in the order in which they subscribed
+    //!
+    //! \tparam CALL_ARGS... - Argument types provided when raised
+    //!
+    //! \param[in] - Tag indicating whether handlers return void
+    //! \param[in] const& subscribers - Subscribers snapshot
+    //! \param[in] &&... args - [optional] Arguments for event handler
+    //! \return result_t - Result of call to final subscriber. If no subscribers then a default constructed 'result_t'
+    //!
+    //! \remarks This overload is selected if the event handler has a return type other than void
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... CALL_ARGS>
+    result_t invoke(std::false_type, const snapshot_t& subscribers, CALL_ARGS&&... args) const
+    {
+      result_t r(defvalue<result_t>());
+
+      // Forward arguments to each subscriber
+      for (auto& fn : subscribers)
+        r = (*fn)(std::forward<CALL_ARGS>(args)...);
+
+      // Return result
+      return r;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConcurrentEvent::invoke() const
+    //! Raises the event, notifying each subscriber in the order in which they subscribed
+    //!
+    //! \tparam CALL_ARGS... - Argument types provided when raised
+    //!
+    //! \param[in] - Tag indicating whether handlers return void
+    //! \param[in] const& subscribers - Subscribers snapshot
+    //! \param[in] &&... args - [optional] Arguments for event handler
+    //!
+    //! \remarks This overload is selected if the event handler has no return type
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... CALL_ARGS>
+    void invoke(std::true_type, const snapshot_t& subscribers, CALL_ARGS&&... args) const
+    {
+      // Forward arguments to each subscriber
+      for (auto& fn : subscribers)
+        (*fn)(std::forward<CALL_ARGS>(args)...);
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConcurrentEvent::clear
+    //! Removes all subscribers
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void clear()
+    {
+      {
+        std::lock_guard<std::mutex> guard(WriteLock);
+
+        // Unpublish current subscribers
+        publish(nullptr);
+      }
+
+      // Destroy delegates once raisers have finished with them
+      Domain.synchronize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConcurrentEvent::raise()
+    //! Raises the event, notifying each subscriber in the order in which they had subscribed when raised
+    //!
+    //! \tparam CALL_ARGS... - Argument types provided when raised
+    //!
+    //! \param[in] &&... args - [optional] Arguments for event handler
+    //! \return result_t - [Returns value] Result of call to final subscriber. If no subscribers then a default constructed 'result_t'
+    //!                    [Returns void] Nothing
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename... CALL_ARGS>
+    result_t raise(CALL_ARGS&&... args)
+    {
+      static const snapshot_t none;
+      EpochGuard  section(Domain);
+
+      // Snapshot remains valid until the read section ends
+      const snapshot_t* subscribers = Subscribers.load(std::memory_order_seq_cst);
+
+      // Forward arguments to each subscriber, and capture return value (iff function signature has a return type)
+      return invoke(std::is_void<result_t>(), subscribers ? *subscribers : none, std::forward<CALL_ARGS>(args)...);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConcurrentEvent::operator +=
+    //! Adds a subscriber to the collection. Also ensures it possesses the correct signature.
+    //!
+    //! \tparam DGT_RET - Delegate return type
+    //! \tparam DGT_ARGS... - [optional] Delegate argument types
+    //!
+    //! \param[in] *ptr - Pointer to subscriber (Transfers ownership to the event)
+    //! \return LPARAM - Unique subscriber identifier
+    /////////////////////////////////////////////////////////////////////////////////////////
+    template <typename DGT_RET, typename... DGT_ARGS>
+    LPARAM operator += (Delegate<DGT_RET,DGT_ARGS...>* ptr)
+    {
+      concept_check(DGT_RET (DGT_ARGS...),MatchingSignature<signature_t>);
+
+      std::lock_guard<std::mutex> guard(WriteLock);
+      const snapshot_t* current = Subscribers.load(std::memory_order_relaxed);
+
+      // Publish copy with new subscriber appended
+      snapshot_t* next = current ? new snapshot_t(*current) : new snapshot_t();
+      next->emplace_back(ptr);
+      publish(next);
+
+      // Return address as cookie
+      return opaque_cast(ptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConcurrentEvent::operator -=
+    //! Removes a subscriber from the collection
+    //!
+    //! \param[in] cookie - Unique subscriber identifier
+    //!
+    //! \remarks Waits for raisers that may still invoke the delegate then destroys it. When called from a handler,
+    //! \remarks the delegate is destroyed once the read sections observing it have ended.
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void operator -= (LPARAM cookie)
+    {
+      auto findByAddress = [cookie] (const storage_t& ptr) { return ptr.get() == opaque_cast<delegate_t>(cookie); };
+
+      {
+        std::lock_guard<std::mutex> guard(WriteLock);
+        const snapshot_t* current = Subscribers.load(std::memory_order_relaxed);
+
+        // [NOT FOUND] Nothing to publish
+        if (!current || std::none_of(current->begin(), current->end(), findByAddress))
+          return;
+
+        // Publish copy without subscriber (or nothing if none remain)
+        snapshot_t* next = new snapshot_t();
+        std::remove_copy_if(current->begin(), current->end(), std::back_inserter(*next), findByAddress);
+        if (next->empty())
+        {
+          delete next;
+          next = nullptr;
+        }
+        publish(next);
+      }
+
+      // Destroy delegate once raisers have finished with it  (Outside the lock; handlers may subscribe)
+      Domain.synchronize();
+    }
+
+  private:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ConcurrentEvent::publish
+    //! Publishes a new subscriber array and retires the previous array
+    //!
+    //! \param[in] *next - Subscriber array, possibly nullptr (Transfers ownership to the event)
+    //!
+    //! \remarks Caller must hold 'WriteLock'
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void publish(snapshot_t* next)
+    {
+      Domain.retire(const_cast<snapshot_t*>(Subscribers.exchange(next, std::memory_order_seq_cst)));
+    }
+  };
+
+} // namespace wtl
+
+#endif // WTL_CONCURRENT_EVENT_HPP
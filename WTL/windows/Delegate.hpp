@@ -9,6 +9,8 @@
 #define WTL_EVENT_DELEGATE_HPP
 
 #include <wtl/WTL.hpp>
+#include <wtl/utils/Requires.hpp>     //!< concept_check
+#include <wtl/utils/SFINAE.hpp>       //!< enable_if_same_t
 #include <functional>             //!< std::function, std::bind, std::placeholders
 
 //! \namespace wtl - Windows template library
@@ -9,7 +9,7 @@
 #define WTL_EVENT_MESSAGE_HPP
 
 #include <wtl/WTL.hpp>
-#include <wtl/windows/Event.hpp>                        //!< Event
+#include <wtl/windows/event.hpp>                        //!< Event
 #include <wtl/resources/ResourceId.hpp>                 //!< ResourceId
 #include <wtl/platform/WindowMessage.hpp>               //!< WindowMessage
 #include <wtl/traits/EncodingTraits.hpp>                //!< Encoding
@@ -13,14 +13,18 @@
 #include <wtl/casts/EnumCast.hpp>                                 //!< enum_cast
 #include <wtl/casts/OpaqueCast.hpp>                               //!< opaque_cast
 #include <wtl/traits/EncodingTraits.hpp>                          //!< Encoding
-#include <wtl/traits/WindowTraits.hpp>                            //!< HWnd
+#include <wtl/traits/windowtraits.hpp>                            //!< HWnd
 #include <wtl/utils/Exception.hpp>                                //!< exception
 #include <wtl/utils/Default.hpp>                                  //!< defvalue
+#if DISPATCH_TRACING
+  #include <wtl/utils/DispatchTrace.hpp>                          //!< TraceScope
+#endif
 #include <wtl/utils/ScopeGuard.hpp>                               //!< ScopeGuard
 #include <wtl/utils/SFINAE.hpp>                                   //!< enable_if_numeric_t
 #include <wtl/utils/Zero.hpp>                                     //!< zero
 #include <wtl/io/Console.hpp>                                     //!< Console
 #include <wtl/resources/ResourceId.hpp>                           //!< ResourceId
+#include <wtl/gdi/PaintBuffer.hpp>                                //!< PaintBuffer
 #include <wtl/platform/WindowFlags.hpp>                           //!< WindowStyle
 #include <wtl/platform/CommonApi.hpp>                             //!< send_message
 #include <wtl/platform/WindowMessage.hpp>                         //!< WindowMesssage
@@ -68,6 +72,7 @@
 #include <wtl/windows/properties/TextProperty.h>                  //!< TextProperty
 #include <wtl/windows/properties/TextLengthProperty.h>            //!< TextLengthProperty
 #include <wtl/windows/properties/VisibilityProperty.h>            //!< VisibilityProperty
+#include <memory>                                                 //!< std::unique_ptr
 
 //! \namespace wtl - Windows template library
 namespace wtl 
@@ -174,6 +179,7 @@ namespace wtl
   protected:
     HWnd                            Handle;         //!< Window handle
     SubClassCollection<encoding>    SubClasses;     //!< Sub-classed windows collection
+    std::unique_ptr<PaintBuffer>    Buffer;         //!< Retains previous frame, if double-buffered
 
   private:
     bool                            IsMouseOver;    //!< True iff mouse is over the window while window has keyboard focus
@@ -239,9 +245,8 @@ namespace wtl
       if (::HWND focus = ::GetFocus())
       {
         // Lookup & return window
-        auto wnd = ActiveWindows.find(focus);
-        if (wnd != ActiveWindows.end())
-          return wnd->second;
+        if (Window<encoding>* wnd = ActiveWindows.find(focus))
+          return wnd;
         
         // [FAILED] Native window
         throw domain_error(HERE, "Input focus belongs to native window");
@@ -273,6 +278,8 @@ namespace wtl
           Window<encoding>::ActiveWindows.erase(hWnd);
       };
  
+      TRACE_SCOPE(WndProc, message);
+
       try
       {
         // Attempt to lookup window object 
@@ -295,14 +302,17 @@ namespace wtl
           wnd->Handle = HWnd(hWnd, AllocType::WeakRef);    // Overwritten by strong reference returned from ::CreateWindow over message is processed
 
           // Add to 'Active Windows' collection
-          type::ActiveWindows[hWnd] = wnd;
+          type::ActiveWindows.insert(hWnd, wnd);
           break;
 
         // [REMAINDER] Lookup native handle from the 'Active Windows' collection
         default:
-          // Lookup window handle
-          if (type::ActiveWindows.find(hWnd) != type::ActiveWindows.end())
-            wnd = type::ActiveWindows[hWnd];
+          {
+            TRACE_SCOPE(Lookup, message);
+
+            // Lookup window handle
+            wnd = type::ActiveWindows.find(hWnd);
+          }
           break;
         }
         
@@ -399,9 +409,8 @@ namespace wtl
       if (::HWND wnd = ::GetParent(Handle))
       {
         // Lookup window in 'Active Windows' collection
-        auto pos = ActiveWindows.find(wnd);
-        if (pos != ActiveWindows.end())
-          return pos->second;
+        if (Window<encoding>* window = ActiveWindows.find(wnd))
+          return window;
 
         // [ERROR] Parent is native window
         throw domain_error(HERE, "Parent is native window");
@@ -553,6 +562,22 @@ namespace wtl
       }
     }
     
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // Window::buffer
+    //! Enables or disables double-buffered painting
+    //! 
+    //! \param[in] enable - Whether to record each paint, and repaint only what changed since the previous
+    //!
+    //! \remarks The skin must draw the entire client area using operations which can be recorded
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  buffer(bool enable)
+    {
+      if (!enable)
+        Buffer.reset();
+      else if (!Buffer)
+        Buffer.reset(new PaintBuffer());
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////
     // Window::execute
     //! Executes an Command, adding it to the commands queue
@@ -669,6 +694,8 @@ namespace wtl
     /////////////////////////////////////////////////////////////////////////////////////////
     virtual LResult route(WindowMessage message, ::WPARAM w, ::LPARAM l)
     {
+      TRACE_SCOPE(Route, enum_cast(message));
+
       try
       {
         LResult ret;       //!< Message result, defaults to unhandled
@@ -751,6 +778,14 @@ namespace wtl
         case WindowMessage::CtrlColourListbox:    ret = ColourizeEventArgs<encoding,WindowMessage::CtrlColourListbox>(w,l).reflect();    break;
         case WindowMessage::CtrlColourScrollbar:  ret = ColourizeEventArgs<encoding,WindowMessage::CtrlColourScrollbar>(w,l).reflect();  break;
         case WindowMessage::CtrlColourStatic:     ret = ColourizeEventArgs<encoding,WindowMessage::CtrlColourStatic>(w,l).reflect();     break;
+
+        // [THEME] Discard cached visual styles  (Skin is emptied once upon next use, however many windows are notified. Leave unhandled so controls are also notified)
+        case WindowMessage::ThemeChanged:
+          if (skin_t* skin = SkinFactory<encoding>::get())
+            skin->invalidate();
+          if (Buffer)
+            Buffer->invalidate();
+          break;
         }
 
         // [UNHANDLED] Return result & routing
@@ -804,13 +839,22 @@ namespace wtl
     /////////////////////////////////////////////////////////////////////////////////////////
     // Window::onPaint
     //! Called to paint the client area of the window
-    //!  Default implementation delegates to the current skin
+    //!  Default implementation delegates to the current skin, via the paint buffer if double-buffered
     //! 
     //! \param[in,out] args - Message arguments containing drawing data
     //! \return LResult - Routing indicating message was handled
     /////////////////////////////////////////////////////////////////////////////////////////
     virtual LResult  onPaint(PaintWindowEventArgs<encoding>& args) 
     { 
+      // [BUFFERED] Record entire client area, then repaint only what changed
+      if (Buffer)
+      {
+        Buffer->paint(args.Graphics, ClientRect.get(), args.Rect, [this] (DeviceContext& dc, const RectL& rc) {
+          SkinFactory<encoding>::get()->draw(*this, dc, rc);
+        });
+        return {MsgRoute::Handled, 0};
+      }
+
       // Perform fallback drawing
       SkinFactory<encoding>::get()->draw(*this, args.Graphics, args.Rect);
 
@@ -11,10 +11,10 @@
 #include <wtl/WTL.hpp>
 #include <wtl/casts/EnumCast.hpp>                                 //!< enum_cast
 #include <wtl/traits/EncodingTraits.hpp>                          //!< Encoding
+#include <wtl/utils/FlatRegistry.hpp>                             //!< FlatRegistry
 #include <wtl/utils/List.hpp>                                     //!< List
 #include <wtl/utils/SFINAE.hpp>                                   //!< enable_if_numeric_t
 //#include <wtl/platform/WindowFlags.hpp>                           //!< WindowId
-#include <map>                                                    //!< std::map
 #include <type_traits>                                            //!< std::underlying_type_t
 
 //! \namespace wtl - Windows template library
@@ -61,7 +61,7 @@ namespace wtl
   //! \tparam ENC - Window character encoding
   /////////////////////////////////////////////////////////////////////////////////////////
   template <Encoding ENC>
-  using WindowHandleCollection = std::map<::HWND,Window<ENC>*>;
+  using WindowHandleCollection = FlatRegistry<::HWND,Window<ENC>>;
 
   /////////////////////////////////////////////////////////////////////////////////////////
   //! \alias WindowIdCollection - Provides an association between window Ids and Window objects
@@ -69,7 +69,7 @@ namespace wtl
   //! \tparam ENC - Window character encoding
   /////////////////////////////////////////////////////////////////////////////////////////
   template <Encoding ENC>
-  using WindowIdCollection = std::map<WindowId,Window<ENC>*>;
+  using WindowIdCollection = FlatRegistry<WindowId,Window<ENC>>;
   
   /////////////////////////////////////////////////////////////////////////////////////////
   //! wtl::window_id
@@ -21,6 +21,7 @@
 #include <wtl/windows/PopupMenu.hpp>                        //!< PopupMenu
 #include <wtl/windows/Command.hpp>                          //!< Command
 #include <wtl/windows/CommandGroup.hpp>                     //!< CommandGroup
+#include <wtl/windows/CommandIndex.hpp>                     //!< CommandIndex
 #include <wtl/windows/events/OwnerDrawMenuEvent.hpp>        //!< OwnerDrawEvent
 #include <wtl/windows/events/OwnerMeasureMenuEvent.hpp>     //!< OwnerMeasureEvent
 
@@ -56,6 +57,9 @@ namespace wtl
 
     //! \alias const_iterator - Immutable popup iterator
     using const_iterator = typename collection_t::const_iterator;
+
+    //! \alias index_t - Define command index type
+    using index_t = CommandIndex<ENC,popup_t>;
     
     // ----------------------------------- REPRESENTATION -----------------------------------
   public:
@@ -65,6 +69,7 @@ namespace wtl
   protected:
     HMenu         Handle;     //!< Menu handle
     collection_t  Popups;     //!< Popup menu collection
+    index_t       Commands;   //!< Commands of every popup menu, indexed by Command Id
     
     // ------------------------------------ CONSTRUCTION ------------------------------------
   public:
@@ -125,13 +130,7 @@ namespace wtl
     /////////////////////////////////////////////////////////////////////////////////////////
     CommandPtr<encoding> find(CommandId id) const
     {
-      // Search popups for a matching command
-      for (auto& popup : Popups)
-        if (auto cmd = popup.find(id))
-          return cmd;
-      
-      // [NOT FOUND] Return empty pointer
-      return CommandPtr<encoding>(nullptr);
+      return Commands.find(id);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////
@@ -163,6 +162,18 @@ namespace wtl
       return Handle;
     }
     
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // WindowMenu::popup const
+    //! Find the popup menu containing a command
+    //! 
+    //! \param[in] id - Command id
+    //! \return const popup_t* - Popup menu, or nullptr if not found
+    /////////////////////////////////////////////////////////////////////////////////////////
+    const popup_t*  popup(CommandId id) const
+    {
+      return Commands.owner(id);
+    }
+    
     /////////////////////////////////////////////////////////////////////////////////////////
     // WindowMenu::size const
     //! Get the number of pop-up menus
@@ -217,6 +228,42 @@ namespace wtl
       // Insert menu item 
       if (!WinAPI<encoding>::insertMenuItem(Handle, idx, True, &item))
         throw platform_error(HERE, "Unable to insert menu item");
+
+      // Index commands
+      for (const auto& cmd : *popup)
+        Commands.insert(cmd, &*popup);
+    }
+    
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // WindowMenu::remove
+    //! Removes the popup menu item containing the Commands of an CommandGroup 
+    //! 
+    //! \param[in] id - Group id
+    //! 
+    //! \throw wtl::logic_error - Popup menu not found
+    //! \throw wtl::platform_error - Unable to remove menu item
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void remove(CommandGroupId id)
+    {
+      int32_t idx = 0;
+
+      // Lookup popup and its position
+      auto pos = Popups.begin();
+      for (; pos != Popups.end() && pos->Group->ident() != id; ++pos)
+        ++idx;
+
+      // [ERROR] Unable to find popup
+      if (pos == Popups.end())
+        throw logic_error(HERE, "Popup menu not found");
+
+      // Remove menu item 
+      if (!::RemoveMenu(Handle, idx, MF_BYPOSITION))
+        throw platform_error(HERE, "Unable to remove menu item");
+
+      // Remove commands from index, then destroy popup
+      for (const auto& cmd : *pos)
+        Commands.erase(cmd->ident(), &*pos);
+      Popups.remove_if([id] (const popup_t& popup) { return popup.Group->ident() == id; });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////
@@ -11,6 +11,7 @@
 #include <wtl/WTL.hpp>
 #include <wtl/traits/EncodingTraits.hpp>        //!< Encoding
 #include <wtl/utils/Size.hpp>                   //!< SizeL
+#include <wtl/platform/DrawingFlags.hpp>        //!< OwnerDrawState
 
 /////////////////////////////////////////////////////////////////////////////////////////
 //! \namespace wtl - Windows template library
@@ -60,6 +61,9 @@ namespace wtl
     virtual void  draw(Edit<encoding>& chk, DeviceContext& dc, const RectL& rc) const = 0;
     virtual void  draw(Window<encoding>& wnd, DeviceContext& dc, const RectL& rc) const = 0;
 
+    //! Drawing items  (Virtual item models)
+    virtual void  draw(ComboBox<encoding>& cmb, DeviceContext& dc, const RectL& rc, uint32_t row, OwnerDrawState state) const = 0;
+
     //! Measuring
     virtual SizeL measure(Button<encoding>& btn, DeviceContext& dc) const = 0;
     virtual SizeL measure(CheckBox<encoding>& chk, DeviceContext& dc) const = 0;
@@ -68,6 +72,8 @@ namespace wtl
 
     // ----------------------------------- MUTATOR METHODS ----------------------------------
 
+    //! Invalidation  (Called by every window notified of a system theme change, so should be inexpensive)
+    virtual void  invalidate() {}
   };
 
   
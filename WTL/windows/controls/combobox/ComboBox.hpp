@@ -13,6 +13,7 @@
 #include <wtl/windows/controls/combobox/ComboBoxConstants.hpp>          //!< (Constants)
 #include <wtl/windows/controls/combobox/ComboBoxItemsCollection.hpp>    //!< ComboBoxItemsCollection
 #include <wtl/windows/controls/combobox/ComboBoxMinVisibleProperty.h>   //!< ComboBoxMinVisibleProperty
+#include <wtl/utils/ItemModel.hpp>                                      //!< ItemModel
 
 //! \namespace wtl - Windows template library
 namespace wtl 
@@ -36,8 +37,15 @@ namespace wtl
     //! \var encoding - Inherit character encoding
     static constexpr Encoding  encoding = base::encoding;
     
+    //! \alias model_t - Define virtual item model type
+    using model_t = ItemModel<encoding_char_t<encoding>>;
+
     // ----------------------------------- REPRESENTATION -----------------------------------
-    
+  protected:
+    model_t*                              Model;          //!< [optional] Virtual item model  (Not owned)
+    uint32_t                              Revision;       //!< Model revision last synchronised with the control
+
+  public:
     // Data
     ComboBoxItemsCollection<encoding>     Items;          //!< Items 
 
@@ -59,6 +67,8 @@ namespace wtl
     //! \throw wtl::platform_error - Unrecognised system window class
     /////////////////////////////////////////////////////////////////////////////////////////
     ComboBox(WindowId id) : base(id), 
+                            Model(nullptr),
+                            Revision(0),
                             Items(*this),
                             MinVisible(*this)
     {
@@ -118,9 +128,47 @@ namespace wtl
     }
         
     // ---------------------------------- ACCESSOR METHODS ----------------------------------			
-    
+  public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ComboBox::model const
+    //! Get the virtual item model
+    //! 
+    //! \return model_t* - Item model, or nullptr if items are stored by the control
+    /////////////////////////////////////////////////////////////////////////////////////////
+    model_t*  model() const
+    {
+      return Model;
+    }
+
     // ----------------------------------- MUTATOR METHODS ----------------------------------
   public:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ComboBox::model
+    //! Display items from a virtual item model instead of storing them in the control
+    //! 
+    //! \param[in] &model - Item model  (Must outlive the control)
+    //! 
+    //! \throw wtl::logic_error - Window already exists
+    //!
+    //! \remarks The control becomes fixed-height owner-draw without strings; rows are drawn on demand by the skin.
+    //! \remarks While attached, 'Items' may only be queried for its size; inserting, clearing or accessing items throws.
+    //!
+    //! \remarks Populating the control remains O(n) messages: unlike a list box (LBS_NODATA), a ComboBox cannot be
+    //! \remarks told its row count, so sync() adds one empty item per new row. Only changes which preserve the row
+    //! \remarks count (sorting, editing text) avoid per-row messages.
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  model(model_t& model)
+    {
+      // Ensure not yet created  (Owner-draw style cannot be changed afterwards)
+      if (this->exists())
+        throw logic_error(HERE, "Cannot attach an item model to an existing ComboBox");
+
+      Model = &model;
+      Revision = model.revision() - 1;
+      this->Style &= ~ComboBoxStyle::HasStrings;
+      this->Style |= ComboBoxStyle::OwnerDrawFixed;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////
     // ComboBox::send
     //! Sends a message to the window
@@ -149,6 +197,51 @@ namespace wtl
       return send_message<encoding>(CM, this->Handle, w, l);
     }
     
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ComboBox::sync
+    //! Synchronise the control with the rows of the item model, if changed
+    //! 
+    //! \throw wtl::logic_error - Window does not exist or no item model
+    //! \throw wtl::platform_error - Unable to resize list
+    //!
+    //! \remarks Only the change in the number of rows is sent to the control; items hold no data and are
+    //! \remarks redrawn from the model. Sorting costs a handful of messages, but adding or filtering rows costs
+    //! \remarks one message per row added to, or removed from, the control  (A ComboBox has no data-less mode).
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void  sync()
+    {
+      // Ensure exists
+      if (!this->exists() || !Model)
+        throw logic_error(HERE, "ComboBox has no item model or does not exist");
+
+      // [UNCHANGED] No-op
+      if (Revision == Model->revision())
+        return;
+
+      int32_t count = ComboBox_GetCount(this->Handle),
+              target = static_cast<int32_t>(Model->size());
+
+      // [SHRINK] Reset rather than delete rows individually where cheaper
+      if (target < count / 2)
+      {
+        ComboBox_ResetContent(this->Handle);
+        count = 0;
+      }
+      for (; count > target; --count)
+        ComboBox_DeleteString(this->Handle, count - 1);
+
+      // [GROW] Pre-allocate then append empty rows
+      if (target > count)
+        send<ComboBoxMessage::InitStorage>(target - count, 0);
+      for (; count < target; ++count)
+        if (ComboBox_AddItemData(this->Handle, 0) < 0)
+          throw platform_error(HERE, "Unable to add ComboBox item");
+
+      // Redraw rows from model
+      Revision = Model->revision();
+      this->invalidate();
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////
     // ComboBox::wndclass const
     //! Get the window class
@@ -227,6 +320,9 @@ namespace wtl
     /////////////////////////////////////////////////////////////////////////////////////////
     virtual LResult  onOwnerDraw(OwnerDrawCtrlEventArgs<encoding>& args) 
     { 
+      // [VIRTUAL] Draw row from item model using current window skin
+      if (Model && args.Item >= 0 && static_cast<uint32_t>(args.Item) < Model->size())
+        SkinFactory<encoding>::get()->draw(*this, args.Graphics, args.Rect, args.Item, args.State);
       
       // Handle message
       return {MsgRoute::Handled, 0};
@@ -210,7 +210,7 @@ namespace wtl
     //! \param[in] idx - Zero-based item index, or -1 for currently selected item
     //! \return proxy_t - Proxy for specified item
     //! 
-    //! \throw wtl::logic_error - ComboBox control does not exist
+    //! \throw wtl::logic_error - ComboBox control does not exist or items are provided by an item model
     //! \throw wtl::out_of_range - Index out of range
     /////////////////////////////////////////////////////////////////////////////////////////
     proxy_t at(int32_t idx) const
@@ -246,6 +246,10 @@ namespace wtl
     /////////////////////////////////////////////////////////////////////////////////////////
     uint32_t size() const 
     {
+      // [VIRTUAL] Query item model  (Avoids a message per call)
+      if (auto* model = this->Control.model())
+        return model->size();
+
       //! Ensure exists
       if (!this->Control.exists())
         throw logic_error(HERE, "ComboBox control does not exist");
@@ -260,13 +264,14 @@ namespace wtl
     //! \param[in] idx - Zero-based item index, or -1 for currently selected item
     //! \return proxy_t - Proxy for specified item 
     //! 
-    //! \throw wtl::logic_error - ComboBox control does not exist
+    //! \throw wtl::logic_error - ComboBox control does not exist or items are provided by an item model
     /////////////////////////////////////////////////////////////////////////////////////////
     proxy_t operator[](int32_t idx) const
     {
       //! Ensure exists
       if (!this->Control.exists())
         throw logic_error(HERE, "ComboBox control does not exist");
+      this->requireNative();
 
       // Create proxy for specified item, otherwise locate currently selected item
       return proxy_t(this->Control, idx >= 0 ? idx : ComboBox_GetCurSel(this->Control.handle()));
@@ -282,7 +287,7 @@ namespace wtl
     //!
     //! \param[in] const* data - Item text or data
     //!
-    //! \throw wtl::logic_error - ComboBox control does not exist
+    //! \throw wtl::logic_error - ComboBox control does not exist or items are provided by an item model
     //! \throw wtl::platform_error - Unable to append item
     /////////////////////////////////////////////////////////////////////////////////////////
     template <typename ItemData>
@@ -295,13 +300,14 @@ namespace wtl
     // ComboBoxItemsCollection::clear() 
     //! Clear all items
     //!
-    //! \throw wtl::logic_error - ComboBox control does not exist
+    //! \throw wtl::logic_error - ComboBox control does not exist or items are provided by an item model
     /////////////////////////////////////////////////////////////////////////////////////////
     void clear() const 
     {
       //! Ensure exists
       if (!this->Control.exists())
         throw logic_error(HERE, "ComboBox control does not exist");
+      this->requireNative();
 
       // Clear items
       ComboBox_ResetContent(this->Control.handle());
@@ -316,7 +322,7 @@ namespace wtl
     //! \param[in] const* data - Item text or data
     //! \param[in] idx - Zero-based item index at which to insert new item
     //!
-    //! \throw wtl::logic_error - ComboBox control does not exist
+    //! \throw wtl::logic_error - ComboBox control does not exist or items are provided by an item model
     //! \throw wtl::platform_error - Unable to append item
     /////////////////////////////////////////////////////////////////////////////////////////
     template <typename ItemData>
@@ -325,6 +331,7 @@ namespace wtl
       //! Ensure exists
       if (!this->Control.exists())
         throw logic_error(HERE, "ComboBox control does not exist");
+      this->requireNative();
 
       // Append item
       switch (ComboBox_InsertItemData(this->Control.handle(), idx, data))
@@ -334,6 +341,18 @@ namespace wtl
       }
     }
 
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ComboBoxItemsCollection::requireNative() const
+    //! Ensure items are stored by the control rather than provided by an item model
+    //!
+    //! \throw wtl::logic_error - Items are provided by an item model  (Modify the model, then call ComboBox::sync())
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void requireNative() const
+    {
+      if (this->Control.model())
+        throw logic_error(HERE, "ComboBox items are provided by an item model");
+    }
   };
 
       
@@ -10,7 +10,11 @@
 
 #include <wtl/WTL.hpp>
 #include <wtl/casts/OpaqueCast.hpp>           //!< OpaqueCast
+#include <wtl/utils/Default.hpp>             //!< defvalue
 #include <wtl/windows/Delegate.hpp>           //!< Delegate
+#if DISPATCH_TRACING
+  #include <wtl/utils/DispatchTrace.hpp>      //!< TraceScope
+#endif
 #include <tuple>                              //!< std::tuple
 #include <utility>                            //!< std::tuple_element
 #include <memory>                             //!< std::shared_ptr
@@ -102,14 +106,17 @@ namespace wtl
     //! 
     //! \remarks This overload is selected if the event handler has a return type other than void
     /////////////////////////////////////////////////////////////////////////////////////////
-    template <typename = enable_if_not_same_t<RET,void>, typename... CALL_ARGS>
+    template <typename R = RET, typename = enable_if_not_same_t<R,void>, typename... CALL_ARGS>
     result_t invoke(CALL_ARGS&&... args) const
     {
       result_t r(defvalue<result_t>());
 
       // Forward arguments to each subscriber
       for (auto& fn : Subscribers)
+      {
+        TRACE_HANDLER(*fn);
         r = (*fn)(std::forward<CALL_ARGS>(args)...);
+      }
 
       // Return result
       return r;
@@ -125,12 +132,15 @@ namespace wtl
     //! 
     //! \remarks This overload is selected if the event handler has no return type
     /////////////////////////////////////////////////////////////////////////////////////////
-    template <typename = enable_if_same_t<result_t,void>, typename = void, typename... CALL_ARGS>
+    template <typename R = RET, typename = enable_if_same_t<R,void>, typename = void, typename... CALL_ARGS>
     void invoke(CALL_ARGS&&... args) const
     {
       // Forward arguments to each subscriber
       for (auto& fn : Subscribers)
+      {
+        TRACE_HANDLER(*fn);
         (*fn)(std::forward<CALL_ARGS>(args)...);
+      }
     }
 
     // ----------------------------------- MUTATOR METHODS ----------------------------------
@@ -157,6 +167,8 @@ namespace wtl
     template <typename... CALL_ARGS>
     result_t raise(CALL_ARGS&&... args) 
     {
+      TRACE_SCOPE(Event, reinterpret_cast<uintptr_t>(this));
+
       // Forward arguments to each subscriber, and capture return value (iff function signature has a return type)
       return invoke(std::forward<CALL_ARGS>(args)...);
     }
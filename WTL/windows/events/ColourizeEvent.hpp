@@ -11,8 +11,8 @@
 #include <wtl/WTL.hpp>
 #include <wtl/utils/Handle.hpp>                 //!< Handle
 #include <wtl/traits/DeviceContextTraits.hpp>   //!< HDeviceContext
-#include <wtl/traits/WindowTraits.hpp>          //!< HWnd
-#include <wtl/windows/Event.hpp>                //!< Event
+#include <wtl/traits/windowtraits.hpp>          //!< HWnd
+#include <wtl/windows/event.hpp>                //!< Event
 #include <wtl/platform/WindowFlags.hpp>         //!< WindowId
 #include <wtl/platform/CommonApi.hpp>           //!< send_message
 
@@ -11,7 +11,7 @@
 #include <wtl/WTL.hpp>
 #include <wtl/casts/EnumCast.hpp>             //!< EnumCast
 #include <wtl/windows/EventArgs.hpp>          //!< EventArgs
-#include <wtl/traits/WindowTraits.hpp>        //!< HWnd
+#include <wtl/traits/windowtraits.hpp>        //!< HWnd
 
 //! \namespace wtl - Windows template library
 namespace wtl
@@ -16,7 +16,7 @@
 #include <wtl/gdi/DeviceContext.hpp>            //!< DeviceContext
 #include <wtl/windows/ControlEventArgs.hpp>     //!< ControlEventArgs
 #include <wtl/utils/Rectangle.hpp>              //!< Rect
-#include <wtl/traits/WindowTraits.hpp>          //!< HWnd
+#include <wtl/traits/windowtraits.hpp>          //!< HWnd
 
 //! \namespace wtl - Windows template library
 namespace wtl 
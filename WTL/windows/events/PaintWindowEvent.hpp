@@ -12,7 +12,7 @@
 #include <wtl/windows/EventArgs.hpp>              //!< EventArgs
 #include <wtl/gdi/DeviceContext.hpp>              //!< DeviceContext
 #include <wtl/utils/Rectangle.hpp>                //!< Rect
-#include <wtl/traits/WindowTraits.hpp>            //!< HWnd
+#include <wtl/traits/windowtraits.hpp>            //!< HWnd
 
 //! \namespace wtl - Windows template library
 namespace wtl
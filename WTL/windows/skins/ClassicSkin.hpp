@@ -12,6 +12,7 @@
 #include <wtl/utils/Rectangle.hpp>                //!< Rect
 #include <wtl/utils/Size.hpp>                     //!< Size
 #include <WTL/platform/Metrics.hpp>               //!< Metrics
+#include <wtl/platform/StockObjects.hpp>          //!< StockBrush
 #include <wtl/gdi/DeviceContext.hpp>              //!< DeviceContext
 #include <WTL/windows/Window.hpp>                 //!< Window
 #include <WTL/windows/WindowSkin.hpp>             //!< IWindowSkin
@@ -142,6 +143,35 @@ namespace wtl
       return {};
     }
     
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ClassicSkin::draw const
+    //! Draws a row of a ComboBox control from its virtual item model
+    //! 
+    //! \param[in,out] &cmb - ComboBox to be drawn
+    //! \param[in,out] &dc - Output device context
+    //! \param[in] const &rc - Drawing rectangle
+    //! \param[in] row - Zero-based row
+    //! \param[in] state - Row state
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void draw(ComboBox<ENC>& cmb, DeviceContext& dc, const RectL& rc, uint32_t row, OwnerDrawState state) const override
+    {
+      auto item = (*cmb.model())[row];
+      bool selected = state && OwnerDrawState::Selected;
+
+      // Draw background
+      dc.fill(rc, selected ? StockBrush::Highlight : StockBrush::Window);
+
+      // Draw text
+      RectL rcText(rc.Left + Metrics::WindowEdge.Width, rc.Top, rc.Right, rc.Bottom);
+      dc.setTextColour(selected ? SystemColour::HighlightText : SystemColour::WindowText);
+      dc += DrawingMode::Transparent;
+      dc.write(item.Text, static_cast<int32_t>(item.Length), rcText, DrawTextFlags::Left|DrawTextFlags::VCentre|DrawTextFlags::SingleLine|DrawTextFlags::NoPrefix);
+
+      // Draw focus rectangle
+      if (state && OwnerDrawState::Focus)
+        dc.focus(rc);
+    }
+    
     /////////////////////////////////////////////////////////////////////////////////////////
     // ThemedSkin::draw const
     //! Draws a standard Edit control
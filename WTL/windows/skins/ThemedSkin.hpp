@@ -14,6 +14,8 @@
 #include <WTL/platform/Metrics.hpp>                     //!< Metrics
 #include <wtl/gdi/DeviceContext.hpp>                    //!< DeviceContext
 #include <wtl/gdi/Theme.hpp>                            //!< Theme
+#include <wtl/gdi/ThemeCache.hpp>                       //!< ThemeCache
+#include <wtl/gdi/NativeThemeProvider.hpp>              //!< NativeThemeProvider
 #include <WTL/windows/Window.hpp>                       //!< Window
 #include <WTL/windows/WindowSkin.hpp>                   //!< IWindowSkin
 #include <WTL/windows/controls/button/Button.hpp>       //!< Button
@@ -28,6 +30,8 @@ namespace wtl
   //! \struct ThemedSkin - Renders standard controls using a 'themed' look n feel
   //! 
   //! \tparam ENC - Message character encoding 
+  //! 
+  //! \remarks Theme handles and part/text measurements are cached until the system theme changes
   /////////////////////////////////////////////////////////////////////////////////////////
   template <Encoding ENC>
   struct ThemedSkin : IWindowSkin<ENC>
@@ -48,13 +52,16 @@ namespace wtl
     //! \var Instance - Singleton instance
     static ThemedSkin<ENC> Instance;
 
+    mutable NativeThemeProvider  Provider;     //!< UxTheme library
+    mutable ThemeCache           Themes;       //!< Theme handles and measurements
+
     // ------------------------------------ CONSTRUCTION ------------------------------------
   private:
     /////////////////////////////////////////////////////////////////////////////////////////
     // ThemedSkin::ThemedSkin
     //! Control singleton instance and set as default window skin
     /////////////////////////////////////////////////////////////////////////////////////////
-    ThemedSkin()
+    ThemedSkin() : Themes(Provider)
     {
       SkinFactory<encoding>::set(*this);
     }
@@ -77,8 +84,49 @@ namespace wtl
       return Instance;
     }
     
-    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThemedSkin::dpi
+    //! Query the DPI of a device context
+    //! 
+    //! \param[in] const& dc - Device context
+    //! \return uint32_t - Vertical dots per inch
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uint32_t dpi(const DeviceContext& dc)
+    {
+      return static_cast<uint32_t>(::GetDeviceCaps(dc.handle(), LOGPIXELSY));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThemedSkin::font
+    //! Query the font selected into a device context
+    //! 
+    //! \param[in] const& dc - Device context
+    //! \return uintptr_t - Font handle
+    /////////////////////////////////////////////////////////////////////////////////////////
+    static uintptr_t font(const DeviceContext& dc)
+    {
+      return reinterpret_cast<uintptr_t>(::GetCurrentObject(dc.handle(), OBJ_FONT));
+    }
     
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  protected:
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThemedSkin::theme const
+    //! Get a cached theme 
+    //! 
+    //! \param[in] const& dc - Target device context
+    //! \param[in] const* classes - Semi-colon separated class list
+    //! \return Theme - Theme whose handle is owned by the cache
+    //! 
+    //! \throw wtl::platform_error - Unable to open theme
+    /////////////////////////////////////////////////////////////////////////////////////////
+    Theme theme(const DeviceContext& dc, const wchar_t* classes) const
+    {
+      return Theme(reinterpret_cast<::HTHEME>(Themes.open(classes, dpi(dc))));
+    }
+
+  public:
     /////////////////////////////////////////////////////////////////////////////////////////
     // ThemedSkin::draw const
     //! Draws a standard button control
@@ -89,7 +137,7 @@ namespace wtl
     /////////////////////////////////////////////////////////////////////////////////////////
     void draw(Button<ENC>& btn, DeviceContext& dc, const RectL& rc) const override
     {
-      Theme theme(btn.handle(), L"Button");
+      Theme theme = this->theme(dc, L"Button");
 
       // Determine state
       ::PUSHBUTTONSTATES state = PBS_NORMAL;
@@ -163,7 +211,7 @@ namespace wtl
     /////////////////////////////////////////////////////////////////////////////////////////
     void draw(CheckBox<ENC>& chk, DeviceContext& dc, const RectL& rc) const override
     {
-      Theme theme(chk.handle(), L"Button");
+      Theme theme = this->theme(dc, L"Button");
         
       // Determine state
       CHECKBOXSTATES state = CBS_UNCHECKEDNORMAL;
@@ -188,7 +236,7 @@ namespace wtl
       dc.fill(rc, StockBrush::ButtonFace);
 
       // Calculate checkbox / text rectangles
-      SizeL szCheckBox = theme.measure(dc, BP_CHECKBOX, state);
+      SizeL szCheckBox = Themes.measure(L"Button", dpi(dc), reinterpret_cast<uintptr_t>(dc.handle().get()), BP_CHECKBOX, state);
       RectL rcCheckBox = rcContent.arrange(szCheckBox, {RectL::FromLeft,Metrics::WindowEdge.Width}, RectL::Centre);
       
       // Draw checkbox
@@ -216,11 +264,13 @@ namespace wtl
     /////////////////////////////////////////////////////////////////////////////////////////
     SizeL measure(CheckBox<ENC>& chk, DeviceContext& dc) const override
     {
-      Theme theme(chk.handle(), L"Button");
+      String<Encoding::UTF16> const text = chk.Text();
+      uintptr_t const hdc = reinterpret_cast<uintptr_t>(dc.handle().get());
+      uint32_t const dpi = type::dpi(dc);
 
       // Measure checkbox + text + edges
-      return theme.measure(dc, BP_CHECKBOX, CBS_UNCHECKEDNORMAL) 
-           + dc.measure(chk.Text()) 
+      return Themes.measure(L"Button", dpi, hdc, BP_CHECKBOX, CBS_UNCHECKEDNORMAL) 
+           + Themes.measure(L"Button", dpi, hdc, font(dc), BP_CHECKBOX, CBS_UNCHECKEDNORMAL, text.c_str(), static_cast<uint32_t>(text.size()), enum_cast(DrawTextFlags::Left|DrawTextFlags::SingleLine)) 
            + SizeL(3*Metrics::WindowEdge.Width, 0);
     }
     
@@ -251,6 +301,36 @@ namespace wtl
       return {};
     }
     
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThemedSkin::draw const
+    //! Draws a row of a ComboBox control from its virtual item model
+    //! 
+    //! \param[in,out] &cmb - ComboBox to be drawn
+    //! \param[in,out] &dc - Output device context
+    //! \param[in] const &rc - Drawing rectangle
+    //! \param[in] row - Zero-based row
+    //! \param[in] state - Row state
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void draw(ComboBox<ENC>& cmb, DeviceContext& dc, const RectL& rc, uint32_t row, OwnerDrawState state) const override
+    {
+      Theme theme = this->theme(dc, L"ComboBox");
+      auto item = (*cmb.model())[row];
+      bool selected = state && OwnerDrawState::Selected;
+
+      // Draw background
+      dc.fill(rc, theme.brush(selected ? ThemeColour::Highlight : ThemeColour::Window));
+
+      // Draw text
+      RectL rcText(rc.Left + Metrics::WindowEdge.Width, rc.Top, rc.Right, rc.Bottom);
+      dc.setTextColour(selected ? SystemColour::HighlightText : SystemColour::WindowText);
+      dc += DrawingMode::Transparent;
+      dc.write(item.Text, static_cast<int32_t>(item.Length), rcText, DrawTextFlags::Left|DrawTextFlags::VCentre|DrawTextFlags::SingleLine|DrawTextFlags::NoPrefix);
+
+      // Draw focus rectangle
+      if (state && OwnerDrawState::Focus)
+        dc.focus(rc);
+    }
+    
     /////////////////////////////////////////////////////////////////////////////////////////
     // ThemedSkin::draw const
     //! Draws a standard Edit control
@@ -288,7 +368,7 @@ namespace wtl
     /////////////////////////////////////////////////////////////////////////////////////////
     void draw(Window<ENC>& wnd, DeviceContext& dc, const RectL& rc) const override
     {
-      Theme theme(wnd.handle(), L"Window");
+      Theme theme = this->theme(dc, L"Window");
 
       // Draw window background
       dc.fill(rc, theme.brush(ThemeColour::Window));   
@@ -297,7 +377,7 @@ namespace wtl
       if (!wnd.Menu.empty())
       {
         ::MENUBARINFO bar { sizeof(::MENUBARINFO) };
-        Theme menu(wnd.handle(), L"Menu");
+        Theme menu = this->theme(dc, L"Menu");
 
         // Draw window menu bar     // [BUG] Attempting to draw into the non-client area
         ::GetMenuBarInfo(wnd.handle(), OBJID_MENU , 0, &bar);
@@ -306,6 +386,15 @@ namespace wtl
     }
 
     // ----------------------------------- MUTATOR METHODS ----------------------------------
+    
+    /////////////////////////////////////////////////////////////////////////////////////////
+    // ThemedSkin::invalidate
+    //! Closes cached theme handles and discards cached measurements upon their next use
+    /////////////////////////////////////////////////////////////////////////////////////////
+    void invalidate() override
+    {
+      Themes.invalidate();
+    }
   };
 
   /////////////////////////////////////////////////////////////////////////////////////////